@@ -0,0 +1,116 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Benchmark: ControllerGroup::onUpdate scaling with worker threads
+ *
+ * Builds N viewports (half Inspect3DController easing through fitToAABB animations, half
+ * Navigation3DController walking with W held), then times group.onUpdate for 0 .. hardware-1 worker
+ * threads. Prints time per frame and speed-up over the single-threaded run.
+ *
+ * Usage: controller_group_benchmark [controllers=64] [frames=2000]
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/controller_group.h"
+#include "vertexnova/interaction/inspect_3d_controller.h"
+#include "vertexnova/interaction/navigation_3d_controller.h"
+#include "vertexnova/events/key_event.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr double kDt = 1.0 / 60.0;
+constexpr int kRefitPeriod = 30;  //!< Frames between fitToAABB calls, so animations never settle
+
+struct Viewport {
+    std::shared_ptr<vne::scene::ICamera> camera;
+    std::shared_ptr<vne::interaction::ICameraController> controller;
+    vne::interaction::Inspect3DController* inspect = nullptr;
+};
+
+std::vector<Viewport> makeViewports(int count) {
+    std::vector<Viewport> views;
+    views.reserve(static_cast<std::size_t>(count));
+    for (int k = 0; k < count; ++k) {
+        Viewport v;
+        v.camera = vne::scene::CameraFactory::createPerspective(
+            vne::scene::PerspectiveCameraParameters(50.0f, 16.0f / 9.0f, 0.1f, 1000.0f));
+        v.camera->setPosition(vne::math::Vec3f(static_cast<float>(k), 2.0f, 8.0f));
+        v.camera->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+        if (k % 2 == 0) {
+            auto inspect = std::make_shared<vne::interaction::Inspect3DController>();
+            v.inspect = inspect.get();
+            v.controller = inspect;
+        } else {
+            v.controller = std::make_shared<vne::interaction::Navigation3DController>();
+        }
+        v.controller->setCamera(v.camera);
+        v.controller->onResize(480.0f, 270.0f);
+        if (!v.inspect) {
+            v.controller->onEvent(vne::events::KeyPressedEvent(vne::events::KeyCode::eW), kDt);
+        }
+        views.push_back(std::move(v));
+    }
+    return views;
+}
+
+/** @return Average seconds per group.onUpdate */
+double timeGroup(std::size_t workers, int controllers, int frames) {
+    std::vector<Viewport> views = makeViewports(controllers);
+    vne::interaction::ControllerGroup group(workers);
+    for (const Viewport& v : views) {
+        group.add(v.controller);
+    }
+    double total = 0.0;
+    for (int frame = 0; frame < frames; ++frame) {
+        if (frame % kRefitPeriod == 0) {
+            const float c = static_cast<float>(frame % (2 * kRefitPeriod));
+            for (const Viewport& v : views) {
+                if (v.inspect) {
+                    v.inspect->fitToAABB(vne::math::Vec3f(c, -1.0f, -1.0f), vne::math::Vec3f(c + 2.0f, 1.0f, 1.0f));
+                }
+            }
+        }
+        const auto t0 = std::chrono::steady_clock::now();
+        group.onUpdate(kDt);
+        total += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    }
+    return total / frames;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const int controllers = argc > 1 ? std::max(1, std::atoi(argv[1])) : 64;
+    const int frames = argc > 2 ? std::max(1, std::atoi(argv[2])) : 2000;
+    const std::size_t max_workers = vne::interaction::ControllerGroup::defaultWorkerThreads();
+
+    std::printf("ControllerGroup: %d controllers, %d frames, %u hardware threads\n",
+                controllers,
+                frames,
+                std::thread::hardware_concurrency());
+    std::printf("%8s %14s %10s\n", "threads", "us / frame", "speed-up");
+
+    timeGroup(0, controllers, std::min(frames, 100));  // warm caches and the allocator
+    const double serial = timeGroup(0, controllers, frames);
+    std::printf("%8d %14.2f %10.2f\n", 1, serial * 1e6, 1.0);
+    for (std::size_t workers = 1; workers <= max_workers; workers = workers < 4 ? workers + 1 : workers * 2) {
+        const double t = timeGroup(workers, controllers, frames);
+        std::printf("%8zu %14.2f %10.2f\n", workers + 1, t * 1e6, serial / t);
+    }
+    if (max_workers > 4 && (max_workers & (max_workers - 1)) != 0) {
+        const double t = timeGroup(max_workers, controllers, frames);
+        std::printf("%8zu %14.2f %10.2f\n", max_workers + 1, t * 1e6, serial / t);
+    }
+    return 0;
+}
@@ -266,6 +266,45 @@ int runCameraStateSaveRestoreExample() {
                      << " shown here as documentation of the per-frame drag model)";
     }
 
+    // ─────────────────────────────────────────────────────────────────────────
+    // Section F: CameraHistory — per-gesture undo / redo owned by the controller
+    // ─────────────────────────────────────────────────────────────────────────
+    VNE_LOG_INFO << "--- F: CameraHistory undo / redo (Inspect3D) ---";
+    {
+        auto camera = vne::scene::CameraFactory::createPerspective(
+            vne::scene::PerspectiveCameraParameters(45.0f, kVpW / kVpH, 0.1f, 1000.0f));
+        camera->setPosition(vne::math::Vec3f(0.0f, 0.0f, 8.0f));
+        camera->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+
+        vne::interaction::Inspect3DController ctrl;
+        ctrl.setCamera(camera);  // commits the initial pose
+        ctrl.onResize(kVpW, kVpH);
+        auto on_event = [&](const vne::events::Event& e, double dt) { ctrl.onEvent(e, dt); };
+
+        vne::interaction::examples::simulateMouseDrag(on_event,
+                                                      vne::events::MouseButton::eLeft,
+                                                      kCx,
+                                                      kCy,
+                                                      150.0f,
+                                                      60.0f,
+                                                      30,
+                                                      kDt);
+        for (int i = 0; i < 60; ++i)
+            ctrl.onUpdate(kDt);  // inertia runs out, then the settled pose is committed
+        ctrl.fitToAABB(vne::math::Vec3f(-1.0f, -1.0f, -1.0f), vne::math::Vec3f(1.0f, 1.0f, 1.0f));
+        for (int i = 0; i < 60; ++i)
+            ctrl.onUpdate(kDt);
+        VNE_LOG_INFO << "  history entries=" << ctrl.cameraHistory().size() << " (initial, after orbit, after fit)";
+
+        ctrl.undo();  // eases back to the orbited pose over 0.35 s
+        for (int i = 0; i < 30; ++i)
+            ctrl.onUpdate(kDt);
+        const auto p = camera->getPosition();
+        VNE_LOG_INFO << "  after undo: pos=(" << p.x() << "," << p.y() << "," << p.z()
+                     << ") canRedo=" << ctrl.cameraHistory().canRedo();
+        ctrl.redo(0.0f);  // 0 = jump without easing
+    }
+
     VNE_LOG_INFO << "08_camera_state_save_restore: done.";
     return 0;
 }
@@ -0,0 +1,201 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file bounds_reduction.h
+ * @brief Parallel bounds of large point and box sets, and the volume a manipulator fits the view to.
+ *
+ * The @c fitToPoints / @c fitToBoxes overloads of @ref TrackballManipulator, @ref FreeLookManipulator and
+ * @ref Ortho2DManipulator reduce millions of inputs to a @ref FitVolume through these functions, so the host
+ * no longer walks the scene on one thread to build an AABB first.
+ *
+ * @par Reduction
+ * Inputs are split into contiguous ranges, one per task. Each task gathers blocks of 16 elements into
+ * structure-of-arrays scratch, folds them into per-lane minima and maxima and merges the lanes at the end;
+ * the task results are merged on the caller. With GCC -O3 the fold and the point gathers vectorize; box
+ * gathers (six floats per element) stay scalar. Min / max are order-independent, so the result is identical
+ * to the serial one for any split. Inputs below a few hundred thousand elements are reduced on the caller.
+ *
+ * @par Threads
+ * Pass a @ref ControllerExecutor to run the tasks on the host's job system. Without one, large inputs use a
+ * work-stealing pool shared by all callers in the process (@ref ControllerGroup::defaultWorkerThreads
+ * threads, started on first use); a call made while another thread holds the pool reduces serially instead
+ * of waiting.
+ *
+ * @par Frustum fit
+ * @ref computeFrustumFit solves for the closest perspective eye along the current view direction whose
+ * frustum holds every input, with the view axis centered between the planes that bind. Boxes enter through
+ * their exact corner support (projected center +/- |axis| . half extents), so all eight corners are covered
+ * without visiting them, and a span of per-object boxes is fitted in the same single pass.
+ *
+ * @par Non-finite input
+ * NaN coordinates are skipped. Infinite ones propagate into the bounds.
+ */
+
+#include "vertexnova/interaction/export.h"
+#include "vertexnova/interaction/controller_group.h"
+
+#include <vertexnova/math/core/core.h>
+
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace vne::interaction {
+
+/**
+ * @brief Axis-aligned box. Default-constructed it is empty (min above max) and merges as the identity.
+ */
+struct VNE_INTERACTION_API BoundingBox {
+    vne::math::Vec3f min_corner{std::numeric_limits<float>::max(),
+                                std::numeric_limits<float>::max(),
+                                std::numeric_limits<float>::max()};
+    vne::math::Vec3f max_corner{std::numeric_limits<float>::lowest(),
+                                std::numeric_limits<float>::lowest(),
+                                std::numeric_limits<float>::lowest()};
+
+    /** @return true when min <= max on every axis (at least one input was merged) */
+    [[nodiscard]] bool isValid() const noexcept {
+        return min_corner.x() <= max_corner.x() && min_corner.y() <= max_corner.y()
+               && min_corner.z() <= max_corner.z();
+    }
+    [[nodiscard]] vne::math::Vec3f center() const noexcept { return (min_corner + max_corner) * 0.5f; }
+    [[nodiscard]] vne::math::Vec3f halfExtents() const noexcept { return (max_corner - min_corner) * 0.5f; }
+};
+
+/**
+ * @brief What the @c fitToPoints / @c fitToBoxes overloads frame.
+ */
+enum class FitBoundsMode : std::uint8_t {
+    eBoundingSphere = 0,  //!< Smallest sphere about the bounds center holding every input (view-independent)
+    eViewExtents = 1,     //!< Extents along the camera's current right / up / forward axes (tighter framing)
+    eFrustum = 2,         //!< Closest eye whose frustum holds every corner / point (perspective; else eViewExtents)
+};
+
+/**
+ * @brief Volume to frame, in the camera's current orientation.
+ *
+ * Half extents are measured along the camera right, up and forward axes about @ref center. A bounding
+ * sphere has @c half_right == @c half_up == radius and @c half_depth == 0, which reproduces the
+ * @c fitToAABB distance.
+ */
+struct VNE_INTERACTION_API FitVolume {
+    vne::math::Vec3f center{0.0f, 0.0f, 0.0f};
+    float half_right = 0.0f;
+    float half_up = 0.0f;
+    float half_depth = 0.0f;
+};
+
+/**
+ * @brief Result of @ref computeFrustumFit.
+ */
+struct VNE_INTERACTION_API FrustumFit {
+    vne::math::Vec3f eye{0.0f, 0.0f, 0.0f};     //!< Closest eye position
+    vne::math::Vec3f center{0.0f, 0.0f, 0.0f};  //!< On the view axis, halfway through the input's depth range
+    float distance = 0.0f;                       //!< From @ref eye to @ref center along the view direction
+};
+
+// -----------------------------------------------------------------------------
+// Reductions
+// -----------------------------------------------------------------------------
+
+/** @return Bounds of @p points (invalid when empty or all NaN) */
+[[nodiscard]] VNE_INTERACTION_API BoundingBox computeBounds(std::span<const vne::math::Vec3f> points,
+                                                            const ControllerExecutor& executor = {}) noexcept;
+
+/** @return Union of @p boxes; invalid boxes are skipped */
+[[nodiscard]] VNE_INTERACTION_API BoundingBox computeBounds(std::span<const BoundingBox> boxes,
+                                                            const ControllerExecutor& executor = {}) noexcept;
+
+/** @return Largest distance from @p center to any of @p points (0 when empty) */
+[[nodiscard]] VNE_INTERACTION_API float computeBoundingRadius(std::span<const vne::math::Vec3f> points,
+                                                              const vne::math::Vec3f& center,
+                                                              const ControllerExecutor& executor = {}) noexcept;
+
+/** @return Largest distance from @p center to any corner of @p boxes (0 when empty) */
+[[nodiscard]] VNE_INTERACTION_API float computeBoundingRadius(std::span<const BoundingBox> boxes,
+                                                              const vne::math::Vec3f& center,
+                                                              const ControllerExecutor& executor = {}) noexcept;
+
+/**
+ * @brief Bounds of @p points in the frame (@p right, @p up, @p forward).
+ *
+ * The axes should be orthonormal. The returned box holds coordinates along the axes, not world positions:
+ * x along @p right, y along @p up, z along @p forward.
+ */
+[[nodiscard]] VNE_INTERACTION_API BoundingBox computeViewExtents(std::span<const vne::math::Vec3f> points,
+                                                                 const vne::math::Vec3f& right,
+                                                                 const vne::math::Vec3f& up,
+                                                                 const vne::math::Vec3f& forward,
+                                                                 const ControllerExecutor& executor = {}) noexcept;
+
+/** @brief As the point overload, over the corners of @p boxes (each box projected from center and extents). */
+[[nodiscard]] VNE_INTERACTION_API BoundingBox computeViewExtents(std::span<const BoundingBox> boxes,
+                                                                 const vne::math::Vec3f& right,
+                                                                 const vne::math::Vec3f& up,
+                                                                 const vne::math::Vec3f& forward,
+                                                                 const ControllerExecutor& executor = {}) noexcept;
+
+// -----------------------------------------------------------------------------
+// Fit volumes
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Volume the manipulators frame for @p points seen along (@p right, @p up, @p forward).
+ *
+ * @c FitBoundsMode::eFrustum gives the view extents here; perspective fits use @ref computeFrustumFit.
+ * @return false when no finite point was found (@p out unchanged)
+ */
+VNE_INTERACTION_API bool computeFitVolume(std::span<const vne::math::Vec3f> points,
+                                          const vne::math::Vec3f& right,
+                                          const vne::math::Vec3f& up,
+                                          const vne::math::Vec3f& forward,
+                                          FitBoundsMode mode,
+                                          FitVolume& out,
+                                          const ControllerExecutor& executor = {}) noexcept;
+
+/** @brief As the point overload, for @p boxes. */
+VNE_INTERACTION_API bool computeFitVolume(std::span<const BoundingBox> boxes,
+                                          const vne::math::Vec3f& right,
+                                          const vne::math::Vec3f& up,
+                                          const vne::math::Vec3f& forward,
+                                          FitBoundsMode mode,
+                                          FitVolume& out,
+                                          const ControllerExecutor& executor = {}) noexcept;
+
+/**
+ * @brief Closest eye looking along @p forward whose symmetric frustum holds all @p points.
+ *
+ * @param tan_half_x Tangent of half the horizontal field of view (divide by a margin to leave a border)
+ * @param tan_half_y Tangent of half the vertical field of view
+ * @return false when no finite point was found or a tangent is not positive (@p out unchanged)
+ */
+VNE_INTERACTION_API bool computeFrustumFit(std::span<const vne::math::Vec3f> points,
+                                           const vne::math::Vec3f& right,
+                                           const vne::math::Vec3f& up,
+                                           const vne::math::Vec3f& forward,
+                                           float tan_half_x,
+                                           float tan_half_y,
+                                           FrustumFit& out,
+                                           const ControllerExecutor& executor = {}) noexcept;
+
+/** @brief As the point overload, for every corner of @p boxes. */
+VNE_INTERACTION_API bool computeFrustumFit(std::span<const BoundingBox> boxes,
+                                           const vne::math::Vec3f& right,
+                                           const vne::math::Vec3f& up,
+                                           const vne::math::Vec3f& forward,
+                                           float tan_half_x,
+                                           float tan_half_y,
+                                           FrustumFit& out,
+                                           const ControllerExecutor& executor = {}) noexcept;
+
+}  // namespace vne::interaction
@@ -0,0 +1,184 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file camera_batch.h
+ * @brief CameraBatch — orbit cameras stepped in bulk from structure-of-arrays storage.
+ *
+ * Meant for scenes with hundreds or thousands of scripted cameras (simulated sensors, thumbnails, light
+ * probes), where a @ref TrackballManipulator and @ref CameraRig per camera would cost heap objects, a
+ * camera and virtual calls each. A batch holds only the orbit state — centre of interest, distance, orientation,
+ * rotation inertia and an optional animation — one array per component, and @ref update steps every
+ * camera and writes its view matrix into a buffer the caller owns:
+ *
+ * @code
+ * vne::interaction::CameraBatch batch(4096);
+ * for (const Sensor& s : sensors) {
+ *     const std::size_t i = batch.add(s.target, s.range, s.orientation);
+ *     batch.setInertia(i, s.spin_axis, s.spin_rate);
+ * }
+ * std::vector<float> views(batch.size() * vne::interaction::CameraBatch::kViewMatrixFloats);
+ * batch.update(dt, views.data());  // 16 floats per camera, column-major
+ * @endcode
+ *
+ * The math matches @ref TrackballManipulator: inertia rotates the orientation about a world axis and decays
+ * by @c exp(-damping·dt); animations lerp centre and distance and slerp the orientation under an easing
+ * curve; the eye sits at @c coi + back·distance, with back / up the orientation's Z / Y axes. The inertia
+ * step evaluates sin / cos / exp with the batch's own float polynomials rather than libm, so its results do
+ * not depend on the platform library in either math mode (@ref setDeterministicMath); animation slerp follows
+ * the math mode.
+ *
+ * @par Reproducibility
+ * The batch source is always compiled without FP contraction, so its polynomials do not fuse into FMAs
+ * differently per target. Results are bit-reproducible across machines only in a
+ * @c VNE_INTERACTION_DETERMINISTIC build, which also pins the vne::math quaternion code the batch shares
+ * (see deterministic_math.h).
+ */
+
+#include "vertexnova/interaction/export.h"
+
+#include <vertexnova/math/core/core.h>
+#include <vertexnova/math/easing.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace vne::interaction {
+
+/**
+ * @brief Structure-of-arrays orbit camera engine.
+ *
+ * Cameras are addressed by dense index [0, @ref size()). @ref remove moves the last camera into the freed
+ * slot, so indices stay dense and the view buffer stays contiguous.
+ *
+ * @ref update makes one pass over the cameras that are animating, one branch-free inertia pass over all of
+ * them (skipped while none spins) and one pass writing the view matrices. Both full passes run over
+ * contiguous float arrays and are written for the compiler's auto-vectorizer (checked with GCC
+ * @c -O3 @c -fopt-info-vec); no intrinsics are used.
+ *
+ * @threadsafe Not thread-safe. Disjoint batches may be updated from different threads.
+ */
+class VNE_INTERACTION_API CameraBatch {
+   public:
+    static constexpr std::size_t kViewMatrixFloats = 16;  //!< Floats written per camera by @ref update
+
+    /** @param capacity Cameras to reserve storage for */
+    explicit CameraBatch(std::size_t capacity = 0);
+    ~CameraBatch();
+
+    CameraBatch(const CameraBatch&) = delete;
+    CameraBatch& operator=(const CameraBatch&) = delete;
+    CameraBatch(CameraBatch&&) noexcept;
+    CameraBatch& operator=(CameraBatch&&) noexcept;
+
+    // -------------------------------------------------------------------------
+    // Cameras
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Append a camera at rest.
+     * @param coi         Centre of interest
+     * @param distance    Eye-to-COI distance (clamped to a small positive minimum)
+     * @param orientation Camera orientation (normalized; identity looks down -Z)
+     * @return Index of the new camera
+     */
+    std::size_t add(const vne::math::Vec3f& coi, float distance, const vne::math::Quatf& orientation);
+
+    /** Remove camera @p index; the last camera takes its index. Out-of-range indices are ignored. */
+    void remove(std::size_t index) noexcept;
+
+    /** Remove all cameras (keeps the storage). */
+    void clear() noexcept;
+
+    void reserve(std::size_t capacity);
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    // -------------------------------------------------------------------------
+    // Per-camera state (out-of-range indices are ignored / return defaults)
+    // -------------------------------------------------------------------------
+
+    /** Place camera @p index; stops its inertia and animation. */
+    void setOrbit(std::size_t index,
+                  const vne::math::Vec3f& coi,
+                  float distance,
+                  const vne::math::Quatf& orientation) noexcept;
+
+    /**
+     * @brief Spin camera @p index about a world axis; the rate decays with the camera's rotation damping.
+     *
+     * Stops an animation in progress, leaving the camera where it is.
+     *
+     * @param axis            World rotation axis (a zero axis stops the spin)
+     * @param speed_rad_per_s Initial angular speed; the spin stops once it falls to 1e-4 rad/s
+     */
+    void setInertia(std::size_t index, const vne::math::Vec3f& axis, float speed_rad_per_s) noexcept;
+
+    /** Rotation damping of camera @p index (1/s, default 8 as in @ref TrackballManipulator); 0 = no inertia. */
+    void setRotationDamping(std::size_t index, float damping) noexcept;
+
+    /** Stop the spin of camera @p index. */
+    void stopInertia(std::size_t index) noexcept;
+
+    /**
+     * @brief Ease camera @p index to a new orbit; stops its inertia.
+     *
+     * A non-positive @p duration_s places the camera immediately, like @ref setOrbit.
+     */
+    void animateTo(std::size_t index,
+                   const vne::math::Vec3f& coi,
+                   float distance,
+                   const vne::math::Quatf& orientation,
+                   float duration_s,
+                   vne::math::EaseType easing = vne::math::EaseType::eCubicInOut) noexcept;
+
+    /** Jump camera @p index to the end of its animation. */
+    void finishAnimation(std::size_t index) noexcept;
+
+    [[nodiscard]] vne::math::Vec3f coi(std::size_t index) const noexcept;
+    [[nodiscard]] float distance(std::size_t index) const noexcept;
+    [[nodiscard]] vne::math::Quatf orientation(std::size_t index) const noexcept;
+    /** @return Eye position @c coi + back·distance */
+    [[nodiscard]] vne::math::Vec3f eye(std::size_t index) const noexcept;
+    [[nodiscard]] bool hasInertia(std::size_t index) const noexcept;
+    [[nodiscard]] bool isAnimating(std::size_t index) const noexcept;
+
+    // -------------------------------------------------------------------------
+    // Stepping
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Advance every camera by @p delta_time and optionally write the view matrices.
+     *
+     * A camera either spins or animates: @ref setInertia stops an animation and @ref animateTo stops the
+     * spin, as in @ref TrackballManipulator. A non-positive or non-finite @p delta_time advances nothing but
+     * still writes the matrices.
+     *
+     * @param delta_time   Seconds since the last update
+     * @param view_out     Either null or room for @ref size() × @ref kViewMatrixFloats floats; camera @c i
+     *                     gets a right-handed look-at matrix at @c view_out + 16·i, column-major
+     *                     (the layout of @c vne::math::Mat4f)
+     */
+    void update(double delta_time, float* view_out) noexcept;
+
+    /** Write the current view matrices without stepping (same layout as @ref update). */
+    void writeViewMatrices(float* view_out) const noexcept;
+
+    /** @return View matrix of camera @p index (identity when out of range) */
+    [[nodiscard]] vne::math::Mat4f viewMatrix(std::size_t index) const noexcept;
+
+   private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace vne::interaction
@@ -0,0 +1,165 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file camera_constraint.h
+ * @brief CameraConstraint — keeps the camera out of scene geometry and inside a bounding volume.
+ *
+ * Manipulators move the eye without knowing the scene. A @ref CameraConstraint attached to a rig
+ * (@ref CameraRig::setCameraConstraint) runs once per @ref CameraRig::onUpdate, after every manipulator has
+ * written its pose, and corrects the eye against a sphere of @ref CameraConstraint::setRadius around it:
+ *
+ * @code
+ * auto constraint = std::make_shared<vne::interaction::CameraConstraint>();
+ * constraint->setSceneQuery(scene_picks);  // a PickIndex, or the host's ISceneQuery
+ * constraint->setRadius(0.25f);
+ * constraint->setBounds(room_min, room_max);
+ * nav_ctrl.setCameraConstraint(constraint);
+ * @endcode
+ *
+ * @par Modes
+ *   - @c ConstraintMode::eSlide (walkthroughs) — the sphere is swept from last frame's constrained eye to the
+ *     new one. On contact it stops short of the surface and the rest of the motion slides along it (up to
+ *     three contacts per frame). The corrected pose is written to the camera, so free-look movement continues
+ *     from where the camera actually is.
+ *   - @c ConstraintMode::eSpringArm (orbiting) — the sphere is swept from the look-at target to the eye and
+ *     the eye is pulled in along the view axis to the first contact. The rig only overrides what the camera
+ *     shows: the orbit manipulator keeps its own distance and the camera springs back once the view clears.
+ *
+ * @par Bounds
+ * With @ref CameraConstraint::setBounds the eye also stays inside an axis-aligned box shrunk by the radius
+ * (clamped per axis in slide mode; cut along the arm in spring-arm mode).
+ *
+ * @par Coherent frames
+ * The primitive of the last contact is passed to @ref ISceneQuery::sphereCast as a hint, which lets a
+ * @ref PickIndex bound its search by that surface first. When neither the eye nor the geometry
+ * (@ref ISceneQuery::revision) moved since the last frame, the previous result is reused without a cast.
+ * Jumps the host makes on purpose (@ref CameraRig::setCamera, @ref CameraRig::animateToPose) call
+ * @ref CameraConstraint::reset so the next frame is not swept from the old pose.
+ */
+
+#include "vertexnova/interaction/export.h"
+#include "vertexnova/interaction/interaction_types.h"
+#include "vertexnova/interaction/scene_query.h"
+
+#include <vertexnova/math/core/core.h>
+
+#include <cstdint>
+#include <memory>
+
+namespace vne::interaction {
+
+/**
+ * @brief How @ref CameraConstraint resolves contacts.
+ */
+enum class ConstraintMode : std::uint8_t {
+    eSlide = 0,      //!< Sweep along the frame's motion and slide along contacts (walkthrough)
+    eSpringArm = 1,  //!< Sweep from the target to the eye and shorten the arm (orbit)
+};
+
+/**
+ * @brief Once-per-frame collision and keep-in-volume correction of the camera eye.
+ *
+ * @threadsafe Not thread-safe. The attached @ref ISceneQuery must not change during @ref constrain.
+ */
+class VNE_INTERACTION_API CameraConstraint {
+   public:
+    static constexpr float kDefaultRadius = 0.1f;
+    static constexpr float kDefaultSkin = 0.01f;
+    static constexpr int kMaxSlideContacts = 3;
+
+    CameraConstraint() = default;
+
+    // -------------------------------------------------------------------------
+    // Geometry
+    // -------------------------------------------------------------------------
+
+    /** Geometry to stay out of (nullptr = none; bounds still apply). */
+    void setSceneQuery(std::shared_ptr<const ISceneQuery> query) noexcept;
+    [[nodiscard]] const std::shared_ptr<const ISceneQuery>& getSceneQuery() const noexcept { return query_; }
+
+    /** Keep the eye inside the box [@p min_corner, @p max_corner] (corners in any order). */
+    void setBounds(const vne::math::Vec3f& min_corner, const vne::math::Vec3f& max_corner) noexcept;
+    void clearBounds() noexcept;
+    [[nodiscard]] bool hasBounds() const noexcept { return has_bounds_; }
+    [[nodiscard]] const vne::math::Vec3f& getBoundsMin() const noexcept { return bounds_min_; }
+    [[nodiscard]] const vne::math::Vec3f& getBoundsMax() const noexcept { return bounds_max_; }
+
+    // -------------------------------------------------------------------------
+    // Tuning
+    // -------------------------------------------------------------------------
+
+    void setMode(ConstraintMode mode) noexcept;
+    [[nodiscard]] ConstraintMode getMode() const noexcept { return mode_; }
+
+    /** Radius of the sphere kept clear around the eye; should exceed the near plane. Default: @ref kDefaultRadius. */
+    void setRadius(float radius) noexcept;
+    [[nodiscard]] float getRadius() const noexcept { return radius_; }
+
+    /** Gap left between the sphere and a contact, against round-off. Default: @ref kDefaultSkin. */
+    void setSkin(float skin) noexcept;
+    [[nodiscard]] float getSkin() const noexcept { return skin_; }
+
+    // -------------------------------------------------------------------------
+    // Constraint
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Correct @p desired, the pose the manipulators produced this frame (or fixed step).
+     *
+     * Call once per frame or fixed step; slide mode sweeps from the eye returned by the previous call.
+     *
+     * @param out Receives the corrected pose (orientation, lens and view direction unchanged)
+     * @return true when @p out differs from @p desired
+     */
+    bool constrain(const CameraPoseSnapshot& desired, CameraPoseSnapshot& out) noexcept;
+
+    /** Forget the previous eye and contact (the next slide starts where the camera is). */
+    void reset() noexcept;
+
+    /** @return true when the last @ref constrain touched geometry */
+    [[nodiscard]] bool hasContact() const noexcept { return has_contact_; }
+    [[nodiscard]] const SweepHit& getLastContact() const noexcept { return contact_; }
+
+    /** @return Number of @ref ISceneQuery::sphereCast calls made so far (for diagnostics) */
+    [[nodiscard]] std::uint64_t getQueryCount() const noexcept { return query_count_; }
+
+   private:
+    [[nodiscard]] vne::math::Vec3f clampToBounds(const vne::math::Vec3f& p) const noexcept;
+    [[nodiscard]] vne::math::Vec3f slide(const vne::math::Vec3f& from, const vne::math::Vec3f& to) noexcept;
+    [[nodiscard]] vne::math::Vec3f springArm(const vne::math::Vec3f& pivot, const vne::math::Vec3f& eye) noexcept;
+    bool cast(const vne::math::Vec3f& origin, const vne::math::Vec3f& dir, float distance, SweepHit& hit) noexcept;
+
+    std::shared_ptr<const ISceneQuery> query_;
+    bool has_bounds_ = false;
+    vne::math::Vec3f bounds_min_{0.0f, 0.0f, 0.0f};
+    vne::math::Vec3f bounds_max_{0.0f, 0.0f, 0.0f};
+
+    ConstraintMode mode_ = ConstraintMode::eSlide;
+    float radius_ = kDefaultRadius;
+    float skin_ = kDefaultSkin;
+
+    // Previous frame, for the slide start and to skip unchanged frames
+    bool has_previous_ = false;
+    bool cache_valid_ = false;  //!< Settings unchanged since the previous frame
+    vne::math::Vec3f previous_desired_{0.0f, 0.0f, 0.0f};
+    vne::math::Vec3f previous_pivot_{0.0f, 0.0f, 0.0f};
+    vne::math::Vec3f previous_eye_{0.0f, 0.0f, 0.0f};  //!< Constrained eye returned last
+    std::uint64_t previous_revision_ = 0;
+
+    bool has_contact_ = false;
+    SweepHit contact_;
+    std::uint32_t hint_ = SweepHit::kNoPrimitive;
+    std::uint64_t query_count_ = 0;
+};
+
+}  // namespace vne::interaction
@@ -21,11 +21,23 @@
  * @par When to use
  * Store `std::unique_ptr<ICameraController>` when the active controller type is chosen at runtime
  * (editor modes, tool switching). Otherwise include the concrete controller header directly.
+ *
+ * @par Switching without a jump
+ * @code
+ * const auto from = CameraRig::capturePose(*camera);  // pose shown by the outgoing controller
+ * active = std::make_unique<Navigation3DController>();
+ * active->setCamera(camera);
+ * active->onResize(w, h);
+ * active->beginTransition(from, 0.35f);               // eased blend runs inside active->onUpdate
+ * @endcode
  */
 
 #include "vertexnova/interaction/export.h"
+#include "vertexnova/interaction/interaction_types.h"
 
+#include <cstddef>
 #include <memory>
+#include <span>
 
 namespace vne::events {
 class Event;
@@ -76,6 +88,64 @@ class VNE_INTERACTION_API ICameraController {
      * @note Many platforms omit a per-event timestep; @c 0.0 is valid.
      */
     virtual void onEvent(const vne::events::Event& event, double delta_time = 0.0) noexcept = 0;
+
+    /**
+     * @brief Ease the camera from @p from into this controller's own pose over @p duration_s seconds.
+     *
+     * Call after @ref setCamera when this controller takes over a camera from another one. Input keeps
+     * flowing to the controller during the blend. Default: no-op (the camera snaps).
+     *
+     * @param from       Pose captured before the switch (see @ref CameraRig::capturePose)
+     * @param duration_s Blend length in seconds; <= 0 snaps
+     */
+    virtual void beginTransition(const CameraPoseSnapshot& from, float duration_s) noexcept {
+        (void)from;
+        (void)duration_s;
+    }
+
+    /**
+     * @brief Run inertia, animation and motion at a fixed rate with interpolated output.
+     *
+     * See @ref CameraRig::setFixedTimestep. Default: no-op (variable-step updates).
+     *
+     * @param step_s Fixed simulation step in seconds; <= 0 returns to variable-step updates
+     */
+    virtual void setFixedTimestep(double step_s) noexcept { (void)step_s; }
+
+    /**
+     * @brief Write only camera pose and lens, leaving @c ICamera::updateMatrices to the application.
+     *
+     * See @ref CameraRig::setMatrixUpdatesDeferred. Default: no-op (matrices refreshed after every write).
+     */
+    virtual void setMatrixUpdatesDeferred(bool deferred) noexcept { (void)deferred; }
+
+    /**
+     * @brief How the camera is moving, for adaptive render quality.
+     *
+     * See @ref CameraRig::getMotionState. Default: at rest.
+     */
+    [[nodiscard]] virtual CameraMotionState getMotionState() const noexcept { return {}; }
+
+    /**
+     * @brief Pose the camera is expected to show @p seconds_ahead from now, for streaming prefetch.
+     *
+     * See @ref CameraRig::predictPose. Default: default-constructed pose (no prediction).
+     */
+    [[nodiscard]] virtual CameraPoseSnapshot predictPose(double seconds_ahead) const noexcept {
+        (void)seconds_ahead;
+        return {};
+    }
+
+    /**
+     * @brief Several look-aheads at once. See @ref CameraRig::predictPoses. Default: none written.
+     * @return Number of poses written to @p out
+     */
+    virtual std::size_t predictPoses(std::span<const double> seconds_ahead,
+                                     std::span<CameraPoseSnapshot> out) const noexcept {
+        (void)seconds_ahead;
+        (void)out;
+        return 0;
+    }
 };
 
 }  // namespace vne::interaction
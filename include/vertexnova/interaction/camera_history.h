@@ -0,0 +1,108 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file camera_history.h
+ * @brief CameraHistory — bounded undo / redo ring of camera poses.
+ *
+ * High-level controllers own one and commit a pose per gesture: the pose before a rotate / pan / look
+ * begins, the pose once the camera settles after it ends (inertia included), and the poses around
+ * @c fitToAABB. Their @c undo() / @c redo() ease the camera to the neighbouring entry through
+ * @ref CameraRig::animateToPose.
+ *
+ * @code
+ * ctrl.fitToAABB(mn, mx);
+ * // ... user orbits, pans ...
+ * ctrl.undo();  // eases back one gesture
+ * ctrl.redo();
+ * @endcode
+ *
+ * Storage is allocated once by the constructor; @ref push, @ref undo and @ref redo are O(1) and never
+ * allocate. When full, the oldest entry is overwritten.
+ */
+
+#include "vertexnova/interaction/export.h"
+#include "vertexnova/interaction/interaction_types.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace vne::interaction {
+
+/**
+ * @brief Fixed-capacity linear history of @ref CameraPoseSnapshot with a current-entry cursor.
+ *
+ * Entries older than the cursor are undo steps, newer ones redo steps. Pushing drops the redo steps.
+ * A pose matching the current entry is not pushed again, so committing at every gesture boundary
+ * coalesces to one entry per change.
+ *
+ * @threadsafe Not thread-safe.
+ */
+class VNE_INTERACTION_API CameraHistory {
+   public:
+    static constexpr std::size_t kDefaultCapacity = 64;
+
+    /** @param capacity Maximum number of entries (at least 2) */
+    explicit CameraHistory(std::size_t capacity = kDefaultCapacity);
+
+    /**
+     * @brief Make @p pose the current entry, dropping redo steps (and the oldest entry when full).
+     * @return false if @p pose matches the current entry (nothing changed)
+     */
+    bool push(const CameraPoseSnapshot& pose) noexcept;
+
+    /**
+     * @brief Step back one entry.
+     *
+     * A @p current pose that differs from the current entry (a change not yet committed) is pushed first,
+     * so it can be redone.
+     *
+     * @param current Pose the camera holds now
+     * @param out     Receives the pose to return to
+     * @return false if there is no earlier entry
+     */
+    bool undo(const CameraPoseSnapshot& current, CameraPoseSnapshot& out) noexcept;
+
+    /**
+     * @brief Step forward one entry.
+     *
+     * A @p current pose that differs from the current entry means the camera moved since the last undo;
+     * it is pushed (which discards the redo steps) and false is returned.
+     *
+     * @return false if there is no later entry
+     */
+    bool redo(const CameraPoseSnapshot& current, CameraPoseSnapshot& out) noexcept;
+
+    /** Remove all entries (keeps the storage). */
+    void clear() noexcept;
+
+    [[nodiscard]] bool canUndo() const noexcept { return cursor_ > 0; }
+    [[nodiscard]] bool canRedo() const noexcept { return cursor_ + 1 < count_; }
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return ring_.size(); }
+
+    /** @return Current entry; only valid when not @ref empty */
+    [[nodiscard]] const CameraPoseSnapshot& current() const noexcept { return at(cursor_); }
+
+   private:
+    [[nodiscard]] const CameraPoseSnapshot& at(std::size_t index) const noexcept {
+        return ring_[(head_ + index) % ring_.size()];
+    }
+
+    std::vector<CameraPoseSnapshot> ring_;
+    std::size_t head_ = 0;    //!< Ring slot of the oldest entry
+    std::size_t count_ = 0;   //!< Valid entries
+    std::size_t cursor_ = 0;  //!< Index (from the oldest) of the current entry
+};
+
+}  // namespace vne::interaction
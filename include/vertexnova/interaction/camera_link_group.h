@@ -0,0 +1,137 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file camera_link_group.h
+ * @brief CameraLinkGroup — mirrors zoom, pan, rotation and center moves of one view onto linked views.
+ *
+ * For multi-view layouts such as axial / sagittal / coronal slices plus a 3D view: whatever the user
+ * does in one view (through its own controller) is carried over to the others, transformed for each view.
+ *
+ * @code
+ * vne::interaction::CameraLinkGroup links;
+ * links.addView(axial_cam, kLinkZoom | kLinkPan, &axial_ctrl.ortho2DManipulator());
+ * links.addView(sagittal_cam, kLinkZoom | kLinkPan, &sagittal_ctrl.ortho2DManipulator());
+ * links.addView(coronal_cam, kLinkZoom | kLinkPan, &coronal_ctrl.ortho2DManipulator());
+ * // per frame, after routing events and calling each controller's onUpdate:
+ * links.sync();
+ * @endcode
+ *
+ * @par How changes propagate
+ * The group keeps the pose each camera had after the previous sync. @ref CameraLinkGroup::sync takes the
+ * first view whose camera has moved since then as the source and derives the shared quantities once from
+ * its old and new pose:
+ *   - zoom: ratio of the new to the old ortho width (perspective: eye-to-target distance);
+ *   - pan: world-space displacement of the target;
+ *   - rotate: rotation from the old to the new orientation;
+ *   - center: the new target.
+ *
+ * Every other view then gets, in a single pass, the channels it links: rotation about its own target,
+ * the zoom factor applied to its own extent, and the pan projected into its own view plane (so a pan
+ * along the axial plane moves the sagittal view only along their shared axis). @ref kLinkCenter instead
+ * moves the view's target onto the source's target, which keeps slice crosshairs aligned; it takes
+ * precedence over @ref kLinkPan. Each linked camera is written once per sync.
+ *
+ * @par Manipulators
+ * Pass the view's manipulator (e.g. @c Ortho2DController::ortho2DManipulator()) so it is told about the
+ * external camera change through @ref ICameraManipulator::onHandoff; manipulators that cache orbit state
+ * (trackball, free-look) otherwise snap back on their next update. Only camera changes are seen: zoom
+ * with @c ZoomMethod::eSceneScale (the default) leaves the camera alone, so linked 2D views should use
+ * @c ZoomMethod::eChangeFov.
+ */
+
+#include "vertexnova/interaction/export.h"
+#include "vertexnova/interaction/camera_manipulator.h"
+
+#include "vertexnova/scene/camera/camera.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace vne::interaction {
+
+//! Link channel bitmask constants for CameraLinkGroup views.
+static constexpr int kLinkNone = 0;         //!< View is a source only; nothing is mirrored onto it
+static constexpr int kLinkZoom = 1 << 0;    //!< Shared zoom factor
+static constexpr int kLinkPan = 1 << 1;     //!< Pan, projected into the view plane
+static constexpr int kLinkRotate = 1 << 2;  //!< Rotation about the view's own target
+static constexpr int kLinkCenter = 1 << 3;  //!< Target follows the source target (supersedes kLinkPan)
+static constexpr int kLinkAll = kLinkZoom | kLinkPan | kLinkRotate | kLinkCenter;
+
+/**
+ * @brief Set of cameras whose navigation is mirrored between each other.
+ *
+ * @threadsafe Not thread-safe: call all methods from the thread that updates the controllers.
+ */
+class VNE_INTERACTION_API CameraLinkGroup {
+   public:
+    static constexpr std::size_t kNoSource = static_cast<std::size_t>(-1);
+
+    CameraLinkGroup();
+    ~CameraLinkGroup();
+
+    CameraLinkGroup(const CameraLinkGroup&) = delete;
+    CameraLinkGroup& operator=(const CameraLinkGroup&) = delete;
+    CameraLinkGroup(CameraLinkGroup&&) noexcept;
+    CameraLinkGroup& operator=(CameraLinkGroup&&) noexcept;
+
+    // -------------------------------------------------------------------------
+    // Views
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Link @p camera; its current pose becomes the baseline for the next sync.
+     * @param channels    Bitmask of kLink* flags mirrored onto this view
+     * @param manipulator Optional, non-owning; notified via @c onHandoff after linked moves. Must outlive
+     *                    its membership.
+     * @return Index of the view (existing index if @p camera is already linked; size() if null)
+     */
+    std::size_t addView(std::shared_ptr<vne::scene::ICamera> camera,
+                        int channels = kLinkAll,
+                        ICameraManipulator* manipulator = nullptr);
+
+    /** Unlink @p camera if present; later views shift down. @return true if it was linked */
+    bool removeView(const vne::scene::ICamera* camera) noexcept;
+
+    void clear() noexcept;
+
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /** Set the kLink* bitmask mirrored onto the view at @p index. */
+    void setChannels(std::size_t index, int channels) noexcept;
+
+    /** @return kLink* bitmask of the view at @p index (kLinkNone when out of range) */
+    [[nodiscard]] int getChannels(std::size_t index) const noexcept;
+
+    // -------------------------------------------------------------------------
+    // Synchronization
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Mirror the change of the first view that moved since the last sync onto the other views.
+     * @return Index of the source view, or @ref kNoSource when no camera moved
+     */
+    std::size_t sync() noexcept;
+
+    /** Mirror the change of the view at @p index since the last sync, whether or not another view moved. */
+    void syncFrom(std::size_t index) noexcept;
+
+    /** Take every camera's current pose as the baseline without mirroring (after programmatic moves). */
+    void resetBaseline() noexcept;
+
+   private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace vne::interaction
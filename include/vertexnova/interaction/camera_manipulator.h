@@ -28,7 +28,10 @@
 #include "vertexnova/interaction/export.h"
 #include "vertexnova/interaction/interaction_types.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <memory>
+#include <span>
 
 namespace vne::scene {
 class ICamera;
@@ -48,6 +51,7 @@ namespace vne::interaction {
  *    @c trackball_manipulator.h)
  *  - FreeLookManipulator — WASD movement + mouse look (FPS or unconstrained Fly mode)
  *  - Ortho2DManipulator — orthographic 2D pan, zoom, optional in-plane rotation
+ *  - CameraPathManipulator — keyframed spline fly-through at constant speed
  *
  * @threadsafe Not thread-safe. All methods must be called from a single thread.
  */
@@ -98,6 +102,62 @@ class VNE_INTERACTION_API ICameraManipulator {
      * @param enabled false = manipulator ignores all actions and onUpdate calls
      */
     virtual void setEnabled(bool enabled) noexcept = 0;
+
+    /**
+     * @brief Adopt a pose handed over by the previously active manipulator.
+     *
+     * Called by @ref CameraRig::switchTo after the camera already holds @p pose. Manipulators that cache
+     * orientation or orbit state override this to initialize from @p pose directly instead of re-reading
+     * the camera. Default: no-op (for manipulators that read the camera on demand).
+     *
+     * @param pose Pose of the camera at the moment of the handoff
+     */
+    virtual void onHandoff(const CameraPoseSnapshot& pose) noexcept { (void)pose; }
+
+    /**
+     * @brief Write only the camera pose and lens, skipping @c ICamera::updateMatrices.
+     *
+     * For pose-only consumers (headless runs, camera batches) that never read the camera's matrices, or
+     * renderers that call @c updateMatrices once per frame themselves. Default: no-op (matrices are
+     * always refreshed).
+     *
+     * @param deferred true = leave matrix updates to the application
+     */
+    virtual void setMatrixUpdatesDeferred(bool deferred) noexcept { (void)deferred; }
+
+    /**
+     * @brief How this manipulator is moving the camera (see @ref CameraMotionState).
+     *
+     * Cheap to call every frame, typically after @ref onUpdate. Default: at rest (for manipulators that never
+     * move the camera on their own).
+     */
+    [[nodiscard]] virtual CameraMotionState getMotionState() const noexcept { return {}; }
+
+    /**
+     * @brief Pose this manipulator will give the camera @p seconds_ahead from now if input stays as it is.
+     *
+     * Held drags and keys continue at their current rate, inertia decays as in @ref onUpdate and running
+     * animations play on; wheel zoom is not extrapolated. Nothing is changed, so this can be called any number
+     * of times per frame (streaming prefetch, I/O scheduling). Default: default-constructed pose (no prediction).
+     *
+     * @param seconds_ahead Look-ahead in seconds; 0 or less gives the current pose
+     */
+    [[nodiscard]] virtual CameraPoseSnapshot predictPose(double seconds_ahead) const noexcept {
+        (void)seconds_ahead;
+        return {};
+    }
+
+    /**
+     * @brief @ref predictPose for each entry of @p seconds_ahead, written to the matching entry of @p out.
+     * @return Number of poses written (the shorter of the two spans)
+     */
+    std::size_t predictPoses(std::span<const double> seconds_ahead, std::span<CameraPoseSnapshot> out) const noexcept {
+        const std::size_t count = std::min(seconds_ahead.size(), out.size());
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = predictPose(seconds_ahead[i]);
+        }
+        return count;
+    }
 };
 
 }  // namespace vne::interaction
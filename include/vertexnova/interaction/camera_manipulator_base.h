@@ -76,6 +76,9 @@ class VNE_INTERACTION_API CameraManipulatorBase : public ICameraManipulator {
     [[nodiscard]] bool isEnabled() const noexcept override { return enabled_; }
     /** @copydoc ICameraManipulator::setEnabled */
     void setEnabled(bool enabled) noexcept override { enabled_ = enabled; }
+    /** @copydoc ICameraManipulator::setMatrixUpdatesDeferred */
+    void setMatrixUpdatesDeferred(bool deferred) noexcept override { defer_matrices_ = deferred; }
+    [[nodiscard]] bool isMatrixUpdatesDeferred() const noexcept { return defer_matrices_; }
 
     // -------------------------------------------------------------------------
     // Zoom method API — shared across all manipulators
@@ -114,6 +117,9 @@ class VNE_INTERACTION_API CameraManipulatorBase : public ICameraManipulator {
     // Camera type helpers
     // -------------------------------------------------------------------------
 
+    /** @brief Refresh @p camera's matrices after a write, unless updates are deferred. */
+    void updateCameraMatrices(vne::scene::ICamera& camera) const noexcept;
+
     /** @brief Return camera cast to PerspectiveCamera, or nullptr. */
     [[nodiscard]] std::shared_ptr<vne::scene::PerspectiveCamera> perspCamera() const noexcept;
     /** @brief Return camera cast to OrthographicCamera, or nullptr. */
@@ -202,18 +208,40 @@ class VNE_INTERACTION_API CameraManipulatorBase : public ICameraManipulator {
      */
     void applyOrthoZoomToCursor(float factor, float mx, float my) noexcept;
 
+    // -------------------------------------------------------------------------
+    // Zoom rate (motion state)
+    // -------------------------------------------------------------------------
+
+    /** @brief Note a zoom that scaled the view extent by @p factor (dispatchZoom does this). */
+    void recordZoom(float factor) noexcept;
+
+    /** @brief Fold the zooms recorded since the last frame into the smoothed rate; call from onUpdate. */
+    void updateZoomRate(double delta_time) noexcept;
+
+    /** @brief Forget recorded zooms (resetState). */
+    void clearZoomRate() noexcept {
+        zoom_log_pending_ = 0.0f;
+        zoom_rate_ = 0.0f;
+    }
+
+    /** @brief Smoothed d ln(extent) / dt in 1/s (> 0 zooming out); see @ref CameraMotionState::zoom_rate. */
+    [[nodiscard]] float zoomRate() const noexcept { return zoom_rate_; }
+
     // -------------------------------------------------------------------------
     // Shared state
     // -------------------------------------------------------------------------
 
     std::shared_ptr<vne::scene::ICamera> camera_;
     bool enabled_ = true;
+    bool defer_matrices_ = false;  //!< Skip ICamera::updateMatrices after writes
 
     vne::math::Viewport viewport_{1280.0f, 720.0f};
 
     ZoomMethod zoom_method_ = ZoomMethod::eSceneScale;
     float zoom_scale_ = 1.0f;       //!< Accumulated zoom scale (eSceneScale)
     float fov_zoom_speed_ = 1.05f;  //!< Legacy default for setFovZoomSpeed (eChangeFov uses event factor)
+    float zoom_log_pending_ = 0.0f;  //!< Sum of ln(factor) recorded since the last updateZoomRate
+    float zoom_rate_ = 0.0f;         //!< Smoothed zoom rate (1/s)
 };
 
 }  // namespace vne::interaction
@@ -0,0 +1,223 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file camera_path_manipulator.h
+ * @brief CameraPathManipulator — keyframed spline fly-through played back at constant speed.
+ *
+ * Keyframes carry a position, an orientation (explicit quaternion or look-at point) and an optional
+ * vertical FOV. Positions are interpolated with a Catmull-Rom spline (uniform, centripetal or chordal
+ * knot spacing), orientations with quaternion squad, FOV with a uniform Catmull-Rom on the scalar.
+ *
+ * @par Constant-speed sampling
+ * @ref setKeyframes builds an arc-length lookup table once (see @ref setSamplesPerSegment). Playback and
+ * @ref sampleAtDistance map a travelled distance to a spline parameter by binary search over that table,
+ * so each sample is O(log n) in the number of table entries and performs no allocation.
+ *
+ * @par Rig integration
+ * Register on a @ref CameraRig like any other manipulator (or use @ref CameraRig::makeCameraPath). The
+ * manipulator drives the camera from @ref onUpdate while playing; @c eResetView rewinds to the start.
+ */
+
+#include "vertexnova/interaction/camera_manipulator_base.h"
+#include "vertexnova/interaction/interaction_types.h"
+
+#include <vertexnova/math/core/core.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace vne::scene {
+class ICamera;
+}
+
+namespace vne::interaction {
+
+/** Knot spacing for the Catmull-Rom position spline. */
+enum class CameraPathSplineType : std::uint8_t {
+    eUniform = 0,      //!< Uniform knots (classic Catmull-Rom); may overshoot / cusp on uneven spacing
+    eCentripetal = 1,  //!< Knots spaced by sqrt(chord length); no cusps or self-intersections (default)
+    eChordal = 2,      //!< Knots spaced by chord length; tightest curve around sharp turns
+};
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)   // dll-interface for member type from another lib
+#pragma warning(disable : 26495)  // uninitialized member (ctor initializes all)
+#endif
+
+/**
+ * @brief One control point of a camera path.
+ *
+ * When @c use_look_at is true the orientation is derived from @c position → @c look_at with the
+ * manipulator's world up; otherwise @c orientation (camera-to-world, forward = -Z) is used.
+ */
+struct VNE_INTERACTION_API CameraPathKeyframe {
+    vne::math::Vec3f position;     //!< Camera position in world space
+    vne::math::Quatf orientation;  //!< Camera-to-world rotation (ignored when @c use_look_at is true)
+    vne::math::Vec3f look_at;      //!< World-space point to look at (used when @c use_look_at is true)
+    bool use_look_at = false;      //!< Derive orientation from @c look_at instead of @c orientation
+    float fov_deg = 0.0f;          //!< Vertical FOV in degrees; <= 0 on any keyframe leaves camera FOV untouched
+
+    CameraPathKeyframe() noexcept
+        : position(0.0f, 0.0f, 0.0f)
+        , orientation(0.0f, 0.0f, 0.0f, 1.0f)
+        , look_at(0.0f, 0.0f, -1.0f) {}
+};
+
+/** @brief Pose produced by @ref CameraPathManipulator::sampleAtDistance. */
+struct VNE_INTERACTION_API CameraPathSample {
+    vne::math::Vec3f position;     //!< Camera position in world space
+    vne::math::Quatf orientation;  //!< Camera-to-world rotation
+    float fov_deg = 0.0f;          //!< Interpolated vertical FOV; 0 when the path carries no FOV track
+
+    CameraPathSample() noexcept
+        : position(0.0f, 0.0f, 0.0f)
+        , orientation(0.0f, 0.0f, 0.0f, 1.0f) {}
+};
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+/** Built spline, squad control points and arc-length table (defined in camera_path_manipulator.cpp). */
+struct CameraPathData;
+
+/**
+ * @brief Plays a keyframed spline path on the attached camera at constant world-space speed.
+ *
+ * @par Action coverage
+ * Utility: @c eResetView (rewind to distance 0 and apply). All interactive actions are ignored.
+ *
+ * @threadsafe Not thread-safe. All methods must be called from a single thread.
+ */
+class VNE_INTERACTION_API CameraPathManipulator final : public CameraManipulatorBase {
+   public:
+    CameraPathManipulator() noexcept;
+    ~CameraPathManipulator() noexcept override;
+
+    CameraPathManipulator(const CameraPathManipulator&) = delete;
+    CameraPathManipulator& operator=(const CameraPathManipulator&) = delete;
+    CameraPathManipulator(CameraPathManipulator&&) noexcept;
+    CameraPathManipulator& operator=(CameraPathManipulator&&) noexcept;
+
+    // -------------------------------------------------------------------------
+    // ICameraManipulator
+    // -------------------------------------------------------------------------
+
+    /** @brief Handles @c eResetView (rewind); ignores all other actions. */
+    bool onAction(CameraActionType action, const CameraCommandPayload& payload, double delta_time) noexcept override;
+
+    /** Advance playback by @c speed × delta_time along the path and apply the pose. */
+    void onUpdate(double delta_time) noexcept override;
+
+    /** Playback position and path are kept; nothing to clear (no gesture state). */
+    void resetState() noexcept override;
+
+    /**
+     * @brief While playing: path speed, turn and FOV rates (sampled one short step ahead) and the time to the
+     * end of the path (infinite when looping).
+     */
+    [[nodiscard]] CameraMotionState getMotionState() const noexcept override;
+
+    /** @brief While playing: the path sample @p seconds_ahead further along (clamped, or wrapped when looping). */
+    [[nodiscard]] CameraPoseSnapshot predictPose(double seconds_ahead) const noexcept override;
+
+    // -------------------------------------------------------------------------
+    // Path definition (allocates; call outside the per-frame path)
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Replace the keyframes and rebuild the spline and arc-length table.
+     * @return false (and clears the path) when fewer than two keyframes are given
+     */
+    bool setKeyframes(std::vector<CameraPathKeyframe> keyframes) noexcept;
+    [[nodiscard]] const std::vector<CameraPathKeyframe>& getKeyframes() const noexcept;
+
+    /** Remove all keyframes and stop playback. */
+    void clear() noexcept;
+
+    /** Knot spacing for the position spline (default: @ref CameraPathSplineType::eCentripetal). Rebuilds. */
+    void setSplineType(CameraPathSplineType type) noexcept;
+    [[nodiscard]] CameraPathSplineType getSplineType() const noexcept { return spline_type_; }
+
+    /** Closed loop: last keyframe connects back to the first and playback wraps. Rebuilds. */
+    void setLooping(bool looping) noexcept;
+    [[nodiscard]] bool isLooping() const noexcept { return looping_; }
+
+    /** Arc-length table resolution per spline segment (clamped to [2, 1024]; default 32). Rebuilds. */
+    void setSamplesPerSegment(int samples) noexcept;
+    [[nodiscard]] int getSamplesPerSegment() const noexcept { return samples_per_segment_; }
+
+    /** World up used to orient look-at keyframes (default: +Y). Rebuilds. */
+    void setWorldUp(const vne::math::Vec3f& world_up) noexcept;
+    [[nodiscard]] vne::math::Vec3f getWorldUp() const noexcept { return world_up_; }
+
+    /** @return true when the path has at least one segment and can be sampled. */
+    [[nodiscard]] bool isValid() const noexcept;
+
+    /** @return Total arc length of the path in world units (0 when invalid). */
+    [[nodiscard]] float getLength() const noexcept;
+
+    // -------------------------------------------------------------------------
+    // Playback
+    // -------------------------------------------------------------------------
+
+    /** Start or resume playback from the current distance. Rewinds first when a non-looping path is at its end. */
+    void play() noexcept;
+    /** Pause playback (keeps the current distance). */
+    void pause() noexcept { playing_ = false; }
+    [[nodiscard]] bool isPlaying() const noexcept { return playing_; }
+
+    /** Playback speed in world units per second; negative plays backwards. */
+    void setSpeed(float units_per_second) noexcept;
+    [[nodiscard]] float getSpeed() const noexcept { return speed_; }
+
+    /** Jump to a distance along the path (clamped, or wrapped when looping) and apply the pose. */
+    void seek(float distance) noexcept;
+    /** Jump to a fraction in [0, 1] of the total length and apply the pose. */
+    void seekNormalized(float fraction) noexcept;
+    /** @return Current distance travelled along the path. */
+    [[nodiscard]] float getDistance() const noexcept { return distance_; }
+
+    // -------------------------------------------------------------------------
+    // Sampling (allocation-free)
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Evaluate the path at an arc-length distance without touching the camera.
+     * @param distance World-space distance from the first keyframe (clamped, or wrapped when looping)
+     * @param out      Receives position, orientation and FOV
+     * @return false when the path is not built
+     */
+    bool sampleAtDistance(float distance, CameraPathSample& out) const noexcept;
+
+   private:
+    void rebuild() noexcept;
+    [[nodiscard]] float wrapDistance(float distance) const noexcept;
+    void applySample(const CameraPathSample& sample) noexcept;
+
+    std::unique_ptr<CameraPathData> path_;
+
+    CameraPathSplineType spline_type_ = CameraPathSplineType::eCentripetal;
+    vne::math::Vec3f world_up_{0.0f, 1.0f, 0.0f};
+    int samples_per_segment_ = 32;
+    bool looping_ = false;
+
+    float speed_ = 1.0f;
+    float distance_ = 0.0f;
+    bool playing_ = false;
+};
+
+}  // namespace vne::interaction
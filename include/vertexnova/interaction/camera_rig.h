@@ -20,14 +20,58 @@
  * directly.
  *
  * Use the static @c make*() factories for common stacks, or @ref addManipulator for custom setups.
+ *
+ * @par Handoff transitions
+ * @ref switchTo activates one registered manipulator and hands it the current camera pose
+ * (@ref ICameraManipulator::onHandoff), then eases the visible camera from the outgoing pose to whatever
+ * the incoming manipulator produces. Controllers swapped at runtime use @ref beginTransition with a pose
+ * captured from the shared camera before the swap. During a transition the manipulators keep operating on
+ * their own pose; the rig only overrides what the camera shows, so input is never dropped.
+ *
+ * @par Fixed timestep
+ * With @ref setFixedTimestep > 0, @ref onUpdate accumulates the frame time and advances the manipulators in
+ * whole steps of exactly that size (inertia, animation, WASD motion), so their motion no longer depends on
+ * the frame rate. The camera shows the pose interpolated between the last two simulated states by the
+ * leftover fraction of a step (@ref getInterpolationAlpha). Actions from @ref onAction are applied at once and
+ * shown without interpolation, so direct manipulation never lags a step behind.
+ *
+ * @par Trajectory export
+ * With @ref setTrajectoryWriter, every @ref onUpdate appends the pose the camera shows to a
+ * @ref CameraTrajectoryWriter, stamped with the accumulated frame time.
+ *
+ * @par Clip planes
+ * With @ref setClipPlaneManager, every @ref onUpdate fits a perspective camera's near / far planes to the
+ * visible scene bounds once the shown pose is final (see @ref ClipPlaneManager).
+ *
+ * @par Camera constraint
+ * With @ref setCameraConstraint, every @ref onUpdate corrects the pose the manipulators produced against scene
+ * geometry and a keep-in volume (see @ref CameraConstraint). Actions dispatched between frames are not constrained
+ * individually. Slide corrections are written to the camera after every fixed step (once per frame without one),
+ * before interpolation and transitions are layered on top, so the manipulators continue from them; spring-arm
+ * corrections are applied once to the final shown pose and only override what the camera shows, like a transition.
+ *
+ * @par Motion state
+ * @ref getMotionState reports how the camera is moving (drag, inertia, animation, zoom rate, time to rest) from
+ * the manipulators' own state, so a renderer can lower or restore quality without diffing view matrices.
+ *
+ * @par Pose prediction
+ * @ref predictPose / @ref predictPoses extrapolate the shown pose from the same state (held drags and keys,
+ * inertia, animations, a running transition) without advancing anything, for streaming prefetch.
  */
 
+#include "vertexnova/interaction/camera_constraint.h"
 #include "vertexnova/interaction/camera_manipulator.h"
+#include "vertexnova/interaction/clip_plane_manager.h"
+#include "vertexnova/interaction/camera_trajectory.h"
 #include "vertexnova/interaction/export.h"
 #include "vertexnova/interaction/interaction_types.h"
 #include "vertexnova/scene/camera/camera.h"
 
+#include <vertexnova/math/easing.h>
+
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace vne::interaction {
@@ -121,6 +165,186 @@ class VNE_INTERACTION_API CameraRig {
     /** Reset all manipulator states. */
     void resetState() noexcept;
 
+    // -------------------------------------------------------------------------
+    // Animated handoff
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Make @p incoming the only enabled manipulator and blend the camera into its pose.
+     *
+     * Captures the pose the camera currently shows, resets and disables every other manipulator, passes the
+     * pose to @c incoming->onHandoff, then starts a transition of @p duration_s seconds (see
+     * @ref beginTransition). A running transition is replaced; the new one starts from the blended pose.
+     *
+     * @param incoming   A manipulator previously added with @ref addManipulator
+     * @param duration_s Blend length in seconds; <= 0 hands off without blending
+     * @return false (no change) when @p incoming is null or not registered on this rig
+     */
+    bool switchTo(const std::shared_ptr<ICameraManipulator>& incoming, float duration_s = 0.35f) noexcept;
+
+    /**
+     * @brief Blend the visible camera from @p from to the pose driven by the enabled manipulators.
+     *
+     * The camera is set to @p from immediately. Each @ref onUpdate (and @ref onAction) restores the
+     * manipulators' own pose before dispatch, then re-applies the eased blend, so manipulators never observe
+     * the blended pose. If the camera was moved outside the rig in between (e.g. a direct manipulator call),
+     * that pose is kept as the manipulators' pose. No-op when no camera is attached or @p duration_s <= 0.
+     *
+     * @param from       Pose to start from (e.g. captured from the camera before switching controllers)
+     * @param duration_s Blend length in seconds
+     */
+    void beginTransition(const CameraPoseSnapshot& from, float duration_s) noexcept;
+
+    /**
+     * @brief Move the enabled manipulators to @p pose and blend the camera there from what it shows now.
+     *
+     * The pose is written to the camera and handed to every enabled manipulator (@ref
+     * ICameraManipulator::onHandoff), then a transition from the previously shown pose starts (see
+     * @ref beginTransition). Used by controller undo / redo (@ref CameraHistory).
+     *
+     * @param pose       Pose to restore
+     * @param duration_s Blend length in seconds; <= 0 jumps without blending
+     */
+    void animateToPose(const CameraPoseSnapshot& pose, float duration_s = 0.35f) noexcept;
+
+    /** Stop a running transition and show the manipulators' pose immediately. */
+    void cancelTransition() noexcept;
+
+    /** @return true while a handoff blend is running. */
+    [[nodiscard]] bool isTransitioning() const noexcept { return transitioning_; }
+
+    /**
+     * @brief Pose the enabled manipulators hold: what the camera shows once a running transition or
+     * fixed-step interpolation completes. Default-constructed when no camera is attached.
+     */
+    [[nodiscard]] CameraPoseSnapshot getManipulatorPose() const noexcept;
+
+    /** Easing curve for handoff blends (default: @c eCubicInOut). */
+    void setTransitionEasing(vne::math::EaseType easing) noexcept { transition_easing_ = easing; }
+    [[nodiscard]] vne::math::EaseType getTransitionEasing() const noexcept { return transition_easing_; }
+
+    // -------------------------------------------------------------------------
+    // Fixed timestep
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Simulate manipulators at a fixed rate and interpolate the shown pose (0 = off, default).
+     *
+     * Changing the step discards accumulated time. Typical values: @c 1.0/240.0 or @c 1.0/120.0.
+     *
+     * @param step_s Fixed simulation step in seconds; <= 0 or non-finite turns the mode off
+     */
+    void setFixedTimestep(double step_s) noexcept;
+    [[nodiscard]] double getFixedTimestep() const noexcept { return fixed_step_s_; }
+    [[nodiscard]] bool isFixedTimestepEnabled() const noexcept { return fixed_step_s_ > 0.0; }
+
+    /**
+     * @brief Upper bound on simulation steps per @ref onUpdate (default 32, clamped to >= 1).
+     *
+     * Time beyond the cap is dropped (the simulation slows down instead of spiralling on very long frames).
+     */
+    void setMaxFixedSteps(int max_steps) noexcept;
+    [[nodiscard]] int getMaxFixedSteps() const noexcept { return max_fixed_steps_; }
+
+    /** @return Fraction in [0, 1) of a step carried over to the next frame (the interpolation weight). */
+    [[nodiscard]] float getInterpolationAlpha() const noexcept;
+
+    // -------------------------------------------------------------------------
+    // Matrix updates
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Let the manipulators and the rig write only pose and lens, without @c ICamera::updateMatrices.
+     *
+     * Applies to current and later-added manipulators. The application then calls @c updateMatrices before
+     * it reads the camera's matrices (rendering, picking); pose getters stay current. Default: off.
+     */
+    void setMatrixUpdatesDeferred(bool deferred) noexcept;
+    [[nodiscard]] bool isMatrixUpdatesDeferred() const noexcept { return defer_matrices_; }
+
+    // -------------------------------------------------------------------------
+    // Trajectory export
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Append the shown pose to @p writer at the end of every @ref onUpdate (nullptr = off, default).
+     *
+     * Timestamps start at 0 and advance by each frame's @c delta_time. The writer must already be open;
+     * the rig never opens or closes it.
+     */
+    void setTrajectoryWriter(std::shared_ptr<CameraTrajectoryWriter> writer) noexcept;
+    [[nodiscard]] const std::shared_ptr<CameraTrajectoryWriter>& getTrajectoryWriter() const noexcept {
+        return trajectory_writer_;
+    }
+
+    /**
+     * @brief Snapshot the pose @p camera currently shows (eye, orientation, target, FOV or ortho extent).
+     *
+     * Use before swapping controllers and pass the result to @ref ICameraController::beginTransition.
+     */
+    [[nodiscard]] static CameraPoseSnapshot capturePose(const vne::scene::ICamera& camera) noexcept;
+
+    // -------------------------------------------------------------------------
+    // Clip planes
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Refit the camera's near / far planes with @p manager at the end of every @ref onUpdate
+     *        (nullptr = off, default). Honors @ref setMatrixUpdatesDeferred.
+     */
+    void setClipPlaneManager(std::shared_ptr<ClipPlaneManager> manager) noexcept;
+    [[nodiscard]] const std::shared_ptr<ClipPlaneManager>& getClipPlaneManager() const noexcept {
+        return clip_planes_;
+    }
+
+    // -------------------------------------------------------------------------
+    // Camera constraint
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Correct the camera with @p constraint during every @ref onUpdate, before the clip planes are
+     *        fitted (nullptr = off, default). Resets the constraint; so do @ref setCamera and
+     *        @ref animateToPose.
+     */
+    void setCameraConstraint(std::shared_ptr<CameraConstraint> constraint) noexcept;
+    [[nodiscard]] const std::shared_ptr<CameraConstraint>& getCameraConstraint() const noexcept {
+        return constraint_;
+    }
+
+    // -------------------------------------------------------------------------
+    // Motion state
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Merged @ref ICameraManipulator::getMotionState of the enabled manipulators.
+     *
+     * A running handoff transition also counts as animating, until its blend ends. Query after @ref onUpdate to
+     * pick the render quality of the frame about to be drawn.
+     */
+    [[nodiscard]] CameraMotionState getMotionState() const noexcept;
+
+    // -------------------------------------------------------------------------
+    // Pose prediction
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Pose the camera is expected to show @p seconds_ahead from now if input stays as it is.
+     *
+     * The motion of the last enabled manipulator that is moving (see @ref ICameraManipulator::predictPose) is
+     * carried onto @ref getManipulatorPose, then a running transition is blended at its later progress. The
+     * camera constraint and fixed-step interpolation are not applied. Nothing is changed.
+     *
+     * @param seconds_ahead Look-ahead in seconds; 0 or less gives the current pose
+     * @return Default-constructed when no camera is attached
+     */
+    [[nodiscard]] CameraPoseSnapshot predictPose(double seconds_ahead) const noexcept;
+
+    /**
+     * @brief @ref predictPose for each entry of @p seconds_ahead, written to the matching entry of @p out.
+     * @return Number of poses written (the shorter of the two spans; 0 when no camera is attached)
+     */
+    std::size_t predictPoses(std::span<const double> seconds_ahead, std::span<CameraPoseSnapshot> out) const noexcept;
+
     // -------------------------------------------------------------------------
     // Convenience factory methods
     // -------------------------------------------------------------------------
@@ -140,8 +364,42 @@ class VNE_INTERACTION_API CameraRig {
     /** 2D orthographic rig: Ortho2DManipulator (pan, zoom, optional in-plane rotation). */
     static CameraRig makeOrtho2D();
 
+    /** Fly-through rig: CameraPathManipulator (set keyframes, then @c play()). */
+    static CameraRig makeCameraPath();
+
    private:
+    void restoreManipulatorPose() noexcept;
+    [[nodiscard]] bool cameraShowsOverride() const noexcept;
+    void stepFixed(double delta_time) noexcept;
+    void publishPose(double delta_time) noexcept;
+    void commitSlideConstraint() noexcept;
+    void applyConstraint() noexcept;
+
     std::vector<std::shared_ptr<ICameraManipulator>> manipulators_;
+    std::shared_ptr<vne::scene::ICamera> camera_;
+
+    CameraPoseSnapshot manipulator_pose_;  //!< Last pose written by the manipulators
+    CameraPoseSnapshot shown_pose_;        //!< Pose last written to the camera by the rig (blend / interpolation)
+    bool pose_overridden_ = false;         //!< Camera shows @c shown_pose_ instead of @c manipulator_pose_
+
+    CameraPoseSnapshot transition_from_;
+    float transition_elapsed_ = 0.0f;
+    float transition_duration_ = 0.0f;
+    vne::math::EaseType transition_easing_ = vne::math::EaseType::eCubicInOut;
+    bool transitioning_ = false;
+
+    CameraPoseSnapshot fixed_prev_pose_;  //!< Manipulator pose one fixed step before @c manipulator_pose_
+    double fixed_step_s_ = 0.0;
+    double fixed_accumulator_s_ = 0.0;
+    int max_fixed_steps_ = 32;
+
+    bool defer_matrices_ = false;  //!< Skip ICamera::updateMatrices after rig and manipulator writes
+
+    std::shared_ptr<CameraTrajectoryWriter> trajectory_writer_;
+    double trajectory_time_s_ = 0.0;  //!< Timestamp of the next appended frame
+
+    std::shared_ptr<ClipPlaneManager> clip_planes_;
+    std::shared_ptr<CameraConstraint> constraint_;
 };
 
 }  // namespace vne::interaction
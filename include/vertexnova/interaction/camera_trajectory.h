@@ -0,0 +1,211 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file camera_trajectory.h
+ * @brief Camera pose trajectory files: CameraTrajectoryWriter (per-frame append) and CameraTrajectoryReader.
+ *
+ * A trajectory stores one @ref CameraTrajectoryFrame per rendered frame — timestamp, eye position, orientation
+ * quaternion, center of interest, eye-to-COI distance and vertical FOV — for offline analytics such as dwell
+ * time per region. Attach a writer to a rig with @ref CameraRig::setTrajectoryWriter, or call
+ * @ref CameraTrajectoryWriter::append yourself.
+ *
+ * @par Format
+ * Frames are grouped into fixed-size blocks stored column by column (structure of arrays). Each channel is
+ * quantized to its step (@ref CameraTrajectoryOptions) and delta-encoded twice within a block: only the
+ * change of per-frame velocity is kept, bit-packed at the smallest width that holds the block's range.
+ * Smooth motion therefore costs a few bits per channel and frame; a one-hour session at 120 Hz of
+ * continuous orbiting stays in the low megabytes. An index of block offsets at the end of the file locates
+ * any frame's block directly, and decoding within a block is bounded by @c frames_per_block, so access cost
+ * does not grow with the file. The reader memory-maps the file where supported.
+ *
+ * @par Precision
+ * Decoded values are within half a quantization step of the written ones. Non-finite values, and values too
+ * large for the step, are stored as raw doubles for that block.
+ */
+
+#include "vertexnova/interaction/export.h"
+#include "vertexnova/interaction/interaction_types.h"
+
+#include <vertexnova/math/core/core.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vne::interaction {
+
+/** Columns of a trajectory file; values are part of the file format. */
+enum class TrajectoryChannel : std::uint8_t {
+    eTime = 0,       //!< Seconds since the start of the trajectory
+    ePositionX = 1,  //!< Eye position
+    ePositionY = 2,
+    ePositionZ = 3,
+    eOrientationX = 4,  //!< Camera-to-world quaternion (hemisphere kept continuous frame to frame)
+    eOrientationY = 5,
+    eOrientationZ = 6,
+    eOrientationW = 7,
+    eCenterX = 8,  //!< Center of interest (look-at target)
+    eCenterY = 9,
+    eCenterZ = 10,
+    eDistance = 11,  //!< Eye to center-of-interest distance
+    eFovDeg = 12,    //!< Vertical FOV in degrees (0 for orthographic cameras)
+    eCount = 13,
+};
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)   // dll-interface for member type from another lib
+#pragma warning(disable : 26495)  // uninitialized member (ctor initializes all)
+#endif
+
+/** One decoded trajectory sample. */
+struct VNE_INTERACTION_API CameraTrajectoryFrame {
+    double time_s = 0.0;           //!< Seconds since the start of the trajectory
+    vne::math::Vec3f position;     //!< Eye position in world space
+    vne::math::Quatf orientation;  //!< Camera-to-world rotation (forward = -Z)
+    vne::math::Vec3f center;       //!< Center of interest in world space
+    float distance = 0.0f;         //!< |center - position|
+    float fov_deg = 0.0f;          //!< Vertical FOV in degrees (0 for orthographic cameras)
+
+    CameraTrajectoryFrame() noexcept
+        : position(0.0f, 0.0f, 0.0f)
+        , orientation(0.0f, 0.0f, 0.0f, 1.0f)
+        , center(0.0f, 0.0f, -1.0f) {}
+
+    /** Frame for @p pose at @p time_s (distance derived from position and target). */
+    [[nodiscard]] static CameraTrajectoryFrame fromPose(double time_s, const CameraPoseSnapshot& pose) noexcept;
+};
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+/** Quantization steps and block size; stored in the file header. */
+struct CameraTrajectoryOptions {
+    std::uint32_t frames_per_block = 256;  //!< Frames per block (clamped to [16, 65536])
+    double time_step_s = 1e-5;             //!< Timestamp quantization step in seconds
+    double position_step = 1e-4;           //!< Position / center / distance step in world units
+    double orientation_step = 1e-5;        //!< Quaternion component step
+    double fov_step_deg = 1e-3;            //!< FOV step in degrees
+};
+
+/**
+ * @brief Appends camera frames to a trajectory file.
+ *
+ * Frames are buffered for one block; completed blocks are handed to a background writer thread, so
+ * @ref append never waits on file I/O.
+ *
+ * @threadsafe Not thread-safe. Call all methods from one thread.
+ */
+class VNE_INTERACTION_API CameraTrajectoryWriter {
+   public:
+    CameraTrajectoryWriter() noexcept;
+    ~CameraTrajectoryWriter();
+
+    CameraTrajectoryWriter(const CameraTrajectoryWriter&) = delete;
+    CameraTrajectoryWriter& operator=(const CameraTrajectoryWriter&) = delete;
+    CameraTrajectoryWriter(CameraTrajectoryWriter&&) noexcept;
+    CameraTrajectoryWriter& operator=(CameraTrajectoryWriter&&) noexcept;
+
+    /**
+     * @brief Create (truncate) @p path and write the file header. An open file is closed first.
+     * @return false if the file cannot be opened or an option is not finite and positive
+     */
+    bool open(const std::string& path, const CameraTrajectoryOptions& options = {}) noexcept;
+
+    /** @brief Append one frame. No-op when not open. */
+    void append(const CameraTrajectoryFrame& frame) noexcept;
+
+    /** @brief Append @p pose stamped @p time_s (see @ref CameraTrajectoryFrame::fromPose). */
+    void append(double time_s, const CameraPoseSnapshot& pose) noexcept;
+
+    /** @brief Write the last partial block and the block index, then close the file. */
+    void close() noexcept;
+
+    [[nodiscard]] bool isOpen() const noexcept;
+
+    /** @return Frames appended since @ref open */
+    [[nodiscard]] std::size_t getFrameCount() const noexcept;
+
+    /** @return Bytes produced since @ref open (complete blocks; the index is added by @ref close) */
+    [[nodiscard]] std::uint64_t getEncodedBytes() const noexcept;
+
+    /** @return true if the background writer failed to write part of the file */
+    [[nodiscard]] bool hasWriteError() const noexcept;
+
+   private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/**
+ * @brief Random-access reader for trajectory files.
+ *
+ * @threadsafe Const methods may be called concurrently once @ref open returned.
+ */
+class VNE_INTERACTION_API CameraTrajectoryReader {
+   public:
+    CameraTrajectoryReader() noexcept;
+    ~CameraTrajectoryReader();
+
+    CameraTrajectoryReader(const CameraTrajectoryReader&) = delete;
+    CameraTrajectoryReader& operator=(const CameraTrajectoryReader&) = delete;
+    CameraTrajectoryReader(CameraTrajectoryReader&&) noexcept;
+    CameraTrajectoryReader& operator=(CameraTrajectoryReader&&) noexcept;
+
+    /**
+     * @brief Open (memory-map, or read where mapping is unsupported) a trajectory file.
+     *
+     * A file without its block index (writer not closed) is indexed by scanning its blocks; a torn last
+     * block is ignored.
+     *
+     * @return false if the file is missing or not a trajectory
+     */
+    bool open(const std::string& path) noexcept;
+
+    void close() noexcept;
+
+    [[nodiscard]] bool isOpen() const noexcept;
+    [[nodiscard]] bool isMemoryMapped() const noexcept;
+
+    /** @return Quantization steps and block size the file was written with */
+    [[nodiscard]] const CameraTrajectoryOptions& getOptions() const noexcept;
+
+    [[nodiscard]] std::size_t getFrameCount() const noexcept;
+
+    /**
+     * @brief Decode frame @p index (O(1) in the file length).
+     * @return false if @p index is out of range
+     */
+    bool readFrame(std::size_t index, CameraTrajectoryFrame& out) const noexcept;
+
+    /** @return Channel @p channel of frame @p index, or 0 when out of range */
+    [[nodiscard]] double readValue(std::size_t index, TrajectoryChannel channel) const noexcept;
+
+    /**
+     * @brief Decode @p count consecutive values of one channel into @p out (bulk SoA access).
+     * @return Number of values written (fewer near the end of the file)
+     */
+    std::size_t readColumn(TrajectoryChannel channel, std::size_t first, std::size_t count, double* out) const noexcept;
+
+    /** @return Whole column @p channel */
+    [[nodiscard]] std::vector<double> readColumn(TrajectoryChannel channel) const;
+
+   private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace vne::interaction
@@ -0,0 +1,166 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file clip_plane_manager.h
+ * @brief ClipPlaneManager — fits perspective near / far planes to the visible scene bounds while navigating.
+ *
+ * Orbit distance ranges from centimetres to thousands of kilometres and free-look flies through whole scenes,
+ * so fixed clip planes either cut geometry or waste depth precision. A @ref ClipPlaneManager knows the scene
+ * as a coarse set of bounding spheres, a @ref PickIndex hierarchy, or both, and fits the planes to the part
+ * of it inside the view:
+ *
+ * @code
+ * auto clip = std::make_shared<vne::interaction::ClipPlaneManager>();
+ * clip->setHierarchy(scene_picks);           // shared with the depth query
+ * clip->setSpheres(instance_bounds);         // and / or coarse spheres
+ * rig.setClipPlaneManager(clip);             // refit at the end of every rig.onUpdate
+ * @endcode
+ *
+ * @par Fit
+ * Only bounds that intersect the view pyramid (the four side planes through the eye) count. The far plane is
+ * the deepest of them times (1 + padding), the near plane the closest divided by (1 + padding), but never less
+ * than @ref ClipPlaneManager::setMinNear nor than far / @ref ClipPlaneManager::setMaxDepthRatio — when the eye
+ * is inside the bounds, the ratio limit keeps depth precision instead of pulling near to the minimum.
+ *
+ * @par Hysteresis
+ * The camera is written only when needed: at once when visible bounds would be clipped by the current planes,
+ * otherwise only when the fitted planes are tighter than the current ones by more than the hysteresis factor.
+ * Slow navigation therefore changes the projection matrix in occasional steps, not every frame. When neither
+ * the camera (eye, orientation, field of view, aspect) nor the bounds changed, the fit is skipped entirely.
+ * When no bounds are visible the planes are left alone.
+ *
+ * Orthographic cameras are not managed (their depth precision does not depend on the near plane).
+ */
+
+#include "vertexnova/interaction/export.h"
+#include "vertexnova/interaction/pick_index.h"
+
+#include <vertexnova/math/core/core.h>
+#include <vertexnova/scene/camera/camera.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace vne::interaction {
+
+/**
+ * @brief World-space bounding sphere for @ref ClipPlaneManager::setSpheres.
+ */
+struct VNE_INTERACTION_API ClipSphere {
+    vne::math::Vec3f center{0.0f, 0.0f, 0.0f};
+    float radius = 0.0f;  //!< Negative or non-finite: ignored
+};
+
+/**
+ * @brief Fits a perspective camera's near / far planes to visible scene bounds, with hysteresis.
+ *
+ * @threadsafe Not thread-safe. The attached @ref PickIndex must not be rebuilt or updated during @ref update.
+ */
+class VNE_INTERACTION_API ClipPlaneManager {
+   public:
+    static constexpr float kDefaultMinNear = 0.01f;
+    static constexpr float kDefaultMaxDepthRatio = 1e5f;
+    static constexpr float kDefaultPadding = 0.05f;
+    static constexpr float kDefaultHysteresis = 0.25f;
+
+    ClipPlaneManager() = default;
+
+    // -------------------------------------------------------------------------
+    // Scene bounds
+    // -------------------------------------------------------------------------
+
+    /** Replace the coarse sphere set (copied). */
+    void setSpheres(std::span<const ClipSphere> spheres);
+
+    /** Move sphere @p index (out of range: ignored). */
+    void updateSphere(std::size_t index, const ClipSphere& sphere) noexcept;
+
+    [[nodiscard]] std::span<const ClipSphere> getSpheres() const noexcept { return spheres_; }
+
+    /** Use the primitives of @p index as bounds as well (nullptr = none). Its updates are picked up. */
+    void setHierarchy(std::shared_ptr<const PickIndex> index) noexcept;
+    [[nodiscard]] const std::shared_ptr<const PickIndex>& getHierarchy() const noexcept { return hierarchy_; }
+
+    // -------------------------------------------------------------------------
+    // Tuning
+    // -------------------------------------------------------------------------
+
+    /** Smallest near plane ever written. Default: @ref kDefaultMinNear. */
+    void setMinNear(float min_near) noexcept;
+    [[nodiscard]] float getMinNear() const noexcept { return min_near_; }
+
+    /** Largest far / near ratio written; raises the near plane when the eye is inside the bounds. */
+    void setMaxDepthRatio(float ratio) noexcept;
+    [[nodiscard]] float getMaxDepthRatio() const noexcept { return max_depth_ratio_; }
+
+    /** Relative margin added around the fitted depth range. Default: @ref kDefaultPadding. */
+    void setPadding(float padding) noexcept;
+    [[nodiscard]] float getPadding() const noexcept { return padding_; }
+
+    /** Relative tightening needed before loose planes are rewritten. Default: @ref kDefaultHysteresis. */
+    void setHysteresis(float hysteresis) noexcept;
+    [[nodiscard]] float getHysteresis() const noexcept { return hysteresis_; }
+
+    // -------------------------------------------------------------------------
+    // Fitting
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Fit the planes of @p camera if it is perspective; call once per frame after navigation.
+     * @param update_matrices Call @c updateMatrices after changing the planes (false when matrix updates are
+     *                        deferred)
+     * @return true when the near or far plane was changed
+     */
+    bool update(vne::scene::ICamera& camera, bool update_matrices = true) noexcept;
+
+    /**
+     * @brief Padded, clamped near / far planes for the current view, without hysteresis and without writing.
+     * @return false when the camera is not perspective or no bounds are visible
+     */
+    bool computePlanes(const vne::scene::ICamera& camera, float& near_plane, float& far_plane) const noexcept;
+
+    /** Make the next @ref update refit even if nothing it tracks changed. */
+    void invalidate() noexcept { cache_valid_ = false; }
+
+    /** @return Number of times @ref update changed the camera's planes */
+    [[nodiscard]] std::uint64_t getPlaneChangeCount() const noexcept { return plane_changes_; }
+
+   private:
+    std::vector<ClipSphere> spheres_;
+    std::shared_ptr<const PickIndex> hierarchy_;
+
+    float min_near_ = kDefaultMinNear;
+    float max_depth_ratio_ = kDefaultMaxDepthRatio;
+    float padding_ = kDefaultPadding;
+    float hysteresis_ = kDefaultHysteresis;
+
+    // Inputs of the last fit, to skip unchanged frames
+    bool cache_valid_ = false;
+    vne::math::Vec3f cached_eye_{0.0f, 0.0f, 0.0f};
+    vne::math::Quatf cached_orientation_;
+    float cached_fov_deg_ = 0.0f;
+    float cached_aspect_ = 0.0f;
+    float cached_near_ = 0.0f;  //!< Camera planes after the last fit; a host edit triggers a refit
+    float cached_far_ = 0.0f;
+    std::uint64_t cached_hierarchy_revision_ = 0;
+    std::uint64_t spheres_revision_ = 0;
+    std::uint64_t cached_spheres_revision_ = 0;
+    const vne::scene::ICamera* cached_camera_ = nullptr;
+
+    std::uint64_t plane_changes_ = 0;
+};
+
+}  // namespace vne::interaction
@@ -0,0 +1,123 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file controller_group.h
+ * @brief ControllerGroup — runs @c onUpdate of many independent controllers in parallel.
+ *
+ * For processes that drive many viewports (video walls, multi-view layouts), each with its own
+ * controller and camera. Events are still fed to each controller directly; once per frame
+ * @ref ControllerGroup::onUpdate advances all of them (inertia, animation, free-look motion) at once:
+ *
+ * @code
+ * vne::interaction::ControllerGroup group;  // one worker per extra core
+ * for (auto& view : views) {
+ *     group.add(view.controller);
+ * }
+ * // per frame: route events to view.controller->onEvent(...), then
+ * group.onUpdate(dt);
+ * @endcode
+ *
+ * @par Threading and determinism
+ * Each controller's @c onUpdate runs on exactly one thread per call, and @ref ControllerGroup::onUpdate
+ * returns only after every controller has finished, so between calls the caller may use the controllers
+ * freely. A controller only reads and writes its own state and camera, so the results are identical to
+ * calling @c onUpdate serially, whatever the thread count or schedule. Controllers in one group must
+ * therefore not share a camera (or any other mutable object).
+ *
+ * @par Executors
+ * By default the group runs on a small built-in work-stealing pool: the controllers are split into one
+ * contiguous slice per thread (the calling thread included), and a thread that finishes its slice takes
+ * controllers from the others. Applications with their own job system can install a
+ * @ref ControllerExecutor instead; no threads are then started.
+ */
+
+#include "vertexnova/interaction/export.h"
+#include "vertexnova/interaction/camera_controller.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace vne::interaction {
+
+/**
+ * @brief Runs a parallel-for on the caller's job system.
+ *
+ * Must call @p task(i) exactly once for every i in [0, @p count), from any threads, and return only after
+ * all calls have finished. @p task must not be called concurrently with itself for the same i.
+ */
+using ControllerExecutor =
+    std::function<void(std::size_t count, const std::function<void(std::size_t)>& task)>;
+
+/**
+ * @brief Set of controllers advanced together by a parallel @ref onUpdate.
+ *
+ * @threadsafe Not thread-safe: call all methods from one thread (typically the frame loop).
+ */
+class VNE_INTERACTION_API ControllerGroup {
+   public:
+    /** @return Default worker count: hardware threads minus one (the caller also works), at least 0 */
+    [[nodiscard]] static std::size_t defaultWorkerThreads() noexcept;
+
+    /**
+     * @param worker_threads Threads of the built-in pool, in addition to the calling thread; 0 runs
+     *                       every update on the caller. The pool is started on the first parallel update.
+     */
+    explicit ControllerGroup(std::size_t worker_threads = defaultWorkerThreads());
+    ~ControllerGroup();
+
+    ControllerGroup(const ControllerGroup&) = delete;
+    ControllerGroup& operator=(const ControllerGroup&) = delete;
+    ControllerGroup(ControllerGroup&&) noexcept;
+    ControllerGroup& operator=(ControllerGroup&&) noexcept;
+
+    // -------------------------------------------------------------------------
+    // Members
+    // -------------------------------------------------------------------------
+
+    /** Append @p controller; null or already-present controllers are ignored. @return Its index */
+    std::size_t add(std::shared_ptr<ICameraController> controller);
+
+    /** Remove the controller at @p index; later controllers shift down. @return The removed controller */
+    std::shared_ptr<ICameraController> removeAt(std::size_t index) noexcept;
+
+    /** Remove @p controller if present. @return true if it was a member */
+    bool remove(const ICameraController* controller) noexcept;
+
+    void clear() noexcept;
+
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /** @return Controller at @p index, or null when out of range */
+    [[nodiscard]] const std::shared_ptr<ICameraController>& controller(std::size_t index) const noexcept;
+
+    // -------------------------------------------------------------------------
+    // Execution
+    // -------------------------------------------------------------------------
+
+    /** Run updates through @p executor; an empty executor restores the built-in pool. */
+    void setExecutor(ControllerExecutor executor);
+
+    /** @return Threads of the built-in pool (configured count, whether or not started yet) */
+    [[nodiscard]] std::size_t workerThreads() const noexcept;
+
+    /** Call @c onUpdate(@p delta_time) on every controller in parallel; returns when all have finished. */
+    void onUpdate(double delta_time) noexcept;
+
+   private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace vne::interaction
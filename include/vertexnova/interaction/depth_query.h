@@ -0,0 +1,94 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file depth_query.h
+ * @brief IDepthQuery — host-implemented, non-blocking lookup of the surface under the cursor.
+ *
+ * Manipulators only know the camera pose, not the scene. With an @ref IDepthQuery attached
+ * (@ref TrackballManipulator::setDepthQuery), double-click pivot (@c eSetPivotAtCursor) and perspective dolly
+ * zoom (@c eZoomAtCursor with @c ZoomMethod::eDollyToCoi) target the surface point under the cursor instead
+ * of a point at orbit distance.
+ *
+ * @par Asynchronous results
+ * @ref IDepthQuery::requestDepth must return at once. A typical implementation records the pixel, copies the
+ * depth buffer to a readback buffer at the end of the frame and reports the result a frame or two later; the
+ * manipulator polls pending requests from @c onAction and @c onUpdate and keeps its current behavior until a
+ * result arrives, so input handling never waits for the GPU. Implementations that can answer immediately
+ * (a CPU pick structure, see @ref DepthRequest::ray_origin) return the result from the first poll, which
+ * follows the request in the same call.
+ *
+ * @par Contract
+ *   - A request id is polled until it reports @ref DepthQueryStatus::eHit or @ref DepthQueryStatus::eMiss, or
+ *     until @ref IDepthQuery::cancelDepth is called for it; it is not used again afterwards.
+ *   - The hit point is in world space. Unproject GPU depth with the view-projection matrix of the frame the
+ *     depth was read from, not the camera's current one: the camera may have moved since the request.
+ *   - All calls come from the thread driving the manipulator.
+ */
+
+#include "vertexnova/interaction/export.h"
+
+#include <vertexnova/math/core/core.h>
+
+#include <cstdint>
+
+namespace vne::interaction {
+
+/**
+ * @brief Result state of a depth request.
+ */
+enum class DepthQueryStatus : std::uint8_t {
+    ePending = 0,  //!< Not available yet; poll again later
+    eHit = 1,      //!< A surface was found; the world point was written
+    eMiss = 2,     //!< Nothing under the cursor (background) or the lookup failed
+};
+
+/**
+ * @brief One depth lookup: the cursor pixel and the matching world-space ray.
+ *
+ * The ray is built from the manipulator's pose when the request is issued, so hosts without a depth buffer
+ * can answer with a ray cast instead of a readback.
+ */
+struct VNE_INTERACTION_API DepthRequest {
+    float x_px = 0.0f;                                  //!< Cursor X in viewport pixels (top-left origin)
+    float y_px = 0.0f;                                  //!< Cursor Y in viewport pixels (top-left origin)
+    vne::math::Vec3f ray_origin{0.0f, 0.0f, 0.0f};      //!< World-space ray start (eye, or near plane for ortho)
+    vne::math::Vec3f ray_direction{0.0f, 0.0f, -1.0f};  //!< Unit world-space ray direction
+};
+
+/**
+ * @brief Host-side surface lookup used by manipulators for cursor-anchored pivot and zoom.
+ */
+class VNE_INTERACTION_API IDepthQuery {
+   public:
+    using RequestId = std::uint64_t;
+    static constexpr RequestId kNoRequest = 0;  //!< Returned when no lookup could be started
+
+    virtual ~IDepthQuery() = default;
+
+    /**
+     * @brief Start a lookup under the cursor. Must not block.
+     * @return Non-zero id to poll, or @ref kNoRequest to make the manipulator fall back right away
+     */
+    virtual RequestId requestDepth(const DepthRequest& request) noexcept = 0;
+
+    /**
+     * @brief Report the state of request @p id.
+     * @param world_point Receives the surface point when the result is @ref DepthQueryStatus::eHit
+     */
+    virtual DepthQueryStatus pollDepth(RequestId id, vne::math::Vec3f& world_point) noexcept = 0;
+
+    /** The manipulator no longer needs request @p id (superseded or state reset). Default: no-op. */
+    virtual void cancelDepth(RequestId id) noexcept { (void)id; }
+};
+
+}  // namespace vne::interaction
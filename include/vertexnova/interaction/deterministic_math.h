@@ -0,0 +1,51 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file deterministic_math.h
+ * @brief Deterministic-math switch for bit-reproducible camera interaction across machines.
+ *
+ * @par What changes
+ * With deterministic math on, the transcendental functions on interaction paths (inertia decay, velocity
+ * smoothing, wheel / pinch zoom factors, axis-angle rotations, spline knot spacing, yaw / pitch and angle
+ * read-back, view-extent tangents, quaternion slerp) use the library's own implementations built only from
+ * IEEE-754 add, multiply, divide and square root in a fixed order, and quaternion renormalization uses a
+ * fixed-order sum. Results then no longer depend on the platform libm.
+ *
+ * @par Build mode
+ * Configure with @c -DVNE_INTERACTION_DETERMINISTIC=ON to turn the mode on by default and compile the library
+ * with floating-point contraction and fast-math disabled (@c -ffp-contract=off / @c /fp:precise), which is
+ * required for identical results across compilers. The quaternion, lookAt and normalize code of vne::math and
+ * vne::scene is on the same path: their in-tree builds get the same flags, and prebuilt copies must have been
+ * built without contraction too. 32-bit x86 builds must use SSE2 arithmetic (no x87). Without this build mode,
+ * the runtime switch makes results independent of libm but not of how the compiler contracts arithmetic.
+ *
+ * @par Runtime mode
+ * @ref setDeterministicMath switches the implementations at runtime (e.g. on for replay, off for live use).
+ * The flag is process-wide; flip it while no interaction is in flight.
+ */
+
+#include "vertexnova/interaction/export.h"
+
+namespace vne::interaction {
+
+/**
+ * @brief Use portable, bit-reproducible math on interaction paths.
+ * @param enabled true = portable implementations; false = platform libm (default unless built with
+ *                @c VNE_INTERACTION_DETERMINISTIC)
+ */
+VNE_INTERACTION_API void setDeterministicMath(bool enabled) noexcept;
+
+/** @return true when interaction paths use the portable math implementations. */
+[[nodiscard]] VNE_INTERACTION_API bool isDeterministicMath() noexcept;
+
+}  // namespace vne::interaction
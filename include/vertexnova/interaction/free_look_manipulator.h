@@ -26,8 +26,15 @@
  * @par Zoom
  * Zoom is dispatched through @ref CameraManipulatorBase and can be disabled per-instance
  * with @ref setHandleZoom when another manipulator should own scroll/pinch in a shared rig.
+ *
+ * @par Latency compensation
+ * With @ref setLatencyCompensation > 0, mouse look writes an orientation that leads the true look pose by
+ * the estimated angular velocity × lead time (clamped by @ref setLatencyCompensationMaxAngle; FPS pitch limits
+ * still apply). The stored orientation is never extrapolated; after @c eEndLook, @ref onUpdate blends the lead
+ * out over about 0.1 s instead of snapping back, and a look that starts mid-blend adopts the displayed pose.
  */
 
+#include "vertexnova/interaction/bounds_reduction.h"
 #include "vertexnova/interaction/camera_manipulator_base.h"
 #include "vertexnova/interaction/interaction_types.h"
 
@@ -37,7 +44,11 @@
 #include <vertexnova/math/core/core.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <span>
+#include <vector>
 
 namespace vne::scene {
 class ICamera;
@@ -97,6 +108,15 @@ class VNE_INTERACTION_API FreeLookManipulator final : public CameraManipulatorBa
     /** Reset all input state (keys, looking flag) and re-sync orientation from the camera if attached. */
     void resetState() noexcept override;
 
+    /** Adopt a handed-off orientation without re-reading the camera; clears look-drag state. */
+    void onHandoff(const CameraPoseSnapshot& pose) noexcept override;
+
+    /** @brief Look rate while dragging and the WASD speed while keys are held (no inertia: settles at once). */
+    [[nodiscard]] CameraMotionState getMotionState() const noexcept override;
+
+    /** @brief Look rate continued about the eye while dragging, held WASD keys moving along the current axes. */
+    [[nodiscard]] CameraPoseSnapshot predictPose(double seconds_ahead) const noexcept override;
+
     // isEnabled / setEnabled inherited from CameraManipulatorBase
 
     // -------------------------------------------------------------------------
@@ -142,6 +162,17 @@ class VNE_INTERACTION_API FreeLookManipulator final : public CameraManipulatorBa
     [[nodiscard]] vne::math::Quatf getOrientation() const noexcept;
     void setOrientation(const vne::math::Quatf& q) noexcept;
 
+    /**
+     * @brief Display lead for mouse look in seconds (0 = off, default). Clamped to [0, 0.1].
+     * Needs per-action @c delta_time from the input path to estimate look velocity.
+     */
+    void setLatencyCompensation(float lead_time_s) noexcept;
+    [[nodiscard]] float getLatencyCompensation() const noexcept { return latency_lead_s_; }
+
+    /** Confidence clamp: largest extrapolated look rotation in degrees (default 8). Clamped to [0, 45]. */
+    void setLatencyCompensationMaxAngle(float degrees) noexcept;
+    [[nodiscard]] float getLatencyCompensationMaxAngle() const noexcept { return latency_max_angle_deg_; }
+
     /** Set movement speed in world units per second (default: 3.0). */
     void setMoveSpeed(float speed) noexcept { move_speed_ = std::max(0.0f, speed); }
     [[nodiscard]] float getMoveSpeed() const noexcept { return move_speed_; }
@@ -187,9 +218,51 @@ class VNE_INTERACTION_API FreeLookManipulator final : public CameraManipulatorBa
      */
     void fitToAABB(const vne::math::Vec3f& min_world, const vne::math::Vec3f& max_world) noexcept;
 
+    /**
+     * @brief Fit camera to a point set (point cloud, mesh vertices) keeping the view direction.
+     *
+     * The bounds are reduced in parallel (see bounds_reduction.h). @c FitBoundsMode::eBoundingSphere frames the
+     * tightest sphere about the bounds center; @c FitBoundsMode::eViewExtents frames the extents seen in the
+     * current view orientation, which is tighter for elongated sets. @c FitBoundsMode::eFrustum moves to the
+     * closest distance at which every point is inside the perspective view (orthographic: view extents).
+     * Empty or all-NaN input is ignored.
+     * @param executor Runs the reduction tasks on the host's job system (empty: shared pool)
+     */
+    void fitToPoints(std::span<const vne::math::Vec3f> points,
+                     FitBoundsMode mode = FitBoundsMode::eBoundingSphere,
+                     const ControllerExecutor& executor = {}) noexcept;
+
+    /** @brief As @ref fitToPoints, over a set of boxes (e.g. per-object bounds); invalid boxes are skipped. */
+    void fitToBoxes(std::span<const BoundingBox> boxes,
+                    FitBoundsMode mode = FitBoundsMode::eBoundingSphere,
+                    const ControllerExecutor& executor = {}) noexcept;
+
     /** Mark orientation as stale (e.g. external camera move). Next @ref ensureAnglesSynced re-reads the camera. */
     void markAnglesDirty() noexcept { orientation_dirty_ = true; }
 
+    // -------------------------------------------------------------------------
+    // State serialization
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Encode settings (mode, rotation / projection mode, speeds, multipliers, zoom handling,
+     * latency compensation, world up) and the camera pose into a compact versioned blob.
+     *
+     * Little-endian on every host; the pose is omitted when no camera is attached.
+     */
+    [[nodiscard]] std::vector<std::uint8_t> serialize() const;
+
+    /**
+     * @brief Restore a blob written by @ref serialize.
+     *
+     * Fields are assigned directly; the stored pose (and scene scale) reaches the attached camera in a
+     * single apply. In-flight gestures are dropped.
+     *
+     * @return false, leaving the manipulator unchanged, if the blob is truncated, corrupt, of another
+     *         kind or from a newer format version
+     */
+    bool deserialize(const std::uint8_t* data, std::size_t size) noexcept;
+
    private:
     // ---- up-vector policy (FPS vs Fly) --------------------------------------
     [[nodiscard]] vne::math::Vec3f upVector() const noexcept;
@@ -219,7 +292,28 @@ class VNE_INTERACTION_API FreeLookManipulator final : public CameraManipulatorBa
     void applyOrientationToCamera() noexcept;
     void yawPitchFromOrientation(float& yaw_deg_out, float& pitch_deg_out) const noexcept;
     void clampFpsPitch() noexcept;
+    /** Clamp @p q to the FPS pitch range (no-op in fly mode). */
+    void clampFpsPitch(vne::math::Quatf& q) const noexcept;
+    /** World velocity of the held WASD / up / down keys (speed modifiers and scene scale applied). */
+    [[nodiscard]] vne::math::Vec3f moveVelocity() const noexcept;
+    /** Update look velocity from the latest sample and write the led orientation to the camera. */
+    void applyLookWithLatencyLead(double delta_time) noexcept;
+    /** Write orientation_ with the current lead applied to the camera. */
+    void showLatencyLead() noexcept;
+    /** Decay a lead released on eEndLook by @p delta_time; drops it once negligible. */
+    void settleLatencyLead(double delta_time) noexcept;
+    /** Forget the lead without touching the camera. */
+    void clearLatencyLead() noexcept;
+    /** Drop any look lead and write the true orientation back to the camera. */
+    void dropLatencyLead() noexcept;
     void applyDolly(float factor, float mx, float my) noexcept override;
+    /** Shared body of fitToPoints / fitToBoxes (defined and instantiated in the .cpp). */
+    template <typename T>
+    void fitToSet(std::span<const T> items, FitBoundsMode mode, const ControllerExecutor& executor) noexcept;
+    /** Back away along the view direction until @p volume fits (fitToPoints / fitToBoxes). */
+    void fitToVolume(const FitVolume& volume) noexcept;
+    /** Place the eye at @p eye looking at @p center (fit tail; keeps the FPS / fly up vector). */
+    void lookFrom(const vne::math::Vec3f& eye, const vne::math::Vec3f& center) noexcept;
 
     // perspCamera() / orthoCamera() inherited from CameraManipulatorBase
 
@@ -245,6 +339,15 @@ class VNE_INTERACTION_API FreeLookManipulator final : public CameraManipulatorBa
     bool handle_zoom_ = true;
     bool orientation_dirty_ = true;
 
+    // Latency compensation (display-only lead; orientation_ stays the true look pose)
+    float latency_lead_s_ = 0.0f;
+    float latency_max_angle_deg_ = 8.0f;
+    vne::math::Quatf latency_prev_rot_{0.0f, 0.0f, 0.0f, 1.0f};
+    vne::math::Vec3f latency_rot_velocity_{0.0f, 0.0f, 0.0f};
+    vne::math::Vec3f latency_rot_lead_{0.0f, 0.0f, 0.0f};  //!< Display lead (rotation vector, world axis)
+    bool latency_lead_active_ = false;
+    bool latency_lead_releasing_ = false;  //!< Released: onUpdate blends the lead out
+
     FreeLookInputState input_state_;
 };
 
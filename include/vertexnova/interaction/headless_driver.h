@@ -0,0 +1,199 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file headless_driver.h
+ * @brief CameraScript and HeadlessDriver — scripted controller runs without a window, at full speed.
+ *
+ * For offline dataset generation and soak tests: a @ref CameraScript lists gesture primitives (drags,
+ * scrolls, key holds, fits, idle frames), and @ref HeadlessDriver plays it into a controller in a tight
+ * loop, recording the camera pose after every simulated frame to a buffer and / or a trajectory file.
+ *
+ * @code
+ * vne::interaction::CameraScript script;
+ * script.fit(mn, mx).idle(60).drag(vne::events::MouseButton::eLeft, 640, 360, 300, 0, 30).idle(120);
+ *
+ * std::vector<vne::interaction::HeadlessJob> jobs(seeds.size());
+ * for (std::size_t i = 0; i < jobs.size(); ++i) {
+ *     jobs[i].controller = std::make_shared<vne::interaction::Inspect3DController>();
+ *     jobs[i].script = script;  // camera left null: the driver supplies one
+ *     jobs[i].trajectory_path = "run_" + std::to_string(i) + ".vnetraj";
+ * }
+ * vne::interaction::HeadlessDriver driver;  // one worker per extra core
+ * driver.runAll(jobs);
+ * @endcode
+ *
+ * @par Frames
+ * Every frame-consuming step calls @c onUpdate(timestep) once per frame after that frame's events, then
+ * records the pose, so a script yields exactly @ref CameraScript::frameCount poses whatever the controller.
+ * Frame @p i is stamped @c (i + 1) * timestep. Events carry the timestep as their @c delta_time, like a
+ * window loop running at that rate.
+ *
+ * @par Cameras
+ * A job without a camera gets a default one when it runs: orthographic for @ref Ortho2DController, perspective
+ * otherwise, 5 units from the origin and looking at it, with the job's viewport aspect. Controllers read
+ * projection parameters (FOV, ortho extent) for zoom and fit, so this is an ordinary scene camera rather than a
+ * bare pose holder; with deferred matrices (below) it costs no more than one. Scripts usually start with a
+ * @ref CameraScript::fit or a @c call step that places it.
+ *
+ * @par Matrices
+ * Recording needs only poses, so by default a run sets @ref ICameraController::setMatrixUpdatesDeferred and the
+ * camera's view / projection matrices are rebuilt once at the end instead of after every write. Clear
+ * @ref HeadlessJob::defer_matrices for @c call steps that read camera matrices mid-run.
+ *
+ * @par Parallel runs
+ * @ref HeadlessDriver::runAll plays independent jobs concurrently on the same work-stealing pool as
+ * @ref ControllerGroup (or a caller @ref ControllerExecutor). Each job runs start to finish on one thread,
+ * so its output is identical to a serial run; jobs must not share controllers, cameras or files.
+ */
+
+#include "vertexnova/interaction/export.h"
+#include "vertexnova/interaction/camera_controller.h"
+#include "vertexnova/interaction/camera_trajectory.h"
+#include "vertexnova/interaction/controller_group.h"
+
+#include <vertexnova/events/types.h>
+#include <vertexnova/math/core/core.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vne::scene {
+class ICamera;
+}
+
+namespace vne::interaction {
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)  // dll-interface for std members
+#endif
+
+/**
+ * @brief Ordered list of simulated input gestures, built with chained calls.
+ *
+ * Pointer coordinates are viewport pixels. Copyable; one script may be shared by many jobs.
+ */
+class VNE_INTERACTION_API CameraScript {
+   public:
+    /** Call @c onResize(@p width_px, @p height_px). No frames. */
+    CameraScript& resize(float width_px, float height_px);
+
+    /**
+     * @brief Press @p button at (@p x, @p y), move by (@p dx, @p dy) spread evenly over @p frames frames,
+     * then release. @p frames frames.
+     */
+    CameraScript& drag(vne::events::MouseButton button, float x, float y, float dx, float dy, int frames);
+
+    /** Move the cursor to (@p x, @p y), then scroll @p amount once per frame. @p count frames. */
+    CameraScript& scroll(float x, float y, float amount, int count = 1);
+
+    /** Press @p key, run @p frames frames, release. */
+    CameraScript& keyHold(vne::events::KeyCode key, int frames);
+
+    /**
+     * @brief Call @c fitToAABB on an Inspect3D, Navigation3D or Ortho2D controller (ignored for others).
+     * No frames; follow with @ref idle to let an animated fit finish.
+     */
+    CameraScript& fit(const vne::math::Vec3f& min_world, const vne::math::Vec3f& max_world);
+
+    /** Run @p frames frames without input (inertia, animations). */
+    CameraScript& idle(int frames);
+
+    /** Call @p fn on the controller (any setting or custom event sequence). No frames. */
+    CameraScript& call(std::function<void(ICameraController&)> fn);
+
+    /** @return Frames (and so recorded poses) one run of the script produces */
+    [[nodiscard]] std::size_t frameCount() const noexcept;
+
+    [[nodiscard]] bool empty() const noexcept { return steps_.empty(); }
+    void clear() noexcept { steps_.clear(); }
+
+   private:
+    friend class HeadlessDriver;
+
+    enum class StepKind { eResize, eDrag, eScroll, eKeyHold, eFit, eIdle, eCall };
+
+    struct Step {
+        StepKind kind = StepKind::eIdle;
+        int frames = 0;
+        int code = 0;  //!< Mouse button or key code
+        float v[6] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+        std::function<void(ICameraController&)> fn;
+    };
+
+    std::vector<Step> steps_;
+};
+
+/**
+ * @brief One scripted run: controller, camera, script and outputs.
+ */
+struct VNE_INTERACTION_API HeadlessJob {
+    std::shared_ptr<ICameraController> controller;  //!< Driven controller (required)
+    std::shared_ptr<vne::scene::ICamera> camera;    //!< Attached with @c setCamera; null: the run creates one
+    CameraScript script;
+    float viewport_width = 1280.0f;  //!< Passed to @c onResize before the script runs
+    float viewport_height = 720.0f;
+
+    bool keep_frames = true;                    //!< Fill @ref frames with one entry per simulated frame
+    bool defer_matrices = true;                 //!< Skip camera matrix rebuilds during the run (pose only)
+    std::string trajectory_path;                //!< When non-empty, also write a trajectory file here
+    CameraTrajectoryOptions trajectory_options;
+
+    std::vector<CameraTrajectoryFrame> frames;  //!< Output: recorded poses (cleared at the start of a run)
+    bool succeeded = false;                     //!< Output: inputs valid and trajectory (if any) fully written
+};
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+/**
+ * @brief Plays CameraScripts into controllers, one job or many in parallel.
+ *
+ * @threadsafe Not thread-safe: call from one thread at a time.
+ */
+class VNE_INTERACTION_API HeadlessDriver {
+   public:
+    static constexpr double kDefaultTimestep = 1.0 / 60.0;
+
+    /** @param worker_threads Pool threads besides the caller for @ref runAll (0: serial) */
+    explicit HeadlessDriver(std::size_t worker_threads = ControllerGroup::defaultWorkerThreads());
+    ~HeadlessDriver();
+
+    HeadlessDriver(const HeadlessDriver&) = delete;
+    HeadlessDriver& operator=(const HeadlessDriver&) = delete;
+    HeadlessDriver(HeadlessDriver&&) noexcept;
+    HeadlessDriver& operator=(HeadlessDriver&&) noexcept;
+
+    /** Simulated seconds per frame (must be finite and positive; default 1/60). */
+    void setTimestep(double seconds) noexcept;
+    [[nodiscard]] double getTimestep() const noexcept;
+
+    /** Run @ref runAll through @p executor; an empty executor restores the built-in pool. */
+    void setExecutor(ControllerExecutor executor);
+
+    /** Play @p job's script to the end on the calling thread. @return job.succeeded */
+    bool run(HeadlessJob& job) const noexcept;
+
+    /** Play all @p jobs, concurrently. @return Number of jobs that succeeded */
+    std::size_t runAll(std::vector<HeadlessJob>& jobs) noexcept;
+
+   private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace vne::interaction
@@ -31,7 +31,8 @@
  *   Use `setRotationEnabled(false)` to disable LMB orbit.
  * - LMB drag = rotate (when rotation enabled), RMB/MMB drag = pan, scroll = zoom
  * - Double-click LMB = move pivot to current center-of-interest along the view direction (auto-pivot; **on** by
- *   default, independent of rotation). Does not use the double-click screen position; see `eSetPivotAtCursor`.
+ *   default, independent of rotation). The double-click screen position is only used with @ref setDepthQuery,
+ *   which moves the pivot to the surface under it; see `eSetPivotAtCursor`.
  * - Pivot mode: eCoi (pivot at the center-of-interest; follows panning)
  *
  * ### Medical / CAD anchor
@@ -65,13 +66,17 @@
 #include "vertexnova/interaction/export.h"
 #include "vertexnova/interaction/interaction_types.h"
 #include "vertexnova/interaction/camera_controller.h"
+#include "vertexnova/interaction/camera_history.h"
 #include "vertexnova/interaction/camera_rig.h"
 #include "vertexnova/interaction/trackball_manipulator.h"
 
 #include <vertexnova/events/types.h>
 #include <vertexnova/math/core/core.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace vne::events {
 class Event;
@@ -123,6 +128,29 @@ class VNE_INTERACTION_API Inspect3DController : public ICameraController {
     /** Advance inertia and fit animation by delta_time seconds. */
     void onUpdate(double delta_time) noexcept override;
 
+    /** Ease the camera from @p from into this controller's pose (see @ref ICameraController::beginTransition). */
+    void beginTransition(const CameraPoseSnapshot& from, float duration_s) noexcept override;
+
+    /** Fixed-step simulation with interpolated output (see @ref CameraRig::setFixedTimestep). */
+    void setFixedTimestep(double step_s) noexcept override;
+
+    /** Skip camera matrix rebuilds after pose writes (see @ref CameraRig::setMatrixUpdatesDeferred). */
+    void setMatrixUpdatesDeferred(bool deferred) noexcept override;
+
+    /** Motion state of the rig, for adaptive render quality (see @ref CameraRig::getMotionState). */
+    [[nodiscard]] CameraMotionState getMotionState() const noexcept override;
+
+    /** Predicted poses of the rig, for streaming prefetch (see @ref CameraRig::predictPose). */
+    [[nodiscard]] CameraPoseSnapshot predictPose(double seconds_ahead) const noexcept override;
+    std::size_t predictPoses(std::span<const double> seconds_ahead,
+                             std::span<CameraPoseSnapshot> out) const noexcept override;
+
+    /**
+     * @brief Keep the camera out of geometry once per frame (see @ref CameraRig::setCameraConstraint).
+     * Null detaches. Orbiting suits @c ConstraintMode::eSpringArm.
+     */
+    void setCameraConstraint(std::shared_ptr<CameraConstraint> constraint) noexcept;
+
     // -------------------------------------------------------------------------
     // Pivot / anchor
     // -------------------------------------------------------------------------
@@ -143,6 +171,12 @@ class VNE_INTERACTION_API Inspect3DController : public ICameraController {
     void setPivotMode(OrbitPivotMode mode) noexcept;
     [[nodiscard]] OrbitPivotMode getPivotMode() const noexcept;
 
+    /**
+     * @brief Host surface lookup for double-click pivot and dolly zoom at the cursor
+     * (see @ref TrackballManipulator::setDepthQuery). Null detaches.
+     */
+    void setDepthQuery(std::shared_ptr<IDepthQuery> query) noexcept;
+
     // -------------------------------------------------------------------------
     // DOF enable/disable (delegates to InputMapper rule removal)
     // -------------------------------------------------------------------------
@@ -229,12 +263,56 @@ class VNE_INTERACTION_API Inspect3DController : public ICameraController {
     // Convenience
     // -------------------------------------------------------------------------
 
-    /** Fit camera to an AABB with smooth animation. */
-    void fitToAABB(const vne::math::Vec3f& min_world, const vne::math::Vec3f& max_world) noexcept;
+    /** Fit camera to an AABB with smooth animation; @p mode as in @ref TrackballManipulator::fitToAABB. */
+    void fitToAABB(const vne::math::Vec3f& min_world,
+                   const vne::math::Vec3f& max_world,
+                   FitBoundsMode mode = FitBoundsMode::eBoundingSphere) noexcept;
 
     /** Reset camera and interaction state. */
     void reset() noexcept;
 
+    // -------------------------------------------------------------------------
+    // Undo / redo
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Ease back to the previous committed camera pose.
+     *
+     * Poses are committed per gesture (before a drag begins and once the camera settles after it ends) and
+     * around @ref fitToAABB; see @ref CameraHistory.
+     *
+     * @return false if there is nothing to undo or no camera is attached
+     */
+    bool undo(float duration_s = 0.35f) noexcept;
+
+    /** @brief Ease forward to the pose left by @ref undo; false if the camera moved since. */
+    bool redo(float duration_s = 0.35f) noexcept;
+
+    /** Committed poses (64 entries by default; assign a new @ref CameraHistory to change capacity). */
+    [[nodiscard]] CameraHistory& cameraHistory() noexcept;
+
+    // -------------------------------------------------------------------------
+    // State serialization
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Encode bindings, DOF flags, sensitivities, interaction-speed keys, the input rule table and the orbit manipulator (settings and camera pose) into a
+     * compact versioned little-endian blob, e.g. to save a workspace.
+     */
+    [[nodiscard]] std::vector<std::uint8_t> serialize() const;
+
+    /**
+     * @brief Restore a blob written by @ref serialize.
+     *
+     * Settings are assigned directly, the input rules are rebuilt once and the camera (when attached)
+     * receives the stored pose in a single apply. In-flight gestures are dropped and
+     * @ref cameraHistory restarts from the restored pose.
+     *
+     * @return false, leaving the controller unchanged, if the blob is truncated, corrupt, of another kind
+     *         or from a newer format version
+     */
+    bool deserialize(const std::uint8_t* data, std::size_t size) noexcept;
+
     // -------------------------------------------------------------------------
     // Escape hatches for power users
     // -------------------------------------------------------------------------
@@ -50,14 +50,29 @@
 // Full type surface (actions, state blobs, bindings, behavioral enums)
 #include "vertexnova/interaction/interaction_types.h"
 
+// Bit-reproducible math switch (replay / CI)
+#include "vertexnova/interaction/deterministic_math.h"
+
 // Manipulators
 #include "vertexnova/interaction/camera_manipulator.h"
+#include "vertexnova/interaction/depth_query.h"
+#include "vertexnova/interaction/scene_query.h"
+#include "vertexnova/interaction/pick_index.h"
+#include "vertexnova/interaction/screen_rays.h"
+#include "vertexnova/interaction/clip_plane_manager.h"
+#include "vertexnova/interaction/camera_constraint.h"
+#include "vertexnova/interaction/bounds_reduction.h"
 #include "vertexnova/interaction/trackball_manipulator.h"
 #include "vertexnova/interaction/free_look_manipulator.h"
 #include "vertexnova/interaction/ortho_2d_manipulator.h"
+#include "vertexnova/interaction/camera_path_manipulator.h"
+
+// Bulk orbit cameras
+#include "vertexnova/interaction/camera_batch.h"
 
 // Rig, mapper, controller interface
 #include "vertexnova/interaction/camera_rig.h"
+#include "vertexnova/interaction/camera_history.h"
 #include "vertexnova/interaction/input_mapper.h"
 #include "vertexnova/interaction/camera_controller.h"
 
@@ -65,3 +80,12 @@
 #include "vertexnova/interaction/inspect_3d_controller.h"
 #include "vertexnova/interaction/navigation_3d_controller.h"
 #include "vertexnova/interaction/ortho_2d_controller.h"
+#include "vertexnova/interaction/controller_group.h"
+#include "vertexnova/interaction/camera_link_group.h"
+#include "vertexnova/interaction/viewport_router.h"
+
+// Session capture and replay
+#include "vertexnova/interaction/interaction_recorder.h"
+#include "vertexnova/interaction/interaction_player.h"
+#include "vertexnova/interaction/camera_trajectory.h"
+#include "vertexnova/interaction/headless_driver.h"
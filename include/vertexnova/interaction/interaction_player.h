@@ -0,0 +1,150 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file interaction_player.h
+ * @brief InteractionPlayer — streams an @ref InteractionRecorder log back into any camera controller.
+ *
+ * @code
+ * InteractionPlayer player;
+ * if (player.open("session.vnir")) {
+ *     Inspect3DController replay;
+ *     replay.setCamera(camera);
+ *     setDeterministicMath(player.getInfo().deterministic_math);
+ *     player.playAll(replay);           // or playUntil(replay, t) once per frame for real-time playback
+ * }
+ * @endcode
+ *
+ * @par Determinism
+ * Records are applied in order with the exact time steps and coordinates that were recorded, so a controller
+ * configured like the recorded one (same type, camera start pose, bindings and deterministic-math mode)
+ * reproduces the session. Wall-clock timestamps only pace @ref playUntil; they never reach the controller.
+ *
+ * @par Streaming
+ * Files at or above the memory-map threshold are mapped read-only where the platform supports it (POSIX);
+ * smaller files, and all files elsewhere, are read in fixed-size chunks, so memory use stays bounded by the
+ * chunk size however long the session is.
+ */
+
+#include "vertexnova/interaction/export.h"
+#include "vertexnova/interaction/interaction_recorder.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vne::interaction {
+
+class ICameraController;
+
+/**
+ * @brief Sequential reader that replays an interaction log into an @ref ICameraController.
+ *
+ * @threadsafe Not thread-safe. Call all methods from one thread.
+ */
+class VNE_INTERACTION_API InteractionPlayer {
+   public:
+    InteractionPlayer() noexcept;
+    ~InteractionPlayer();
+
+    InteractionPlayer(const InteractionPlayer&) = delete;
+    InteractionPlayer& operator=(const InteractionPlayer&) = delete;
+    InteractionPlayer(InteractionPlayer&&) noexcept;
+    InteractionPlayer& operator=(InteractionPlayer&&) noexcept;
+
+    // -------------------------------------------------------------------------
+    // Source
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Open a log file and read its session header.
+     * @param path File written by @ref InteractionRecorder
+     * @return false if the file cannot be read or its header is invalid
+     */
+    bool open(const std::string& path) noexcept;
+
+    /**
+     * @brief Play a log already held in memory (e.g. received over the network).
+     * @param bytes Complete log contents; the player takes ownership
+     * @return false if the header is invalid
+     */
+    bool openMemory(std::vector<std::uint8_t> bytes) noexcept;
+
+    /** @brief Release the file, mapping or buffer. */
+    void close() noexcept;
+
+    /** @return true while a log is open (including after its last record was played) */
+    [[nodiscard]] bool isOpen() const noexcept;
+
+    /** @return true if the open file is memory-mapped rather than streamed in chunks */
+    [[nodiscard]] bool isMemoryMapped() const noexcept;
+
+    /** @return Session header of the open log */
+    [[nodiscard]] const InteractionRecordingInfo& getInfo() const noexcept;
+
+    /**
+     * @brief Files at least this large are memory-mapped on open (default 4 MiB).
+     * @param bytes Threshold; 0 maps every file
+     */
+    void setMemoryMapThreshold(std::uint64_t bytes) noexcept;
+    [[nodiscard]] std::uint64_t getMemoryMapThreshold() const noexcept;
+
+    /**
+     * @brief Read size for streamed files (default 64 KiB); applies from the next @ref open.
+     * @param bytes Chunk size; clamped to at least 16 bytes
+     */
+    void setChunkSize(std::size_t bytes) noexcept;
+    [[nodiscard]] std::size_t getChunkSize() const noexcept;
+
+    // -------------------------------------------------------------------------
+    // Playback
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Apply the next record to @p target.
+     *
+     * Before the first record, the header viewport (when known) is applied with @ref ICameraController::onResize
+     * and a recorded fixed timestep with @ref ICameraController::setFixedTimestep.
+     *
+     * @return false at the end of the log or on a decode error (see @ref hasError)
+     */
+    bool step(ICameraController& target) noexcept;
+
+    /**
+     * @brief Apply every record stamped at or before @p time_s seconds after the start of the recording.
+     * @return Number of records applied
+     */
+    std::size_t playUntil(ICameraController& target, double time_s) noexcept;
+
+    /** @brief Apply all remaining records. @return Number of records applied */
+    std::size_t playAll(ICameraController& target) noexcept;
+
+    /** @return Timestamp in seconds of the last applied record */
+    [[nodiscard]] double getTime() const noexcept;
+
+    /** @return Records applied since @ref open */
+    [[nodiscard]] std::size_t getRecordCount() const noexcept;
+
+    /** @return true once the last record was applied or a decode error stopped playback */
+    [[nodiscard]] bool isFinished() const noexcept;
+
+    /** @return true if the log is truncated or corrupt */
+    [[nodiscard]] bool hasError() const noexcept;
+
+   private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace vne::interaction
@@ -0,0 +1,162 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file interaction_recorder.h
+ * @brief InteractionRecorder — records the input a camera controller receives to a compact binary log.
+ *
+ * The recorder is itself an @ref ICameraController that wraps the real one: every call is forwarded
+ * unchanged, and @ref onEvent, @ref onUpdate, @ref onResize and @ref setFixedTimestep are also appended to
+ * the log. Replay the log with @ref InteractionPlayer to drive any controller through the same session.
+ *
+ * @code
+ * auto nav = std::make_shared<Navigation3DController>();
+ * InteractionRecorder recorder(nav);
+ * recorder.start("session.vnir", {"navigation_3d"});
+ * controller = &recorder;             // feed events / frames through the recorder as usual
+ * ...
+ * recorder.stop();                    // flushes and closes the file
+ * @endcode
+ *
+ * @par Encoding
+ * Timestamps, cursor positions and scroll offsets are delta / zigzag varint encoded; a typical mouse-move
+ * record is four to six bytes. Time steps are stored once and reused while they repeat. Values that the
+ * compact encoding cannot hold exactly are stored verbatim, so replay sees the recorded doubles unchanged.
+ *
+ * @par Threading
+ * Records are appended to an in-memory chunk on the calling thread. Full chunks (and @ref flush) hand the
+ * chunk to a background writer thread, so the UI thread never waits on file I/O. Only @ref start (file open)
+ * and @ref stop (join) touch the file system from the caller's thread.
+ *
+ * @par Limits
+ * Touch events are forwarded but not recorded. @ref beginTransition and @ref setCamera are forwarded but not
+ * recorded; repeat them before replay when the session depends on them.
+ */
+
+#include "vertexnova/interaction/export.h"
+#include "vertexnova/interaction/camera_controller.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vne::interaction {
+
+/**
+ * @brief Per-session header stored at the start of an interaction log.
+ *
+ * Describes the controller the session was recorded against so a player can configure the replay target
+ * identically. @ref InteractionRecorder::start fills zero viewport / step fields from the calls it has seen
+ * and always stamps @ref deterministic_math from @ref isDeterministicMath.
+ */
+struct InteractionRecordingInfo {
+    std::string controller;            //!< Free-form controller label (e.g. "inspect_3d")
+    float viewport_width = 0.0f;       //!< Viewport width in pixels at record start (0 = unknown)
+    float viewport_height = 0.0f;      //!< Viewport height in pixels at record start (0 = unknown)
+    double fixed_step_s = 0.0;         //!< Controller fixed timestep in seconds (0 = variable step)
+    bool deterministic_math = false;   //!< Deterministic math was on while recording
+    std::vector<std::uint8_t> config;  //!< Opaque application-defined controller configuration
+};
+
+/**
+ * @brief ICameraController decorator that records the input stream of a wrapped controller.
+ *
+ * @threadsafe Not thread-safe. Call all methods from the thread that drives the wrapped controller.
+ */
+class VNE_INTERACTION_API InteractionRecorder : public ICameraController {
+   public:
+    /**
+     * @brief Wrap @p target; recording starts with @ref start.
+     * @param target Controller that receives every forwarded call; may be nullptr (record only)
+     */
+    explicit InteractionRecorder(std::shared_ptr<ICameraController> target = nullptr) noexcept;
+    ~InteractionRecorder() override;
+
+    InteractionRecorder(const InteractionRecorder&) = delete;
+    InteractionRecorder& operator=(const InteractionRecorder&) = delete;
+    InteractionRecorder(InteractionRecorder&&) noexcept;
+    InteractionRecorder& operator=(InteractionRecorder&&) noexcept;
+
+    // -------------------------------------------------------------------------
+    // Recording
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Create (truncate) @p path, write the session header and start recording.
+     *
+     * A recording already in progress is stopped first.
+     *
+     * @param path File to write
+     * @param info Session header; see @ref InteractionRecordingInfo for the fields filled in automatically
+     * @return false if the file cannot be opened (nothing is recorded)
+     */
+    bool start(const std::string& path, InteractionRecordingInfo info = {}) noexcept;
+
+    /** @brief Write out pending records, stop the writer thread and close the file. */
+    void stop() noexcept;
+
+    /** @return true between a successful @ref start and @ref stop */
+    [[nodiscard]] bool isRecording() const noexcept;
+
+    /** @brief Hand the current chunk to the writer thread without waiting for it to reach the file. */
+    void flush() noexcept;
+
+    /**
+     * @brief Chunk size at which records are handed to the writer thread (default 64 KiB).
+     * @param bytes Chunk size; clamped to at least 256 bytes
+     */
+    void setChunkSize(std::size_t bytes) noexcept;
+    [[nodiscard]] std::size_t getChunkSize() const noexcept;
+
+    /** @return Records appended since @ref start */
+    [[nodiscard]] std::size_t getRecordCount() const noexcept;
+
+    /** @return Encoded bytes (header included) produced since @ref start */
+    [[nodiscard]] std::uint64_t getEncodedBytes() const noexcept;
+
+    /** @return Events forwarded but not recorded (touch and unknown event types) since @ref start */
+    [[nodiscard]] std::size_t getSkippedEventCount() const noexcept;
+
+    /** @return true if the writer thread failed to write part of the current or last recording */
+    [[nodiscard]] bool hasWriteError() const noexcept;
+
+    /** @return The wrapped controller */
+    [[nodiscard]] const std::shared_ptr<ICameraController>& getTarget() const noexcept;
+
+    // -------------------------------------------------------------------------
+    // ICameraController
+    // -------------------------------------------------------------------------
+
+    /** Forwarded; not recorded. */
+    void setCamera(std::shared_ptr<vne::scene::ICamera> camera) noexcept override;
+    void onResize(float width_px, float height_px) noexcept override;
+    void onUpdate(double delta_time) noexcept override;
+    void onEvent(const vne::events::Event& event, double delta_time = 0.0) noexcept override;
+    /** Forwarded; not recorded. */
+    void beginTransition(const CameraPoseSnapshot& from, float duration_s) noexcept override;
+    void setFixedTimestep(double step_s) noexcept override;
+    /** Forwarded; not recorded (output only, replay is unaffected). */
+    void setMatrixUpdatesDeferred(bool deferred) noexcept override;
+    /** Forwarded from the wrapped controller. */
+    [[nodiscard]] CameraMotionState getMotionState() const noexcept override;
+    [[nodiscard]] CameraPoseSnapshot predictPose(double seconds_ahead) const noexcept override;
+    std::size_t predictPoses(std::span<const double> seconds_ahead,
+                             std::span<CameraPoseSnapshot> out) const noexcept override;
+
+   private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace vne::interaction
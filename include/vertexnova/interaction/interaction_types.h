@@ -19,7 +19,8 @@
  *
  * @par Contents
  * - @ref CameraActionType, @ref CameraCommandPayload, @ref GestureAction
- * - @ref TrackballCameraState, @ref FreeCameraState, @ref FreeLookInputState, @ref OrbitalInteractionState
+ * - @ref TrackballCameraState, @ref FreeCameraState, @ref CameraPoseSnapshot, @ref FreeLookInputState,
+ *   @ref OrbitalInteractionState, @ref CameraMotionState
  * - @ref InputRule, @ref MouseBinding, @ref KeyBinding, touch structs, modifier constants
  * - Behavioral enums: @ref FreeLookMode, @ref FreeLookRotationMode, @ref ZoomMethod,
  *   @ref OrbitPivotMode, @ref UpAxis, @ref ViewDirection, @ref CenterOfInterestSpace,
@@ -35,6 +36,8 @@
 #include <vertexnova/events/types.h>
 #include <vertexnova/math/core/core.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 
 namespace vne::interaction {
@@ -85,7 +88,7 @@ enum class CameraActionType : std::uint8_t {
     eOrbitPanModifier = 19,  //!< Orbit: Shift+LMB pan alias; navigation: sprint-like where mapped.
     eResetView = 20,         //!< Reset the view of the camera
     eSetPivotAtCursor =
-        21,  //!< Double-click: set COI along view direction (camera + front * orbit distance); payload x/y ignored
+        21,  //!< Double-click: COI along view direction; moves to the surface at payload x/y with an IDepthQuery
     eIncreaseMoveSpeed = 22,         //!< Increase the movement speed by like Shift key or mouse wheel
     eDecreaseMoveSpeed = 23,         //!< Decrease the movement speed by like Ctrl key or mouse wheel
     eIncreaseInteractionSpeed = 24,  //!< Increase the interaction speed by like Shift key or mouse wheel
@@ -169,6 +172,59 @@ struct VNE_INTERACTION_API FreeCameraState {
         , orientation(0.0f, 0.0f, 0.0f, 1.0f) {}
 };
 
+/**
+ * @brief Manipulator-agnostic camera pose: eye, orientation, look-at target and lens extent.
+ *
+ * Captured by @ref CameraRig when handing the camera from one manipulator (or controller) to another
+ * and blended during the handoff transition. Lens fields are 0 when they do not apply to the camera type.
+ */
+struct VNE_INTERACTION_API CameraPoseSnapshot {
+    vne::math::Vec3f position;     //!< Camera position in world space
+    vne::math::Quatf orientation;  //!< Camera-to-world rotation (forward = -Z)
+    vne::math::Vec3f target;       //!< Look-at target (center of interest) in world space
+    float fov_deg = 0.0f;          //!< Vertical FOV in degrees (perspective only; 0 otherwise)
+    float ortho_width = 0.0f;      //!< Orthographic frustum width (orthographic only; 0 otherwise)
+    float ortho_height = 0.0f;     //!< Orthographic frustum height (orthographic only; 0 otherwise)
+
+    CameraPoseSnapshot() noexcept
+        : position(0.0f, 0.0f, 0.0f)
+        , orientation(0.0f, 0.0f, 0.0f, 1.0f)
+        , target(0.0f, 0.0f, -1.0f) {}
+};
+
+/**
+ * @brief How the camera is moving, for renderers that lower quality in motion and refine at rest.
+ *
+ * Reported by @ref ICameraManipulator::getMotionState from the manipulator's own velocity estimates (drag,
+ * inertia, key motion, animation), so it is known before the next pose is written; @ref CameraRig::getMotionState
+ * merges the enabled manipulators. All fields are zero / false at rest.
+ */
+struct VNE_INTERACTION_API CameraMotionState {
+    float angular_speed = 0.0f;  //!< Rotation of the view direction, radians per second
+    float linear_speed = 0.0f;   //!< Translation (pan, key motion, path, animated pivot), world units per second
+    float zoom_rate = 0.0f;      //!< d ln(zoom extent) / dt per second (> 0 zooming out), smoothed over wheel bursts
+    float settle_time_s = 0.0f;  //!< Seconds until at rest if all input stops now (glide / animation left)
+    bool dragging = false;       //!< A rotate / pan / look gesture is held
+    bool inertia = false;        //!< Coasting after a released gesture
+    bool animating = false;      //!< Fit / view / path animation or rig transition running
+
+    /** @return true while anything moves the camera or is about to */
+    [[nodiscard]] bool isMoving() const noexcept {
+        return dragging || inertia || animating || angular_speed > 0.0f || linear_speed > 0.0f || zoom_rate != 0.0f;
+    }
+
+    /** @brief Combine with another source: fastest speeds, strongest zoom, latest settle, any flag. */
+    void merge(const CameraMotionState& other) noexcept {
+        angular_speed = std::max(angular_speed, other.angular_speed);
+        linear_speed = std::max(linear_speed, other.linear_speed);
+        zoom_rate = std::abs(zoom_rate) >= std::abs(other.zoom_rate) ? zoom_rate : other.zoom_rate;
+        settle_time_s = std::max(settle_time_s, other.settle_time_s);
+        dragging = dragging || other.dragging;
+        inertia = inertia || other.inertia;
+        animating = animating || other.animating;
+    }
+};
+
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
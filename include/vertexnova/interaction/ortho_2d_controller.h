@@ -33,10 +33,15 @@
 #include "vertexnova/interaction/export.h"
 #include "vertexnova/interaction/interaction_types.h"
 #include "vertexnova/interaction/camera_controller.h"
+#include "vertexnova/interaction/camera_history.h"
 #include "vertexnova/interaction/camera_rig.h"
+#include "vertexnova/interaction/ortho_2d_manipulator.h"
 
 #include <vertexnova/events/types.h>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace vne::events {
 class Event;
@@ -49,7 +54,6 @@ class ICamera;
 namespace vne::interaction {
 
 class InputMapper;
-class Ortho2DManipulator;
 
 /**
  * @brief High-level camera controller for orthographic 2D viewports.
@@ -85,6 +89,23 @@ class VNE_INTERACTION_API Ortho2DController : public ICameraController {
     void onEvent(const vne::events::Event& event, double delta_time = 0.0) noexcept override;
     void onUpdate(double delta_time) noexcept override;
 
+    /** Ease the camera from @p from into this controller's pose (see @ref ICameraController::beginTransition). */
+    void beginTransition(const CameraPoseSnapshot& from, float duration_s) noexcept override;
+
+    /** Fixed-step simulation with interpolated output (see @ref CameraRig::setFixedTimestep). */
+    void setFixedTimestep(double step_s) noexcept override;
+
+    /** Skip camera matrix rebuilds after pose writes (see @ref CameraRig::setMatrixUpdatesDeferred). */
+    void setMatrixUpdatesDeferred(bool deferred) noexcept override;
+
+    /** Motion state of the rig, for adaptive render quality (see @ref CameraRig::getMotionState). */
+    [[nodiscard]] CameraMotionState getMotionState() const noexcept override;
+
+    /** Predicted poses of the rig, for streaming prefetch (see @ref CameraRig::predictPose). */
+    [[nodiscard]] CameraPoseSnapshot predictPose(double seconds_ahead) const noexcept override;
+    std::size_t predictPoses(std::span<const double> seconds_ahead,
+                             std::span<CameraPoseSnapshot> out) const noexcept override;
+
     // -------------------------------------------------------------------------
     // DOF
     // -------------------------------------------------------------------------
@@ -134,8 +155,53 @@ class VNE_INTERACTION_API Ortho2DController : public ICameraController {
     /** World units per screen pixel (delegates to Ortho2DManipulator). Useful for hit testing. */
     [[nodiscard]] float getWorldUnitsPerPixel() const noexcept;
 
+    /** Visible world rectangle, optionally predicted @p lookahead_s seconds ahead, for tile prefetch (delegates). */
+    [[nodiscard]] VisibleRegion getVisibleRegion(double lookahead_s = 0.0) const noexcept;
+
     void reset() noexcept;
 
+    // -------------------------------------------------------------------------
+    // Undo / redo
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Ease back to the previous committed camera pose.
+     *
+     * Poses are committed per gesture (before a drag begins and once the camera settles after it ends) and
+     * around @ref fitToAABB; see @ref CameraHistory.
+     *
+     * @return false if there is nothing to undo or no camera is attached
+     */
+    bool undo(float duration_s = 0.35f) noexcept;
+
+    /** @brief Ease forward to the pose left by @ref undo; false if the camera moved since. */
+    bool redo(float duration_s = 0.35f) noexcept;
+
+    /** Committed poses (64 entries by default; assign a new @ref CameraHistory to change capacity). */
+    [[nodiscard]] CameraHistory& cameraHistory() noexcept;
+
+    // -------------------------------------------------------------------------
+    // State serialization
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Encode bindings and DOF flags, the input rule table and the 2D manipulator (settings and camera pose) into a
+     * compact versioned little-endian blob, e.g. to save a workspace.
+     */
+    [[nodiscard]] std::vector<std::uint8_t> serialize() const;
+
+    /**
+     * @brief Restore a blob written by @ref serialize.
+     *
+     * Settings are assigned directly, the input rules are rebuilt once and the camera (when attached)
+     * receives the stored pose in a single apply. In-flight gestures are dropped and
+     * @ref cameraHistory restarts from the restored pose.
+     *
+     * @return false, leaving the controller unchanged, if the blob is truncated, corrupt, of another kind
+     *         or from a newer format version
+     */
+    bool deserialize(const std::uint8_t* data, std::size_t size) noexcept;
+
     // -------------------------------------------------------------------------
     // Escape hatches
     // -------------------------------------------------------------------------
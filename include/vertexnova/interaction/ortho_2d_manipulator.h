@@ -23,17 +23,28 @@
  * @par Inertia
  * Pan velocity is damped over time in @ref onUpdate using exponential decay.
  *
+ * @par Visible region
+ * @ref getVisibleRegion reports the world rectangle on screen (rotated with the view) and its scale, for
+ * tiled image / map viewers that pick a pyramid level and prefetch tiles. With a lookahead it extrapolates
+ * the rectangle along the current drag or inertia motion.
+ *
  * @par Input pairing
  * @ref Ortho2DController wires @ref InputMapper rules; this manipulator handles @c ePanDelta,
  * @c eZoomAtCursor, and optional @c eBeginRotate / @c eRotateDelta / @c eEndRotate when rotation is enabled.
  */
 
+#include "vertexnova/interaction/bounds_reduction.h"
 #include "vertexnova/interaction/camera_manipulator_base.h"
 #include "vertexnova/interaction/interaction_types.h"
 
 #include <vertexnova/math/core/core.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <span>
+#include <vector>
 
 namespace vne::scene {
 class ICamera;
@@ -41,6 +52,37 @@ class ICamera;
 
 namespace vne::interaction {
 
+/**
+ * @brief World-space rectangle shown by an orthographic view (see @ref Ortho2DManipulator::getVisibleRegion).
+ *
+ * The rectangle lies in the view plane through @ref center and spans @ref center +/- @ref axis_x *
+ * @ref half_width +/- @ref axis_y * @ref half_height. The axes follow in-plane rotation. @ref bounds_min /
+ * @ref bounds_max hold the axis-aligned box around the (possibly rotated) rectangle, which is what a tile grid
+ * is usually queried with.
+ */
+struct VNE_INTERACTION_API VisibleRegion {
+    bool valid = false;                             //!< false when no orthographic camera / viewport is set
+    vne::math::Vec3f center{0.0f, 0.0f, 0.0f};      //!< Camera target (middle of the screen)
+    vne::math::Vec3f axis_x{1.0f, 0.0f, 0.0f};      //!< Screen right in world space (unit)
+    vne::math::Vec3f axis_y{0.0f, 1.0f, 0.0f};      //!< Screen up in world space (unit)
+    float half_width = 0.0f;                        //!< Along @ref axis_x, world units
+    float half_height = 0.0f;                       //!< Along @ref axis_y, world units
+    vne::math::Vec3f bounds_min{0.0f, 0.0f, 0.0f};  //!< World AABB of the rectangle
+    vne::math::Vec3f bounds_max{0.0f, 0.0f, 0.0f};  //!< World AABB of the rectangle
+    float world_units_per_pixel = 0.0f;             //!< As @ref Ortho2DManipulator::getWorldUnitsPerPixel
+
+    /** @return Corner @p index (0..3, counter-clockwise on screen from bottom-left) */
+    [[nodiscard]] vne::math::Vec3f corner(int index) const noexcept;
+
+    /**
+     * @brief Image pyramid level whose texel size best matches the screen: floor(log2(world_units_per_pixel /
+     * @p level0_units_per_pixel)), clamped to [0, @p max_level].
+     *
+     * Level 0 is full resolution and each level halves it. Returns 0 for an invalid region or scale.
+     */
+    [[nodiscard]] int pyramidLevel(float level0_units_per_pixel, int max_level) const noexcept;
+};
+
 /**
  * @brief Orthographic 2D pan, zoom, and optional in-plane rotation.
  *
@@ -88,6 +130,12 @@ class VNE_INTERACTION_API Ortho2DManipulator final : public CameraManipulatorBas
     /** Reset pan inertia and interaction flags. */
     void resetState() noexcept override;
 
+    /** @brief Pan / in-plane rotation rates while dragging, pan inertia and its settle time. */
+    [[nodiscard]] CameraMotionState getMotionState() const noexcept override;
+
+    /** @brief In-plane rotation rate continued while rotating; pan as in @ref getVisibleRegion's look-ahead. */
+    [[nodiscard]] CameraPoseSnapshot predictPose(double seconds_ahead) const noexcept override;
+
     // isEnabled / setEnabled inherited from CameraManipulatorBase
 
     // -------------------------------------------------------------------------
@@ -136,6 +184,18 @@ class VNE_INTERACTION_API Ortho2DManipulator final : public CameraManipulatorBas
      */
     [[nodiscard]] float getWorldUnitsPerPixel() const noexcept;
 
+    /**
+     * @brief World rectangle on screen now, or where it is heading.
+     *
+     * With @p lookahead_s > 0 the center is moved by the pan expected over that many seconds: the smoothed drag
+     * velocity while a pan is held, or the remaining inertia glide (v * (1 - e^(-damping * t)) / damping) after
+     * release. Zoom and rotation are applied immediately and are not extrapolated. Prefetch the tiles under the
+     * predicted rectangle while drawing the current one.
+     *
+     * @param lookahead_s Seconds ahead (0 = current view; negative values are treated as 0)
+     */
+    [[nodiscard]] VisibleRegion getVisibleRegion(double lookahead_s = 0.0) const noexcept;
+
     /**
      * @brief Fit orthographic viewport to an AABB.
      * @param min_world AABB min corner in world space
@@ -143,10 +203,58 @@ class VNE_INTERACTION_API Ortho2DManipulator final : public CameraManipulatorBas
      */
     void fitToAABB(const vne::math::Vec3f& min_world, const vne::math::Vec3f& max_world) noexcept;
 
+    /**
+     * @brief Fit camera to a point set (point cloud, mesh vertices) by the orthographic bounds.
+     *
+     * The bounds are reduced in parallel (see bounds_reduction.h). @c FitBoundsMode::eBoundingSphere frames the
+     * tightest sphere about the bounds center; @c FitBoundsMode::eViewExtents frames the extents seen in the
+     * current view orientation, which is tighter for elongated sets (@c FitBoundsMode::eFrustum is the same
+     * here: the orthographic view extents are already exact). Empty or all-NaN input is ignored.
+     * @param executor Runs the reduction tasks on the host's job system (empty: shared pool)
+     */
+    void fitToPoints(std::span<const vne::math::Vec3f> points,
+                     FitBoundsMode mode = FitBoundsMode::eBoundingSphere,
+                     const ControllerExecutor& executor = {}) noexcept;
+
+    /** @brief As @ref fitToPoints, over a set of boxes (e.g. per-object bounds); invalid boxes are skipped. */
+    void fitToBoxes(std::span<const BoundingBox> boxes,
+                    FitBoundsMode mode = FitBoundsMode::eBoundingSphere,
+                    const ControllerExecutor& executor = {}) noexcept;
+
+    // -------------------------------------------------------------------------
+    // State serialization
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Encode settings (zoom, pan damping and inertia, rotation sensitivity, DOF flags) and the
+     * camera pose into a compact versioned blob.
+     *
+     * Little-endian on every host; the pose is omitted when no camera is attached.
+     */
+    [[nodiscard]] std::vector<std::uint8_t> serialize() const;
+
+    /**
+     * @brief Restore a blob written by @ref serialize.
+     *
+     * Fields are assigned directly; the stored pose (and scene scale) reaches the attached camera in a
+     * single apply. In-flight gestures are dropped.
+     *
+     * @return false, leaving the manipulator unchanged, if the blob is truncated, corrupt, of another
+     *         kind or from a newer format version
+     */
+    bool deserialize(const std::uint8_t* data, std::size_t size) noexcept;
+
    private:
     void pan(float delta_x_px, float delta_y_px, double delta_time) noexcept;
-    void rotateInPlane(float delta_x_px, float delta_y_px) noexcept;
+    void rotateInPlane(float delta_x_px, float delta_y_px, double delta_time) noexcept;
     void applyInertia(double delta_time) noexcept;
+    /** World displacement the current drag / inertia is expected to add over @p lookahead_s seconds. */
+    [[nodiscard]] vne::math::Vec3f predictedPan(float lookahead_s) const noexcept;
+    /** Shared body of fitToPoints / fitToBoxes (defined and instantiated in the .cpp). */
+    template <typename T>
+    void fitToSet(std::span<const T> items, FitBoundsMode mode, const ControllerExecutor& executor) noexcept;
+    /** Frame @p volume (shared tail of the fitTo* overloads). */
+    void fitToVolume(const FitVolume& volume) noexcept;
 
     // orthoCamera() inherited from CameraManipulatorBase
     // applyDolly() default in CameraManipulatorBase handles ortho zoom-to-cursor
@@ -162,6 +270,7 @@ class VNE_INTERACTION_API Ortho2DManipulator final : public CameraManipulatorBas
     bool panning_ = false;
     bool rotating_ = false;
     vne::math::Vec3f pan_velocity_{0.0f, 0.0f, 0.0f};
+    float rotate_velocity_ = 0.0f;  //!< Smoothed signed in-plane rotation rate while rotating (rad/s)
 
     bool warned_no_camera_ = false;  //!< Log at most once per instance if @c onAction runs with no camera
 };
@@ -0,0 +1,204 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file pick_index.h
+ * @brief PickIndex — CPU bounding volume hierarchy for cursor picking and camera collision without a depth buffer.
+ *
+ * For hosts that cannot read back depth (headless runs, CPU-side meshes such as medical segmentations),
+ * a @ref PickIndex holds the pickable scene as axis-aligned boxes or triangles and answers ray casts.
+ * It implements @ref IDepthQuery, so attaching it makes double-click pivot and dolly zoom target the
+ * surface under the cursor, with results available on the first poll:
+ *
+ * @code
+ * auto picks = std::make_shared<vne::interaction::PickIndex>();
+ * picks->buildFromTriangles(mesh.positions.data(), mesh.positions.size(),
+ *                           mesh.indices.data(), mesh.indices.size() / 3);
+ * inspect_ctrl.setDepthQuery(picks);
+ * @endcode
+ *
+ * @par Build
+ * The hierarchy is split with the surface area heuristic over 16 centroid bins per node. Large builds run
+ * on a work-stealing pool (or a caller @ref ControllerExecutor): bounds, binning of the upper levels and the
+ * independent subtrees below them are computed in parallel. The result does not depend on the thread count.
+ *
+ * @par Moving primitives
+ * @ref PickIndex::updateBox and @ref PickIndex::updateTriangle replace one primitive and refit the bounds
+ * on its path to the root; the tree shape is kept. Rebuild after large or widespread motion, when the
+ * refitted bounds overlap so much that queries slow down.
+ *
+ * @par Queries
+ * @ref PickIndex::raycast and @ref PickIndex::depthRange do not allocate and do not modify the index, so several
+ * threads may query concurrently between updates. Boxes are hit where the ray enters them (or at the origin when
+ * it starts inside); triangles are two-sided. @ref PickIndex::depthRange reports how far the primitives inside a
+ * view volume extend along the view direction, which @ref ClipPlaneManager uses to fit near / far planes.
+ *
+ * @par Swept spheres
+ * @ref PickIndex::sphereCast implements @ref ISceneQuery, so the same index keeps a @ref CameraConstraint out
+ * of the geometry. Nodes and boxes are inflated by the radius (box corners and edges are treated as square);
+ * triangles are swept exactly against their face, edges and vertices. The hint primitive is tested first, so
+ * frames that touch the same surface as the previous one prune most of the tree.
+ */
+
+#include "vertexnova/interaction/export.h"
+#include "vertexnova/interaction/controller_group.h"
+#include "vertexnova/interaction/depth_query.h"
+#include "vertexnova/interaction/scene_query.h"
+
+#include <vertexnova/math/core/core.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+
+namespace vne::interaction {
+
+/**
+ * @brief Closest ray hit reported by @ref PickIndex::raycast.
+ */
+struct VNE_INTERACTION_API PickHit {
+    static constexpr std::uint32_t kNoPrimitive = 0xFFFFFFFFu;
+
+    float distance = 0.0f;                      //!< Distance from the ray origin (world units)
+    vne::math::Vec3f point{0.0f, 0.0f, 0.0f};  //!< World-space hit point
+    std::uint32_t primitive = kNoPrimitive;     //!< Index of the box or triangle in the build input
+};
+
+/**
+ * @brief Bounding volume hierarchy over host boxes or triangles, usable as an @ref IDepthQuery and an
+ * @ref ISceneQuery.
+ *
+ * @threadsafe Builds and updates need exclusive access; @ref raycast and @ref sphereCast may run concurrently.
+ */
+class VNE_INTERACTION_API PickIndex final : public IDepthQuery, public ISceneQuery {
+   public:
+    /**
+     * @param worker_threads Pool threads besides the caller for large builds (0: serial). The pool is started
+     *                       on the first build large enough to use it.
+     */
+    explicit PickIndex(std::size_t worker_threads = ControllerGroup::defaultWorkerThreads());
+    ~PickIndex() override;
+
+    PickIndex(const PickIndex&) = delete;
+    PickIndex& operator=(const PickIndex&) = delete;
+    PickIndex(PickIndex&&) noexcept;
+    PickIndex& operator=(PickIndex&&) noexcept;
+
+    /** Run large builds through @p executor; an empty executor restores the built-in pool. */
+    void setExecutor(ControllerExecutor executor);
+
+    // -------------------------------------------------------------------------
+    // Build
+    // -------------------------------------------------------------------------
+
+    /** Index @p count boxes given as parallel min / max corner arrays. Replaces the previous contents. */
+    void buildFromBoxes(const vne::math::Vec3f* mins, const vne::math::Vec3f* maxs, std::size_t count);
+
+    /**
+     * @brief Index @p triangle_count triangles. Replaces the previous contents.
+     * @param indices Three vertex indices per triangle, or null for consecutive vertex triples
+     *                (@p vertex_count must then be at least 3 × @p triangle_count). Out-of-range indices skip
+     *                the triangle.
+     */
+    void buildFromTriangles(const vne::math::Vec3f* vertices,
+                            std::size_t vertex_count,
+                            const std::uint32_t* indices,
+                            std::size_t triangle_count);
+
+    void clear() noexcept;
+
+    /** @return Number of indexed primitives (boxes or triangles) */
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /** @return Number of hierarchy nodes (for diagnostics) */
+    [[nodiscard]] std::size_t nodeCount() const noexcept;
+
+    /** @return Counter bumped by every build, update and @ref clear (lets consumers skip unchanged scenes) */
+    [[nodiscard]] std::uint64_t revision() const noexcept override;
+
+    // -------------------------------------------------------------------------
+    // Updates
+    // -------------------------------------------------------------------------
+
+    /** Move box @p index (build-input order) and refit its ancestors. Ignored in triangle mode. */
+    void updateBox(std::size_t index, const vne::math::Vec3f& min_corner, const vne::math::Vec3f& max_corner) noexcept;
+
+    /** Move triangle @p index (build-input order) and refit its ancestors. Ignored in box mode. */
+    void updateTriangle(std::size_t index,
+                        const vne::math::Vec3f& a,
+                        const vne::math::Vec3f& b,
+                        const vne::math::Vec3f& c) noexcept;
+
+    // -------------------------------------------------------------------------
+    // Queries
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Closest hit along the ray from @p origin in @p direction (need not be unit length).
+     * @return true and fills @p hit when a primitive lies within @p max_distance
+     */
+    bool raycast(const vne::math::Vec3f& origin,
+                 const vne::math::Vec3f& direction,
+                 PickHit& hit,
+                 float max_distance = std::numeric_limits<float>::max()) const noexcept;
+
+    /**
+     * @brief Depth extent along @p forward of the primitives that intersect a convex view volume.
+     *
+     * Primitives entirely outside one of @p planes are skipped; the others contribute the depth range of their
+     * box (or triangle vertices), which is conservative for primitives cut by a plane.
+     *
+     * @param eye        Point depths are measured from
+     * @param forward    Unit view direction
+     * @param planes     Volume planes (nx, ny, nz, d); a point p is inside when n·p + d >= 0
+     * @param near_depth Receives the smallest depth (negative when a primitive reaches behind @p eye)
+     * @param far_depth  Receives the largest depth
+     * @return false when no primitive intersects the volume (outputs untouched)
+     */
+    bool depthRange(const vne::math::Vec3f& eye,
+                    const vne::math::Vec3f& forward,
+                    std::span<const vne::math::Vec4f> planes,
+                    float& near_depth,
+                    float& far_depth) const noexcept;
+
+    // -------------------------------------------------------------------------
+    // ISceneQuery
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief First contact of a sphere of @p radius swept from @p origin along @p direction (need not be unit).
+     *
+     * @ref SweepHit::primitive is the build-input index; pass it back as @p hint on the next coherent cast.
+     */
+    bool sphereCast(const vne::math::Vec3f& origin,
+                    const vne::math::Vec3f& direction,
+                    float radius,
+                    float max_distance,
+                    SweepHit& hit,
+                    std::uint32_t hint = SweepHit::kNoPrimitive) const noexcept override;
+
+    // -------------------------------------------------------------------------
+    // IDepthQuery — answered synchronously by a ray cast
+    // -------------------------------------------------------------------------
+
+    RequestId requestDepth(const DepthRequest& request) noexcept override;
+    DepthQueryStatus pollDepth(RequestId id, vne::math::Vec3f& world_point) noexcept override;
+
+   private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace vne::interaction
@@ -0,0 +1,80 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file scene_query.h
+ * @brief ISceneQuery — host-implemented swept-sphere casts against scene geometry.
+ *
+ * A @ref CameraConstraint keeps the camera out of geometry by sweeping a sphere around the eye along each
+ * frame's motion. The geometry comes from an @ref ISceneQuery: the host's physics or collision world, or a
+ * @ref PickIndex, which implements this interface over its boxes or triangles.
+ *
+ * @par Contract
+ *   - @ref ISceneQuery::sphereCast reports the first contact of the moving sphere, synchronously.
+ *   - Geometry the sphere already overlaps at the origin is reported at distance 0 when the motion goes
+ *     deeper into it and ignored when the motion leaves it, so a camera resting on a surface can move away.
+ *   - The hint is the primitive of the previous contact. Implementations may test it first to bound the
+ *     search; any other value must give the same answer.
+ *   - All calls come from the thread driving the camera.
+ */
+
+#include "vertexnova/interaction/export.h"
+
+#include <vertexnova/math/core/core.h>
+
+#include <cstdint>
+
+namespace vne::interaction {
+
+/**
+ * @brief First contact of a swept sphere.
+ */
+struct VNE_INTERACTION_API SweepHit {
+    static constexpr std::uint32_t kNoPrimitive = 0xFFFFFFFFu;
+
+    float distance = 0.0f;                       //!< Distance the sphere center travels before contact
+    vne::math::Vec3f point{0.0f, 0.0f, 0.0f};   //!< World-space contact point on the surface
+    vne::math::Vec3f normal{0.0f, 0.0f, 1.0f};  //!< Unit surface normal at the contact, toward the sphere
+    std::uint32_t primitive = kNoPrimitive;      //!< Host primitive id (hint for the next cast)
+};
+
+/**
+ * @brief Host-side collision geometry for camera constraints.
+ */
+class VNE_INTERACTION_API ISceneQuery {
+   public:
+    virtual ~ISceneQuery() = default;
+
+    /**
+     * @brief Sweep a sphere from @p origin along the unit vector @p direction.
+     * @param radius       Sphere radius (world units)
+     * @param max_distance Longest travel to test
+     * @param hit          Receives the first contact
+     * @param hint         Primitive of the previous contact, or @ref SweepHit::kNoPrimitive
+     * @return true when the sphere touches geometry within @p max_distance
+     */
+    virtual bool sphereCast(const vne::math::Vec3f& origin,
+                            const vne::math::Vec3f& direction,
+                            float radius,
+                            float max_distance,
+                            SweepHit& hit,
+                            std::uint32_t hint = SweepHit::kNoPrimitive) const noexcept = 0;
+
+    /**
+     * @brief Counter that changes whenever the geometry moves. Default: 0 (static geometry).
+     *
+     * Lets the constraint skip the cast on frames where neither the camera nor the scene moved.
+     */
+    [[nodiscard]] virtual std::uint64_t revision() const noexcept { return 0; }
+};
+
+}  // namespace vne::interaction
@@ -0,0 +1,67 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file screen_rays.h
+ * @brief Batched screen-to-world ray generation for lasso, box and brush selection.
+ *
+ * Selection tools turn many cursor positions into world rays each frame (every vertex of a lasso, a grid
+ * of samples in a selection box). @ref screenToWorldRays inverts the camera's view-projection once and then
+ * maps all points through one kernel:
+ *
+ * @code
+ * std::vector<vne::math::Ray> rays(lasso_px.size());
+ * vne::interaction::screenToWorldRays(*camera, vne::math::Viewport(width, height), lasso_px, rays);
+ * @endcode
+ *
+ * @par Conventions
+ * Points are in top-left window pixels, like mouse events, and are mapped to NDC with the camera's graphics
+ * API the same way the manipulators do (OpenGL flips Y; Vulkan, Metal, DirectX and WebGPU do not; near-plane
+ * depth is -1 for OpenGL and 0 otherwise). Perspective rays start at the eye; orthographic rays start on the
+ * near plane. Directions are unit length and point away from the camera.
+ *
+ * @par Matrices
+ * The camera's view-projection matrix is read as is, so call @c updateMatrices first when matrix updates are
+ * deferred (@ref CameraRig::setMatrixUpdatesDeferred).
+ *
+ * @par Performance
+ * Points are processed in fixed-size blocks of structure-of-arrays floats: two affine maps to homogeneous
+ * near / far points, a perspective divide and a normalization per point, with no branches inside a block. The
+ * source is built with @c -fno-math-errno on GCC and Clang so the square root does not block vectorization of
+ * the block loop. No memory is allocated.
+ */
+
+#include "vertexnova/interaction/export.h"
+
+#include <vertexnova/math/core/core.h>
+#include <vertexnova/math/viewport.h>
+#include <vertexnova/scene/camera/camera.h>
+
+#include <cstddef>
+#include <span>
+
+namespace vne::interaction {
+
+/**
+ * @brief World rays through many cursor positions of one camera.
+ * @param camera    Camera whose current view-projection matrix is used
+ * @param viewport  Viewport the positions refer to (pixels)
+ * @param points_px Cursor positions in top-left window pixels
+ * @param rays      Receives the ray through @c points_px[i] at index @c i
+ * @return Rays written: the smaller of the two span sizes, or 0 when the viewport has no area
+ */
+VNE_INTERACTION_API std::size_t screenToWorldRays(const vne::scene::ICamera& camera,
+                                                  const vne::math::Viewport& viewport,
+                                                  std::span<const vne::math::Vec2f> points_px,
+                                                  std::span<vne::math::Ray> rays) noexcept;
+
+}  // namespace vne::interaction
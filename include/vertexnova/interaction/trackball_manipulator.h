@@ -28,7 +28,9 @@
  * @ref ZoomMethod::eDollyToCoi, @ref ZoomMethod::eSceneScale, and @ref ZoomMethod::eChangeFov.
  */
 
+#include "vertexnova/interaction/bounds_reduction.h"
 #include "vertexnova/interaction/camera_manipulator_base.h"
+#include "vertexnova/interaction/depth_query.h"
 #include "vertexnova/interaction/interaction_types.h"
 
 #include "vertexnova/scene/camera/orthographic_camera.h"
@@ -38,7 +40,11 @@
 #include <vertexnova/math/easing.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <span>
+#include <vector>
 
 namespace vne::scene {
 class ICamera;
@@ -67,6 +73,23 @@ struct OrbitalAnimation;
  * @par Inertia
  * Rotation and pan both support damping-based inertia via @ref onUpdate.
  *
+ * @par Depth-assisted pivot and zoom
+ * With @ref setDepthQuery, @c eSetPivotAtCursor first applies the usual COI on the view ray, then moves the
+ * pivot to the surface point under the cursor when the host's lookup reports it (the view recenters on it).
+ * Perspective dolly zoom issues a lookup at the cursor and, once a hit is known, scales eye and COI about
+ * that point, so the surface under the cursor stays put while zooming; until then, and whenever the camera
+ * rotated or moved otherwise since the lookup, it zooms toward the usual cursor point at orbit distance.
+ * Zoom anchoring is skipped in @c OrbitPivotMode::eFixed and for orthographic cameras (whose zoom-to-cursor
+ * is already exact).
+ *
+ * @par Latency compensation
+ * With @ref setLatencyCompensation > 0 the pose written to the camera during a rotate or pan drag leads the
+ * true drag pose by the estimated gesture velocity × lead time, hiding a deep render queue. The lead is
+ * clamped by @ref setLatencyCompensationMaxAngle and recomputed from the true pose on every sample. On release
+ * @ref onUpdate blends it out over about 0.1 s, so the camera settles where the drag ended without a jump back;
+ * a new drag that starts mid-blend adopts the displayed pose. Pan lead is not applied in
+ * @c OrbitPivotMode::eFixed (the camera itself carries the pan there).
+ *
  * @par Animation (fit + view presets)
  * Perspective @ref fitToAABB uses a single eased lerp (COI + orbit distance); duration from
  * @ref setFitAnimationDuration (default ~0.5s). Use duration @c 0 for an instant snap. Animated view
@@ -96,7 +119,8 @@ class VNE_INTERACTION_API TrackballManipulator final : public CameraManipulatorB
     /**
      * @brief Dispatch a camera action.
      * Handles: eBeginRotate, eRotateDelta, eEndRotate, eBeginPan, ePanDelta, eEndPan,
-     *          eZoomAtCursor, eOrbitPanModifier, eResetView, eSetPivotAtCursor (COI on view ray; ignores payload x/y).
+     *          eZoomAtCursor, eOrbitPanModifier, eResetView, eSetPivotAtCursor (COI on view ray; surface under
+     *          payload x/y once an attached IDepthQuery reports it).
      */
     bool onAction(CameraActionType action, const CameraCommandPayload& payload, double delta_time) noexcept override;
 
@@ -115,6 +139,21 @@ class VNE_INTERACTION_API TrackballManipulator final : public CameraManipulatorB
     /** Reset all interaction state (velocities, drag tracking). */
     void resetState() noexcept override;
 
+    /** Adopt a handed-off pose: COI (unless @c eFixed), orbit distance and orientation; stops inertia and animation. */
+    void onHandoff(const CameraPoseSnapshot& pose) noexcept override;
+
+    /**
+     * @brief Drag / inertia rates and the settle time of the remaining glide, or the rates of a running fit /
+     * view animation (sampled one short step ahead) and its remaining duration.
+     */
+    [[nodiscard]] CameraMotionState getMotionState() const noexcept override;
+
+    /**
+     * @brief Running fit / view animation sampled ahead; otherwise the drag rate continued, or rotation and pan
+     * inertia integrated over their exponential decay (orbiting about the center of interest).
+     */
+    [[nodiscard]] CameraPoseSnapshot predictPose(double seconds_ahead) const noexcept override;
+
     // isEnabled / setEnabled inherited from CameraManipulatorBase
 
     // -------------------------------------------------------------------------
@@ -143,6 +182,13 @@ class VNE_INTERACTION_API TrackballManipulator final : public CameraManipulatorB
     void setPivot(const vne::math::Vec3f& pos,
                   CenterOfInterestSpace space = CenterOfInterestSpace::eWorldSpace) noexcept;
 
+    /**
+     * @brief Attach a host surface lookup for cursor-anchored pivot and zoom (null detaches).
+     * Pending requests on the previous query are cancelled.
+     */
+    void setDepthQuery(std::shared_ptr<IDepthQuery> query) noexcept;
+    [[nodiscard]] const std::shared_ptr<IDepthQuery>& getDepthQuery() const noexcept { return depth_query_; }
+
     /** Get the current center of interest in world space. */
     [[nodiscard]] vne::math::Vec3f getCenterOfInterestWorld() const noexcept { return coi_world_; }
 
@@ -234,6 +280,20 @@ class VNE_INTERACTION_API TrackballManipulator final : public CameraManipulatorB
     void setPanInertiaEnabled(bool enabled) noexcept { pan_inertia_enabled_ = enabled; }
     [[nodiscard]] bool isPanInertiaEnabled() const noexcept { return pan_inertia_enabled_; }
 
+    /**
+     * @brief Display lead for rotate/pan drags in seconds (0 = off, default). Clamped to [0, 0.1].
+     * Set to roughly the render pipeline latency (frames in flight × frame time).
+     */
+    void setLatencyCompensation(float lead_time_s) noexcept;
+    [[nodiscard]] float getLatencyCompensation() const noexcept { return latency_lead_s_; }
+
+    /**
+     * @brief Confidence clamp: largest extrapolated rotation in degrees (default 8). Pan lead is limited to the
+     * same angle subtended at the orbit distance. Clamped to [0, 45].
+     */
+    void setLatencyCompensationMaxAngle(float degrees) noexcept;
+    [[nodiscard]] float getLatencyCompensationMaxAngle() const noexcept { return latency_max_angle_deg_; }
+
     /** When false, ignore rotate actions. Zoom uses manipulator @c setEnabled. */
     void setRotateEnabled(bool enabled) noexcept { rotate_enabled_ = enabled; }
     [[nodiscard]] bool isRotateEnabled() const noexcept { return rotate_enabled_; }
@@ -246,12 +306,59 @@ class VNE_INTERACTION_API TrackballManipulator final : public CameraManipulatorB
      * @brief Fit camera to an AABB with smooth animation.
      * @param min_world AABB min corner in world space
      * @param max_world AABB max corner in world space
+     * @param mode      Default: the box's circumscribed sphere. @c FitBoundsMode::eFrustum (perspective) moves
+     *                  to the closest distance at which all eight corners are inside the view, keeping the
+     *                  orientation; elongated boxes then fill the screen.
      */
-    void fitToAABB(const vne::math::Vec3f& min_world, const vne::math::Vec3f& max_world) noexcept;
+    void fitToAABB(const vne::math::Vec3f& min_world,
+                   const vne::math::Vec3f& max_world,
+                   FitBoundsMode mode = FitBoundsMode::eBoundingSphere) noexcept;
+
+    /**
+     * @brief Fit camera to a point set (point cloud, mesh vertices) with the same animation as @ref fitToAABB.
+     *
+     * The bounds are reduced in parallel (see bounds_reduction.h). @c FitBoundsMode::eBoundingSphere frames the
+     * tightest sphere about the bounds center; @c FitBoundsMode::eViewExtents frames the extents seen in the
+     * current view orientation, which is tighter for elongated sets. @c FitBoundsMode::eFrustum moves to the
+     * closest distance at which every point is inside the perspective view (orthographic: view extents).
+     * Empty or all-NaN input is ignored.
+     * @param executor Runs the reduction tasks on the host's job system (empty: shared pool)
+     */
+    void fitToPoints(std::span<const vne::math::Vec3f> points,
+                     FitBoundsMode mode = FitBoundsMode::eBoundingSphere,
+                     const ControllerExecutor& executor = {}) noexcept;
+
+    /** @brief As @ref fitToPoints, over a set of boxes (e.g. per-object bounds); invalid boxes are skipped. */
+    void fitToBoxes(std::span<const BoundingBox> boxes,
+                    FitBoundsMode mode = FitBoundsMode::eBoundingSphere,
+                    const ControllerExecutor& executor = {}) noexcept;
 
     /** Get world units per pixel (useful for screen-to-world conversions). */
     [[nodiscard]] float getWorldUnitsPerPixel() const noexcept;
 
+    // -------------------------------------------------------------------------
+    // State serialization
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Encode settings (speeds, damping, inertia and DOF flags, pivot / zoom / projection modes,
+     * latency compensation, world up, pivot) and the camera pose into a compact versioned blob.
+     *
+     * Little-endian on every host; the pose is omitted when no camera is attached.
+     */
+    [[nodiscard]] std::vector<std::uint8_t> serialize() const;
+
+    /**
+     * @brief Restore a blob written by @ref serialize.
+     *
+     * Fields are assigned directly; the stored pose (and scene scale) reaches the attached camera in a
+     * single apply. Gestures, inertia and animations in flight are dropped.
+     *
+     * @return false, leaving the manipulator unchanged, if the blob is truncated, corrupt, of another
+     *         kind or from a newer format version
+     */
+    bool deserialize(const std::uint8_t* data, std::size_t size) noexcept;
+
    protected:
     /**
      * @brief Zoom dispatch: eSceneScale → applySceneScaleZoom; eChangeFov → applyFovZoom only (no dolly
@@ -265,6 +372,13 @@ class VNE_INTERACTION_API TrackballManipulator final : public CameraManipulatorB
     void syncFromCamera() noexcept;
     void applyToCamera() noexcept;
     void onPivotChanged() noexcept;
+    /** Shared body of fitToPoints / fitToBoxes (defined and instantiated in the .cpp). */
+    template <typename T>
+    void fitToSet(std::span<const T> items, FitBoundsMode mode, const ControllerExecutor& executor) noexcept;
+    /** Frame @p volume (shared tail of the fitTo* overloads). */
+    void fitToVolume(const FitVolume& volume) noexcept;
+    /** Perspective fit: move the COI and orbit distance, eased unless fit animation is off. */
+    void fitToOrbit(const vne::math::Vec3f& coi, float distance) noexcept;
 
     void syncCoiAndDistanceFromCamera() noexcept;
 
@@ -284,6 +398,18 @@ class VNE_INTERACTION_API TrackballManipulator final : public CameraManipulatorB
     /** EMA pan velocity from drag; skips update if @a delta_time is invalid for sampling. */
     void updatePanInertiaFromDragSample(const vne::math::Vec3f& delta_world, double delta_time) noexcept;
 
+    // ---- latency compensation ---------------------------------------------------
+    /** Recompute the display lead from the current gesture velocity (no-op when compensation is off). */
+    void updateLatencyLead(bool rotating, double delta_time) noexcept;
+    /** Hand the current lead to @ref settleLatencyLead on release (eEndRotate / eEndPan). */
+    void releaseLatencyLead() noexcept;
+    /** Decay a released lead by @p delta_time and write the blended pose; drops it once negligible. */
+    void settleLatencyLead(double delta_time) noexcept;
+    /** Forget the lead without touching the camera. */
+    void clearLatencyLead() noexcept;
+    /** Drop any display lead and write the true pose back to the camera. */
+    void dropLatencyLead() noexcept;
+
     // ---- zoom -------------------------------------------------------------------
     /** Ortho zoom-to-cursor or perspective orbit dolly (zoom_speed_ applied via pow). */
     void applyDolly(float factor, float mx, float my) noexcept override;
@@ -291,6 +417,16 @@ class VNE_INTERACTION_API TrackballManipulator final : public CameraManipulatorB
     // ---- inertia ----------------------------------------------------------------
     void applyInertia(double delta_time) noexcept;
 
+    // ---- depth queries ----------------------------------------------------------
+    /** World ray through viewport pixel (@a mx, @a my) for the current orbit pose. */
+    [[nodiscard]] DepthRequest makeDepthRequest(float mx, float my) const noexcept;
+    /** Poll pending pivot / zoom requests and apply the results that arrived. */
+    void pollDepthRequests() noexcept;
+    /** Cancel pending requests and forget the zoom anchor. */
+    void cancelDepthRequests() noexcept;
+    /** @return true if the zoom anchor is known for cursor (@a mx, @a my) and the camera has not moved since */
+    [[nodiscard]] bool isZoomAnchorUsable(float mx, float my) const noexcept;
+
     // ---- camera helpers ---------------------------------------------------------
     [[nodiscard]] bool isPerspective() const noexcept;
     [[nodiscard]] bool isOrthographic() const noexcept;
@@ -330,6 +466,27 @@ class VNE_INTERACTION_API TrackballManipulator final : public CameraManipulatorB
     bool rotate_enabled_ = true;
     bool pan_enabled_ = true;
 
+    // Latency compensation (display-only lead; true pose stays in orbital_rot_ / coi_world_)
+    float latency_lead_s_ = 0.0f;
+    float latency_max_angle_deg_ = 8.0f;
+    vne::math::Quatf latency_rot_lead_{0.0f, 0.0f, 0.0f, 1.0f};
+    vne::math::Vec3f latency_pan_lead_{0.0f, 0.0f, 0.0f};
+    vne::math::Quatf latency_prev_rot_{0.0f, 0.0f, 0.0f, 1.0f};  //!< True orientation at the previous drag sample
+    vne::math::Vec3f latency_rot_velocity_{0.0f, 0.0f, 0.0f};    //!< EMA angular velocity (rad/s, world axis)
+    bool latency_lead_active_ = false;
+    bool latency_lead_releasing_ = false;  //!< Released: onUpdate blends the lead out
+
+    // Depth-assisted pivot / zoom (see setDepthQuery)
+    std::shared_ptr<IDepthQuery> depth_query_;
+    IDepthQuery::RequestId pivot_depth_request_ = IDepthQuery::kNoRequest;
+    IDepthQuery::RequestId zoom_depth_request_ = IDepthQuery::kNoRequest;
+    vne::math::Vec2f zoom_depth_px_{0.0f, 0.0f};                       //!< Cursor of the pending zoom request
+    vne::math::Quatf zoom_depth_orientation_{0.0f, 0.0f, 0.0f, 1.0f};  //!< Orbit orientation at that request
+    vne::math::Vec3f zoom_anchor_world_{0.0f, 0.0f, 0.0f};             //!< Surface point zoomed toward
+    vne::math::Vec2f zoom_anchor_px_{0.0f, 0.0f};                      //!< Cursor the anchor belongs to
+    vne::math::Vec3f zoom_anchor_eye_{0.0f, 0.0f, 0.0f};               //!< Eye after the last anchored step
+    bool zoom_anchor_valid_ = false;
+
     std::unique_ptr<OrbitalAnimation> anim_;
     float fit_anim_duration_ = 0.5f;
     bool orbit_animation_enabled_ = true;
@@ -0,0 +1,154 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file viewport_router.h
+ * @brief ViewportRouter — dispatches one window event stream to per-viewport controllers.
+ *
+ * Multi-viewport windows (quad views, slice layouts, video walls) feed every window event to the router;
+ * it picks the viewport, rewrites the pointer position to viewport-local pixels and forwards the event to
+ * that viewport's controller:
+ *
+ * @code
+ * vne::interaction::ViewportRouter router;
+ * router.addViewport(axial_ctrl, {0.0f, 0.0f, 640.0f, 360.0f});
+ * router.addViewport(volume_ctrl, {640.0f, 0.0f, 640.0f, 360.0f});
+ * // window callbacks:
+ * router.onEvent(event, dt);
+ * // per frame:
+ * router.onUpdate(dt);
+ * @endcode
+ *
+ * @par Routing rules
+ *   - Pointer moves, presses, double-clicks and scrolls go to the viewport under the cursor. Rectangles are
+ *     half-open ([x, x + width) × [y, y + height)), so a pixel on a shared border belongs to exactly one
+ *     viewport. Where rectangles overlap, the one added last wins.
+ *   - A button press captures the pointer: until every button is released, all pointer events go to that
+ *     viewport, even when the cursor leaves it (local coordinates may then be negative or exceed its size).
+ *   - A button press also focuses its viewport. Key presses go to the focused viewport. When focus moves,
+ *     keys still held are handed over: the old viewport gets a key release and the new one a key press.
+ *   - Touch events follow the pointer rules: a touch press goes to the viewport under the finger, focuses and
+ *     captures it, and its moves and release go there too.
+ *
+ * @par Hit testing
+ * Small layouts are scanned linearly. From @ref ViewportRouter::kGridThreshold viewports on, a uniform grid
+ * over the layout bounds is rebuilt after any rectangle change, and a hit test only checks the viewports
+ * overlapping one grid cell.
+ */
+
+#include "vertexnova/interaction/export.h"
+#include "vertexnova/interaction/camera_controller.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace vne::events {
+class Event;
+}
+
+namespace vne::interaction {
+
+/**
+ * @brief Viewport rectangle in window pixels (origin and size, same axes as the window's mouse events).
+ */
+struct VNE_INTERACTION_API ViewportRect {
+    float x = 0.0f;       //!< Left edge (pixels)
+    float y = 0.0f;       //!< Top edge (pixels)
+    float width = 0.0f;   //!< Width (pixels)
+    float height = 0.0f;  //!< Height (pixels)
+
+    /** @return true if window point (@p px, @p py) lies inside (left / top edges inclusive) */
+    [[nodiscard]] bool contains(float px, float py) const noexcept {
+        return px >= x && px < x + width && py >= y && py < y + height;
+    }
+};
+
+/**
+ * @brief Set of viewport rectangles with their controllers, fed from one window event stream.
+ *
+ * @threadsafe Not thread-safe: call all methods from the window event thread.
+ */
+class VNE_INTERACTION_API ViewportRouter {
+   public:
+    static constexpr std::size_t kNoViewport = static_cast<std::size_t>(-1);
+    static constexpr std::size_t kGridThreshold = 16;  //!< Viewport count from which hit tests use the grid
+
+    ViewportRouter();
+    ~ViewportRouter();
+
+    ViewportRouter(const ViewportRouter&) = delete;
+    ViewportRouter& operator=(const ViewportRouter&) = delete;
+    ViewportRouter(ViewportRouter&&) noexcept;
+    ViewportRouter& operator=(ViewportRouter&&) noexcept;
+
+    // -------------------------------------------------------------------------
+    // Viewports
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Add a viewport on top of the existing ones and call @c onResize with its size.
+     * @return Index of the viewport, or @ref kNoViewport if @p controller is null
+     */
+    std::size_t addViewport(std::shared_ptr<ICameraController> controller, const ViewportRect& rect);
+
+    /** Move / resize the viewport at @p index (calls @c onResize when the size changed). */
+    void setViewportRect(std::size_t index, const ViewportRect& rect) noexcept;
+
+    /** Remove the viewport at @p index; later viewports shift down. @return The removed controller */
+    std::shared_ptr<ICameraController> removeViewport(std::size_t index) noexcept;
+
+    void clear() noexcept;
+
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /** @return Rectangle of the viewport at @p index (empty rectangle when out of range) */
+    [[nodiscard]] ViewportRect viewportRect(std::size_t index) const noexcept;
+
+    /** @return Controller of the viewport at @p index, or null when out of range */
+    [[nodiscard]] const std::shared_ptr<ICameraController>& controller(std::size_t index) const noexcept;
+
+    /** @return Topmost viewport containing window point (@p x, @p y), or @ref kNoViewport */
+    [[nodiscard]] std::size_t viewportAt(float x, float y) const noexcept;
+
+    // -------------------------------------------------------------------------
+    // Focus and capture
+    // -------------------------------------------------------------------------
+
+    /** Focus the viewport at @p index for keyboard events (@ref kNoViewport clears focus); held keys follow. */
+    void setFocusedViewport(std::size_t index) noexcept;
+
+    /** @return Viewport receiving key presses, or @ref kNoViewport */
+    [[nodiscard]] std::size_t focusedViewport() const noexcept;
+
+    /** @return Viewport holding the pointer capture (a button is down), or @ref kNoViewport */
+    [[nodiscard]] std::size_t capturedViewport() const noexcept;
+
+    // -------------------------------------------------------------------------
+    // Event feed
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Route a window event to one viewport's controller, in viewport-local coordinates.
+     * @return true if a controller received the event
+     */
+    bool onEvent(const vne::events::Event& event, double delta_time = 0.0) noexcept;
+
+    /** Call @c onUpdate on every viewport's controller, in order (see ControllerGroup for parallel updates). */
+    void onUpdate(double delta_time) noexcept;
+
+   private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace vne::interaction
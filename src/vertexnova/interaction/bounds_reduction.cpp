@@ -0,0 +1,452 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/bounds_reduction.h"
+
+#include "detail/work_stealing_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+
+namespace vne::interaction {
+
+namespace {
+
+constexpr std::size_t kBlock = 16;               //!< Lanes per block (SoA loops sized for auto-vectorization)
+constexpr std::size_t kParallelMin = 1u << 18;   //!< Smaller inputs are reduced on the caller
+constexpr std::size_t kMinTaskSize = 1u << 16;   //!< Elements per task, at least
+constexpr std::size_t kMaxTasks = 64;            //!< Partial results live on the stack
+constexpr float kFloatMax = std::numeric_limits<float>::max();
+
+/** Min / max along three axes. NaN candidates never win a comparison, so they are skipped. */
+struct Extent {
+    float lo[3] = {kFloatMax, kFloatMax, kFloatMax};
+    float hi[3] = {-kFloatMax, -kFloatMax, -kFloatMax};
+
+    void merge(const Extent& other) noexcept {
+        for (int a = 0; a < 3; ++a) {
+            lo[a] = other.lo[a] < lo[a] ? other.lo[a] : lo[a];
+            hi[a] = other.hi[a] > hi[a] ? other.hi[a] : hi[a];
+        }
+    }
+};
+
+/** Projection axes: component a of an extent is the minimum along lo[a] and the maximum along hi[a]. */
+struct Frame {
+    float lo[3][3];
+    float hi[3][3];
+};
+
+void setAxis(float axis[3], const vne::math::Vec3f& v) noexcept {
+    axis[0] = v.x();
+    axis[1] = v.y();
+    axis[2] = v.z();
+}
+
+/** Min and max along the same three axes. */
+Frame makeFrame(const vne::math::Vec3f& right, const vne::math::Vec3f& up, const vne::math::Vec3f& forward) noexcept {
+    Frame frame{};
+    setAxis(frame.lo[0], right);
+    setAxis(frame.lo[1], up);
+    setAxis(frame.lo[2], forward);
+    setAxis(frame.hi[0], right);
+    setAxis(frame.hi[1], up);
+    setAxis(frame.hi[2], forward);
+    return frame;
+}
+
+float dot(const float axis[3], float x, float y, float z) noexcept {
+    return axis[0] * x + axis[1] * y + axis[2] * z;
+}
+
+/** Support of the half extents (@p hx, @p hy, @p hz) along @p axis: the box corners' spread about the center. */
+float support(const float axis[3], float hx, float hy, float hz) noexcept {
+    return std::abs(axis[0]) * hx + std::abs(axis[1]) * hy + std::abs(axis[2]) * hz;
+}
+
+BoundingBox toBox(const Extent& e) noexcept {
+    BoundingBox box;
+    if (e.lo[0] <= e.hi[0] && e.lo[1] <= e.hi[1] && e.lo[2] <= e.hi[2]) {
+        box.min_corner = vne::math::Vec3f(e.lo[0], e.lo[1], e.lo[2]);
+        box.max_corner = vne::math::Vec3f(e.hi[0], e.hi[1], e.hi[2]);
+    }
+    return box;
+}
+
+/**
+ * @brief Reduce [@p begin, @p end) with per-lane accumulators.
+ *
+ * @p load(i, lo, hi) writes the three min and max candidates of element i; a block of them is gathered
+ * into SoA arrays and folded into the lanes with branch-free selects. Full blocks are gathered without a
+ * bounds test; the partial block at the end is padded with the fold's identity once.
+ */
+template <typename Load>
+Extent reduceRange(std::size_t begin, std::size_t end, const Load& load) noexcept {
+    float lo[3][kBlock];
+    float hi[3][kBlock];
+    for (int a = 0; a < 3; ++a) {
+        std::fill(lo[a], lo[a] + kBlock, kFloatMax);
+        std::fill(hi[a], hi[a] + kBlock, -kFloatMax);
+    }
+    float block_lo[3][kBlock];
+    float block_hi[3][kBlock];
+    auto gather = [&](std::size_t first, std::size_t k) noexcept {
+        float c_lo[3] = {kFloatMax, kFloatMax, kFloatMax};
+        float c_hi[3] = {-kFloatMax, -kFloatMax, -kFloatMax};
+        load(first + k, c_lo, c_hi);
+        for (int a = 0; a < 3; ++a) {
+            block_lo[a][k] = c_lo[a];
+            block_hi[a][k] = c_hi[a];
+        }
+    };
+    auto fold = [&]() noexcept {
+        for (int a = 0; a < 3; ++a) {
+            for (std::size_t k = 0; k < kBlock; ++k) {
+                lo[a][k] = block_lo[a][k] < lo[a][k] ? block_lo[a][k] : lo[a][k];
+                hi[a][k] = block_hi[a][k] > hi[a][k] ? block_hi[a][k] : hi[a][k];
+            }
+        }
+    };
+
+    const std::size_t full_end = begin + (end - begin) / kBlock * kBlock;
+    for (std::size_t first = begin; first < full_end; first += kBlock) {
+        for (std::size_t k = 0; k < kBlock; ++k) {
+            gather(first, k);
+        }
+        fold();
+    }
+    if (full_end < end) {
+        const std::size_t count = end - full_end;
+        for (std::size_t k = 0; k < count; ++k) {
+            gather(full_end, k);
+        }
+        for (int a = 0; a < 3; ++a) {
+            std::fill(block_lo[a] + count, block_lo[a] + kBlock, kFloatMax);
+            std::fill(block_hi[a] + count, block_hi[a] + kBlock, -kFloatMax);
+        }
+        fold();
+    }
+    Extent out;
+    for (std::size_t k = 0; k < kBlock; ++k) {
+        Extent lane;
+        for (int a = 0; a < 3; ++a) {
+            lane.lo[a] = lo[a][k];
+            lane.hi[a] = hi[a][k];
+        }
+        out.merge(lane);
+    }
+    return out;
+}
+
+/** Pool for callers without an executor, shared process-wide and started on first use. */
+struct SharedPool {
+    std::mutex mutex;  //!< Held for a whole parallelFor (the pool is not re-entrant)
+    detail::WorkStealingPool pool{ControllerGroup::defaultWorkerThreads()};
+};
+
+SharedPool& sharedPool() {
+    static SharedPool shared;
+    return shared;
+}
+
+/** Reduce [0, @p count) in contiguous tasks on @p executor or the shared pool; serial when small or busy. */
+template <typename Load>
+Extent reduce(std::size_t count, const ControllerExecutor& executor, const Load& load) noexcept {
+    const std::size_t tasks = count < kParallelMin ? 1 : std::min(kMaxTasks, count / kMinTaskSize);
+    if (tasks > 1) {
+        std::array<Extent, kMaxTasks> partial{};
+        const std::size_t per_task = (count + tasks - 1) / tasks;
+        const std::function<void(std::size_t)> task = [&](std::size_t t) {
+            const std::size_t begin = std::min(count, t * per_task);
+            partial[t] = reduceRange(begin, std::min(count, begin + per_task), load);
+        };
+        bool done = false;
+        if (executor) {
+            executor(tasks, task);
+            done = true;
+        } else {
+            SharedPool& shared = sharedPool();
+            std::unique_lock<std::mutex> lock(shared.mutex, std::try_to_lock);
+            if (lock.owns_lock()) {
+                shared.pool.parallelFor(tasks, task);
+                done = true;
+            }
+        }
+        if (done) {
+            Extent out;
+            for (std::size_t t = 0; t < tasks; ++t) {
+                out.merge(partial[t]);
+            }
+            return out;
+        }
+    }
+    return reduceRange(0, count, load);
+}
+
+/** Min / max of @p points along the frame axes. */
+Extent projectExtent(std::span<const vne::math::Vec3f> points,
+                     const Frame& frame,
+                     const ControllerExecutor& executor) noexcept {
+    const vne::math::Vec3f* p = points.data();
+    return reduce(points.size(), executor, [p, &frame](std::size_t i, float lo[3], float hi[3]) noexcept {
+        const float x = p[i].x();
+        const float y = p[i].y();
+        const float z = p[i].z();
+        for (int a = 0; a < 3; ++a) {
+            lo[a] = dot(frame.lo[a], x, y, z);
+            hi[a] = dot(frame.hi[a], x, y, z);
+        }
+    });
+}
+
+/** Min / max of the corners of @p boxes along the frame axes: the projected center +/- the support. */
+Extent projectExtent(std::span<const BoundingBox> boxes,
+                     const Frame& frame,
+                     const ControllerExecutor& executor) noexcept {
+    const BoundingBox* b = boxes.data();
+    return reduce(boxes.size(), executor, [b, &frame](std::size_t i, float lo[3], float hi[3]) noexcept {
+        if (!b[i].isValid()) {
+            return;
+        }
+        const vne::math::Vec3f c = b[i].center();
+        const vne::math::Vec3f h = b[i].halfExtents();
+        for (int a = 0; a < 3; ++a) {
+            lo[a] = dot(frame.lo[a], c.x(), c.y(), c.z()) - support(frame.lo[a], h.x(), h.y(), h.z());
+            hi[a] = dot(frame.hi[a], c.x(), c.y(), c.z()) + support(frame.hi[a], h.x(), h.y(), h.z());
+        }
+    });
+}
+
+// ---------------------------------------------------------------------------
+// Fit volumes (shared by the point and box overloads)
+// ---------------------------------------------------------------------------
+
+bool isFinite(const vne::math::Vec3f& v) noexcept {
+    return std::isfinite(v.x()) && std::isfinite(v.y()) && std::isfinite(v.z());
+}
+
+template <typename T>
+bool fitVolume(std::span<const T> items,
+               const vne::math::Vec3f& right,
+               const vne::math::Vec3f& up,
+               const vne::math::Vec3f& forward,
+               FitBoundsMode mode,
+               FitVolume& out,
+               const ControllerExecutor& executor) noexcept {
+    FitVolume volume;
+    if (mode != FitBoundsMode::eBoundingSphere) {
+        const BoundingBox extents = computeViewExtents(items, right, up, forward, executor);
+        if (!extents.isValid()) {
+            return false;
+        }
+        const vne::math::Vec3f c = extents.center();
+        const vne::math::Vec3f h = extents.halfExtents();
+        volume.center = right * c.x() + up * c.y() + forward * c.z();
+        volume.half_right = h.x();
+        volume.half_up = h.y();
+        volume.half_depth = h.z();
+    } else {
+        const BoundingBox bounds = computeBounds(items, executor);
+        if (!bounds.isValid()) {
+            return false;
+        }
+        volume.center = bounds.center();
+        const float radius = computeBoundingRadius(items, volume.center, executor);
+        volume.half_right = radius;
+        volume.half_up = radius;
+    }
+    if (!isFinite(volume.center) || !std::isfinite(volume.half_right) || !std::isfinite(volume.half_up)
+        || !std::isfinite(volume.half_depth)) {
+        return false;
+    }
+    out = volume;
+    return true;
+}
+
+/**
+ * @brief Closest eye along -@p forward whose frustum holds @p items.
+ *
+ * With x, y, z the coordinates along right, up, forward and e the eye, an item is inside the horizontal
+ * planes when x - tx z <= e_x - tx e_z and x + tx z >= e_x + tx e_z. One pass gives A = max(x - tx z) and
+ * B = min(x + tx z) (likewise C, D vertically, and the depth range); the eye is then centered between the
+ * planes of the tighter axis at e_z = min((B - A) / 2tx, (D - C) / 2ty).
+ */
+template <typename T>
+bool frustumFit(std::span<const T> items,
+                const vne::math::Vec3f& right,
+                const vne::math::Vec3f& up,
+                const vne::math::Vec3f& forward,
+                float tan_half_x,
+                float tan_half_y,
+                FrustumFit& out,
+                const ControllerExecutor& executor) noexcept {
+    if (!(tan_half_x > 0.0f) || !(tan_half_y > 0.0f) || !std::isfinite(tan_half_x) || !std::isfinite(tan_half_y)) {
+        return false;
+    }
+    Frame frame{};
+    setAxis(frame.lo[0], right + forward * tan_half_x);
+    setAxis(frame.hi[0], right - forward * tan_half_x);
+    setAxis(frame.lo[1], up + forward * tan_half_y);
+    setAxis(frame.hi[1], up - forward * tan_half_y);
+    setAxis(frame.lo[2], forward);
+    setAxis(frame.hi[2], forward);
+    const Extent e = projectExtent(items, frame, executor);
+    if (!(e.lo[2] <= e.hi[2])) {
+        return false;  // nothing reduced
+    }
+    const float eye_z =
+        std::min((e.lo[0] - e.hi[0]) / (2.0f * tan_half_x), (e.lo[1] - e.hi[1]) / (2.0f * tan_half_y));
+    const float eye_x = 0.5f * (e.lo[0] + e.hi[0]);
+    const float eye_y = 0.5f * (e.lo[1] + e.hi[1]);
+    FrustumFit fit;
+    fit.eye = right * eye_x + up * eye_y + forward * eye_z;
+    fit.distance = 0.5f * (e.lo[2] + e.hi[2]) - eye_z;
+    fit.center = fit.eye + forward * fit.distance;
+    if (!isFinite(fit.eye) || !std::isfinite(fit.distance)) {
+        return false;
+    }
+    out = fit;
+    return true;
+}
+
+}  // namespace
+
+// ---------------------------------------------------------------------------
+// Reductions
+// ---------------------------------------------------------------------------
+
+BoundingBox computeBounds(std::span<const vne::math::Vec3f> points, const ControllerExecutor& executor) noexcept {
+    const vne::math::Vec3f* p = points.data();
+    return toBox(reduce(points.size(), executor, [p](std::size_t i, float lo[3], float hi[3]) noexcept {
+        lo[0] = hi[0] = p[i].x();
+        lo[1] = hi[1] = p[i].y();
+        lo[2] = hi[2] = p[i].z();
+    }));
+}
+
+BoundingBox computeBounds(std::span<const BoundingBox> boxes, const ControllerExecutor& executor) noexcept {
+    const BoundingBox* b = boxes.data();
+    return toBox(reduce(boxes.size(), executor, [b](std::size_t i, float lo[3], float hi[3]) noexcept {
+        if (!b[i].isValid()) {
+            return;
+        }
+        lo[0] = b[i].min_corner.x();
+        lo[1] = b[i].min_corner.y();
+        lo[2] = b[i].min_corner.z();
+        hi[0] = b[i].max_corner.x();
+        hi[1] = b[i].max_corner.y();
+        hi[2] = b[i].max_corner.z();
+    }));
+}
+
+float computeBoundingRadius(std::span<const vne::math::Vec3f> points,
+                            const vne::math::Vec3f& center,
+                            const ControllerExecutor& executor) noexcept {
+    const vne::math::Vec3f* p = points.data();
+    const float cx = center.x();
+    const float cy = center.y();
+    const float cz = center.z();
+    const Extent e = reduce(points.size(), executor, [=](std::size_t i, float /*lo*/[3], float hi[3]) noexcept {
+        const float dx = p[i].x() - cx;
+        const float dy = p[i].y() - cy;
+        const float dz = p[i].z() - cz;
+        hi[0] = dx * dx + dy * dy + dz * dz;
+    });
+    return e.hi[0] > 0.0f ? std::sqrt(e.hi[0]) : 0.0f;
+}
+
+float computeBoundingRadius(std::span<const BoundingBox> boxes,
+                            const vne::math::Vec3f& center,
+                            const ControllerExecutor& executor) noexcept {
+    const BoundingBox* b = boxes.data();
+    const float cx = center.x();
+    const float cy = center.y();
+    const float cz = center.z();
+    const Extent e = reduce(boxes.size(), executor, [=](std::size_t i, float /*lo*/[3], float hi[3]) noexcept {
+        if (!b[i].isValid()) {
+            return;
+        }
+        // Farthest corner: the farther face on every axis
+        const float dx = std::max(std::abs(b[i].min_corner.x() - cx), std::abs(b[i].max_corner.x() - cx));
+        const float dy = std::max(std::abs(b[i].min_corner.y() - cy), std::abs(b[i].max_corner.y() - cy));
+        const float dz = std::max(std::abs(b[i].min_corner.z() - cz), std::abs(b[i].max_corner.z() - cz));
+        hi[0] = dx * dx + dy * dy + dz * dz;
+    });
+    return e.hi[0] > 0.0f ? std::sqrt(e.hi[0]) : 0.0f;
+}
+
+BoundingBox computeViewExtents(std::span<const vne::math::Vec3f> points,
+                               const vne::math::Vec3f& right,
+                               const vne::math::Vec3f& up,
+                               const vne::math::Vec3f& forward,
+                               const ControllerExecutor& executor) noexcept {
+    return toBox(projectExtent(points, makeFrame(right, up, forward), executor));
+}
+
+BoundingBox computeViewExtents(std::span<const BoundingBox> boxes,
+                               const vne::math::Vec3f& right,
+                               const vne::math::Vec3f& up,
+                               const vne::math::Vec3f& forward,
+                               const ControllerExecutor& executor) noexcept {
+    return toBox(projectExtent(boxes, makeFrame(right, up, forward), executor));
+}
+
+// ---------------------------------------------------------------------------
+// Fit volumes
+// ---------------------------------------------------------------------------
+
+bool computeFitVolume(std::span<const vne::math::Vec3f> points,
+                      const vne::math::Vec3f& right,
+                      const vne::math::Vec3f& up,
+                      const vne::math::Vec3f& forward,
+                      FitBoundsMode mode,
+                      FitVolume& out,
+                      const ControllerExecutor& executor) noexcept {
+    return fitVolume(points, right, up, forward, mode, out, executor);
+}
+
+bool computeFitVolume(std::span<const BoundingBox> boxes,
+                      const vne::math::Vec3f& right,
+                      const vne::math::Vec3f& up,
+                      const vne::math::Vec3f& forward,
+                      FitBoundsMode mode,
+                      FitVolume& out,
+                      const ControllerExecutor& executor) noexcept {
+    return fitVolume(boxes, right, up, forward, mode, out, executor);
+}
+
+bool computeFrustumFit(std::span<const vne::math::Vec3f> points,
+                       const vne::math::Vec3f& right,
+                       const vne::math::Vec3f& up,
+                       const vne::math::Vec3f& forward,
+                       float tan_half_x,
+                       float tan_half_y,
+                       FrustumFit& out,
+                       const ControllerExecutor& executor) noexcept {
+    return frustumFit(points, right, up, forward, tan_half_x, tan_half_y, out, executor);
+}
+
+bool computeFrustumFit(std::span<const BoundingBox> boxes,
+                       const vne::math::Vec3f& right,
+                       const vne::math::Vec3f& up,
+                       const vne::math::Vec3f& forward,
+                       float tan_half_x,
+                       float tan_half_y,
+                       FrustumFit& out,
+                       const ControllerExecutor& executor) noexcept {
+    return frustumFit(boxes, right, up, forward, tan_half_x, tan_half_y, out, executor);
+}
+
+}  // namespace vne::interaction
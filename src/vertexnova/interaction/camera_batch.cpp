@@ -0,0 +1,511 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/camera_batch.h"
+#include "interaction_utils.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace vne::interaction {
+
+namespace {
+
+constexpr float kMinOrbitDistance = 0.01f;  //!< Same limits as TrackballManipulator
+constexpr float kMaxOrbitDistance = 1e6f;
+constexpr float kDefaultRotationDamping = 8.0f;
+constexpr float kInertiaStopSpeed = 1e-4f;  //!< rad/s; TrackballManipulator's inertia threshold
+constexpr float kMinDamping = 1e-6f;
+constexpr float kAxisEpsilon = 1e-6f;
+
+[[nodiscard]] float sanitizeDistance(float distance) noexcept {
+    return std::isfinite(distance) ? std::clamp(distance, kMinOrbitDistance, kMaxOrbitDistance) : kMinOrbitDistance;
+}
+
+[[nodiscard]] vne::math::Quatf sanitizeOrientation(const vne::math::Quatf& q) noexcept {
+    const float len_sq = ((q.x * q.x + q.y * q.y) + q.z * q.z) + q.w * q.w;
+    if (!(len_sq > 0.0f) || !std::isfinite(len_sq)) {
+        return vne::math::Quatf(0.0f, 0.0f, 0.0f, 1.0f);
+    }
+    const float inv = 1.0f / std::sqrt(len_sq);
+    return vne::math::Quatf(q.x * inv, q.y * inv, q.z * inv, q.w * inv);
+}
+
+[[nodiscard]] bool finiteVec(const vne::math::Vec3f& v) noexcept {
+    return std::isfinite(v.x()) && std::isfinite(v.y()) && std::isfinite(v.z());
+}
+
+// Float Cody-Waite split of pi/2 and ln(2) (Cephes); k * hi is exact for the multiples reached here.
+constexpr float kTwoOverPi = 0.636619772367581343f;
+constexpr float kPio2Hi = 1.5703125f;
+constexpr float kPio2Mid = 4.837512969970703125e-4f;
+constexpr float kPio2Lo = 7.54978995489188216e-8f;
+constexpr float kInvLn2 = 1.44269504088896341f;
+constexpr float kLn2Hi = 0.693359375f;
+constexpr float kLn2Lo = -2.12194440e-4f;
+constexpr float kRoundMagic = 12582912.0f;  //!< 1.5 * 2^23: (x + m) - m rounds |x| < 2^22 to nearest
+constexpr float kExpMin = -87.0f;           //!< Decay exponents below this leave no speed (e^-87 ~ 1.6e-38)
+
+/**
+ * sin and cos of @p x (|x| < 1e5) from one reduction by pi/2 and the Cephes single-precision polynomials.
+ *
+ * Used instead of libm: straight-line float code that inlines into the vectorized lane loop, built only from
+ * IEEE add / multiply and exact rounding, so the results do not depend on the platform library. This file is
+ * compiled with FP contraction off (src/CMakeLists.txt), so no target fuses the polynomials into FMAs.
+ */
+inline void sinCos(float x, float& s, float& c) noexcept {
+    const float k = (x * kTwoOverPi + kRoundMagic) - kRoundMagic;
+    const float r = ((x - k * kPio2Hi) - k * kPio2Mid) - k * kPio2Lo;
+    const float r2 = r * r;
+    const float sr = r + r * r2 * ((-1.9515295891e-4f * r2 + 8.3321608736e-3f) * r2 - 1.6666654611e-1f);
+    const float cr = (1.0f - 0.5f * r2)
+                     + r2 * r2 * ((2.443315711809948e-5f * r2 - 1.388731625493765e-3f) * r2 + 4.166664568298827e-2f);
+    const std::int32_t q = static_cast<std::int32_t>(k);
+    const float ss = (q & 1) != 0 ? cr : sr;
+    const float cc = (q & 1) != 0 ? sr : cr;
+    s = (q & 2) != 0 ? -ss : ss;
+    c = ((q + 1) & 2) != 0 ? -cc : cc;
+}
+
+/** e^x for x in [kExpMin, 0] (Cephes polynomial, 2^k applied through the exponent bits). */
+inline float expDecay(float x) noexcept {
+    const float t = x * kInvLn2 + kRoundMagic;
+    const float k = t - kRoundMagic;
+    const float r = (x - k * kLn2Hi) - k * kLn2Lo;
+    float p = 1.9875691500e-4f;
+    p = p * r + 1.3981999507e-3f;
+    p = p * r + 8.3334519073e-3f;
+    p = p * r + 4.1665795894e-2f;
+    p = p * r + 1.6666665459e-1f;
+    p = p * r + 5.0000001201e-1f;
+    const float er = (p * (r * r) + r) + 1.0f;
+    // k is in the low mantissa bits of t; k >= -126 keeps the scale a normal float
+    const std::int32_t exponent = std::bit_cast<std::int32_t>(t) - std::bit_cast<std::int32_t>(kRoundMagic) + 127;
+    return er * std::bit_cast<float>(exponent << 23);
+}
+
+/** 1.0f when @p on, else 0.0f. Bit masking: GCC does not vectorize a select or a bool-to-float cast here. */
+inline float unitIf(bool on) noexcept {
+    return std::bit_cast<float>(-static_cast<std::int32_t>(on) & std::bit_cast<std::int32_t>(1.0f));
+}
+
+/**
+ * Inertia step of @p n cameras, one array per component; returns how many still spin.
+ *
+ * The body is straight-line float code so the loop vectorizes (GCC -O3, see -fopt-info-vec): cameras at
+ * rest are not branched around but carry zero weights, which leave them unchanged, and the quaternion is
+ * renormalized by one Newton step (exact to float precision for the near-unit result of a rotation, and free
+ * of the errno handling that keeps @c std::sqrt scalar). @c __restrict on parameters, not locals, is what
+ * lets GCC drop the aliasing checks.
+ */
+std::size_t stepInertiaLanes(std::size_t n,
+                             float dt,
+                             float* __restrict qx,
+                             float* __restrict qy,
+                             float* __restrict qz,
+                             float* __restrict qw,
+                             float* __restrict speed,
+                             const float* __restrict ax,
+                             const float* __restrict ay,
+                             const float* __restrict az,
+                             const float* __restrict damping) noexcept {
+    std::uint32_t live_count = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const float x = qx[i];
+        const float y = qy[i];
+        const float z = qz[i];
+        const float w = qw[i];
+        const float s = speed[i];
+        const float d = damping[i];
+        // Same decay as interactionDamp(s, 0, 1 / d, dt); below kExpMin no speed is left after this step
+        const float decay_arg = -dt / (1.0f / d);
+        const bool live = (std::abs(s) > kInertiaStopSpeed) & (d > kMinDamping);
+        const float spin = unitIf(live);
+        const float carry = unitIf(live & (decay_arg > kExpMin));
+        float sh = 0.0f;
+        float ch = 1.0f;
+        sinCos(0.5f * s * dt * spin, sh, ch);
+        const float rx = ax[i] * sh;
+        const float ry = ay[i] * sh;
+        const float rz = az[i] * sh;
+        // r * q: rotation about the world axis (q itself at rest: sh = 0, ch = 1)
+        const float nx = ch * x + rx * w + ry * z - rz * y;
+        const float ny = ch * y - rx * z + ry * w + rz * x;
+        const float nz = ch * z + rx * y - ry * x + rz * w;
+        const float nw = ch * w - rx * x - ry * y - rz * z;
+        const float inv = 1.5f - 0.5f * (((nx * nx + ny * ny) + nz * nz) + nw * nw);
+        const float scale = spin * inv + (1.0f - spin);
+        qx[i] = nx * scale;
+        qy[i] = ny * scale;
+        qz[i] = nz * scale;
+        qw[i] = nw * scale;
+        speed[i] = s * carry * expDecay(decay_arg * carry);
+        live_count += static_cast<std::uint32_t>(live);
+    }
+    return live_count;
+}
+
+}  // namespace
+
+// ---------------------------------------------------------------------------
+// Impl
+// ---------------------------------------------------------------------------
+
+class CameraBatch::Impl {
+    friend class CameraBatch;
+
+    /** Animation record; cold data, visited only while @ref animating is non-zero. */
+    struct Animation {
+        bool active = false;
+        vne::math::EaseType easing = vne::math::EaseType::eCubicInOut;
+        float elapsed = 0.0f;
+        float duration = 0.0f;
+        vne::math::Vec3f coi_from{0.0f, 0.0f, 0.0f};
+        vne::math::Vec3f coi_to{0.0f, 0.0f, 0.0f};
+        float dist_from = 0.0f;
+        float dist_to = 0.0f;
+        vne::math::Quatf rot_from{0.0f, 0.0f, 0.0f, 1.0f};
+        vne::math::Quatf rot_to{0.0f, 0.0f, 0.0f, 1.0f};
+    };
+
+    // Hot lanes, one float per camera each
+    std::vector<float> cx, cy, cz;      //!< Centre of interest
+    std::vector<float> dist;            //!< Orbit distance
+    std::vector<float> qx, qy, qz, qw;  //!< Orientation
+    std::vector<float> ax, ay, az;      //!< Unit inertia axis (world)
+    std::vector<float> speed;           //!< Inertia angular speed (rad/s); 0 = at rest
+    std::vector<float> damping;         //!< Rotation damping (1/s)
+
+    std::vector<Animation> anims;
+    std::size_t animating = 0;
+    std::size_t spinning = 0;  //!< Cameras live after the last inertia pass plus any started since (0 = skip it)
+
+    [[nodiscard]] std::array<std::vector<float>*, 13> lanes() noexcept {
+        return {&cx, &cy, &cz, &dist, &qx, &qy, &qz, &qw, &ax, &ay, &az, &speed, &damping};
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return dist.size(); }
+
+    void place(std::size_t i, const vne::math::Vec3f& c, float d, const vne::math::Quatf& q) noexcept {
+        cx[i] = c.x();
+        cy[i] = c.y();
+        cz[i] = c.z();
+        dist[i] = d;
+        qx[i] = q.x;
+        qy[i] = q.y;
+        qz[i] = q.z;
+        qw[i] = q.w;
+    }
+
+    void stopAnimation(std::size_t i) noexcept {
+        if (anims[i].active) {
+            anims[i].active = false;
+            --animating;
+        }
+    }
+
+    void stepAnimations(float dt) noexcept {
+        for (std::size_t i = 0; i < anims.size() && animating > 0; ++i) {
+            Animation& a = anims[i];
+            if (!a.active) {
+                continue;
+            }
+            a.elapsed += dt;
+            const float t = std::clamp(a.elapsed / a.duration, 0.0f, 1.0f);
+            if (t >= 1.0f) {
+                place(i, a.coi_to, a.dist_to, a.rot_to);
+                stopAnimation(i);
+                continue;
+            }
+            const float et = vne::math::ease(a.easing, t);
+            place(i,
+                  a.coi_from + (a.coi_to - a.coi_from) * et,
+                  a.dist_from + (a.dist_to - a.dist_from) * et,
+                  sanitizeOrientation(slerpQuat(a.rot_from, a.rot_to, et)));
+        }
+    }
+
+    /** Inertia step over every camera; returns how many still spin. */
+    std::size_t stepInertia(float dt) noexcept {
+        return stepInertiaLanes(size(), dt, qx.data(), qy.data(), qz.data(), qw.data(), speed.data(), ax.data(),
+                                ay.data(), az.data(), damping.data());
+    }
+
+    /** Right-handed look-at from the orbit: rows right / up / back, eye = coi + back·dist. Column-major. */
+    static void writeView(float x,
+                          float y,
+                          float z,
+                          float w,
+                          float coi_x,
+                          float coi_y,
+                          float coi_z,
+                          float d,
+                          float* m) noexcept {
+        const float rx = 1.0f - 2.0f * (y * y + z * z);
+        const float ry = 2.0f * (x * y + w * z);
+        const float rz = 2.0f * (x * z - w * y);
+        const float ux = 2.0f * (x * y - w * z);
+        const float uy = 1.0f - 2.0f * (x * x + z * z);
+        const float uz = 2.0f * (y * z + w * x);
+        const float bx = 2.0f * (x * z + w * y);
+        const float by = 2.0f * (y * z - w * x);
+        const float bz = 1.0f - 2.0f * (x * x + y * y);
+        m[0] = rx;
+        m[1] = ux;
+        m[2] = bx;
+        m[3] = 0.0f;
+        m[4] = ry;
+        m[5] = uy;
+        m[6] = by;
+        m[7] = 0.0f;
+        m[8] = rz;
+        m[9] = uz;
+        m[10] = bz;
+        m[11] = 0.0f;
+        // -R·eye with eye = coi + back·d; right and up are orthogonal to back
+        m[12] = -(rx * coi_x + ry * coi_y + rz * coi_z);
+        m[13] = -(ux * coi_x + uy * coi_y + uz * coi_z);
+        m[14] = -(bx * coi_x + by * coi_y + bz * coi_z) - d;
+        m[15] = 1.0f;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Construction
+// ---------------------------------------------------------------------------
+
+CameraBatch::CameraBatch(std::size_t capacity)
+    : impl_(std::make_unique<Impl>()) {
+    reserve(capacity);
+}
+
+CameraBatch::~CameraBatch() = default;
+CameraBatch::CameraBatch(CameraBatch&&) noexcept = default;
+CameraBatch& CameraBatch::operator=(CameraBatch&&) noexcept = default;
+
+// ---------------------------------------------------------------------------
+// Cameras
+// ---------------------------------------------------------------------------
+
+std::size_t CameraBatch::add(const vne::math::Vec3f& coi, float distance, const vne::math::Quatf& orientation) {
+    for (std::vector<float>* lane : impl_->lanes()) {
+        lane->push_back(0.0f);
+    }
+    impl_->anims.emplace_back();
+    const std::size_t i = impl_->size() - 1;
+    impl_->place(i, finiteVec(coi) ? coi : vne::math::Vec3f(0.0f, 0.0f, 0.0f), sanitizeDistance(distance),
+                 sanitizeOrientation(orientation));
+    impl_->ay[i] = 1.0f;
+    impl_->damping[i] = kDefaultRotationDamping;
+    return i;
+}
+
+void CameraBatch::remove(std::size_t index) noexcept {
+    if (index >= impl_->size()) {
+        return;
+    }
+    impl_->stopAnimation(index);
+    for (std::vector<float>* lane : impl_->lanes()) {
+        (*lane)[index] = lane->back();
+        lane->pop_back();
+    }
+    impl_->anims[index] = impl_->anims.back();
+    impl_->anims.pop_back();
+}
+
+void CameraBatch::clear() noexcept {
+    for (std::vector<float>* lane : impl_->lanes()) {
+        lane->clear();
+    }
+    impl_->anims.clear();
+    impl_->animating = 0;
+    impl_->spinning = 0;
+}
+
+void CameraBatch::reserve(std::size_t capacity) {
+    for (std::vector<float>* lane : impl_->lanes()) {
+        lane->reserve(capacity);
+    }
+    impl_->anims.reserve(capacity);
+}
+
+std::size_t CameraBatch::size() const noexcept {
+    return impl_->size();
+}
+
+// ---------------------------------------------------------------------------
+// Per-camera state
+// ---------------------------------------------------------------------------
+
+void CameraBatch::setOrbit(std::size_t index,
+                           const vne::math::Vec3f& coi,
+                           float distance,
+                           const vne::math::Quatf& orientation) noexcept {
+    if (index >= impl_->size() || !finiteVec(coi)) {
+        return;
+    }
+    impl_->stopAnimation(index);
+    impl_->speed[index] = 0.0f;
+    impl_->place(index, coi, sanitizeDistance(distance), sanitizeOrientation(orientation));
+}
+
+void CameraBatch::setInertia(std::size_t index, const vne::math::Vec3f& axis, float speed_rad_per_s) noexcept {
+    if (index >= impl_->size()) {
+        return;
+    }
+    impl_->stopAnimation(index);
+    const float len = axis.length();
+    if (!(len > kAxisEpsilon) || !std::isfinite(len) || !std::isfinite(speed_rad_per_s)) {
+        impl_->speed[index] = 0.0f;
+        return;
+    }
+    impl_->ax[index] = axis.x() / len;
+    impl_->ay[index] = axis.y() / len;
+    impl_->az[index] = axis.z() / len;
+    impl_->speed[index] = speed_rad_per_s;
+    ++impl_->spinning;
+}
+
+void CameraBatch::setRotationDamping(std::size_t index, float damping) noexcept {
+    if (index >= impl_->size() || !std::isfinite(damping)) {
+        return;
+    }
+    impl_->damping[index] = std::max(0.0f, damping);
+}
+
+void CameraBatch::stopInertia(std::size_t index) noexcept {
+    if (index < impl_->size()) {
+        impl_->speed[index] = 0.0f;
+    }
+}
+
+void CameraBatch::animateTo(std::size_t index,
+                            const vne::math::Vec3f& coi,
+                            float distance,
+                            const vne::math::Quatf& orientation,
+                            float duration_s,
+                            vne::math::EaseType easing) noexcept {
+    if (index >= impl_->size() || !finiteVec(coi)) {
+        return;
+    }
+    if (!(duration_s > 0.0f) || !std::isfinite(duration_s)) {
+        setOrbit(index, coi, distance, orientation);
+        return;
+    }
+    impl_->speed[index] = 0.0f;
+    Impl::Animation& a = impl_->anims[index];
+    if (!a.active) {
+        ++impl_->animating;
+    }
+    a.active = true;
+    a.easing = easing;
+    a.elapsed = 0.0f;
+    a.duration = duration_s;
+    a.coi_from = this->coi(index);
+    a.coi_to = coi;
+    a.dist_from = impl_->dist[index];
+    a.dist_to = sanitizeDistance(distance);
+    a.rot_from = this->orientation(index);
+    a.rot_to = sanitizeOrientation(orientation);
+}
+
+void CameraBatch::finishAnimation(std::size_t index) noexcept {
+    if (index >= impl_->size() || !impl_->anims[index].active) {
+        return;
+    }
+    const Impl::Animation& a = impl_->anims[index];
+    impl_->place(index, a.coi_to, a.dist_to, a.rot_to);
+    impl_->stopAnimation(index);
+}
+
+vne::math::Vec3f CameraBatch::coi(std::size_t index) const noexcept {
+    if (index >= impl_->size()) {
+        return {0.0f, 0.0f, 0.0f};
+    }
+    return {impl_->cx[index], impl_->cy[index], impl_->cz[index]};
+}
+
+float CameraBatch::distance(std::size_t index) const noexcept {
+    return index < impl_->size() ? impl_->dist[index] : 0.0f;
+}
+
+vne::math::Quatf CameraBatch::orientation(std::size_t index) const noexcept {
+    if (index >= impl_->size()) {
+        return vne::math::Quatf(0.0f, 0.0f, 0.0f, 1.0f);
+    }
+    return vne::math::Quatf(impl_->qx[index], impl_->qy[index], impl_->qz[index], impl_->qw[index]);
+}
+
+vne::math::Vec3f CameraBatch::eye(std::size_t index) const noexcept {
+    if (index >= impl_->size()) {
+        return {0.0f, 0.0f, 0.0f};
+    }
+    return coi(index) + orientation(index).getZAxis() * impl_->dist[index];
+}
+
+bool CameraBatch::hasInertia(std::size_t index) const noexcept {
+    return index < impl_->size() && std::abs(impl_->speed[index]) > kInertiaStopSpeed
+           && impl_->damping[index] > kMinDamping;
+}
+
+bool CameraBatch::isAnimating(std::size_t index) const noexcept {
+    return index < impl_->size() && impl_->anims[index].active;
+}
+
+// ---------------------------------------------------------------------------
+// Stepping
+// ---------------------------------------------------------------------------
+
+void CameraBatch::update(double delta_time, float* view_out) noexcept {
+    const float dt = static_cast<float>(delta_time);
+    if (!std::isfinite(dt) || dt <= 0.0f) {
+        writeViewMatrices(view_out);
+        return;
+    }
+    if (impl_->animating > 0) {
+        impl_->stepAnimations(dt);
+    }
+    if (impl_->spinning > 0) {
+        impl_->spinning = impl_->stepInertia(dt);
+    }
+    writeViewMatrices(view_out);
+}
+
+void CameraBatch::writeViewMatrices(float* view_out) const noexcept {
+    if (!view_out) {
+        return;
+    }
+    const Impl& s = *impl_;
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        Impl::writeView(s.qx[i], s.qy[i], s.qz[i], s.qw[i], s.cx[i], s.cy[i], s.cz[i], s.dist[i],
+                        view_out + i * kViewMatrixFloats);
+    }
+}
+
+vne::math::Mat4f CameraBatch::viewMatrix(std::size_t index) const noexcept {
+    if (index >= impl_->size()) {
+        return vne::math::Mat4f::identity();
+    }
+    float m[kViewMatrixFloats];
+    const Impl& s = *impl_;
+    Impl::writeView(s.qx[index], s.qy[index], s.qz[index], s.qw[index], s.cx[index], s.cy[index], s.cz[index],
+                    s.dist[index], m);
+    return vne::math::Mat4f(vne::math::Vec4f(m[0], m[1], m[2], m[3]),
+                            vne::math::Vec4f(m[4], m[5], m[6], m[7]),
+                            vne::math::Vec4f(m[8], m[9], m[10], m[11]),
+                            vne::math::Vec4f(m[12], m[13], m[14], m[15]));
+}
+
+}  // namespace vne::interaction
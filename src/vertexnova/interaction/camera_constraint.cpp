@@ -0,0 +1,246 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/camera_constraint.h"
+
+#include <vertexnova/logging/logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace {
+CREATE_VNE_LOGGER_CATEGORY("vne.interaction.camera_constraint");
+}  // namespace
+
+namespace vne::interaction {
+
+namespace {
+
+constexpr float kMinMove = 1e-6f;       //!< Shorter motions are applied without a cast
+constexpr float kMinArmLength = 1e-3f;  //!< The eye never collapses onto the target (degenerate look-at)
+
+bool isFinite(const vne::math::Vec3f& v) noexcept {
+    return std::isfinite(v.x()) && std::isfinite(v.y()) && std::isfinite(v.z());
+}
+
+bool samePoint(const vne::math::Vec3f& a, const vne::math::Vec3f& b) noexcept {
+    return a.x() == b.x() && a.y() == b.y() && a.z() == b.z();
+}
+
+void toArray(const vne::math::Vec3f& v, float out[3]) noexcept {
+    out[0] = v.x();
+    out[1] = v.y();
+    out[2] = v.z();
+}
+
+}  // namespace
+
+// ---------------------------------------------------------------------------
+// Geometry
+// ---------------------------------------------------------------------------
+
+void CameraConstraint::setSceneQuery(std::shared_ptr<const ISceneQuery> query) noexcept {
+    query_ = std::move(query);
+    hint_ = SweepHit::kNoPrimitive;
+    cache_valid_ = false;
+}
+
+void CameraConstraint::setBounds(const vne::math::Vec3f& min_corner, const vne::math::Vec3f& max_corner) noexcept {
+    if (!isFinite(min_corner) || !isFinite(max_corner)) {
+        VNE_LOG_WARN << "CameraConstraint: non-finite bounds ignored";
+        return;
+    }
+    bounds_min_ = vne::math::Vec3f(std::min(min_corner.x(), max_corner.x()),
+                                   std::min(min_corner.y(), max_corner.y()),
+                                   std::min(min_corner.z(), max_corner.z()));
+    bounds_max_ = vne::math::Vec3f(std::max(min_corner.x(), max_corner.x()),
+                                   std::max(min_corner.y(), max_corner.y()),
+                                   std::max(min_corner.z(), max_corner.z()));
+    has_bounds_ = true;
+    cache_valid_ = false;
+}
+
+void CameraConstraint::clearBounds() noexcept {
+    has_bounds_ = false;
+    cache_valid_ = false;
+}
+
+// ---------------------------------------------------------------------------
+// Tuning
+// ---------------------------------------------------------------------------
+
+void CameraConstraint::setMode(ConstraintMode mode) noexcept {
+    mode_ = mode;
+    cache_valid_ = false;
+}
+
+void CameraConstraint::setRadius(float radius) noexcept {
+    if (!std::isfinite(radius) || radius < 0.0f) {
+        VNE_LOG_WARN << "CameraConstraint: radius must be non-negative, ignoring " << radius;
+        return;
+    }
+    radius_ = radius;
+    cache_valid_ = false;
+}
+
+void CameraConstraint::setSkin(float skin) noexcept {
+    skin_ = std::isfinite(skin) ? std::max(skin, 0.0f) : kDefaultSkin;
+    cache_valid_ = false;
+}
+
+// ---------------------------------------------------------------------------
+// Constraint
+// ---------------------------------------------------------------------------
+
+void CameraConstraint::reset() noexcept {
+    has_previous_ = false;
+    cache_valid_ = false;
+    has_contact_ = false;
+    hint_ = SweepHit::kNoPrimitive;
+}
+
+bool CameraConstraint::constrain(const CameraPoseSnapshot& desired, CameraPoseSnapshot& out) noexcept {
+    out = desired;
+    if (!isFinite(desired.position) || !isFinite(desired.target)) {
+        return false;
+    }
+    const vne::math::Vec3f& eye = desired.position;
+    const std::uint64_t revision = query_ ? query_->revision() : 0;
+
+    vne::math::Vec3f corrected = eye;
+    const bool unchanged = cache_valid_ && revision == previous_revision_ && samePoint(eye, previous_desired_)
+                           && samePoint(desired.target, previous_pivot_);
+    if (unchanged) {
+        corrected = previous_eye_;  // same input, same geometry: no cast
+    } else if (mode_ == ConstraintMode::eSpringArm) {
+        corrected = springArm(desired.target, eye);
+    } else {
+        corrected = slide(has_previous_ ? previous_eye_ : clampToBounds(eye), eye);
+    }
+
+    has_previous_ = true;
+    cache_valid_ = true;
+    previous_desired_ = eye;
+    previous_pivot_ = desired.target;
+    previous_eye_ = corrected;
+    previous_revision_ = revision;
+
+    if (samePoint(corrected, eye)) {
+        return false;
+    }
+    out.position = corrected;
+    if (mode_ == ConstraintMode::eSlide) {
+        out.target = desired.target + (corrected - eye);  // translate: the view direction is kept
+    }
+    return true;
+}
+
+vne::math::Vec3f CameraConstraint::clampToBounds(const vne::math::Vec3f& p) const noexcept {
+    if (!has_bounds_) {
+        return p;
+    }
+    float c[3];
+    float mn[3];
+    float mx[3];
+    toArray(p, c);
+    toArray(bounds_min_, mn);
+    toArray(bounds_max_, mx);
+    for (int a = 0; a < 3; ++a) {
+        const float lo = mn[a] + radius_;
+        const float hi = mx[a] - radius_;
+        c[a] = lo <= hi ? std::clamp(c[a], lo, hi) : 0.5f * (mn[a] + mx[a]);
+    }
+    return vne::math::Vec3f(c[0], c[1], c[2]);
+}
+
+bool CameraConstraint::cast(const vne::math::Vec3f& origin,
+                            const vne::math::Vec3f& dir,
+                            float distance,
+                            SweepHit& hit) noexcept {
+    if (!query_) {
+        return false;
+    }
+    ++query_count_;
+    if (!query_->sphereCast(origin, dir, radius_, distance, hit, hint_)) {
+        return false;
+    }
+    has_contact_ = true;
+    contact_ = hit;
+    hint_ = hit.primitive;
+    return true;
+}
+
+vne::math::Vec3f CameraConstraint::slide(const vne::math::Vec3f& from, const vne::math::Vec3f& to) noexcept {
+    vne::math::Vec3f pos = from;
+    vne::math::Vec3f goal = clampToBounds(to);
+    has_contact_ = false;
+    for (int i = 0; i < kMaxSlideContacts; ++i) {
+        const vne::math::Vec3f delta = goal - pos;
+        const float len = delta.length();
+        if (!(len > kMinMove)) {
+            return goal;
+        }
+        const vne::math::Vec3f dir = delta / len;
+        SweepHit hit;
+        if (!cast(pos, dir, len + skin_, hit)) {
+            return goal;
+        }
+        // Stop short of the contact, then keep the part of the remaining motion that runs along the surface
+        pos = pos + dir * std::clamp(hit.distance - skin_, 0.0f, len);
+        vne::math::Vec3f rest = goal - pos;
+        const float into = rest.dot(hit.normal);
+        if (into < 0.0f) {
+            rest = rest - hit.normal * into;
+        }
+        goal = clampToBounds(pos + rest);
+    }
+    return pos;  // still blocked after the last contact: stay at the last safe point
+}
+
+vne::math::Vec3f CameraConstraint::springArm(const vne::math::Vec3f& pivot, const vne::math::Vec3f& eye) noexcept {
+    has_contact_ = false;
+    const vne::math::Vec3f arm = eye - pivot;
+    const float len = arm.length();
+    if (!(len > kMinArmLength)) {
+        return clampToBounds(eye);
+    }
+    const vne::math::Vec3f dir = arm / len;
+    float reach = len;
+    if (has_bounds_) {
+        if (!samePoint(clampToBounds(pivot), pivot)) {
+            return clampToBounds(eye);  // target outside the volume: no arm to shorten
+        }
+        // Where the arm leaves the box shrunk by the radius
+        float p[3];
+        float d[3];
+        float mn[3];
+        float mx[3];
+        toArray(pivot, p);
+        toArray(dir, d);
+        toArray(bounds_min_, mn);
+        toArray(bounds_max_, mx);
+        for (int a = 0; a < 3; ++a) {
+            if (d[a] > 0.0f) {
+                reach = std::min(reach, (mx[a] - radius_ - p[a]) / d[a]);
+            } else if (d[a] < 0.0f) {
+                reach = std::min(reach, (mn[a] + radius_ - p[a]) / d[a]);
+            }
+        }
+    }
+    SweepHit hit;
+    if (cast(pivot, dir, reach + skin_, hit)) {
+        reach = std::min(reach, hit.distance - skin_);
+    }
+    return pivot + dir * std::max(reach, kMinArmLength);
+}
+
+}  // namespace vne::interaction
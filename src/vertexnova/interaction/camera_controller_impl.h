@@ -12,17 +12,19 @@
 
 /**
  * @file camera_controller_impl.h
- * @brief Shared rig + mapper + camera + viewport + cursor for high-level controllers.
+ * @brief Shared rig + mapper + camera + viewport + cursor + history for high-level controllers.
  *
  * Controllers set @ref InputMapper::setActionCallback themselves (often with a custom
  * lambda); do not store @c this-capturing callbacks on the context — moves would invalidate
  * them. Use @c Impl* capture as today.
  */
 
+#include "vertexnova/interaction/camera_history.h"
 #include "vertexnova/interaction/camera_rig.h"
 #include "vertexnova/interaction/input_mapper.h"
 
 #include "input_event_translator.h"
+#include "interaction_utils.h"
 
 #include <memory>
 
@@ -45,10 +47,14 @@ struct CameraControllerContext {
     float viewport_w = kDefaultControllerViewportWidthPx;
     float viewport_h = kDefaultControllerViewportHeightPx;
     CursorState cursor;
+    CameraHistory history;
+    bool history_settling = false;         //!< A gesture ended; commit once the camera stops moving
+    CameraPoseSnapshot history_last_pose;  //!< Pose at the previous update while settling
 
     void setCamera(std::shared_ptr<vne::scene::ICamera> cam) noexcept {
         camera = std::move(cam);
         rig.setCamera(camera);
+        resetHistory();
     }
 
     void onResize(float width_px, float height_px) noexcept {
@@ -57,7 +63,80 @@ struct CameraControllerContext {
         rig.onResize(width_px, height_px);
     }
 
-    void onUpdate(double delta_time) noexcept { rig.onUpdate(delta_time); }
+    void onUpdate(double delta_time) noexcept {
+        rig.onUpdate(delta_time);
+        if (history_settling) {
+            const CameraPoseSnapshot pose = rig.getManipulatorPose();
+            if (cameraPosesMatch(pose, history_last_pose)) {
+                history.push(pose);
+                history_settling = false;
+            }
+            history_last_pose = pose;
+        }
+    }
+
+    /** Forward @p action to the rig, committing history at gesture boundaries (mapper callbacks use this). */
+    void dispatchAction(CameraActionType action, const CameraCommandPayload& payload, double delta_time) noexcept {
+        switch (action) {
+            case CameraActionType::eBeginRotate:
+            case CameraActionType::eBeginPan:
+            case CameraActionType::eBeginLook:
+                commitHistory();  // pose before the gesture, including uncommitted zoom / key motion
+                rig.onAction(action, payload, delta_time);
+                return;
+            case CameraActionType::eEndRotate:
+            case CameraActionType::eEndPan:
+            case CameraActionType::eEndLook:
+                rig.onAction(action, payload, delta_time);
+                beginHistorySettle();
+                return;
+            default:
+                rig.onAction(action, payload, delta_time);
+                return;
+        }
+    }
+
+    /** Push the settled camera pose to @ref history (no-op if unchanged or no camera). */
+    void commitHistory() noexcept {
+        if (camera) {
+            history.push(rig.getManipulatorPose());
+        }
+        history_settling = false;
+    }
+
+    /** Drop every entry and commit the current pose as the new baseline (camera change, state restore). */
+    void resetHistory() noexcept {
+        history.clear();
+        commitHistory();
+    }
+
+    /** Commit the pose reached after inertia or an animation has run out (see @ref onUpdate). */
+    void beginHistorySettle() noexcept {
+        if (camera) {
+            history_settling = true;
+            history_last_pose = rig.getManipulatorPose();
+        }
+    }
+
+    bool undo(float duration_s) noexcept {
+        CameraPoseSnapshot to;
+        if (!camera || !history.undo(rig.getManipulatorPose(), to)) {
+            return false;
+        }
+        history_settling = false;
+        rig.animateToPose(to, duration_s);
+        return true;
+    }
+
+    bool redo(float duration_s) noexcept {
+        CameraPoseSnapshot to;
+        if (!camera || !history.redo(rig.getManipulatorPose(), to)) {
+            return false;
+        }
+        history_settling = false;
+        rig.animateToPose(to, duration_s);
+        return true;
+    }
 
     /**
      * Clear input and gesture state: @ref InputMapper::resetState (active chords),
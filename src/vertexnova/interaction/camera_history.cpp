@@ -0,0 +1,69 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/camera_history.h"
+
+#include "interaction_utils.h"
+
+#include <algorithm>
+
+namespace vne::interaction {
+
+namespace {
+constexpr std::size_t kMinHistoryCapacity = 2;
+}  // namespace
+
+CameraHistory::CameraHistory(std::size_t capacity)
+    : ring_(std::max(capacity, kMinHistoryCapacity)) {}
+
+bool CameraHistory::push(const CameraPoseSnapshot& pose) noexcept {
+    if (count_ > 0) {
+        if (cameraPosesMatch(pose, current())) {
+            return false;
+        }
+        count_ = cursor_ + 1;  // drop redo steps
+    }
+    if (count_ == ring_.size()) {
+        head_ = (head_ + 1) % ring_.size();
+        --count_;
+    }
+    ring_[(head_ + count_) % ring_.size()] = pose;
+    cursor_ = count_;
+    ++count_;
+    return true;
+}
+
+bool CameraHistory::undo(const CameraPoseSnapshot& current, CameraPoseSnapshot& out) noexcept {
+    push(current);
+    if (cursor_ == 0) {
+        return false;
+    }
+    --cursor_;
+    out = at(cursor_);
+    return true;
+}
+
+bool CameraHistory::redo(const CameraPoseSnapshot& current, CameraPoseSnapshot& out) noexcept {
+    if (push(current) || !canRedo()) {
+        return false;
+    }
+    ++cursor_;
+    out = at(cursor_);
+    return true;
+}
+
+void CameraHistory::clear() noexcept {
+    head_ = 0;
+    count_ = 0;
+    cursor_ = 0;
+}
+
+}  // namespace vne::interaction
@@ -0,0 +1,217 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/camera_link_group.h"
+
+#include "interaction_utils.h"
+
+#include <vertexnova/logging/logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+CREATE_VNE_LOGGER_CATEGORY("vne.interaction.camera_link_group");
+}  // namespace
+
+namespace vne::interaction {
+
+namespace {
+
+/** Shared quantities derived once per sync from the source view's old and new pose. */
+struct LinkDelta {
+    float zoom = 1.0f;
+    vne::math::Vec3f pan{0.0f, 0.0f, 0.0f};
+    vne::math::Quatf rotation;
+    bool rotates = false;
+    vne::math::Vec3f center{0.0f, 0.0f, 0.0f};
+};
+
+/** Ortho width, or eye-to-target distance for perspective poses. */
+float poseExtent(const CameraPoseSnapshot& pose) noexcept {
+    return pose.ortho_width > 0.0f ? pose.ortho_width : (pose.target - pose.position).length();
+}
+
+LinkDelta computeDelta(const CameraPoseSnapshot& from, const CameraPoseSnapshot& to) noexcept {
+    LinkDelta d;
+    const float from_extent = poseExtent(from);
+    const float to_extent = poseExtent(to);
+    if (from_extent > detail::kManipulatorUtilsEpsilon && to_extent > detail::kManipulatorUtilsEpsilon) {
+        d.zoom = to_extent / from_extent;
+    }
+    d.pan = to.target - from.target;
+    d.rotation = (to.orientation * from.orientation.conjugate()).normalized();
+    // No threshold: a slow orbit turns less than any epsilon per sync and would never reach the linked views.
+    d.rotates = d.rotation.x != 0.0f || d.rotation.y != 0.0f || d.rotation.z != 0.0f;
+    d.center = to.target;
+    return d;
+}
+
+/** Apply the channels in @p channels of @p d to @p pose: rotate, then zoom, then center or pan. */
+CameraPoseSnapshot linkPose(CameraPoseSnapshot pose, const LinkDelta& d, int channels) noexcept {
+    if ((channels & kLinkRotate) != 0 && d.rotates) {
+        pose.position = pose.target + d.rotation.rotate(pose.position - pose.target);
+        pose.orientation = (d.rotation * pose.orientation).normalized();
+    }
+    if ((channels & kLinkZoom) != 0 && d.zoom != 1.0f) {
+        if (pose.ortho_width > 0.0f) {
+            pose.ortho_width *= d.zoom;
+            pose.ortho_height *= d.zoom;
+        } else {
+            pose.position = pose.target + (pose.position - pose.target) * d.zoom;
+        }
+    }
+    vne::math::Vec3f shift(0.0f, 0.0f, 0.0f);
+    if ((channels & kLinkCenter) != 0) {
+        shift = d.center - pose.target;
+    } else if ((channels & kLinkPan) != 0) {
+        // Keep only the part of the pan that lies in this view's plane; depth motion would move a slice.
+        const vne::math::Vec3f n = pose.orientation.getZAxis();
+        shift = d.pan - n * d.pan.dot(n);
+    }
+    pose.position = pose.position + shift;
+    pose.target = pose.target + shift;
+    return pose;
+}
+
+}  // namespace
+
+// ---------------------------------------------------------------------------
+// Impl
+// ---------------------------------------------------------------------------
+
+class CameraLinkGroup::Impl {
+    friend class CameraLinkGroup;
+
+    struct View {
+        std::shared_ptr<vne::scene::ICamera> camera;
+        ICameraManipulator* manipulator = nullptr;
+        int channels = kLinkAll;
+        CameraPoseSnapshot last;  //!< Pose after the previous sync
+    };
+
+    std::vector<View> views;
+
+    void propagate(std::size_t source, const CameraPoseSnapshot& now) noexcept {
+        const LinkDelta delta = computeDelta(views[source].last, now);
+        views[source].last = now;
+        for (std::size_t i = 0; i < views.size(); ++i) {
+            View& v = views[i];
+            if (i == source || (v.channels & kLinkAll) == 0) {
+                continue;
+            }
+            const CameraPoseSnapshot linked = linkPose(captureCameraPose(*v.camera), delta, v.channels);
+            applyCameraPose(*v.camera, linked);
+            if (v.manipulator) {
+                v.manipulator->onHandoff(linked);
+            }
+            v.last = captureCameraPose(*v.camera);
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Construction
+// ---------------------------------------------------------------------------
+
+CameraLinkGroup::CameraLinkGroup()
+    : impl_(std::make_unique<Impl>()) {}
+
+CameraLinkGroup::~CameraLinkGroup() = default;
+CameraLinkGroup::CameraLinkGroup(CameraLinkGroup&&) noexcept = default;
+CameraLinkGroup& CameraLinkGroup::operator=(CameraLinkGroup&&) noexcept = default;
+
+// ---------------------------------------------------------------------------
+// Views
+// ---------------------------------------------------------------------------
+
+std::size_t CameraLinkGroup::addView(std::shared_ptr<vne::scene::ICamera> camera,
+                                     int channels,
+                                     ICameraManipulator* manipulator) {
+    auto& views = impl_->views;
+    if (!camera) {
+        VNE_LOG_WARN << "CameraLinkGroup::addView: null camera ignored";
+        return views.size();
+    }
+    const auto it =
+        std::find_if(views.begin(), views.end(), [&camera](const Impl::View& v) { return v.camera == camera; });
+    if (it != views.end()) {
+        return static_cast<std::size_t>(it - views.begin());
+    }
+    Impl::View view;
+    view.last = captureCameraPose(*camera);
+    view.camera = std::move(camera);
+    view.manipulator = manipulator;
+    view.channels = channels;
+    views.push_back(std::move(view));
+    return views.size() - 1;
+}
+
+bool CameraLinkGroup::removeView(const vne::scene::ICamera* camera) noexcept {
+    auto& views = impl_->views;
+    const auto it =
+        std::find_if(views.begin(), views.end(), [camera](const Impl::View& v) { return v.camera.get() == camera; });
+    if (it == views.end()) {
+        return false;
+    }
+    views.erase(it);
+    return true;
+}
+
+void CameraLinkGroup::clear() noexcept {
+    impl_->views.clear();
+}
+
+std::size_t CameraLinkGroup::size() const noexcept {
+    return impl_->views.size();
+}
+
+void CameraLinkGroup::setChannels(std::size_t index, int channels) noexcept {
+    if (index < impl_->views.size()) {
+        impl_->views[index].channels = channels;
+    }
+}
+
+int CameraLinkGroup::getChannels(std::size_t index) const noexcept {
+    return index < impl_->views.size() ? impl_->views[index].channels : kLinkNone;
+}
+
+// ---------------------------------------------------------------------------
+// Synchronization
+// ---------------------------------------------------------------------------
+
+std::size_t CameraLinkGroup::sync() noexcept {
+    auto& views = impl_->views;
+    for (std::size_t i = 0; i < views.size(); ++i) {
+        const CameraPoseSnapshot now = captureCameraPose(*views[i].camera);
+        if (!cameraPosesMatch(now, views[i].last)) {
+            impl_->propagate(i, now);
+            return i;
+        }
+    }
+    return kNoSource;
+}
+
+void CameraLinkGroup::syncFrom(std::size_t index) noexcept {
+    if (index >= impl_->views.size()) {
+        return;
+    }
+    impl_->propagate(index, captureCameraPose(*impl_->views[index].camera));
+}
+
+void CameraLinkGroup::resetBaseline() noexcept {
+    for (Impl::View& v : impl_->views) {
+        v.last = captureCameraPose(*v.camera);
+    }
+}
+
+}  // namespace vne::interaction
@@ -28,6 +28,8 @@ constexpr float kEpsilon = 1e-6f;
 constexpr float kZoomOrthoHalfMin = 1e-3f;
 constexpr float kZoomOrthoHalfMax = 1e6f;
 constexpr float kMinFovZoomSpeed = 0.01f;
+constexpr float kZoomRateBlendRate = 25.0f;  // EMA time-constant reciprocal (1/s), as the pan velocity
+constexpr float kZoomRateThreshold = 1e-3f;  // Smoothed rates below this read as at rest
 }  // namespace
 
 // ---------------------------------------------------------------------------
@@ -55,7 +57,7 @@ void CameraManipulatorBase::setZoomMethod(ZoomMethod method) noexcept {
     if (prev == ZoomMethod::eSceneScale && method != ZoomMethod::eSceneScale && camera_) {
         zoom_scale_ = 1.0f;
         camera_->setSceneScale(1.0f);
-        camera_->updateMatrices();
+        updateCameraMatrices(*camera_);
     }
 }
 
@@ -63,6 +65,12 @@ void CameraManipulatorBase::setZoomMethod(ZoomMethod method) noexcept {
 // Camera type helpers
 // ---------------------------------------------------------------------------
 
+void CameraManipulatorBase::updateCameraMatrices(vne::scene::ICamera& camera) const noexcept {
+    if (!defer_matrices_) {
+        camera.updateMatrices();
+    }
+}
+
 std::shared_ptr<vne::scene::PerspectiveCamera> CameraManipulatorBase::perspCamera() const noexcept {
     return std::dynamic_pointer_cast<vne::scene::PerspectiveCamera>(camera_);
 }
@@ -83,6 +91,7 @@ void CameraManipulatorBase::dispatchZoom(float factor, float mx, float my) noexc
     if (!camera_ || factor <= 0.0f || !std::isfinite(factor)) {
         return;
     }
+    recordZoom(factor);
     switch (zoom_method_) {
         case ZoomMethod::eSceneScale:
             applySceneScaleZoom(factor);
@@ -103,6 +112,30 @@ void CameraManipulatorBase::applyDolly(float factor, float mx, float my) noexcep
     }
 }
 
+// ---------------------------------------------------------------------------
+// Zoom rate
+// ---------------------------------------------------------------------------
+
+void CameraManipulatorBase::recordZoom(float factor) noexcept {
+    if (factor > 0.0f && std::isfinite(factor)) {
+        zoom_log_pending_ += std::log(factor);
+    }
+}
+
+void CameraManipulatorBase::updateZoomRate(double delta_time) noexcept {
+    if (!(delta_time > 0.0) || !std::isfinite(delta_time)) {
+        return;
+    }
+    const auto dt = static_cast<float>(delta_time);
+    const float sample = zoom_log_pending_ / dt;
+    const float blend = 1.0f - interactionExp(-kZoomRateBlendRate * dt);
+    zoom_rate_ += (sample - zoom_rate_) * blend;
+    zoom_log_pending_ = 0.0f;
+    if (std::abs(zoom_rate_) < kZoomRateThreshold || !std::isfinite(zoom_rate_)) {
+        zoom_rate_ = 0.0f;
+    }
+}
+
 // ---------------------------------------------------------------------------
 // applyFovZoom
 // ---------------------------------------------------------------------------
@@ -114,7 +147,7 @@ void CameraManipulatorBase::applyFovZoom(float factor) noexcept {
     // Use scroll/pinch factor magnitude directly (same convention as dolly ortho + InputMapper).
     if (auto persp = perspCamera()) {
         persp->setFieldOfView(vne::math::clamp(persp->getFieldOfView() * factor, kFovMinDeg, kFovMaxDeg));
-        persp->updateMatrices();
+        updateCameraMatrices(*persp);
     } else if (auto ortho = orthoCamera()) {
         const float half_h = ortho->getHeight() * 0.5f;
         const float half_w = ortho->getWidth() * 0.5f;
@@ -126,7 +159,7 @@ void CameraManipulatorBase::applyFovZoom(float factor) noexcept {
         const float new_half_w = half_w * t;
         const float new_half_h = half_h * t;
         ortho->setBounds(-new_half_w, new_half_w, -new_half_h, new_half_h, ortho->getNearPlane(), ortho->getFarPlane());
-        ortho->updateMatrices();
+        updateCameraMatrices(*ortho);
     }
 }
 
@@ -140,7 +173,7 @@ void CameraManipulatorBase::applySceneScaleZoom(float factor) noexcept {
     }
     zoom_scale_ = vne::math::clamp(zoom_scale_ * factor, kSceneScaleMin, kSceneScaleMax);
     camera_->setSceneScale(zoom_scale_);
-    camera_->updateMatrices();
+    updateCameraMatrices(*camera_);
 }
 
 // ---------------------------------------------------------------------------
@@ -183,7 +216,7 @@ void CameraManipulatorBase::applyOrthoZoomToCursor(float factor, float mx, float
     ortho->setBounds(-new_half_w, new_half_w, -new_half_h, new_half_h, ortho->getNearPlane(), ortho->getFarPlane());
     ortho->setTarget(new_target);
     ortho->setPosition(new_target + eye_offset);
-    ortho->updateMatrices();
+    updateCameraMatrices(*ortho);
 }
 
 }  // namespace vne::interaction
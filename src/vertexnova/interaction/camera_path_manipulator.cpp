@@ -0,0 +1,553 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/camera_path_manipulator.h"
+#include "interaction_utils.h"
+
+#include "vertexnova/scene/camera/camera.h"
+#include "vertexnova/scene/camera/perspective_camera.h"
+
+#include <vertexnova/math/core/core.h>
+#include <vertexnova/math/core/math_utils.h>
+#include <vertexnova/logging/logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace vne::interaction {
+
+// ---------------------------------------------------------------------------
+// Built path (lives only in this TU)
+// ---------------------------------------------------------------------------
+
+/** Barry–Goldman control points and knot values for one Catmull-Rom segment. */
+struct CameraPathSegment {
+    vne::math::Vec3f p0;
+    vne::math::Vec3f p1;
+    vne::math::Vec3f p2;
+    vne::math::Vec3f p3;
+    float t0 = 0.0f;
+    float t1 = 1.0f;
+    float t2 = 2.0f;
+    float t3 = 3.0f;
+};
+
+struct CameraPathData {
+    std::vector<CameraPathKeyframe> keyframes;
+    std::vector<CameraPathSegment> segments;
+    std::vector<vne::math::Quatf> rotations;  //!< Resolved, hemisphere-aligned keyframe orientations
+    std::vector<vne::math::Quatf> squad;      //!< Squad inner control quaternion per keyframe
+    std::vector<float> arc_length;            //!< Cumulative length at parameter k / samples_per_segment
+    int samples_per_segment = 32;
+    bool has_fov = false;
+    bool closed = false;
+
+    void clear() noexcept {
+        keyframes.clear();
+        segments.clear();
+        rotations.clear();
+        squad.clear();
+        arc_length.clear();
+        has_fov = false;
+        closed = false;
+    }
+
+    [[nodiscard]] std::size_t keyCount() const noexcept { return keyframes.size(); }
+
+    /** Keyframe index with wrap (closed) or clamp (open). */
+    [[nodiscard]] std::size_t keyIndex(std::ptrdiff_t i) const noexcept {
+        const auto n = static_cast<std::ptrdiff_t>(keyframes.size());
+        if (closed) {
+            return static_cast<std::size_t>(((i % n) + n) % n);
+        }
+        return static_cast<std::size_t>(std::clamp<std::ptrdiff_t>(i, 0, n - 1));
+    }
+
+    [[nodiscard]] float totalLength() const noexcept { return arc_length.empty() ? 0.0f : arc_length.back(); }
+};
+
+namespace {
+CREATE_VNE_LOGGER_CATEGORY("vne.interaction.camera_path");
+constexpr float kEpsilon = 1e-6f;
+/** Floor on knot intervals so coincident control points do not divide by zero. */
+constexpr float kMinKnotInterval = 1e-4f;
+constexpr float kCentripetalAlpha = 0.5f;
+constexpr float kChordalAlpha = 1.0f;
+constexpr int kMinSamplesPerSegment = 2;
+constexpr int kMaxSamplesPerSegment = 1024;
+/** Below this |sin(angle)| the quaternion log/exp use the small-angle limit. */
+constexpr float kQuatSmallAngle = 1e-6f;
+constexpr float kSquadQuarter = 0.25f;
+/** Step (seconds) over which getMotionState differentiates orientation and FOV along the path. */
+constexpr float kMotionSampleStepS = 1.0f / 120.0f;
+
+[[nodiscard]] float knotAlpha(CameraPathSplineType type) noexcept {
+    switch (type) {
+        case CameraPathSplineType::eUniform:
+            return 0.0f;
+        case CameraPathSplineType::eCentripetal:
+            return kCentripetalAlpha;
+        case CameraPathSplineType::eChordal:
+            return kChordalAlpha;
+    }
+    return kCentripetalAlpha;
+}
+
+[[nodiscard]] float knotInterval(const vne::math::Vec3f& a, const vne::math::Vec3f& b, float alpha) noexcept {
+    const float d = (b - a).length();
+    return std::max(interactionPow(d, alpha), kMinKnotInterval);
+}
+
+[[nodiscard]] vne::math::Vec3f lerpKnots(
+    const vne::math::Vec3f& a, const vne::math::Vec3f& b, float ta, float tb, float t) noexcept {
+    const float span = tb - ta;
+    return a * ((tb - t) / span) + b * ((t - ta) / span);
+}
+
+/** Barry–Goldman pyramidal evaluation; @a u in [0, 1] maps to [t1, t2]. */
+[[nodiscard]] vne::math::Vec3f evalSegment(const CameraPathSegment& s, float u) noexcept {
+    const float t = s.t1 + (s.t2 - s.t1) * u;
+    const vne::math::Vec3f a1 = lerpKnots(s.p0, s.p1, s.t0, s.t1, t);
+    const vne::math::Vec3f a2 = lerpKnots(s.p1, s.p2, s.t1, s.t2, t);
+    const vne::math::Vec3f a3 = lerpKnots(s.p2, s.p3, s.t2, s.t3, t);
+    const vne::math::Vec3f b1 = lerpKnots(a1, a2, s.t0, s.t2, t);
+    const vne::math::Vec3f b2 = lerpKnots(a2, a3, s.t1, s.t3, t);
+    return lerpKnots(b1, b2, s.t1, s.t2, t);
+}
+
+/** Uniform Catmull-Rom on a scalar track (FOV). */
+[[nodiscard]] float catmullRomScalar(float v0, float v1, float v2, float v3, float u) noexcept {
+    const float u2 = u * u;
+    const float u3 = u2 * u;
+    return 0.5f
+           * ((2.0f * v1) + (-v0 + v2) * u + (2.0f * v0 - 5.0f * v1 + 4.0f * v2 - v3) * u2
+              + (-v0 + 3.0f * v1 - 3.0f * v2 + v3) * u3);
+}
+
+/** Log of a unit quaternion as a pure-vector (axis × half-angle). */
+[[nodiscard]] vne::math::Vec3f quatLog(const vne::math::Quatf& q) noexcept {
+    const vne::math::Vec3f v(q.x, q.y, q.z);
+    const float s = v.length();
+    if (s < kQuatSmallAngle) {
+        return v;
+    }
+    const float half_angle = interactionAtan2(s, q.w);
+    return v * (half_angle / s);
+}
+
+/** Exp of a pure-vector quaternion (inverse of @ref quatLog). */
+[[nodiscard]] vne::math::Quatf quatExp(const vne::math::Vec3f& v) noexcept {
+    const float half_angle = v.length();
+    if (half_angle < kQuatSmallAngle) {
+        return vne::math::Quatf(v.x(), v.y(), v.z(), 1.0f).normalized();
+    }
+    const vne::math::Vec3f axis = v * (interactionSin(half_angle) / half_angle);
+    return vne::math::Quatf(axis.x(), axis.y(), axis.z(), interactionCos(half_angle));
+}
+
+/** Camera-to-world rotation looking from @a eye at @a target (forward = -Z), same basis as the trackball. */
+[[nodiscard]] vne::math::Quatf lookAtOrientation(const vne::math::Vec3f& eye,
+                                                 const vne::math::Vec3f& target,
+                                                 const vne::math::Vec3f& world_up) noexcept {
+    vne::math::Vec3f back = eye - target;
+    const float back_len = back.length();
+    if (back_len < kEpsilon) {
+        return vne::math::Quatf::identity();
+    }
+    back /= back_len;
+    vne::math::Vec3f right = world_up.cross(back);
+    float right_len = right.length();
+    if (right_len < kEpsilon) {
+        right = vne::math::Vec3f(1.0f, 0.0f, 0.0f).cross(back);
+        right_len = right.length();
+        if (right_len < kEpsilon) {
+            right = vne::math::Vec3f(0.0f, 0.0f, 1.0f).cross(back);
+            right_len = right.length();
+        }
+    }
+    right /= right_len;
+    const vne::math::Vec3f up = back.cross(right);
+    const vne::math::Mat4f rot(vne::math::Vec4f(right.x(), right.y(), right.z(), 0.0f),
+                               vne::math::Vec4f(up.x(), up.y(), up.z(), 0.0f),
+                               vne::math::Vec4f(back.x(), back.y(), back.z(), 0.0f),
+                               vne::math::Vec4f(0.0f, 0.0f, 0.0f, 1.0f));
+    return vne::math::Quatf(rot).normalized();
+}
+
+}  // namespace
+
+// ---------------------------------------------------------------------------
+// Constructor / destructor / move
+// ---------------------------------------------------------------------------
+
+CameraPathManipulator::CameraPathManipulator() noexcept
+    : path_(std::make_unique<CameraPathData>()) {}
+
+CameraPathManipulator::~CameraPathManipulator() noexcept = default;
+
+CameraPathManipulator::CameraPathManipulator(CameraPathManipulator&&) noexcept = default;
+
+CameraPathManipulator& CameraPathManipulator::operator=(CameraPathManipulator&&) noexcept = default;
+
+// ---------------------------------------------------------------------------
+// Path definition
+// ---------------------------------------------------------------------------
+
+bool CameraPathManipulator::setKeyframes(std::vector<CameraPathKeyframe> keyframes) noexcept {
+    if (keyframes.size() < 2) {
+        VNE_LOG_WARN << "CameraPathManipulator: setKeyframes needs at least 2 keyframes (got " << keyframes.size()
+                     << "); path cleared";
+        clear();
+        return false;
+    }
+    path_->keyframes = std::move(keyframes);
+    rebuild();
+    distance_ = wrapDistance(distance_);
+    return true;
+}
+
+const std::vector<CameraPathKeyframe>& CameraPathManipulator::getKeyframes() const noexcept {
+    return path_->keyframes;
+}
+
+void CameraPathManipulator::clear() noexcept {
+    path_->clear();
+    playing_ = false;
+    distance_ = 0.0f;
+}
+
+void CameraPathManipulator::setSplineType(CameraPathSplineType type) noexcept {
+    spline_type_ = type;
+    rebuild();
+}
+
+void CameraPathManipulator::setLooping(bool looping) noexcept {
+    looping_ = looping;
+    rebuild();
+    distance_ = wrapDistance(distance_);
+}
+
+void CameraPathManipulator::setSamplesPerSegment(int samples) noexcept {
+    samples_per_segment_ = std::clamp(samples, kMinSamplesPerSegment, kMaxSamplesPerSegment);
+    rebuild();
+}
+
+void CameraPathManipulator::setWorldUp(const vne::math::Vec3f& world_up) noexcept {
+    if (world_up.length() < kEpsilon) {
+        return;
+    }
+    world_up_ = world_up.normalized();
+    rebuild();
+}
+
+bool CameraPathManipulator::isValid() const noexcept {
+    return !path_->segments.empty() && !path_->arc_length.empty();
+}
+
+float CameraPathManipulator::getLength() const noexcept {
+    return path_->totalLength();
+}
+
+void CameraPathManipulator::rebuild() noexcept {
+    CameraPathData& p = *path_;
+    const std::size_t n = p.keyCount();
+    p.segments.clear();
+    p.rotations.clear();
+    p.squad.clear();
+    p.arc_length.clear();
+    p.samples_per_segment = samples_per_segment_;
+    p.closed = looping_;
+    if (n < 2) {
+        return;
+    }
+
+    // Orientations: resolve look-at keys, then keep consecutive quaternions in the same hemisphere so
+    // slerp / squad take the short arc.
+    p.rotations.reserve(n);
+    p.has_fov = true;
+    for (std::size_t i = 0; i < n; ++i) {
+        const CameraPathKeyframe& k = p.keyframes[i];
+        vne::math::Quatf q = k.use_look_at ? lookAtOrientation(k.position, k.look_at, world_up_)
+                                           : k.orientation.normalized();
+        if (i > 0 && p.rotations.back().dot(q) < 0.0f) {
+            q = vne::math::Quatf(-q.x, -q.y, -q.z, -q.w);
+        }
+        p.rotations.push_back(q);
+        p.has_fov = p.has_fov && k.fov_deg > 0.0f;
+    }
+
+    // Squad inner control points: s_i = q_i * exp(-(log(q_i^-1 q_{i+1}) + log(q_i^-1 q_{i-1})) / 4).
+    p.squad.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto ii = static_cast<std::ptrdiff_t>(i);
+        const vne::math::Quatf& qi = p.rotations[i];
+        vne::math::Quatf q_prev = p.rotations[p.keyIndex(ii - 1)];
+        vne::math::Quatf q_next = p.rotations[p.keyIndex(ii + 1)];
+        if (qi.dot(q_prev) < 0.0f) {
+            q_prev = vne::math::Quatf(-q_prev.x, -q_prev.y, -q_prev.z, -q_prev.w);
+        }
+        if (qi.dot(q_next) < 0.0f) {
+            q_next = vne::math::Quatf(-q_next.x, -q_next.y, -q_next.z, -q_next.w);
+        }
+        const vne::math::Quatf qi_inv = qi.conjugate();
+        const vne::math::Vec3f sum = quatLog(qi_inv * q_next) + quatLog(qi_inv * q_prev);
+        p.squad.push_back((qi * quatExp(sum * -kSquadQuarter)).normalized());
+    }
+
+    // Position segments (Barry–Goldman form). Open paths extrapolate phantom end points.
+    const float alpha = knotAlpha(spline_type_);
+    const std::size_t segment_count = p.closed ? n : n - 1;
+    p.segments.reserve(segment_count);
+    const auto key_pos = [&p, n](std::ptrdiff_t i) -> vne::math::Vec3f {
+        if (!p.closed) {
+            const auto last = static_cast<std::ptrdiff_t>(n) - 1;
+            if (i < 0) {
+                return p.keyframes[0].position * 2.0f - p.keyframes[1].position;
+            }
+            if (i > last) {
+                return p.keyframes[n - 1].position * 2.0f - p.keyframes[n - 2].position;
+            }
+        }
+        return p.keyframes[p.keyIndex(i)].position;
+    };
+    for (std::size_t i = 0; i < segment_count; ++i) {
+        const auto ii = static_cast<std::ptrdiff_t>(i);
+        CameraPathSegment s;
+        s.p0 = key_pos(ii - 1);
+        s.p1 = key_pos(ii);
+        s.p2 = key_pos(ii + 1);
+        s.p3 = key_pos(ii + 2);
+        s.t0 = 0.0f;
+        s.t1 = s.t0 + knotInterval(s.p0, s.p1, alpha);
+        s.t2 = s.t1 + knotInterval(s.p1, s.p2, alpha);
+        s.t3 = s.t2 + knotInterval(s.p2, s.p3, alpha);
+        p.segments.push_back(s);
+    }
+
+    // Arc-length table: cumulative chord length at uniform parameter steps.
+    const int spp = p.samples_per_segment;
+    p.arc_length.reserve(segment_count * static_cast<std::size_t>(spp) + 1);
+    p.arc_length.push_back(0.0f);
+    float total = 0.0f;
+    vne::math::Vec3f prev = p.segments.front().p1;
+    for (const CameraPathSegment& s : p.segments) {
+        for (int k = 1; k <= spp; ++k) {
+            const vne::math::Vec3f pt = evalSegment(s, static_cast<float>(k) / static_cast<float>(spp));
+            total += (pt - prev).length();
+            p.arc_length.push_back(total);
+            prev = pt;
+        }
+    }
+    VNE_LOG_DEBUG << "CameraPathManipulator: built " << segment_count << " segments, length " << total;
+}
+
+// ---------------------------------------------------------------------------
+// Sampling
+// ---------------------------------------------------------------------------
+
+float CameraPathManipulator::wrapDistance(float distance) const noexcept {
+    const float total = path_->totalLength();
+    if (!std::isfinite(distance) || !(total > 0.0f)) {
+        return 0.0f;
+    }
+    if (looping_) {
+        float d = std::fmod(distance, total);
+        if (d < 0.0f) {
+            d += total;
+        }
+        return d;
+    }
+    return vne::math::clamp(distance, 0.0f, total);
+}
+
+bool CameraPathManipulator::sampleAtDistance(float distance, CameraPathSample& out) const noexcept {
+    const CameraPathData& p = *path_;
+    if (!isValid()) {
+        return false;
+    }
+    const float d = wrapDistance(distance);
+
+    // Binary search for the table interval containing d; linear in the parameter within it.
+    const auto it = std::upper_bound(p.arc_length.begin(), p.arc_length.end(), d);
+    const std::size_t last = p.arc_length.size() - 1;
+    const std::size_t hi = std::min(static_cast<std::size_t>(std::max<std::ptrdiff_t>(it - p.arc_length.begin(), 1)),
+                                    last);
+    const std::size_t lo = hi - 1;
+    const float span = p.arc_length[hi] - p.arc_length[lo];
+    const float frac = (span > kEpsilon) ? vne::math::clamp((d - p.arc_length[lo]) / span, 0.0f, 1.0f) : 0.0f;
+    const float param = (static_cast<float>(lo) + frac) / static_cast<float>(p.samples_per_segment);
+
+    const std::size_t seg_count = p.segments.size();
+    const std::size_t seg = std::min(static_cast<std::size_t>(param), seg_count - 1);
+    const float u = vne::math::clamp(param - static_cast<float>(seg), 0.0f, 1.0f);
+
+    out.position = evalSegment(p.segments[seg], u);
+
+    const auto si = static_cast<std::ptrdiff_t>(seg);
+    const std::size_t i1 = p.keyIndex(si);
+    const std::size_t i2 = p.keyIndex(si + 1);
+    vne::math::Quatf q2 = p.rotations[i2];
+    vne::math::Quatf s2 = p.squad[i2];
+    if (p.rotations[i1].dot(q2) < 0.0f) {
+        // Closed loop seam: last → first may sit in the opposite hemisphere.
+        q2 = vne::math::Quatf(-q2.x, -q2.y, -q2.z, -q2.w);
+        s2 = vne::math::Quatf(-s2.x, -s2.y, -s2.z, -s2.w);
+    }
+    const vne::math::Quatf outer = slerpQuat(p.rotations[i1], q2, u);
+    const vne::math::Quatf inner = slerpQuat(p.squad[i1], s2, u);
+    out.orientation = normalizeQuat(slerpQuat(outer, inner, 2.0f * u * (1.0f - u)));
+
+    if (p.has_fov) {
+        const float f0 = p.keyframes[p.keyIndex(si - 1)].fov_deg;
+        const float f1 = p.keyframes[i1].fov_deg;
+        const float f2 = p.keyframes[i2].fov_deg;
+        const float f3 = p.keyframes[p.keyIndex(si + 2)].fov_deg;
+        out.fov_deg = vne::math::clamp(catmullRomScalar(f0, f1, f2, f3, u), kFovMinDeg, kFovMaxDeg);
+    } else {
+        out.fov_deg = 0.0f;
+    }
+    return true;
+}
+
+void CameraPathManipulator::applySample(const CameraPathSample& sample) noexcept {
+    if (!camera_) {
+        return;
+    }
+    if (sample.fov_deg > 0.0f) {
+        if (auto persp = perspCamera()) {
+            persp->setFieldOfView(sample.fov_deg);
+        }
+    }
+    camera_->setOrientationView(sample.position, sample.orientation);
+    updateCameraMatrices(*camera_);
+}
+
+// ---------------------------------------------------------------------------
+// Playback
+// ---------------------------------------------------------------------------
+
+void CameraPathManipulator::play() noexcept {
+    if (!isValid()) {
+        VNE_LOG_WARN << "CameraPathManipulator: play called without a built path";
+        return;
+    }
+    const float total = path_->totalLength();
+    if (!looping_ && ((speed_ >= 0.0f && distance_ >= total) || (speed_ < 0.0f && distance_ <= 0.0f))) {
+        distance_ = (speed_ >= 0.0f) ? 0.0f : total;
+    }
+    playing_ = true;
+}
+
+void CameraPathManipulator::setSpeed(float units_per_second) noexcept {
+    if (!std::isfinite(units_per_second)) {
+        return;
+    }
+    speed_ = units_per_second;
+}
+
+void CameraPathManipulator::seek(float distance) noexcept {
+    distance_ = wrapDistance(distance);
+    CameraPathSample sample;
+    if (sampleAtDistance(distance_, sample)) {
+        applySample(sample);
+    }
+}
+
+void CameraPathManipulator::seekNormalized(float fraction) noexcept {
+    seek(vne::math::clamp(fraction, 0.0f, 1.0f) * path_->totalLength());
+}
+
+// ---------------------------------------------------------------------------
+// ICameraManipulator
+// ---------------------------------------------------------------------------
+
+void CameraPathManipulator::onUpdate(double delta_time) noexcept {
+    if (!enabled_ || !camera_ || !playing_ || !isValid()) {
+        return;
+    }
+    if (!std::isfinite(delta_time) || delta_time <= 0.0) {
+        return;
+    }
+    const float total = path_->totalLength();
+    const float next = distance_ + speed_ * static_cast<float>(delta_time);
+    if (!looping_ && ((speed_ > 0.0f && next >= total) || (speed_ < 0.0f && next <= 0.0f))) {
+        playing_ = false;  // Land exactly on the end keyframe, then stop.
+    }
+    distance_ = wrapDistance(next);
+
+    CameraPathSample sample;
+    if (sampleAtDistance(distance_, sample)) {
+        applySample(sample);
+    }
+}
+
+bool CameraPathManipulator::onAction(CameraActionType action,
+                                     const CameraCommandPayload& /*payload*/,
+                                     double /*delta_time*/) noexcept {
+    if (!enabled_ || !camera_) {
+        return false;
+    }
+    if (action == CameraActionType::eResetView) {
+        seek(0.0f);
+        return isValid();
+    }
+    return false;
+}
+
+void CameraPathManipulator::resetState() noexcept {}
+
+CameraMotionState CameraPathManipulator::getMotionState() const noexcept {
+    CameraMotionState state;
+    if (!enabled_ || !camera_ || !playing_ || !isValid() || speed_ == 0.0f) {
+        return state;
+    }
+    const float speed = std::abs(speed_);
+    state.animating = true;
+    state.linear_speed = speed;
+    if (looping_) {
+        state.settle_time_s = std::numeric_limits<float>::infinity();
+    } else {
+        state.settle_time_s = ((speed_ > 0.0f) ? (path_->totalLength() - distance_) : distance_) / speed;
+    }
+    CameraPathSample now;
+    CameraPathSample next;
+    if (sampleAtDistance(distance_, now) && sampleAtDistance(distance_ + speed_ * kMotionSampleStepS, next)) {
+        const vne::math::Quatf turn = normalizeQuat(next.orientation * now.orientation.conjugate());
+        state.angular_speed = quatToRotationVector(turn).length() / kMotionSampleStepS;
+        if (now.fov_deg > 0.0f && next.fov_deg > 0.0f) {
+            state.zoom_rate = std::log(next.fov_deg / now.fov_deg) / kMotionSampleStepS;
+        }
+    }
+    return state;
+}
+
+CameraPoseSnapshot CameraPathManipulator::predictPose(double seconds_ahead) const noexcept {
+    if (!camera_) {
+        return {};
+    }
+    CameraPoseSnapshot pose = captureCameraPose(*camera_);
+    CameraPathSample sample;
+    if (!enabled_ || !playing_ || !sampleAtDistance(distance_ + speed_ * lookaheadSeconds(seconds_ahead), sample)) {
+        return pose;
+    }
+    // Sampled even with no look-ahead: the path pose, not a blend the rig may be showing
+    const float dist = std::max((pose.target - pose.position).length(), kEpsilon);
+    pose.position = sample.position;
+    pose.orientation = sample.orientation;
+    pose.target = sample.position - sample.orientation.getZAxis() * dist;
+    if (sample.fov_deg > 0.0f && pose.fov_deg > 0.0f) {
+        pose.fov_deg = sample.fov_deg;
+    }
+    return pose;
+}
+
+}  // namespace vne::interaction
@@ -14,13 +14,21 @@
 #include "vertexnova/interaction/trackball_manipulator.h"
 #include "vertexnova/interaction/free_look_manipulator.h"
 #include "vertexnova/interaction/ortho_2d_manipulator.h"
+#include "vertexnova/interaction/camera_path_manipulator.h"
+
+#include "interaction_utils.h"
 
 #include <vertexnova/logging/logging.h>
 
 #include <algorithm>
+#include <cmath>
+#include <utility>
 
 namespace {
 CREATE_VNE_LOGGER_CATEGORY("vne.interaction.camera_rig");
+constexpr float kPoseMatchEpsilon = 1e-5f;
+constexpr double kFixedStepEpsilon = 1e-9;  // absorbs rounding when dt is an exact multiple of the step
+constexpr int kMinFixedSteps = 1;
 }  // namespace
 
 namespace vne::interaction {
@@ -30,6 +38,9 @@ void CameraRig::addManipulator(std::shared_ptr<ICameraManipulator> manipulator)
         VNE_LOG_WARN << "CameraRig: addManipulator called with null manipulator, ignoring";
         return;
     }
+    if (defer_matrices_) {
+        manipulator->setMatrixUpdatesDeferred(true);
+    }
     manipulators_.push_back(std::move(manipulator));
 }
 
@@ -42,22 +53,56 @@ void CameraRig::clearManipulators() {
 }
 
 void CameraRig::onAction(CameraActionType action, const CameraCommandPayload& payload, double delta_time) noexcept {
+    restoreManipulatorPose();
     for (auto& m : manipulators_) {
         if (m && m->isEnabled()) {
             m->onAction(action, payload, delta_time);
         }
     }
+    if (isFixedTimestepEnabled() && camera_) {
+        // Direct input is shown as-is: restart interpolation from the pose the action produced.
+        const CameraPoseSnapshot now = captureCameraPose(*camera_);
+        if (!cameraPosesMatch(now, manipulator_pose_)) {
+            fixed_prev_pose_ = now;
+        }
+    }
+    publishPose(0.0);
 }
 
 void CameraRig::onUpdate(double delta_time) noexcept {
-    for (auto& m : manipulators_) {
-        if (m && m->isEnabled()) {
-            m->onUpdate(delta_time);
+    restoreManipulatorPose();
+    if (isFixedTimestepEnabled()) {
+        stepFixed(delta_time);
+    } else {
+        for (auto& m : manipulators_) {
+            if (m && m->isEnabled()) {
+                m->onUpdate(delta_time);
+            }
+        }
+        commitSlideConstraint();
+    }
+    publishPose(delta_time);
+    applyConstraint();
+    if (clip_planes_ && camera_) {
+        clip_planes_->update(*camera_, !defer_matrices_);
+    }
+
+    if (trajectory_writer_ && camera_) {
+        trajectory_writer_->append(trajectory_time_s_, captureCameraPose(*camera_));
+        if (delta_time > 0.0 && std::isfinite(delta_time)) {
+            trajectory_time_s_ += delta_time;
         }
     }
 }
 
 void CameraRig::setCamera(const std::shared_ptr<vne::scene::ICamera>& camera) noexcept {
+    transitioning_ = false;
+    pose_overridden_ = false;
+    fixed_accumulator_s_ = 0.0;
+    camera_ = camera;
+    if (constraint_) {
+        constraint_->reset();
+    }
     for (auto& m : manipulators_) {
         if (m) {
             m->setCamera(camera);
@@ -81,6 +126,338 @@ void CameraRig::resetState() noexcept {
     }
 }
 
+// ---------------------------------------------------------------------------
+// Animated handoff
+// ---------------------------------------------------------------------------
+
+bool CameraRig::switchTo(const std::shared_ptr<ICameraManipulator>& incoming, float duration_s) noexcept {
+    if (!incoming || std::find(manipulators_.begin(), manipulators_.end(), incoming) == manipulators_.end()) {
+        VNE_LOG_WARN << "CameraRig: switchTo called with a manipulator not registered on this rig, ignoring";
+        return false;
+    }
+    // Start from what the camera shows now (the blended pose if a transition is already running).
+    CameraPoseSnapshot from;
+    if (camera_) {
+        from = captureCameraPose(*camera_);
+    }
+    transitioning_ = false;
+    pose_overridden_ = false;  // The shown pose is what gets handed off.
+
+    for (auto& m : manipulators_) {
+        if (!m || m == incoming) {
+            continue;
+        }
+        if (m->isEnabled()) {
+            m->resetState();
+        }
+        m->setEnabled(false);
+    }
+    incoming->setEnabled(true);
+    if (!camera_) {
+        return true;
+    }
+    incoming->onHandoff(from);
+    beginTransition(from, duration_s);
+    return true;
+}
+
+void CameraRig::beginTransition(const CameraPoseSnapshot& from, float duration_s) noexcept {
+    if (!camera_ || !(duration_s > 0.0f)) {
+        transitioning_ = false;
+        return;
+    }
+    restoreManipulatorPose();
+    transition_from_ = from;
+    transition_elapsed_ = 0.0f;
+    transition_duration_ = duration_s;
+    transitioning_ = true;
+    publishPose(0.0);
+}
+
+void CameraRig::animateToPose(const CameraPoseSnapshot& pose, float duration_s) noexcept {
+    if (!camera_) {
+        return;
+    }
+    const CameraPoseSnapshot from = captureCameraPose(*camera_);
+    transitioning_ = false;
+    pose_overridden_ = false;
+    applyCameraPose(*camera_, pose, !defer_matrices_);
+    if (constraint_) {
+        constraint_->reset();  // a deliberate jump, not motion to sweep
+    }
+    for (auto& m : manipulators_) {
+        if (m && m->isEnabled()) {
+            m->resetState();
+            m->onHandoff(pose);
+        }
+    }
+    beginTransition(from, duration_s);
+}
+
+void CameraRig::cancelTransition() noexcept {
+    restoreManipulatorPose();
+    transitioning_ = false;
+}
+
+CameraPoseSnapshot CameraRig::capturePose(const vne::scene::ICamera& camera) noexcept {
+    return captureCameraPose(camera);
+}
+
+// ---------------------------------------------------------------------------
+// Fixed timestep
+// ---------------------------------------------------------------------------
+
+void CameraRig::setFixedTimestep(double step_s) noexcept {
+    fixed_step_s_ = (std::isfinite(step_s) && step_s > 0.0) ? step_s : 0.0;
+    fixed_accumulator_s_ = 0.0;
+}
+
+void CameraRig::setMaxFixedSteps(int max_steps) noexcept {
+    max_fixed_steps_ = std::max(kMinFixedSteps, max_steps);
+}
+
+float CameraRig::getInterpolationAlpha() const noexcept {
+    if (!isFixedTimestepEnabled()) {
+        return 0.0f;
+    }
+    return vne::math::clamp(static_cast<float>(fixed_accumulator_s_ / fixed_step_s_), 0.0f, 1.0f);
+}
+
+void CameraRig::stepFixed(double delta_time) noexcept {
+    if (delta_time > 0.0 && std::isfinite(delta_time)) {
+        fixed_accumulator_s_ += delta_time;
+    }
+    int steps = 0;
+    while (fixed_accumulator_s_ + kFixedStepEpsilon >= fixed_step_s_) {
+        if (steps >= max_fixed_steps_) {
+            // Too far behind: drop whole steps rather than spiral on the next frame.
+            fixed_accumulator_s_ = std::fmod(fixed_accumulator_s_, fixed_step_s_);
+            if (fixed_accumulator_s_ + kFixedStepEpsilon >= fixed_step_s_) {
+                fixed_accumulator_s_ = 0.0;
+            }
+            break;
+        }
+        if (camera_) {
+            fixed_prev_pose_ = captureCameraPose(*camera_);
+        }
+        for (auto& m : manipulators_) {
+            if (m && m->isEnabled()) {
+                m->onUpdate(fixed_step_s_);
+            }
+        }
+        commitSlideConstraint();  // every step, so the pose interpolated from is inside too
+        fixed_accumulator_s_ = std::max(0.0, fixed_accumulator_s_ - fixed_step_s_);
+        ++steps;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Shown pose (handoff blend, fixed-step interpolation)
+// ---------------------------------------------------------------------------
+
+void CameraRig::restoreManipulatorPose() noexcept {
+    if (!camera_) {
+        return;
+    }
+    if (pose_overridden_) {
+        pose_overridden_ = false;
+        // A camera that no longer shows the rig's pose was moved directly; that pose is the manipulators' pose.
+        if (cameraShowsOverride()) {
+            applyCameraPose(*camera_, manipulator_pose_, !defer_matrices_);
+            return;
+        }
+    }
+    if (isFixedTimestepEnabled()) {
+        // Camera moved outside the rig (or mode just enabled): do not interpolate from a stale state.
+        const CameraPoseSnapshot now = captureCameraPose(*camera_);
+        if (!cameraPosesMatch(now, manipulator_pose_)) {
+            manipulator_pose_ = now;
+            fixed_prev_pose_ = now;
+        }
+    }
+}
+
+bool CameraRig::cameraShowsOverride() const noexcept {
+    return (camera_->getPosition() - shown_pose_.position).length() <= kPoseMatchEpsilon
+           && (camera_->getTarget() - shown_pose_.target).length() <= kPoseMatchEpsilon;
+}
+
+CameraPoseSnapshot CameraRig::getManipulatorPose() const noexcept {
+    if (!camera_) {
+        return {};
+    }
+    if (pose_overridden_ && cameraShowsOverride()) {
+        return manipulator_pose_;
+    }
+    return captureCameraPose(*camera_);
+}
+
+void CameraRig::publishPose(double delta_time) noexcept {
+    if (!camera_ || (!transitioning_ && !isFixedTimestepEnabled())) {
+        return;
+    }
+    manipulator_pose_ = captureCameraPose(*camera_);
+    CameraPoseSnapshot shown = manipulator_pose_;
+    bool override_pose = false;
+
+    if (isFixedTimestepEnabled() && !cameraPosesMatch(fixed_prev_pose_, manipulator_pose_)) {
+        shown = blendCameraPose(fixed_prev_pose_, manipulator_pose_, getInterpolationAlpha());
+        override_pose = true;
+    }
+    if (transitioning_) {
+        if (delta_time > 0.0) {
+            transition_elapsed_ += static_cast<float>(delta_time);
+        }
+        if (transition_elapsed_ >= transition_duration_) {
+            transitioning_ = false;
+        } else {
+            const float t = vne::math::clamp(transition_elapsed_ / transition_duration_, 0.0f, 1.0f);
+            shown = blendCameraPose(transition_from_, shown, vne::math::ease(transition_easing_, t));
+            override_pose = true;
+        }
+    }
+    if (!override_pose) {
+        return;
+    }
+    applyCameraPose(*camera_, shown, !defer_matrices_);
+    // Store what the camera reports back so the next comparison is exact.
+    shown_pose_ = shown;
+    shown_pose_.position = camera_->getPosition();
+    shown_pose_.target = camera_->getTarget();
+    pose_overridden_ = true;
+}
+
+// ---------------------------------------------------------------------------
+// Matrix updates
+// ---------------------------------------------------------------------------
+
+void CameraRig::setMatrixUpdatesDeferred(bool deferred) noexcept {
+    defer_matrices_ = deferred;
+    for (auto& m : manipulators_) {
+        if (m) {
+            m->setMatrixUpdatesDeferred(deferred);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Trajectory export
+// ---------------------------------------------------------------------------
+
+void CameraRig::setTrajectoryWriter(std::shared_ptr<CameraTrajectoryWriter> writer) noexcept {
+    trajectory_writer_ = std::move(writer);
+    trajectory_time_s_ = 0.0;
+}
+
+// ---------------------------------------------------------------------------
+// Clip planes
+// ---------------------------------------------------------------------------
+
+void CameraRig::setClipPlaneManager(std::shared_ptr<ClipPlaneManager> manager) noexcept {
+    clip_planes_ = std::move(manager);
+}
+
+// ---------------------------------------------------------------------------
+// Camera constraint
+// ---------------------------------------------------------------------------
+
+void CameraRig::setCameraConstraint(std::shared_ptr<CameraConstraint> constraint) noexcept {
+    constraint_ = std::move(constraint);
+    if (constraint_) {
+        constraint_->reset();
+    }
+}
+
+void CameraRig::commitSlideConstraint() noexcept {
+    if (!constraint_ || !camera_ || constraint_->getMode() != ConstraintMode::eSlide) {
+        return;
+    }
+    // The camera still holds the manipulators' own pose here; fixed-step interpolation and handoff blends are
+    // layered on top of the corrected poses by publishPose, so they never carry the manipulators through a wall.
+    CameraPoseSnapshot corrected;
+    if (constraint_->constrain(captureCameraPose(*camera_), corrected)) {
+        applyCameraPose(*camera_, corrected, !defer_matrices_);  // manipulators continue from the corrected pose
+    }
+}
+
+void CameraRig::applyConstraint() noexcept {
+    if (!constraint_ || !camera_ || constraint_->getMode() == ConstraintMode::eSlide) {
+        return;
+    }
+    const CameraPoseSnapshot shown = captureCameraPose(*camera_);
+    CameraPoseSnapshot corrected;
+    if (!constraint_->constrain(shown, corrected)) {
+        return;
+    }
+    applyCameraPose(*camera_, corrected, !defer_matrices_);
+    // Spring arm: show the correction, keep the manipulators' own pose
+    if (!pose_overridden_) {
+        manipulator_pose_ = shown;
+    }
+    shown_pose_ = corrected;
+    shown_pose_.position = camera_->getPosition();
+    shown_pose_.target = camera_->getTarget();
+    pose_overridden_ = true;
+}
+
+// ---------------------------------------------------------------------------
+// Motion state
+// ---------------------------------------------------------------------------
+
+CameraMotionState CameraRig::getMotionState() const noexcept {
+    CameraMotionState state;
+    for (const auto& m : manipulators_) {
+        if (m && m->isEnabled()) {
+            state.merge(m->getMotionState());
+        }
+    }
+    if (transitioning_) {
+        state.animating = true;
+        state.settle_time_s = std::max(state.settle_time_s, transition_duration_ - transition_elapsed_);
+    }
+    return state;
+}
+
+// ---------------------------------------------------------------------------
+// Pose prediction
+// ---------------------------------------------------------------------------
+
+CameraPoseSnapshot CameraRig::predictPose(double seconds_ahead) const noexcept {
+    CameraPoseSnapshot pose;
+    predictPoses(std::span<const double>(&seconds_ahead, 1), std::span<CameraPoseSnapshot>(&pose, 1));
+    return pose;
+}
+
+std::size_t CameraRig::predictPoses(std::span<const double> seconds_ahead,
+                                    std::span<CameraPoseSnapshot> out) const noexcept {
+    if (!camera_) {
+        return 0;
+    }
+    // The last manipulator in motion writes the camera last in onUpdate
+    const ICameraManipulator* source = nullptr;
+    for (const auto& m : manipulators_) {
+        if (m && m->isEnabled() && m->getMotionState().isMoving()) {
+            source = m.get();
+        }
+    }
+    // Carried as a relative motion: the manipulator reads the camera, which may be showing a blend
+    const CameraPoseSnapshot held = getManipulatorPose();
+    const CameraPoseSnapshot from = source ? source->predictPose(0.0) : held;
+    const std::size_t count = std::min(seconds_ahead.size(), out.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        const float ahead = lookaheadSeconds(seconds_ahead[i]);
+        CameraPoseSnapshot pose = source ? transferCameraMotion(held, from, source->predictPose(ahead)) : held;
+        if (transitioning_ && transition_duration_ > 0.0f) {
+            const float t = (transition_elapsed_ + ahead) / transition_duration_;
+            if (t < 1.0f) {
+                pose = blendCameraPose(transition_from_, pose, vne::math::ease(transition_easing_, t));
+            }
+        }
+        out[i] = pose;
+    }
+    return count;
+}
+
 // ---------------------------------------------------------------------------
 // Factory methods
 // ---------------------------------------------------------------------------
@@ -123,4 +500,10 @@ CameraRig CameraRig::makeOrtho2D() {
     return rig;
 }
 
+CameraRig CameraRig::makeCameraPath() {
+    CameraRig rig;
+    rig.addManipulator(std::make_shared<CameraPathManipulator>());
+    return rig;
+}
+
 }  // namespace vne::interaction
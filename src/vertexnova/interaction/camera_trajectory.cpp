@@ -0,0 +1,707 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/camera_trajectory.h"
+
+#include "detail/async_file_writer.h"
+#include "detail/mapped_file.h"
+#include "interaction_utils.h"
+
+#include <vertexnova/logging/logging.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+CREATE_VNE_LOGGER_CATEGORY("vne.interaction.trajectory");
+
+// File layout (little-endian):
+//   header : magic "VNCT", u16 version, u16 channel count, u32 frames per block, f64 step per channel
+//   block  : u32 block bytes, u32 frame count, per channel {i64 q0, i64 d1, i64 e_min, u8 bits}, then per
+//            channel a column of (frame count - 2) residuals packed LSB-first at `bits` each
+//            (kRawBits = frame count raw f64 values instead)
+//   footer : u64 block offset per block, u64 frame count, u64 block count, u64 footer offset, magic "VNCT"
+// Each channel is quantized to q_i = round(v_i / step). A block stores q_0, d_1 = q_1 - q_0 and, for i >= 2,
+// the second differences e_i = q_i - 2 q_{i-1} + q_{i-2} as e_i - e_min. Smooth motion keeps e_i near zero.
+
+constexpr std::uint8_t kMagic[4] = {'V', 'N', 'C', 'T'};
+constexpr std::uint16_t kVersion = 1;
+constexpr std::size_t kChannels = static_cast<std::size_t>(vne::interaction::TrajectoryChannel::eCount);
+constexpr std::size_t kHeaderBytes = 4 + 2 + 2 + 4 + 8 * kChannels;
+constexpr std::size_t kChannelDescBytes = 8 + 8 + 8 + 1;
+constexpr std::size_t kBlockHeaderBytes = 4 + 4 + kChannelDescBytes * kChannels;
+constexpr std::size_t kFooterTailBytes = 8 + 8 + 8 + 4;
+constexpr std::uint8_t kRawBits = 64;       //!< Column holds raw f64 values
+constexpr std::uint8_t kMaxPackedBits = 56;  //!< Widest packed residual (fits one unaligned 64-bit read)
+constexpr double kMaxQuantized = 4503599627370496.0;       //!< 2^52: |e_i| stays below 2^54
+constexpr std::uint32_t kMinFramesPerBlock = 16;
+constexpr std::uint32_t kMaxFramesPerBlock = 65536;
+
+using Steps = std::array<double, kChannels>;
+
+// ---------------------------------------------------------------------------
+// Byte helpers
+// ---------------------------------------------------------------------------
+
+void putLE(std::vector<std::uint8_t>& out, std::uint64_t v, int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+        out.push_back(static_cast<std::uint8_t>(v >> (8 * i)));
+    }
+}
+
+void putF64(std::vector<std::uint8_t>& out, double v) {
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &v, sizeof(bits));
+    putLE(out, bits, 8);
+}
+
+void patchLE32(std::vector<std::uint8_t>& out, std::size_t at, std::uint32_t v) {
+    for (int i = 0; i < 4; ++i) {
+        out[at + static_cast<std::size_t>(i)] = static_cast<std::uint8_t>(v >> (8 * i));
+    }
+}
+
+[[nodiscard]] std::uint64_t getLE(const std::uint8_t* p, int bytes) noexcept {
+    std::uint64_t v = 0;
+    for (int i = 0; i < bytes; ++i) {
+        v |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+    }
+    return v;
+}
+
+[[nodiscard]] double getF64(const std::uint8_t* p) noexcept {
+    const std::uint64_t bits = getLE(p, 8);
+    double v = 0.0;
+    std::memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+[[nodiscard]] std::size_t columnBytes(std::uint8_t bits, std::size_t frames) noexcept {
+    if (bits == kRawBits) {
+        return frames * 8;
+    }
+    return frames < 2 ? 0 : ((frames - 2) * bits + 7) / 8;
+}
+
+[[nodiscard]] int bitWidth(std::uint64_t v) noexcept {
+    int bits = 0;
+    while (v != 0) {
+        ++bits;
+        v >>= 1;
+    }
+    return bits;
+}
+
+/** Residual @p index of a packed column (reads at most 8 bytes, never past @p column_end). */
+[[nodiscard]] std::uint64_t unpack(const std::uint8_t* column,
+                                   const std::uint8_t* column_end,
+                                   std::uint8_t bits,
+                                   std::size_t index) noexcept {
+    if (bits == 0) {
+        return 0;
+    }
+    const std::size_t bit = index * bits;
+    const std::uint8_t* p = column + bit / 8;
+    const auto avail = static_cast<int>(std::min<std::ptrdiff_t>(column_end - p, 8));
+    const std::uint64_t word = getLE(p, avail);
+    return (word >> (bit % 8)) & ((std::uint64_t{1} << bits) - 1u);
+}
+
+[[nodiscard]] Steps stepsFor(const vne::interaction::CameraTrajectoryOptions& o) noexcept {
+    using vne::interaction::TrajectoryChannel;
+    Steps s{};
+    s.fill(o.position_step);
+    s[static_cast<std::size_t>(TrajectoryChannel::eTime)] = o.time_step_s;
+    for (auto c : {TrajectoryChannel::eOrientationX,
+                   TrajectoryChannel::eOrientationY,
+                   TrajectoryChannel::eOrientationZ,
+                   TrajectoryChannel::eOrientationW}) {
+        s[static_cast<std::size_t>(c)] = o.orientation_step;
+    }
+    s[static_cast<std::size_t>(TrajectoryChannel::eFovDeg)] = o.fov_step_deg;
+    return s;
+}
+
+[[nodiscard]] bool validStep(double step) noexcept {
+    return std::isfinite(step) && step > 0.0;
+}
+
+// ---------------------------------------------------------------------------
+// Block encoding
+// ---------------------------------------------------------------------------
+
+/** Append channel column @p values (descriptor at @p desc_at, column at the end of @p out). */
+void encodeColumn(std::vector<std::uint8_t>& out,
+                  std::size_t desc_at,
+                  const std::vector<double>& values,
+                  double step,
+                  std::vector<std::int64_t>& q) {
+    const std::size_t n = values.size();
+    bool raw = false;
+    q.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double scaled = values[i] / step;
+        if (!(std::fabs(scaled) < kMaxQuantized)) {
+            raw = true;  // non-finite or too large for the step
+            break;
+        }
+        q[i] = std::llround(scaled);
+    }
+
+    std::int64_t q0 = 0;
+    std::int64_t d1 = 0;
+    std::int64_t lo = 0;
+    std::int64_t hi = 0;
+    int bits = kRawBits;
+    if (!raw) {
+        q0 = q[0];
+        d1 = n > 1 ? q[1] - q[0] : 0;
+        // Second differences in place, back to front so each step still sees the quantized inputs.
+        for (std::size_t i = n; i-- > 2;) {
+            q[i] = q[i] - 2 * q[i - 1] + q[i - 2];
+        }
+        for (std::size_t i = 2; i < n; ++i) {
+            lo = i == 2 ? q[i] : std::min(lo, q[i]);
+            hi = i == 2 ? q[i] : std::max(hi, q[i]);
+        }
+        bits = bitWidth(static_cast<std::uint64_t>(hi - lo));
+    }
+
+    std::uint8_t* desc = out.data() + desc_at;
+    for (std::int64_t field : {q0, d1, lo}) {
+        const auto u = static_cast<std::uint64_t>(field);
+        for (int b = 0; b < 8; ++b) {
+            *desc++ = static_cast<std::uint8_t>(u >> (8 * b));
+        }
+    }
+    *desc = static_cast<std::uint8_t>(bits);
+
+    if (raw) {
+        for (double v : values) {
+            putF64(out, v);
+        }
+        return;
+    }
+    // Fewer than 8 bits are pending before each residual is added, so acc never exceeds 63 bits.
+    std::uint64_t acc = 0;
+    int acc_bits = 0;
+    for (std::size_t i = 2; i < n; ++i) {
+        acc |= static_cast<std::uint64_t>(q[i] - lo) << acc_bits;
+        acc_bits += bits;
+        while (acc_bits >= 8) {
+            out.push_back(static_cast<std::uint8_t>(acc));
+            acc >>= 8;
+            acc_bits -= 8;
+        }
+    }
+    if (acc_bits > 0) {
+        out.push_back(static_cast<std::uint8_t>(acc));
+    }
+}
+
+}  // namespace
+
+namespace vne::interaction {
+
+using namespace vne;
+
+// ---------------------------------------------------------------------------
+// CameraTrajectoryFrame
+// ---------------------------------------------------------------------------
+
+CameraTrajectoryFrame CameraTrajectoryFrame::fromPose(double time_s, const CameraPoseSnapshot& pose) noexcept {
+    CameraTrajectoryFrame f;
+    f.time_s = time_s;
+    f.position = pose.position;
+    f.orientation = pose.orientation;
+    f.center = pose.target;
+    f.distance = (pose.target - pose.position).length();
+    f.fov_deg = pose.fov_deg;
+    return f;
+}
+
+// ---------------------------------------------------------------------------
+// Writer
+// ---------------------------------------------------------------------------
+
+class CameraTrajectoryWriter::Impl {
+    friend class CameraTrajectoryWriter;
+
+    detail::AsyncFileWriter file_;
+    bool open_ = false;
+    CameraTrajectoryOptions options_;
+    Steps steps_{};
+    std::array<std::vector<double>, kChannels> columns_;  //!< Frames of the block being filled
+    std::vector<std::int64_t> scratch_;
+    std::vector<std::uint8_t> out_;
+    std::vector<std::uint64_t> block_offsets_;
+    std::uint64_t bytes_ = 0;
+    std::size_t frames_ = 0;
+    vne::math::Quatf last_orientation_{0.0f, 0.0f, 0.0f, 1.0f};
+
+    void flushBlock() noexcept {
+        const std::size_t n = columns_[0].size();
+        if (n == 0) {
+            return;
+        }
+        const std::size_t start = out_.size();
+        out_.resize(start + kBlockHeaderBytes);
+        patchLE32(out_, start + 4, static_cast<std::uint32_t>(n));
+        for (std::size_t c = 0; c < kChannels; ++c) {
+            encodeColumn(out_, start + 8 + c * kChannelDescBytes, columns_[c], steps_[c], scratch_);
+            columns_[c].clear();
+        }
+        patchLE32(out_, start, static_cast<std::uint32_t>(out_.size() - start));
+        block_offsets_.push_back(bytes_);
+        bytes_ += out_.size() - start;
+        file_.submit(out_);
+    }
+};
+
+CameraTrajectoryWriter::CameraTrajectoryWriter() noexcept
+    : impl_(std::make_unique<Impl>()) {}
+
+CameraTrajectoryWriter::~CameraTrajectoryWriter() {
+    if (impl_) {
+        close();
+    }
+}
+
+CameraTrajectoryWriter::CameraTrajectoryWriter(CameraTrajectoryWriter&&) noexcept = default;
+CameraTrajectoryWriter& CameraTrajectoryWriter::operator=(CameraTrajectoryWriter&&) noexcept = default;
+
+bool CameraTrajectoryWriter::open(const std::string& path, const CameraTrajectoryOptions& options) noexcept {
+    close();
+    const Steps steps = stepsFor(options);
+    if (!std::all_of(steps.begin(), steps.end(), validStep)) {
+        VNE_LOG_WARN << "CameraTrajectoryWriter: quantization steps must be finite and positive";
+        return false;
+    }
+    if (!impl_->file_.open(path)) {
+        VNE_LOG_WARN << "CameraTrajectoryWriter: cannot open '" << path << "' for writing";
+        return false;
+    }
+    impl_->options_ = options;
+    impl_->options_.frames_per_block =
+        std::clamp(options.frames_per_block, kMinFramesPerBlock, kMaxFramesPerBlock);
+    impl_->steps_ = steps;
+    for (auto& column : impl_->columns_) {
+        column.clear();
+        column.reserve(impl_->options_.frames_per_block);
+    }
+    impl_->block_offsets_.clear();
+    impl_->frames_ = 0;
+    impl_->last_orientation_ = vne::math::Quatf(0.0f, 0.0f, 0.0f, 1.0f);
+
+    auto& out = impl_->out_;
+    out.clear();
+    out.insert(out.end(), std::begin(kMagic), std::end(kMagic));
+    putLE(out, kVersion, 2);
+    putLE(out, kChannels, 2);
+    putLE(out, impl_->options_.frames_per_block, 4);
+    for (double step : steps) {
+        putF64(out, step);
+    }
+    impl_->bytes_ = out.size();
+    impl_->file_.submit(out);
+    impl_->open_ = true;
+    return true;
+}
+
+void CameraTrajectoryWriter::append(const CameraTrajectoryFrame& frame) noexcept {
+    if (!impl_->open_) {
+        return;
+    }
+    // q and -q are the same rotation; keep the hemisphere continuous so residuals stay small.
+    vne::math::Quatf q = frame.orientation;
+    const vne::math::Quatf& prev = impl_->last_orientation_;
+    if (q.x * prev.x + q.y * prev.y + q.z * prev.z + q.w * prev.w < 0.0f) {
+        q = vne::math::Quatf(-q.x, -q.y, -q.z, -q.w);
+    }
+    impl_->last_orientation_ = q;
+
+    const std::array<double, kChannels> values = {frame.time_s,
+                                                  frame.position.x(),
+                                                  frame.position.y(),
+                                                  frame.position.z(),
+                                                  q.x,
+                                                  q.y,
+                                                  q.z,
+                                                  q.w,
+                                                  frame.center.x(),
+                                                  frame.center.y(),
+                                                  frame.center.z(),
+                                                  frame.distance,
+                                                  frame.fov_deg};
+    for (std::size_t c = 0; c < kChannels; ++c) {
+        impl_->columns_[c].push_back(values[c]);
+    }
+    ++impl_->frames_;
+    if (impl_->columns_[0].size() >= impl_->options_.frames_per_block) {
+        impl_->flushBlock();
+    }
+}
+
+void CameraTrajectoryWriter::append(double time_s, const CameraPoseSnapshot& pose) noexcept {
+    append(CameraTrajectoryFrame::fromPose(time_s, pose));
+}
+
+void CameraTrajectoryWriter::close() noexcept {
+    if (!impl_->open_) {
+        return;
+    }
+    impl_->flushBlock();
+    auto& out = impl_->out_;
+    const std::uint64_t footer_at = impl_->bytes_;
+    for (std::uint64_t offset : impl_->block_offsets_) {
+        putLE(out, offset, 8);
+    }
+    putLE(out, impl_->frames_, 8);
+    putLE(out, impl_->block_offsets_.size(), 8);
+    putLE(out, footer_at, 8);
+    out.insert(out.end(), std::begin(kMagic), std::end(kMagic));
+    impl_->file_.submit(out);
+    impl_->file_.close();
+    impl_->open_ = false;
+    if (impl_->file_.hasError()) {
+        VNE_LOG_WARN << "CameraTrajectoryWriter: trajectory is incomplete (file write failed)";
+    }
+}
+
+bool CameraTrajectoryWriter::isOpen() const noexcept {
+    return impl_->open_;
+}
+
+std::size_t CameraTrajectoryWriter::getFrameCount() const noexcept {
+    return impl_->frames_;
+}
+
+std::uint64_t CameraTrajectoryWriter::getEncodedBytes() const noexcept {
+    return impl_->bytes_;
+}
+
+bool CameraTrajectoryWriter::hasWriteError() const noexcept {
+    return impl_->file_.hasError();
+}
+
+// ---------------------------------------------------------------------------
+// Reader
+// ---------------------------------------------------------------------------
+
+class CameraTrajectoryReader::Impl {
+    friend class CameraTrajectoryReader;
+
+    /** Decoded descriptors of one block. */
+    struct BlockView {
+        std::size_t frames = 0;
+        std::array<std::uint64_t, kChannels> q0{};  //!< Two's complement; decoded with wrapping arithmetic
+        std::array<std::uint64_t, kChannels> d1{};
+        std::array<std::uint64_t, kChannels> e_min{};
+        std::array<std::uint8_t, kChannels> bits{};
+        std::array<const std::uint8_t*, kChannels> column{};
+        std::array<const std::uint8_t*, kChannels> column_end{};
+    };
+
+    detail::MappedFile map_;
+    std::vector<std::uint8_t> buffer_;  //!< Whole file when mapping is unavailable
+    const std::uint8_t* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool open_ = false;
+    CameraTrajectoryOptions options_;
+    Steps steps_{};
+    std::vector<std::uint64_t> block_offsets_;
+    std::size_t frames_ = 0;
+
+    void release() noexcept {
+        map_.unmap();
+        buffer_.clear();
+        buffer_.shrink_to_fit();
+        data_ = nullptr;
+        size_ = 0;
+        open_ = false;
+        options_ = {};
+        steps_ = {};
+        block_offsets_.clear();
+        frames_ = 0;
+    }
+
+    /** Parse the block at @p offset; false if it does not fit in the file or is inconsistent. */
+    bool view(std::uint64_t offset, BlockView& v) const noexcept {
+        if (offset > size_ || size_ - offset < kBlockHeaderBytes) {
+            return false;
+        }
+        const std::uint8_t* p = data_ + offset;
+        const std::uint64_t block_bytes = getLE(p, 4);
+        v.frames = static_cast<std::size_t>(getLE(p + 4, 4));
+        if (block_bytes < kBlockHeaderBytes || block_bytes > size_ - offset || v.frames == 0
+            || v.frames > options_.frames_per_block) {
+            return false;
+        }
+        const std::uint8_t* column = p + kBlockHeaderBytes;
+        const std::uint8_t* end = p + block_bytes;
+        for (std::size_t c = 0; c < kChannels; ++c) {
+            const std::uint8_t* d = p + 8 + c * kChannelDescBytes;
+            v.q0[c] = getLE(d, 8);
+            v.d1[c] = getLE(d + 8, 8);
+            v.e_min[c] = getLE(d + 16, 8);
+            v.bits[c] = d[24];
+            if (v.bits[c] > kMaxPackedBits && v.bits[c] != kRawBits) {
+                return false;
+            }
+            const std::size_t bytes = columnBytes(v.bits[c], v.frames);
+            if (static_cast<std::size_t>(end - column) < bytes) {
+                return false;
+            }
+            v.column[c] = column;
+            v.column_end[c] = column + bytes;
+            column += bytes;
+        }
+        return true;
+    }
+
+    /** Decode frames [@p from, @p to) of channel @p c into @p out (runs the sums from the block start). */
+    void decode(const BlockView& v, std::size_t c, std::size_t from, std::size_t to, double* out) const noexcept {
+        if (v.bits[c] == kRawBits) {
+            for (std::size_t i = from; i < to; ++i) {
+                *out++ = getF64(v.column[c] + i * 8);
+            }
+            return;
+        }
+        std::uint64_t q = v.q0[c];
+        std::uint64_t d = v.d1[c];
+        for (std::size_t i = 0; i < to; ++i) {
+            if (i >= 2) {
+                d += v.e_min[c] + unpack(v.column[c], v.column_end[c], v.bits[c], i - 2);
+            }
+            if (i >= 1) {
+                q += d;
+            }
+            if (i >= from) {
+                *out++ = static_cast<double>(static_cast<std::int64_t>(q)) * steps_[c];
+            }
+        }
+    }
+
+    bool readHeader() noexcept {
+        if (size_ < kHeaderBytes || std::memcmp(data_, kMagic, sizeof(kMagic)) != 0
+            || getLE(data_ + 4, 2) != kVersion || getLE(data_ + 6, 2) != kChannels) {
+            return false;
+        }
+        options_.frames_per_block = static_cast<std::uint32_t>(getLE(data_ + 8, 4));
+        if (options_.frames_per_block < kMinFramesPerBlock || options_.frames_per_block > kMaxFramesPerBlock) {
+            return false;
+        }
+        for (std::size_t c = 0; c < kChannels; ++c) {
+            steps_[c] = getF64(data_ + 12 + 8 * c);
+            if (!validStep(steps_[c])) {
+                return false;
+            }
+        }
+        options_.time_step_s = steps_[static_cast<std::size_t>(TrajectoryChannel::eTime)];
+        options_.position_step = steps_[static_cast<std::size_t>(TrajectoryChannel::ePositionX)];
+        options_.orientation_step = steps_[static_cast<std::size_t>(TrajectoryChannel::eOrientationX)];
+        options_.fov_step_deg = steps_[static_cast<std::size_t>(TrajectoryChannel::eFovDeg)];
+        return true;
+    }
+
+    /** Use the footer index when present and consistent. */
+    bool readFooter() noexcept {
+        if (size_ < kHeaderBytes + kFooterTailBytes
+            || std::memcmp(data_ + size_ - sizeof(kMagic), kMagic, sizeof(kMagic)) != 0) {
+            return false;
+        }
+        const std::uint8_t* tail = data_ + size_ - kFooterTailBytes;
+        const std::uint64_t frames = getLE(tail, 8);
+        const std::uint64_t blocks = getLE(tail + 8, 8);
+        const std::uint64_t footer_at = getLE(tail + 16, 8);
+        if (footer_at < kHeaderBytes || footer_at > size_ - kFooterTailBytes
+            || (size_ - kFooterTailBytes - footer_at) / 8 != blocks
+            || (size_ - kFooterTailBytes - footer_at) % 8 != 0) {
+            return false;
+        }
+        std::vector<std::uint64_t> offsets(static_cast<std::size_t>(blocks));
+        for (std::size_t b = 0; b < offsets.size(); ++b) {
+            offsets[b] = getLE(data_ + footer_at + 8 * b, 8);
+        }
+        if (!checkBlocks(offsets, frames)) {
+            return false;
+        }
+        block_offsets_ = std::move(offsets);
+        frames_ = static_cast<std::size_t>(frames);
+        return true;
+    }
+
+    /** Index a file whose writer did not finish by walking the blocks from the header on. */
+    void scanBlocks() noexcept {
+        std::uint64_t offset = kHeaderBytes;
+        BlockView v;
+        while (view(offset, v)) {
+            block_offsets_.push_back(offset);
+            frames_ += v.frames;
+            offset += getLE(data_ + offset, 4);
+            if (v.frames < options_.frames_per_block) {
+                break;  // only the last block may be partial
+            }
+        }
+    }
+
+    /** Blocks must be full except the last, and their frames must add up to @p frames. */
+    bool checkBlocks(const std::vector<std::uint64_t>& offsets, std::uint64_t frames) const noexcept {
+        std::uint64_t total = 0;
+        BlockView v;
+        for (std::size_t b = 0; b < offsets.size(); ++b) {
+            if (!view(offsets[b], v)) {
+                return false;
+            }
+            if (b + 1 < offsets.size() && v.frames != options_.frames_per_block) {
+                return false;
+            }
+            total += v.frames;
+        }
+        return total == frames;
+    }
+
+    bool locate(std::size_t index, BlockView& v, std::size_t& local) const noexcept {
+        if (!open_ || index >= frames_) {
+            return false;
+        }
+        const std::size_t block = index / options_.frames_per_block;
+        local = index % options_.frames_per_block;
+        return view(block_offsets_[block], v) && local < v.frames;
+    }
+};
+
+CameraTrajectoryReader::CameraTrajectoryReader() noexcept
+    : impl_(std::make_unique<Impl>()) {}
+
+CameraTrajectoryReader::~CameraTrajectoryReader() = default;
+CameraTrajectoryReader::CameraTrajectoryReader(CameraTrajectoryReader&&) noexcept = default;
+CameraTrajectoryReader& CameraTrajectoryReader::operator=(CameraTrajectoryReader&&) noexcept = default;
+
+bool CameraTrajectoryReader::open(const std::string& path) noexcept {
+    close();
+    if (impl_->map_.map(path)) {
+        impl_->data_ = impl_->map_.data();
+        impl_->size_ = impl_->map_.size();
+    } else {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            VNE_LOG_WARN << "CameraTrajectoryReader: cannot read '" << path << "'";
+            return false;
+        }
+        impl_->buffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        impl_->data_ = impl_->buffer_.data();
+        impl_->size_ = impl_->buffer_.size();
+    }
+    if (!impl_->readHeader()) {
+        VNE_LOG_WARN << "CameraTrajectoryReader: '" << path << "' is not a camera trajectory";
+        impl_->release();
+        return false;
+    }
+    if (!impl_->readFooter()) {
+        impl_->scanBlocks();
+    }
+    impl_->open_ = true;
+    return true;
+}
+
+void CameraTrajectoryReader::close() noexcept {
+    impl_->release();
+}
+
+bool CameraTrajectoryReader::isOpen() const noexcept {
+    return impl_->open_;
+}
+
+bool CameraTrajectoryReader::isMemoryMapped() const noexcept {
+    return impl_->map_.isMapped();
+}
+
+const CameraTrajectoryOptions& CameraTrajectoryReader::getOptions() const noexcept {
+    return impl_->options_;
+}
+
+std::size_t CameraTrajectoryReader::getFrameCount() const noexcept {
+    return impl_->frames_;
+}
+
+bool CameraTrajectoryReader::readFrame(std::size_t index, CameraTrajectoryFrame& out) const noexcept {
+    Impl::BlockView v;
+    std::size_t i = 0;
+    if (!impl_->locate(index, v, i)) {
+        return false;
+    }
+    std::array<double, kChannels> d{};
+    for (std::size_t c = 0; c < kChannels; ++c) {
+        impl_->decode(v, c, i, i + 1, &d[c]);
+    }
+    out.time_s = d[0];
+    out.position = vne::math::Vec3f(static_cast<float>(d[1]), static_cast<float>(d[2]), static_cast<float>(d[3]));
+    out.orientation = normalizeQuat(vne::math::Quatf(
+        static_cast<float>(d[4]), static_cast<float>(d[5]), static_cast<float>(d[6]), static_cast<float>(d[7])));
+    out.center = vne::math::Vec3f(static_cast<float>(d[8]), static_cast<float>(d[9]), static_cast<float>(d[10]));
+    out.distance = static_cast<float>(d[11]);
+    out.fov_deg = static_cast<float>(d[12]);
+    return true;
+}
+
+double CameraTrajectoryReader::readValue(std::size_t index, TrajectoryChannel channel) const noexcept {
+    Impl::BlockView v;
+    std::size_t i = 0;
+    const auto c = static_cast<std::size_t>(channel);
+    if (c >= kChannels || !impl_->locate(index, v, i)) {
+        return 0.0;
+    }
+    double value = 0.0;
+    impl_->decode(v, c, i, i + 1, &value);
+    return value;
+}
+
+std::size_t CameraTrajectoryReader::readColumn(TrajectoryChannel channel,
+                                               std::size_t first,
+                                               std::size_t count,
+                                               double* out) const noexcept {
+    const auto c = static_cast<std::size_t>(channel);
+    if (!impl_->open_ || out == nullptr || c >= kChannels || first >= impl_->frames_) {
+        return 0;
+    }
+    const std::size_t last = first + std::min(count, impl_->frames_ - first);
+    const std::size_t per_block = impl_->options_.frames_per_block;
+    std::size_t index = first;
+    Impl::BlockView v;
+    while (index < last) {
+        const std::size_t block = index / per_block;
+        if (!impl_->view(impl_->block_offsets_[block], v)) {
+            break;
+        }
+        const std::size_t block_first = block * per_block;
+        const std::size_t block_last = std::min(last, block_first + v.frames);
+        impl_->decode(v, c, index - block_first, block_last - block_first, out);
+        out += block_last - index;
+        index = block_last;
+        if (index < last && v.frames < per_block) {
+            break;  // short block before the end: index inconsistent
+        }
+    }
+    return index - first;
+}
+
+std::vector<double> CameraTrajectoryReader::readColumn(TrajectoryChannel channel) const {
+    std::vector<double> column(impl_->frames_);
+    column.resize(readColumn(channel, 0, column.size(), column.data()));
+    return column;
+}
+
+}  // namespace vne::interaction
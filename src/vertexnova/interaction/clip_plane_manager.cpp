@@ -0,0 +1,232 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/clip_plane_manager.h"
+
+#include <vertexnova/logging/logging.h>
+#include <vertexnova/scene/camera/perspective_camera.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace {
+CREATE_VNE_LOGGER_CATEGORY("vne.interaction.clip_plane_manager");
+}  // namespace
+
+namespace vne::interaction {
+
+namespace {
+
+constexpr float kMinDepthRatio = 2.0f;
+constexpr float kClipTolerance = 1e-4f;   //!< Relative slack before a plane counts as clipping (float round-off)
+constexpr float kMaxHalfAngleRad = 1.5f;  //!< Side planes are clamped just short of a 180° field of view
+
+bool isFinite(const vne::math::Vec3f& v) noexcept {
+    return std::isfinite(v.x()) && std::isfinite(v.y()) && std::isfinite(v.z());
+}
+
+bool samePose(const vne::math::Vec3f& a,
+              const vne::math::Quatf& qa,
+              const vne::math::Vec3f& b,
+              const vne::math::Quatf& qb) noexcept {
+    return a.x() == b.x() && a.y() == b.y() && a.z() == b.z() && qa.x == qb.x && qa.y == qb.y && qa.z == qb.z
+           && qa.w == qb.w;
+}
+
+/** Inward plane through @p eye with unit normal @p n, as (n, -n·eye). */
+vne::math::Vec4f planeThrough(const vne::math::Vec3f& n, const vne::math::Vec3f& eye) noexcept {
+    return vne::math::Vec4f(n.x(), n.y(), n.z(), -n.dot(eye));
+}
+
+}  // namespace
+
+// ---------------------------------------------------------------------------
+// Scene bounds
+// ---------------------------------------------------------------------------
+
+void ClipPlaneManager::setSpheres(std::span<const ClipSphere> spheres) {
+    spheres_.assign(spheres.begin(), spheres.end());
+    ++spheres_revision_;
+}
+
+void ClipPlaneManager::updateSphere(std::size_t index, const ClipSphere& sphere) noexcept {
+    if (index >= spheres_.size()) {
+        return;
+    }
+    spheres_[index] = sphere;
+    ++spheres_revision_;
+}
+
+void ClipPlaneManager::setHierarchy(std::shared_ptr<const PickIndex> index) noexcept {
+    hierarchy_ = std::move(index);
+    cache_valid_ = false;
+}
+
+// ---------------------------------------------------------------------------
+// Tuning
+// ---------------------------------------------------------------------------
+
+void ClipPlaneManager::setMinNear(float min_near) noexcept {
+    if (!std::isfinite(min_near) || !(min_near > 0.0f)) {
+        VNE_LOG_WARN << "ClipPlaneManager: min near must be positive, ignoring " << min_near;
+        return;
+    }
+    min_near_ = min_near;
+    cache_valid_ = false;
+}
+
+void ClipPlaneManager::setMaxDepthRatio(float ratio) noexcept {
+    if (!std::isfinite(ratio) || !(ratio >= kMinDepthRatio)) {
+        VNE_LOG_WARN << "ClipPlaneManager: depth ratio must be at least " << kMinDepthRatio << ", ignoring " << ratio;
+        return;
+    }
+    max_depth_ratio_ = ratio;
+    cache_valid_ = false;
+}
+
+void ClipPlaneManager::setPadding(float padding) noexcept {
+    padding_ = std::isfinite(padding) ? std::max(padding, 0.0f) : kDefaultPadding;
+    cache_valid_ = false;
+}
+
+void ClipPlaneManager::setHysteresis(float hysteresis) noexcept {
+    hysteresis_ = std::isfinite(hysteresis) ? std::max(hysteresis, 0.0f) : kDefaultHysteresis;
+    cache_valid_ = false;
+}
+
+// ---------------------------------------------------------------------------
+// Fitting
+// ---------------------------------------------------------------------------
+
+bool ClipPlaneManager::computePlanes(const vne::scene::ICamera& camera,
+                                     float& near_plane,
+                                     float& far_plane) const noexcept {
+    const auto* persp = dynamic_cast<const vne::scene::PerspectiveCamera*>(&camera);
+    if (!persp) {
+        return false;
+    }
+    const vne::math::Vec3f eye = persp->getPosition();
+    const vne::math::Quatf q = persp->getOrientation();
+    const vne::math::Vec3f right = q.getXAxis();
+    const vne::math::Vec3f up = q.getYAxis();
+    const vne::math::Vec3f forward = -q.getZAxis();
+    const float aspect = persp->getAspectRatio();
+    if (!isFinite(eye) || !isFinite(forward) || !std::isfinite(aspect) || !(aspect > 0.0f)) {
+        return false;
+    }
+
+    // View pyramid: four side planes through the eye with inward normals
+    const float half_y = std::min(vne::math::degToRad(persp->getFieldOfView()) * 0.5f, kMaxHalfAngleRad);
+    const float half_x = std::min(std::atan(std::tan(half_y) * aspect), kMaxHalfAngleRad);
+    const float cx = std::cos(half_x);
+    const float sx = std::sin(half_x);
+    const float cy = std::cos(half_y);
+    const float sy = std::sin(half_y);
+    const std::array<vne::math::Vec4f, 4> planes = {planeThrough(right * cx + forward * sx, eye),
+                                                    planeThrough(right * -cx + forward * sx, eye),
+                                                    planeThrough(up * cy + forward * sy, eye),
+                                                    planeThrough(up * -cy + forward * sy, eye)};
+
+    float lo = std::numeric_limits<float>::infinity();
+    float hi = -std::numeric_limits<float>::infinity();
+    for (const ClipSphere& s : spheres_) {
+        if (!isFinite(s.center) || !std::isfinite(s.radius) || s.radius < 0.0f) {
+            continue;
+        }
+        const bool outside = std::any_of(planes.begin(), planes.end(), [&](const vne::math::Vec4f& p) {
+            return p.x() * s.center.x() + p.y() * s.center.y() + p.z() * s.center.z() + p.w() < -s.radius;
+        });
+        if (outside) {
+            continue;
+        }
+        const float depth = forward.dot(s.center - eye);
+        lo = std::min(lo, depth - s.radius);
+        hi = std::max(hi, depth + s.radius);
+    }
+    float tree_lo = 0.0f;
+    float tree_hi = 0.0f;
+    if (hierarchy_ && hierarchy_->depthRange(eye, forward, planes, tree_lo, tree_hi)) {
+        lo = std::min(lo, tree_lo);
+        hi = std::max(hi, tree_hi);
+    }
+    if (!(hi > 0.0f) || !std::isfinite(hi)) {
+        return false;  // nothing visible, or everything behind the eye
+    }
+
+    far_plane = std::max(hi * (1.0f + padding_), min_near_ * kMinDepthRatio);
+    const float ratio_floor = far_plane / max_depth_ratio_;
+    // Below far: far >= kMinDepthRatio * min near and ratio floor <= far / kMinDepthRatio
+    near_plane = std::max({lo / (1.0f + padding_), min_near_, ratio_floor});
+    return true;
+}
+
+bool ClipPlaneManager::update(vne::scene::ICamera& camera, bool update_matrices) noexcept {
+    auto* persp = dynamic_cast<vne::scene::PerspectiveCamera*>(&camera);
+    if (!persp) {
+        return false;
+    }
+    const vne::math::Vec3f eye = persp->getPosition();
+    const vne::math::Quatf orientation = persp->getOrientation();
+    const std::uint64_t hierarchy_revision = hierarchy_ ? hierarchy_->revision() : 0;
+    const float cur_near = persp->getNearPlane();
+    const float cur_far = persp->getFarPlane();
+    if (cache_valid_ && cached_camera_ == &camera && samePose(cached_eye_, cached_orientation_, eye, orientation)
+        && cached_fov_deg_ == persp->getFieldOfView() && cached_aspect_ == persp->getAspectRatio()
+        && cached_near_ == cur_near && cached_far_ == cur_far && cached_hierarchy_revision_ == hierarchy_revision
+        && cached_spheres_revision_ == spheres_revision_) {
+        return false;
+    }
+    cache_valid_ = true;
+    cached_camera_ = &camera;
+    cached_eye_ = eye;
+    cached_orientation_ = orientation;
+    cached_fov_deg_ = persp->getFieldOfView();
+    cached_aspect_ = persp->getAspectRatio();
+    cached_hierarchy_revision_ = hierarchy_revision;
+    cached_spheres_revision_ = spheres_revision_;
+    cached_near_ = cur_near;
+    cached_far_ = cur_far;
+
+    float fit_near = 0.0f;
+    float fit_far = 0.0f;
+    if (!computePlanes(camera, fit_near, fit_far)) {
+        return false;
+    }
+    // The fitted range without padding must stay inside the current planes; loose planes wait for the hysteresis.
+    const float pad = 1.0f + padding_;
+    const bool clips =
+        fit_near * pad < cur_near * (1.0f - kClipTolerance) || fit_far / pad > cur_far * (1.0f + kClipTolerance);
+    const float slack = 1.0f + hysteresis_;
+    const bool loose = fit_near > cur_near * slack || fit_far * slack < cur_far;
+    if (!clips && !loose && std::isfinite(cur_near) && std::isfinite(cur_far) && cur_near > 0.0f) {
+        return false;
+    }
+    // Keep near < far at every step in case the camera validates each setter
+    if (fit_near < cur_far) {
+        persp->setNearPlane(fit_near);
+        persp->setFarPlane(fit_far);
+    } else {
+        persp->setFarPlane(fit_far);
+        persp->setNearPlane(fit_near);
+    }
+    if (update_matrices) {
+        persp->updateMatrices();
+    }
+    cached_near_ = persp->getNearPlane();
+    cached_far_ = persp->getFarPlane();
+    ++plane_changes_;
+    return true;
+}
+
+}  // namespace vne::interaction
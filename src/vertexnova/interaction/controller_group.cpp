@@ -0,0 +1,148 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/controller_group.h"
+
+#include "detail/work_stealing_pool.h"
+
+#include <vertexnova/logging/logging.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace {
+CREATE_VNE_LOGGER_CATEGORY("vne.interaction.controller_group");
+}  // namespace
+
+namespace vne::interaction {
+
+// ---------------------------------------------------------------------------
+// Impl
+// ---------------------------------------------------------------------------
+
+class ControllerGroup::Impl {
+    friend class ControllerGroup;
+
+    std::vector<std::shared_ptr<ICameraController>> controllers;
+    std::size_t worker_threads = 0;
+    std::unique_ptr<detail::WorkStealingPool> pool;  //!< Started on the first parallel update
+    ControllerExecutor executor;
+};
+
+// ---------------------------------------------------------------------------
+// Construction
+// ---------------------------------------------------------------------------
+
+std::size_t ControllerGroup::defaultWorkerThreads() noexcept {
+    const unsigned hw = std::thread::hardware_concurrency();
+    return hw > 1 ? static_cast<std::size_t>(hw - 1) : 0;
+}
+
+ControllerGroup::ControllerGroup(std::size_t worker_threads)
+    : impl_(std::make_unique<Impl>()) {
+    impl_->worker_threads = worker_threads;
+}
+
+ControllerGroup::~ControllerGroup() = default;
+ControllerGroup::ControllerGroup(ControllerGroup&&) noexcept = default;
+ControllerGroup& ControllerGroup::operator=(ControllerGroup&&) noexcept = default;
+
+// ---------------------------------------------------------------------------
+// Members
+// ---------------------------------------------------------------------------
+
+std::size_t ControllerGroup::add(std::shared_ptr<ICameraController> controller) {
+    auto& list = impl_->controllers;
+    if (!controller) {
+        VNE_LOG_WARN << "ControllerGroup::add: null controller ignored";
+        return list.size();
+    }
+    const auto it = std::find(list.begin(), list.end(), controller);
+    if (it != list.end()) {
+        return static_cast<std::size_t>(it - list.begin());
+    }
+    list.push_back(std::move(controller));
+    return list.size() - 1;
+}
+
+std::shared_ptr<ICameraController> ControllerGroup::removeAt(std::size_t index) noexcept {
+    auto& list = impl_->controllers;
+    if (index >= list.size()) {
+        return nullptr;
+    }
+    std::shared_ptr<ICameraController> removed = std::move(list[index]);
+    list.erase(list.begin() + static_cast<std::ptrdiff_t>(index));
+    return removed;
+}
+
+bool ControllerGroup::remove(const ICameraController* controller) noexcept {
+    auto& list = impl_->controllers;
+    const auto it =
+        std::find_if(list.begin(), list.end(), [controller](const auto& c) { return c.get() == controller; });
+    if (it == list.end()) {
+        return false;
+    }
+    list.erase(it);
+    return true;
+}
+
+void ControllerGroup::clear() noexcept {
+    impl_->controllers.clear();
+}
+
+std::size_t ControllerGroup::size() const noexcept {
+    return impl_->controllers.size();
+}
+
+const std::shared_ptr<ICameraController>& ControllerGroup::controller(std::size_t index) const noexcept {
+    static const std::shared_ptr<ICameraController> kNone;
+    return index < impl_->controllers.size() ? impl_->controllers[index] : kNone;
+}
+
+// ---------------------------------------------------------------------------
+// Execution
+// ---------------------------------------------------------------------------
+
+void ControllerGroup::setExecutor(ControllerExecutor executor) {
+    impl_->executor = std::move(executor);
+    if (impl_->executor) {
+        impl_->pool.reset();
+    }
+}
+
+std::size_t ControllerGroup::workerThreads() const noexcept {
+    return impl_->worker_threads;
+}
+
+void ControllerGroup::onUpdate(double delta_time) noexcept {
+    auto& list = impl_->controllers;
+    const std::size_t count = list.size();
+    const std::function<void(std::size_t)> task = [&list, delta_time](std::size_t i) {
+        list[i]->onUpdate(delta_time);
+    };
+    if (impl_->executor) {
+        impl_->executor(count, task);
+        return;
+    }
+    if (count < 2 || impl_->worker_threads == 0) {
+        for (std::size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+    if (!impl_->pool) {
+        impl_->pool = std::make_unique<detail::WorkStealingPool>(impl_->worker_threads);
+    }
+    impl_->pool->parallelFor(count, task);
+}
+
+}  // namespace vne::interaction
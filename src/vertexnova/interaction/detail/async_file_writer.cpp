@@ -0,0 +1,90 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "async_file_writer.h"
+
+namespace vne::interaction::detail {
+
+bool AsyncFileWriter::open(const std::string& path) noexcept {
+    close();
+    file_.open(path, std::ios::binary | std::ios::trunc);
+    if (!file_) {
+        file_.clear();
+        return false;
+    }
+    failed_.store(false, std::memory_order_relaxed);
+    stopping_ = false;
+    thread_ = std::thread([this] { run(); });
+    return true;
+}
+
+void AsyncFileWriter::submit(std::vector<std::uint8_t>& buffer) noexcept {
+    if (buffer.empty() || !isOpen()) {
+        return;
+    }
+    const std::size_t capacity = buffer.capacity();
+    std::vector<std::uint8_t> next;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back(std::move(buffer));
+        if (!spare_.empty()) {
+            next = std::move(spare_.back());
+            spare_.pop_back();
+        }
+    }
+    wake_.notify_one();
+    next.clear();
+    next.reserve(capacity);
+    buffer = std::move(next);
+}
+
+void AsyncFileWriter::close() noexcept {
+    if (!thread_.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+    file_.close();
+    pending_.clear();
+    stopping_ = false;
+}
+
+void AsyncFileWriter::run() noexcept {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait(lock, [this] { return stopping_ || !pending_.empty(); });
+        while (!pending_.empty()) {
+            std::vector<std::uint8_t> buffer = std::move(pending_.front());
+            pending_.pop_front();
+            const bool drained = pending_.empty();
+            lock.unlock();
+            file_.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+            if (drained) {
+                file_.flush();
+            }
+            if (!file_) {
+                failed_.store(true, std::memory_order_relaxed);
+            }
+            buffer.clear();
+            lock.lock();
+            spare_.push_back(std::move(buffer));
+        }
+        if (stopping_) {
+            return;
+        }
+    }
+}
+
+}  // namespace vne::interaction::detail
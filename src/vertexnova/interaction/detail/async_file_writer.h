@@ -0,0 +1,71 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file async_file_writer.h
+ * @brief AsyncFileWriter — appends byte buffers to a file from a background thread.
+ *
+ * Producers fill a buffer on their own thread and @ref AsyncFileWriter::submit it; the call only swaps
+ * the buffer into a queue under a mutex and hands back a recycled one, so it never waits on the disk.
+ * Used by InteractionRecorder and CameraTrajectoryWriter.
+ *
+ * Internal header — not installed.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vne::interaction::detail {
+
+class AsyncFileWriter {
+   public:
+    AsyncFileWriter() = default;
+    ~AsyncFileWriter() { close(); }
+
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+    /** Create (truncate) @p path and start the writer thread; false if the file cannot be opened. */
+    bool open(const std::string& path) noexcept;
+
+    /** Queue the contents of @p buffer for writing; @p buffer is replaced by an empty recycled buffer. */
+    void submit(std::vector<std::uint8_t>& buffer) noexcept;
+
+    /** Write everything queued, stop the thread and close the file. No-op when not open. */
+    void close() noexcept;
+
+    [[nodiscard]] bool isOpen() const noexcept { return thread_.joinable(); }
+
+    /** @return true if any write failed since @ref open */
+    [[nodiscard]] bool hasError() const noexcept { return failed_.load(std::memory_order_relaxed); }
+
+   private:
+    void run() noexcept;
+
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<std::vector<std::uint8_t>> pending_;
+    std::vector<std::vector<std::uint8_t>> spare_;  //!< Written buffers returned for reuse
+    bool stopping_ = false;
+    std::ofstream file_;
+    std::atomic<bool> failed_{false};
+};
+
+}  // namespace vne::interaction::detail
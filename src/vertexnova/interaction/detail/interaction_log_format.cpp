@@ -0,0 +1,385 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "interaction_log_format.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+using vne::interaction::detail::kLogFlagExact;
+using vne::interaction::detail::kLogFlagSameDt;
+using vne::interaction::detail::kLogRecordTypeMask;
+using vne::interaction::detail::LogRecordType;
+
+constexpr std::uint8_t kLogMagic[4] = {'V', 'N', 'I', 'R'};
+constexpr std::uint8_t kHeaderFlagDeterministic = 0x01;
+constexpr double kLogCoordScale = 256.0;                 //!< Fixed-point steps per pixel (power of two: exact)
+constexpr double kMaxFixedMagnitude = 1099511627776.0;   //!< 2^40 px; keeps fixed point well inside int64
+constexpr std::uint64_t kMaxHeaderBlobBytes = 1u << 20;  //!< Sanity cap for name / config lengths
+constexpr int kMaxVarintBytes = 10;
+
+// ---------------------------------------------------------------------------
+// Writing
+// ---------------------------------------------------------------------------
+
+void appendVarint(std::vector<std::uint8_t>& out, std::uint64_t v) noexcept {
+    while (v >= 0x80u) {
+        out.push_back(static_cast<std::uint8_t>(v | 0x80u));
+        v >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(v));
+}
+
+void appendZigZag(std::vector<std::uint8_t>& out, std::int64_t v) noexcept {
+    appendVarint(out, (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63));
+}
+
+void appendLE(std::vector<std::uint8_t>& out, std::uint64_t bits, int bytes) noexcept {
+    for (int i = 0; i < bytes; ++i) {
+        out.push_back(static_cast<std::uint8_t>(bits >> (8 * i)));
+    }
+}
+
+void appendF64(std::vector<std::uint8_t>& out, double v) noexcept {
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &v, sizeof(bits));
+    appendLE(out, bits, 8);
+}
+
+void appendF32(std::vector<std::uint8_t>& out, float v) noexcept {
+    std::uint32_t bits = 0;
+    std::memcpy(&bits, &v, sizeof(bits));
+    appendLE(out, bits, 4);
+}
+
+[[nodiscard]] bool sameBits(double a, double b) noexcept {
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+/** Exact 1/256-pixel fixed point of @p v, or false when the conversion would lose information. */
+[[nodiscard]] bool toFixed(double v, std::int64_t& q) noexcept {
+    if (!(std::fabs(v) < kMaxFixedMagnitude) || (v == 0.0 && std::signbit(v))) {
+        return false;
+    }
+    const double scaled = v * kLogCoordScale;
+    if (scaled != std::floor(scaled)) {
+        return false;
+    }
+    q = static_cast<std::int64_t>(scaled);
+    return true;
+}
+
+[[nodiscard]] bool isEventRecord(LogRecordType type) noexcept {
+    return type >= LogRecordType::eMouseMove && type <= LogRecordType::eKeyRepeat;
+}
+
+[[nodiscard]] bool hasCode(LogRecordType type) noexcept {
+    return (type >= LogRecordType::eButtonPress && type <= LogRecordType::eDoubleClick)
+           || type >= LogRecordType::eKeyPress;
+}
+
+[[nodiscard]] bool hasCoords(LogRecordType type) noexcept {
+    return type >= LogRecordType::eMouseMove && type <= LogRecordType::eScroll;
+}
+
+// ---------------------------------------------------------------------------
+// Reading
+// ---------------------------------------------------------------------------
+
+/** Bounds-checked reader; the first short read latches @ref truncated and every later read fails. */
+struct ByteReader {
+    const std::uint8_t* p;
+    const std::uint8_t* end;
+    bool truncated = false;
+    bool corrupt = false;
+
+    [[nodiscard]] bool ok() const noexcept { return !truncated && !corrupt; }
+
+    bool take(std::size_t n) noexcept {
+        if (!ok()) {
+            return false;
+        }
+        if (static_cast<std::size_t>(end - p) < n) {
+            truncated = true;
+            return false;
+        }
+        return true;
+    }
+
+    std::uint8_t u8() noexcept {
+        if (!take(1)) {
+            return 0;
+        }
+        return *p++;
+    }
+
+    std::uint64_t le(int bytes) noexcept {
+        if (!take(static_cast<std::size_t>(bytes))) {
+            return 0;
+        }
+        std::uint64_t v = 0;
+        for (int i = 0; i < bytes; ++i) {
+            v |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+        }
+        p += bytes;
+        return v;
+    }
+
+    double f64() noexcept {
+        const std::uint64_t bits = le(8);
+        double v = 0.0;
+        std::memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+
+    float f32() noexcept {
+        const auto bits = static_cast<std::uint32_t>(le(4));
+        float v = 0.0f;
+        std::memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+
+    std::uint64_t varint() noexcept {
+        std::uint64_t v = 0;
+        for (int i = 0; i < kMaxVarintBytes; ++i) {
+            const std::uint8_t b = u8();
+            if (!ok()) {
+                return 0;
+            }
+            v |= static_cast<std::uint64_t>(b & 0x7Fu) << (7 * i);
+            if ((b & 0x80u) == 0) {
+                return v;
+            }
+        }
+        corrupt = true;
+        return 0;
+    }
+
+    std::int64_t zigzag() noexcept {
+        const std::uint64_t v = varint();
+        return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1u);
+    }
+
+    bool bytes(std::size_t n, const std::uint8_t*& out) noexcept {
+        if (!take(n)) {
+            return false;
+        }
+        out = p;
+        p += n;
+        return true;
+    }
+};
+
+[[nodiscard]] vne::interaction::detail::LogDecodeStatus statusOf(const ByteReader& r) noexcept {
+    using vne::interaction::detail::LogDecodeStatus;
+    if (r.corrupt) {
+        return LogDecodeStatus::eCorrupt;
+    }
+    return r.truncated ? LogDecodeStatus::eNeedMore : LogDecodeStatus::eOk;
+}
+
+}  // namespace
+
+namespace vne::interaction::detail {
+
+// ---------------------------------------------------------------------------
+// Header
+// ---------------------------------------------------------------------------
+
+void encodeLogHeader(std::vector<std::uint8_t>& out, const InteractionRecordingInfo& info) noexcept {
+    out.insert(out.end(), std::begin(kLogMagic), std::end(kLogMagic));
+    appendLE(out, kInteractionLogVersion, 2);
+    appendVarint(out, info.controller.size());
+    out.insert(out.end(), info.controller.begin(), info.controller.end());
+    appendF32(out, info.viewport_width);
+    appendF32(out, info.viewport_height);
+    appendF64(out, info.fixed_step_s);
+    out.push_back(info.deterministic_math ? kHeaderFlagDeterministic : std::uint8_t{0});
+    appendVarint(out, info.config.size());
+    out.insert(out.end(), info.config.begin(), info.config.end());
+}
+
+LogDecodeStatus decodeLogHeader(const std::uint8_t*& cursor,
+                                const std::uint8_t* end,
+                                InteractionRecordingInfo& info) noexcept {
+    ByteReader r{cursor, end};
+    const std::uint8_t* magic = nullptr;
+    if (!r.bytes(sizeof(kLogMagic), magic)) {
+        return statusOf(r);
+    }
+    if (std::memcmp(magic, kLogMagic, sizeof(kLogMagic)) != 0) {
+        return LogDecodeStatus::eCorrupt;
+    }
+    const auto version = static_cast<std::uint16_t>(r.le(2));
+    if (r.ok() && version != kInteractionLogVersion) {
+        return LogDecodeStatus::eCorrupt;
+    }
+
+    InteractionRecordingInfo parsed;
+    const std::uint64_t name_len = r.varint();
+    if (r.ok() && name_len > kMaxHeaderBlobBytes) {
+        return LogDecodeStatus::eCorrupt;
+    }
+    const std::uint8_t* name = nullptr;
+    if (r.bytes(static_cast<std::size_t>(name_len), name)) {
+        parsed.controller.assign(reinterpret_cast<const char*>(name), static_cast<std::size_t>(name_len));
+    }
+    parsed.viewport_width = r.f32();
+    parsed.viewport_height = r.f32();
+    parsed.fixed_step_s = r.f64();
+    parsed.deterministic_math = (r.u8() & kHeaderFlagDeterministic) != 0;
+    const std::uint64_t config_len = r.varint();
+    if (r.ok() && config_len > kMaxHeaderBlobBytes) {
+        return LogDecodeStatus::eCorrupt;
+    }
+    const std::uint8_t* config = nullptr;
+    if (r.bytes(static_cast<std::size_t>(config_len), config)) {
+        parsed.config.assign(config, config + config_len);
+    }
+    if (!r.ok()) {
+        return statusOf(r);
+    }
+    info = std::move(parsed);
+    cursor = r.p;
+    return LogDecodeStatus::eOk;
+}
+
+// ---------------------------------------------------------------------------
+// Records
+// ---------------------------------------------------------------------------
+
+void encodeLogRecord(std::vector<std::uint8_t>& out, LogCodecState& state, const LogRecord& record) noexcept {
+    const LogRecordType type = record.type;
+    std::uint8_t tag = static_cast<std::uint8_t>(type);
+
+    const bool event = isEventRecord(type);
+    bool same_dt = false;
+    if (type == LogRecordType::eUpdate) {
+        same_dt = sameBits(record.dt, state.update_dt);
+    } else if (event) {
+        same_dt = sameBits(record.dt, state.event_dt);
+    }
+    if (same_dt) {
+        tag |= kLogFlagSameDt;
+    }
+
+    std::int64_t qx = 0;
+    std::int64_t qy = 0;
+    const bool coords = hasCoords(type);
+    const bool exact = coords && !(toFixed(record.x, qx) && toFixed(record.y, qy));
+    if (exact) {
+        tag |= kLogFlagExact;
+    }
+
+    out.push_back(tag);
+    const std::uint64_t delta_us = record.time_us > state.time_us ? record.time_us - state.time_us : 0;
+    appendVarint(out, delta_us);
+    state.time_us += delta_us;
+
+    if (type == LogRecordType::eResize) {
+        appendF32(out, static_cast<float>(record.x));
+        appendF32(out, static_cast<float>(record.y));
+        return;
+    }
+    if (type == LogRecordType::eFixedTimestep) {
+        appendF64(out, record.dt);
+        return;
+    }
+    if (!same_dt && (type == LogRecordType::eUpdate || event)) {
+        appendF64(out, record.dt);
+        (type == LogRecordType::eUpdate ? state.update_dt : state.event_dt) = record.dt;
+    }
+    if (hasCode(type)) {
+        appendZigZag(out, record.code);
+    }
+    if (!coords) {
+        return;
+    }
+    if (exact) {
+        appendF64(out, record.x);
+        appendF64(out, record.y);
+        return;
+    }
+    if (type == LogRecordType::eScroll) {
+        appendZigZag(out, qx);
+        appendZigZag(out, qy);
+        return;
+    }
+    appendZigZag(out, qx - state.cursor_x);
+    appendZigZag(out, qy - state.cursor_y);
+    state.cursor_x = qx;
+    state.cursor_y = qy;
+}
+
+LogDecodeStatus decodeLogRecord(const std::uint8_t*& cursor,
+                                const std::uint8_t* end,
+                                LogCodecState& state,
+                                LogRecord& record) noexcept {
+    ByteReader r{cursor, end};
+    const std::uint8_t tag = r.u8();
+    if (!r.ok()) {
+        return statusOf(r);
+    }
+    const auto raw_type = static_cast<std::uint8_t>(tag & kLogRecordTypeMask);
+    if (raw_type < static_cast<std::uint8_t>(LogRecordType::eUpdate)
+        || raw_type > static_cast<std::uint8_t>(LogRecordType::eKeyRepeat)) {
+        return LogDecodeStatus::eCorrupt;
+    }
+
+    LogCodecState next = state;
+    LogRecord rec;
+    rec.type = static_cast<LogRecordType>(raw_type);
+    next.time_us += r.varint();
+    rec.time_us = next.time_us;
+
+    const LogRecordType type = rec.type;
+    const bool event = isEventRecord(type);
+    if (type == LogRecordType::eResize) {
+        rec.x = r.f32();
+        rec.y = r.f32();
+    } else if (type == LogRecordType::eFixedTimestep) {
+        rec.dt = r.f64();
+    } else {
+        double& last_dt = type == LogRecordType::eUpdate ? next.update_dt : next.event_dt;
+        if ((tag & kLogFlagSameDt) == 0) {
+            last_dt = r.f64();
+        }
+        rec.dt = last_dt;
+    }
+    if (event && hasCode(type)) {
+        rec.code = r.zigzag();
+    }
+    if (hasCoords(type)) {
+        if ((tag & kLogFlagExact) != 0) {
+            rec.x = r.f64();
+            rec.y = r.f64();
+        } else if (type == LogRecordType::eScroll) {
+            rec.x = static_cast<double>(r.zigzag()) / kLogCoordScale;
+            rec.y = static_cast<double>(r.zigzag()) / kLogCoordScale;
+        } else {
+            next.cursor_x += r.zigzag();
+            next.cursor_y += r.zigzag();
+            rec.x = static_cast<double>(next.cursor_x) / kLogCoordScale;
+            rec.y = static_cast<double>(next.cursor_y) / kLogCoordScale;
+        }
+    }
+    if (!r.ok()) {
+        return statusOf(r);
+    }
+    state = next;
+    record = rec;
+    cursor = r.p;
+    return LogDecodeStatus::eOk;
+}
+
+}  // namespace vne::interaction::detail
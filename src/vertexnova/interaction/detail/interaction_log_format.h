@@ -0,0 +1,103 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file interaction_log_format.h
+ * @brief Binary layout of interaction recordings shared by InteractionRecorder and InteractionPlayer.
+ *
+ * @par Layout
+ * A log is a session header followed by records until end of file:
+ *  - header: magic @c "VNIR", u16 version, controller name (varint length + bytes), f32 viewport width and
+ *    height, f64 fixed step, u8 flags (bit 0 = deterministic math), config blob (varint length + bytes);
+ *  - record: tag byte (type in the low five bits, flags above), varint timestamp delta in microseconds,
+ *    then a type-specific payload.
+ *
+ * Cursor coordinates are 1/256-pixel fixed point, zigzag-varint encoded as the delta from the previous
+ * cursor position; scroll offsets use the same fixed point without the delta. Values that fixed point
+ * cannot hold exactly are written as raw f64 under @ref kLogFlagExact, so decoding always reproduces the
+ * recorded doubles bit for bit. Time steps repeat from record to record and are written once under
+ * @ref kLogFlagSameDt. Multi-byte scalars are little-endian.
+ *
+ * Internal header — not installed.
+ */
+
+#include "vertexnova/interaction/interaction_recorder.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace vne::interaction::detail {
+
+inline constexpr std::uint16_t kInteractionLogVersion = 1;
+inline constexpr std::uint8_t kLogRecordTypeMask = 0x1F;
+inline constexpr std::uint8_t kLogFlagSameDt = 0x20;  //!< Time step equals the previous one of its kind
+inline constexpr std::uint8_t kLogFlagExact = 0x40;   //!< Coordinates follow as raw f64 instead of fixed point
+
+/** Record kinds; values are part of the file format. */
+enum class LogRecordType : std::uint8_t {
+    eUpdate = 1,         //!< onUpdate(dt)
+    eResize = 2,         //!< onResize(w, h)
+    eFixedTimestep = 3,  //!< setFixedTimestep(step)
+    eMouseMove = 4,      //!< Cursor position
+    eButtonPress = 5,    //!< Button code + cursor position
+    eButtonRelease = 6,  //!< Button code + cursor position
+    eDoubleClick = 7,    //!< Button code + cursor position
+    eScroll = 8,         //!< Wheel offsets
+    eKeyPress = 9,       //!< Key code
+    eKeyRelease = 10,    //!< Key code
+    eKeyRepeat = 11,     //!< Key code
+};
+
+/** One decoded record; fields not used by @ref type are zero. */
+struct LogRecord {
+    LogRecordType type = LogRecordType::eUpdate;
+    std::uint64_t time_us = 0;  //!< Absolute timestamp since the start of the recording
+    double dt = 0.0;            //!< Update / event time step, or fixed step
+    double x = 0.0;             //!< Cursor x, scroll x offset, or viewport width
+    double y = 0.0;             //!< Cursor y, scroll y offset, or viewport height
+    std::int64_t code = 0;      //!< Mouse button or key code
+};
+
+/** Running state that delta encoding depends on; encoder and decoder each keep one. */
+struct LogCodecState {
+    std::uint64_t time_us = 0;
+    std::int64_t cursor_x = 0;  //!< Last fixed-point cursor x
+    std::int64_t cursor_y = 0;  //!< Last fixed-point cursor y
+    double update_dt = 0.0;
+    double event_dt = 0.0;
+};
+
+enum class LogDecodeStatus : std::uint8_t {
+    eOk = 0,        //!< One item decoded; cursor advanced
+    eNeedMore = 1,  //!< Input ends mid-item; nothing consumed
+    eCorrupt = 2,   //!< Input is not a valid log
+};
+
+/** Append the session header for @p info. */
+void encodeLogHeader(std::vector<std::uint8_t>& out, const InteractionRecordingInfo& info) noexcept;
+
+/** Decode the session header from [@p cursor, @p end); advances @p cursor only on eOk. */
+[[nodiscard]] LogDecodeStatus decodeLogHeader(const std::uint8_t*& cursor,
+                                              const std::uint8_t* end,
+                                              InteractionRecordingInfo& info) noexcept;
+
+/** Append @p record, updating @p state. */
+void encodeLogRecord(std::vector<std::uint8_t>& out, LogCodecState& state, const LogRecord& record) noexcept;
+
+/** Decode one record from [@p cursor, @p end); advances @p cursor and updates @p state only on eOk. */
+[[nodiscard]] LogDecodeStatus decodeLogRecord(const std::uint8_t*& cursor,
+                                              const std::uint8_t* end,
+                                              LogCodecState& state,
+                                              LogRecord& record) noexcept;
+
+}  // namespace vne::interaction::detail
@@ -0,0 +1,50 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file mapped_file.h
+ * @brief MappedFile — read-only memory mapping of a whole file (POSIX; unsupported elsewhere).
+ *
+ * Callers fall back to buffered reads when @ref MappedFile::map returns false.
+ *
+ * Internal header — not installed.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace vne::interaction::detail {
+
+class MappedFile {
+   public:
+    MappedFile() = default;
+    ~MappedFile() { unmap(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /** Map @p path read-only for sequential or random access; false if unsupported, empty or unreadable. */
+    bool map(const std::string& path) noexcept;
+
+    void unmap() noexcept;
+
+    [[nodiscard]] bool isMapped() const noexcept { return data_ != nullptr; }
+    [[nodiscard]] const std::uint8_t* data() const noexcept { return data_; }
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+   private:
+    const std::uint8_t* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+}  // namespace vne::interaction::detail
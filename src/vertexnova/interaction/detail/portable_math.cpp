@@ -0,0 +1,301 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "portable_math.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace vne::interaction::detail {
+
+namespace {
+// ln(2) and pi/2 split so that k * hi is exact for the reduction multiples used here (fdlibm constants).
+constexpr double kLn2Hi = 6.93147180369123816490e-01;
+constexpr double kLn2Lo = 1.90821492927058770002e-10;
+constexpr double kInvLn2 = 1.44269504088896338700e+00;
+constexpr double kPio2Hi = 1.57079632673412561417e+00;
+constexpr double kPio2Lo = 6.07710050650619224932e-11;
+constexpr double kTwoOverPi = 6.36619772367581382433e-01;
+constexpr double kSqrtHalf = 7.07106781186547524401e-01;
+constexpr double kPi = 3.14159265358979311600e+00;
+constexpr double kHalfPi = 1.57079632679489655800e+00;
+constexpr double kExpOverflow = 709.78;
+constexpr double kExpUnderflow = -745.2;
+
+/** e^r for |r| <= ln(2)/2: Taylor series to r^13 (truncation < 1e-17). */
+double expReduced(double r) noexcept {
+    double p = 1.0 / 6227020800.0;  // 1/13!
+    p = p * r + 1.0 / 479001600.0;
+    p = p * r + 1.0 / 39916800.0;
+    p = p * r + 1.0 / 3628800.0;
+    p = p * r + 1.0 / 362880.0;
+    p = p * r + 1.0 / 40320.0;
+    p = p * r + 1.0 / 5040.0;
+    p = p * r + 1.0 / 720.0;
+    p = p * r + 1.0 / 120.0;
+    p = p * r + 1.0 / 24.0;
+    p = p * r + 1.0 / 6.0;
+    p = p * r + 0.5;
+    p = p * r + 1.0;
+    return p * r + 1.0;
+}
+
+double expDouble(double x) noexcept {
+    if (std::isnan(x)) {
+        return x;
+    }
+    if (x > kExpOverflow) {
+        return std::numeric_limits<double>::infinity();
+    }
+    if (x < kExpUnderflow) {
+        return 0.0;
+    }
+    const double k = std::floor(x * kInvLn2 + 0.5);
+    const double r = (x - k * kLn2Hi) - k * kLn2Lo;
+    return std::ldexp(expReduced(r), static_cast<int>(k));
+}
+
+double logDouble(double x) noexcept {
+    if (std::isnan(x) || x < 0.0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (x == 0.0) {
+        return -std::numeric_limits<double>::infinity();
+    }
+    if (std::isinf(x)) {
+        return x;
+    }
+    int e = 0;
+    double m = std::frexp(x, &e);  // x = m * 2^e, m in [0.5, 1)
+    if (m < kSqrtHalf) {
+        m *= 2.0;
+        --e;
+    }
+    // log(m) = 2 atanh(s), s = (m - 1) / (m + 1), |s| <= 0.1716: odd series to s^19.
+    const double s = (m - 1.0) / (m + 1.0);
+    const double s2 = s * s;
+    double p = 1.0 / 19.0;
+    p = p * s2 + 1.0 / 17.0;
+    p = p * s2 + 1.0 / 15.0;
+    p = p * s2 + 1.0 / 13.0;
+    p = p * s2 + 1.0 / 11.0;
+    p = p * s2 + 1.0 / 9.0;
+    p = p * s2 + 1.0 / 7.0;
+    p = p * s2 + 1.0 / 5.0;
+    p = p * s2 + 1.0 / 3.0;
+    p = p * s2 + 1.0;
+    const double de = static_cast<double>(e);
+    return de * kLn2Hi + (2.0 * s * p + de * kLn2Lo);
+}
+
+/** sin(r) for |r| <= pi/4: Taylor series to r^17. */
+double sinReduced(double r) noexcept {
+    const double r2 = r * r;
+    double p = 1.0 / 355687428096000.0;  // 1/17!
+    p = -p * r2 + 1.0 / 1307674368000.0;
+    p = -p * r2 + 1.0 / 6227020800.0;
+    p = -p * r2 + 1.0 / 39916800.0;
+    p = -p * r2 + 1.0 / 362880.0;
+    p = -p * r2 + 1.0 / 5040.0;
+    p = -p * r2 + 1.0 / 120.0;
+    p = -p * r2 + 1.0 / 6.0;
+    p = -p * r2 + 1.0;
+    return r * p;
+}
+
+/** cos(r) for |r| <= pi/4: Taylor series to r^18. */
+double cosReduced(double r) noexcept {
+    const double r2 = r * r;
+    double p = 1.0 / 6402373705728000.0;  // 1/18!
+    p = -p * r2 + 1.0 / 20922789888000.0;
+    p = -p * r2 + 1.0 / 87178291200.0;
+    p = -p * r2 + 1.0 / 479001600.0;
+    p = -p * r2 + 1.0 / 3628800.0;
+    p = -p * r2 + 1.0 / 40320.0;
+    p = -p * r2 + 1.0 / 720.0;
+    p = -p * r2 + 1.0 / 24.0;
+    p = -p * r2 + 0.5;
+    return -p * r2 + 1.0;
+}
+
+/** atan(t) for |t| <= 0.2: odd series to t^25 (truncation < 1e-19). */
+double atanReduced(double t) noexcept {
+    const double t2 = t * t;
+    double p = 1.0 / 25.0;
+    p = -p * t2 + 1.0 / 23.0;
+    p = -p * t2 + 1.0 / 21.0;
+    p = -p * t2 + 1.0 / 19.0;
+    p = -p * t2 + 1.0 / 17.0;
+    p = -p * t2 + 1.0 / 15.0;
+    p = -p * t2 + 1.0 / 13.0;
+    p = -p * t2 + 1.0 / 11.0;
+    p = -p * t2 + 1.0 / 9.0;
+    p = -p * t2 + 1.0 / 7.0;
+    p = -p * t2 + 1.0 / 5.0;
+    p = -p * t2 + 1.0 / 3.0;
+    p = -p * t2 + 1.0;
+    return t * p;
+}
+
+/** atan(t) for t in [0, 1]: two half-angle steps t / (1 + sqrt(1 + t^2)) bring t below 0.2. */
+double atanUnit(double t) noexcept {
+    t = t / (1.0 + std::sqrt(1.0 + t * t));
+    t = t / (1.0 + std::sqrt(1.0 + t * t));
+    return 4.0 * atanReduced(t);
+}
+
+/** atan2 for finite, not both zero, arguments. */
+double atan2Double(double y, double x) noexcept {
+    const double ay = std::fabs(y);
+    const double ax = std::fabs(x);
+    double a = ay <= ax ? atanUnit(ay / ax) : kHalfPi - atanUnit(ax / ay);
+    if (x < 0.0) {
+        a = kPi - a;
+    }
+    return y < 0.0 ? -a : a;
+}
+
+/** Reduce @p x to r in [-pi/4, pi/4]; returns the quadrant (0..3). */
+int reduceQuadrant(double x, double& r) noexcept {
+    const double k = std::floor(x * kTwoOverPi + 0.5);
+    r = (x - k * kPio2Hi) - k * kPio2Lo;
+    const auto q = static_cast<std::int64_t>(k) % 4;
+    return static_cast<int>(q < 0 ? q + 4 : q);
+}
+}  // namespace
+
+float portableExp(float x) noexcept {
+    return static_cast<float>(expDouble(static_cast<double>(x)));
+}
+
+float portableLog(float x) noexcept {
+    return static_cast<float>(logDouble(static_cast<double>(x)));
+}
+
+float portablePow(float base, float exponent) noexcept {
+    if (exponent == 0.0f || base == 1.0f) {
+        return 1.0f;
+    }
+    if (std::isnan(base) || std::isnan(exponent)) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    const double b = static_cast<double>(base);
+    const double e = static_cast<double>(exponent);
+    if (b == 0.0) {
+        return e > 0.0 ? 0.0f : std::numeric_limits<float>::infinity();
+    }
+    if (b < 0.0) {
+        if (std::floor(e) != e) {
+            return std::numeric_limits<float>::quiet_NaN();
+        }
+        const double magnitude = expDouble(e * logDouble(-b));
+        const bool odd = std::fmod(e, 2.0) != 0.0;
+        return static_cast<float>(odd ? -magnitude : magnitude);
+    }
+    return static_cast<float>(expDouble(e * logDouble(b)));
+}
+
+float portableSin(float x) noexcept {
+    if (!std::isfinite(x)) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    double r = 0.0;
+    switch (reduceQuadrant(static_cast<double>(x), r)) {
+        case 0:
+            return static_cast<float>(sinReduced(r));
+        case 1:
+            return static_cast<float>(cosReduced(r));
+        case 2:
+            return static_cast<float>(-sinReduced(r));
+        default:
+            return static_cast<float>(-cosReduced(r));
+    }
+}
+
+float portableCos(float x) noexcept {
+    if (!std::isfinite(x)) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    double r = 0.0;
+    switch (reduceQuadrant(static_cast<double>(x), r)) {
+        case 0:
+            return static_cast<float>(cosReduced(r));
+        case 1:
+            return static_cast<float>(-sinReduced(r));
+        case 2:
+            return static_cast<float>(-cosReduced(r));
+        default:
+            return static_cast<float>(sinReduced(r));
+    }
+}
+
+float portableTan(float x) noexcept {
+    if (!std::isfinite(x)) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    double r = 0.0;
+    const int quadrant = reduceQuadrant(static_cast<double>(x), r);
+    const double s = sinReduced(r);
+    const double c = cosReduced(r);
+    return static_cast<float>((quadrant & 1) != 0 ? -c / s : s / c);
+}
+
+float portableAtan(float x) noexcept {
+    if (std::isnan(x)) {
+        return x;
+    }
+    return portableAtan2(x, 1.0f);
+}
+
+float portableAtan2(float y, float x) noexcept {
+    if (std::isnan(x) || std::isnan(y)) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    const double dy = static_cast<double>(y);
+    const double dx = static_cast<double>(x);
+    if (y == 0.0f) {
+        // Signed zeros: +0 / -0 to the right, +pi / -pi to the left
+        return static_cast<float>(std::copysign(std::signbit(x) ? kPi : 0.0, dy));
+    }
+    if (std::isinf(x) || std::isinf(y)) {
+        const double a = std::isinf(y) ? (std::isinf(x) ? (x > 0.0f ? kPi / 4.0 : 3.0 * kPi / 4.0) : kHalfPi)
+                                       : (x > 0.0f ? 0.0 : kPi);
+        return static_cast<float>(std::copysign(a, dy));
+    }
+    return static_cast<float>(atan2Double(dy, dx));
+}
+
+float portableAsin(float x) noexcept {
+    if (!(std::fabs(x) <= 1.0f)) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    if (x == 0.0f) {
+        return x;  // keeps the sign of zero
+    }
+    const double d = static_cast<double>(x);
+    const double c = std::sqrt((1.0 - d) * (1.0 + d));
+    return static_cast<float>(c == 0.0 ? std::copysign(kHalfPi, d) : atan2Double(d, c));
+}
+
+float portableAcos(float x) noexcept {
+    if (!(std::fabs(x) <= 1.0f)) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    const double d = static_cast<double>(x);
+    const double s = std::sqrt((1.0 - d) * (1.0 + d));
+    if (s == 0.0) {
+        return d > 0.0 ? 0.0f : static_cast<float>(kPi);
+    }
+    return static_cast<float>(atan2Double(s, d));
+}
+
+}  // namespace vne::interaction::detail
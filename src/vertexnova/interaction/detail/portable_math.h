@@ -0,0 +1,58 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file portable_math.h
+ * @brief Portable transcendental functions with bit-identical results on every IEEE-754 platform.
+ *
+ * Each function reduces its argument with exact steps (@c floor, @c frexp, @c ldexp, Cody-Waite split
+ * constants) and evaluates a fixed polynomial by Horner's rule in double precision, then rounds once to
+ * float. Only correctly-rounded IEEE operations are used, so the output depends on neither libm nor the
+ * compiler, provided the translation unit is compiled without FP contraction (see @c src/CMakeLists.txt).
+ * Accuracy is well below one float ulp over the ranges used by interaction code.
+ */
+
+#include "vertexnova/interaction/export.h"
+
+namespace vne::interaction::detail {
+
+/** e^x; +inf above the double overflow threshold, +0 below underflow, NaN propagates. */
+[[nodiscard]] VNE_INTERACTION_API float portableExp(float x) noexcept;
+
+/** Natural logarithm; NaN for x < 0, -inf for 0. */
+[[nodiscard]] VNE_INTERACTION_API float portableLog(float x) noexcept;
+
+/** base^exponent via exp(exponent · log(base)); negative bases only for integral exponents. */
+[[nodiscard]] VNE_INTERACTION_API float portablePow(float base, float exponent) noexcept;
+
+/** Sine of @p x radians (Cody-Waite reduction by pi/2; intended for |x| < 1e5). */
+[[nodiscard]] VNE_INTERACTION_API float portableSin(float x) noexcept;
+
+/** Cosine of @p x radians (Cody-Waite reduction by pi/2; intended for |x| < 1e5). */
+[[nodiscard]] VNE_INTERACTION_API float portableCos(float x) noexcept;
+
+/** Tangent of @p x radians (sine over cosine after the same reduction). */
+[[nodiscard]] VNE_INTERACTION_API float portableTan(float x) noexcept;
+
+/** Arc tangent in [-pi/2, pi/2]. */
+[[nodiscard]] VNE_INTERACTION_API float portableAtan(float x) noexcept;
+
+/** Angle of (@p x, @p y) in [-pi, pi], with the signed-zero and infinity cases of @c std::atan2. */
+[[nodiscard]] VNE_INTERACTION_API float portableAtan2(float y, float x) noexcept;
+
+/** Arc sine in [-pi/2, pi/2]; NaN outside [-1, 1]. */
+[[nodiscard]] VNE_INTERACTION_API float portableAsin(float x) noexcept;
+
+/** Arc cosine in [0, pi]; NaN outside [-1, 1]. */
+[[nodiscard]] VNE_INTERACTION_API float portableAcos(float x) noexcept;
+
+}  // namespace vne::interaction::detail
@@ -0,0 +1,342 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "state_codec.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace vne::interaction::detail {
+
+namespace {
+
+constexpr std::uint8_t kStateMagic[4] = {'V', 'N', 'C', 'S'};
+constexpr std::size_t kStateHeaderBytes = 7;
+constexpr std::uint64_t kMaxStateRules = 4096;  //!< Sanity cap for a rule table
+constexpr int kMaxVarintBytes = 10;
+
+[[nodiscard]] bool fitsInt(std::int64_t v) noexcept {
+    return v >= std::numeric_limits<int>::min() && v <= std::numeric_limits<int>::max();
+}
+
+}  // namespace
+
+// ---------------------------------------------------------------------------
+// StateWriter
+// ---------------------------------------------------------------------------
+
+StateWriter::StateWriter(StateBlobKind kind) {
+    out_.reserve(128);
+    out_.insert(out_.end(), std::begin(kStateMagic), std::end(kStateMagic));
+    out_.push_back(static_cast<std::uint8_t>(kStateBlobVersion & 0xFFu));
+    out_.push_back(static_cast<std::uint8_t>(kStateBlobVersion >> 8));
+    out_.push_back(static_cast<std::uint8_t>(kind));
+}
+
+void StateWriter::u8(std::uint8_t v) {
+    out_.push_back(v);
+}
+
+void StateWriter::flags(std::initializer_list<bool> bits) {
+    std::uint8_t packed = 0;
+    int bit = 0;
+    for (const bool b : bits) {
+        if (b) {
+            packed = static_cast<std::uint8_t>(packed | (1u << bit));
+        }
+        ++bit;
+    }
+    out_.push_back(packed);
+}
+
+void StateWriter::varint(std::uint64_t v) {
+    while (v >= 0x80u) {
+        out_.push_back(static_cast<std::uint8_t>(v | 0x80u));
+        v >>= 7;
+    }
+    out_.push_back(static_cast<std::uint8_t>(v));
+}
+
+void StateWriter::zigzag(std::int64_t v) {
+    varint((static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63));
+}
+
+void StateWriter::f32(float v) {
+    std::uint32_t bits = 0;
+    std::memcpy(&bits, &v, sizeof(bits));
+    for (int i = 0; i < 4; ++i) {
+        out_.push_back(static_cast<std::uint8_t>(bits >> (8 * i)));
+    }
+}
+
+void StateWriter::vec3(const vne::math::Vec3f& v) {
+    f32(v.x());
+    f32(v.y());
+    f32(v.z());
+}
+
+void StateWriter::quat(const vne::math::Quatf& q) {
+    f32(q.x);
+    f32(q.y);
+    f32(q.z);
+    f32(q.w);
+}
+
+void StateWriter::pose(const CameraPoseSnapshot& pose) {
+    vec3(pose.position);
+    quat(pose.orientation);
+    vec3(pose.target);
+    f32(pose.fov_deg);
+    f32(pose.ortho_width);
+    f32(pose.ortho_height);
+}
+
+void StateWriter::mouseBinding(const MouseBinding& binding) {
+    zigzag(static_cast<std::int64_t>(binding.button));
+    modifier(binding.modifier_mask);
+}
+
+void StateWriter::keyBinding(const KeyBinding& binding) {
+    keyCode(binding.key);
+    modifier(binding.modifier_mask);
+}
+
+void StateWriter::keyCode(vne::events::KeyCode key) {
+    zigzag(static_cast<std::int64_t>(key));
+}
+
+void StateWriter::modifier(vne::events::ModifierKey mod) {
+    zigzag(static_cast<std::int64_t>(mod));
+}
+
+void StateWriter::rules(const std::vector<InputRule>& rules) {
+    varint(rules.size());
+    for (const InputRule& r : rules) {
+        enumU8(r.trigger);
+        zigzag(r.code);
+        zigzag(r.modifier_mask);
+        enumU8(r.on_press);
+        enumU8(r.on_release);
+        enumU8(r.on_delta);
+    }
+}
+
+void StateWriter::blob(const std::vector<std::uint8_t>& bytes) {
+    varint(bytes.size());
+    out_.insert(out_.end(), bytes.begin(), bytes.end());
+}
+
+// ---------------------------------------------------------------------------
+// StateReader
+// ---------------------------------------------------------------------------
+
+StateReader::StateReader(const std::uint8_t* data, std::size_t size, StateBlobKind kind) noexcept
+    : p_(data)
+    , end_(data + (data ? size : 0)) {
+    const std::uint8_t* header = nullptr;
+    if (!take(header, kStateHeaderBytes) || std::memcmp(header, kStateMagic, sizeof(kStateMagic)) != 0) {
+        fail();
+        return;
+    }
+    version_ = static_cast<std::uint16_t>(header[4] | (header[5] << 8));
+    if (version_ == 0 || version_ > kStateBlobVersion || header[6] != static_cast<std::uint8_t>(kind)) {
+        fail();
+    }
+}
+
+bool StateReader::take(const std::uint8_t*& bytes, std::size_t n) noexcept {
+    if (!ok_ || static_cast<std::size_t>(end_ - p_) < n) {
+        return fail();
+    }
+    bytes = p_;
+    p_ += n;
+    return true;
+}
+
+bool StateReader::u8(std::uint8_t& v) noexcept {
+    const std::uint8_t* b = nullptr;
+    if (!take(b, 1)) {
+        return false;
+    }
+    v = b[0];
+    return true;
+}
+
+bool StateReader::flags(std::initializer_list<bool*> bits) noexcept {
+    std::uint8_t packed = 0;
+    if (!u8(packed)) {
+        return false;
+    }
+    int bit = 0;
+    for (bool* b : bits) {
+        *b = (packed >> bit) & 1u;
+        ++bit;
+    }
+    return true;
+}
+
+bool StateReader::varint(std::uint64_t& v) noexcept {
+    v = 0;
+    for (int i = 0; i < kMaxVarintBytes; ++i) {
+        std::uint8_t byte = 0;
+        if (!u8(byte)) {
+            return false;
+        }
+        v |= static_cast<std::uint64_t>(byte & 0x7Fu) << (7 * i);
+        if ((byte & 0x80u) == 0) {
+            return true;
+        }
+    }
+    return fail();
+}
+
+bool StateReader::zigzag(std::int64_t& v) noexcept {
+    std::uint64_t raw = 0;
+    if (!varint(raw)) {
+        return false;
+    }
+    v = static_cast<std::int64_t>(raw >> 1) ^ -static_cast<std::int64_t>(raw & 1u);
+    return true;
+}
+
+bool StateReader::f32(float& v) noexcept {
+    const std::uint8_t* b = nullptr;
+    if (!take(b, 4)) {
+        return false;
+    }
+    const std::uint32_t bits = static_cast<std::uint32_t>(b[0]) | (static_cast<std::uint32_t>(b[1]) << 8)
+                               | (static_cast<std::uint32_t>(b[2]) << 16) | (static_cast<std::uint32_t>(b[3]) << 24);
+    float f = 0.0f;
+    std::memcpy(&f, &bits, sizeof(f));
+    if (!std::isfinite(f)) {
+        return fail();
+    }
+    v = f;
+    return true;
+}
+
+bool StateReader::vec3(vne::math::Vec3f& v) noexcept {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+    if (!f32(x) || !f32(y) || !f32(z)) {
+        return false;
+    }
+    v = vne::math::Vec3f(x, y, z);
+    return true;
+}
+
+bool StateReader::quat(vne::math::Quatf& q) noexcept {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+    float w = 0.0f;
+    if (!f32(x) || !f32(y) || !f32(z) || !f32(w)) {
+        return false;
+    }
+    q = vne::math::Quatf(x, y, z, w);
+    return true;
+}
+
+bool StateReader::pose(CameraPoseSnapshot& pose) noexcept {
+    return vec3(pose.position) && quat(pose.orientation) && vec3(pose.target) && f32(pose.fov_deg)
+           && f32(pose.ortho_width) && f32(pose.ortho_height);
+}
+
+bool StateReader::mouseBinding(MouseBinding& binding) noexcept {
+    std::int64_t button = 0;
+    if (!zigzag(button) || !fitsInt(button)) {
+        return fail();
+    }
+    binding.button = static_cast<MouseButton>(button);
+    return modifier(binding.modifier_mask);
+}
+
+bool StateReader::keyBinding(KeyBinding& binding) noexcept {
+    return keyCode(binding.key) && modifier(binding.modifier_mask);
+}
+
+bool StateReader::keyCode(vne::events::KeyCode& key) noexcept {
+    std::int64_t code = 0;
+    if (!zigzag(code) || !fitsInt(code)) {
+        return fail();
+    }
+    key = static_cast<vne::events::KeyCode>(code);
+    return true;
+}
+
+bool StateReader::modifier(vne::events::ModifierKey& mod) noexcept {
+    std::int64_t mask = 0;
+    if (!zigzag(mask) || !fitsInt(mask)) {
+        return fail();
+    }
+    mod = static_cast<vne::events::ModifierKey>(mask);
+    return true;
+}
+
+bool StateReader::rules(std::vector<InputRule>& rules) noexcept {
+    std::uint64_t count = 0;
+    if (!varint(count) || count > kMaxStateRules) {
+        return fail();
+    }
+    rules.clear();
+    rules.reserve(static_cast<std::size_t>(count));
+    for (std::uint64_t i = 0; i < count; ++i) {
+        InputRule r;
+        std::int64_t code = 0;
+        std::int64_t mask = 0;
+        std::uint8_t press = 0;
+        std::uint8_t release = 0;
+        std::uint8_t delta = 0;
+        if (!enumU8(r.trigger, InputRule::Trigger::eMouseDblClick) || !zigzag(code) || !zigzag(mask)
+            || !u8(press) || !u8(release) || !u8(delta) || !fitsInt(code) || !fitsInt(mask)) {
+            return fail();
+        }
+        r.code = static_cast<int>(code);
+        r.modifier_mask = static_cast<int>(mask);
+        r.on_press = static_cast<CameraActionType>(press);
+        r.on_release = static_cast<CameraActionType>(release);
+        r.on_delta = static_cast<CameraActionType>(delta);
+        rules.push_back(r);
+    }
+    return true;
+}
+
+bool StateReader::blob(const std::uint8_t*& data, std::size_t& size) noexcept {
+    std::uint64_t n = 0;
+    if (!varint(n) || n > static_cast<std::uint64_t>(end_ - p_)) {
+        return fail();
+    }
+    size = static_cast<std::size_t>(n);
+    return take(data, size);
+}
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+
+bool sameInputRules(const std::vector<InputRule>& a, const std::vector<InputRule>& b) noexcept {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        const InputRule& x = a[i];
+        const InputRule& y = b[i];
+        if (x.trigger != y.trigger || x.code != y.code || x.modifier_mask != y.modifier_mask
+            || x.on_press != y.on_press || x.on_release != y.on_release || x.on_delta != y.on_delta) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace vne::interaction::detail
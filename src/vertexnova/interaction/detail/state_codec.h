@@ -0,0 +1,146 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file state_codec.h
+ * @brief Binary layout of controller / manipulator state blobs (@c serialize / @c deserialize).
+ *
+ * @par Layout
+ * A blob is a header followed by the fields of one object:
+ *  - header: magic @c "VNCS", u16 format version, u8 @ref StateBlobKind;
+ *  - fields in a fixed per-kind order: u8 enums and flag bytes, f32 scalars and vectors, zigzag varints
+ *    for key / button / modifier codes, and varint-length-prefixed nested blobs (a controller embeds the
+ *    blob of its manipulator).
+ *
+ * Multi-byte scalars are little-endian regardless of the host. Fields added later are appended after
+ * the existing ones, and readers ignore bytes past the fields they know; @ref kStateBlobVersion changes
+ * only when an existing field changes meaning, and readers reject blobs newer than their own version.
+ *
+ * Internal header — not installed.
+ */
+
+#include "vertexnova/interaction/interaction_types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+namespace vne::interaction::detail {
+
+inline constexpr std::uint16_t kStateBlobVersion = 1;
+
+/** Object a blob describes; values are part of the format. */
+enum class StateBlobKind : std::uint8_t {
+    eTrackballManipulator = 1,
+    eFreeLookManipulator = 2,
+    eOrtho2DManipulator = 3,
+    eInspect3DController = 16,
+    eNavigation3DController = 17,
+    eOrtho2DController = 18,
+};
+
+/** Appends fields to a blob whose header is written by the constructor. */
+class StateWriter {
+   public:
+    explicit StateWriter(StateBlobKind kind);
+
+    void u8(std::uint8_t v);
+    /** Up to eight flags packed into one byte, bit 0 first. */
+    void flags(std::initializer_list<bool> bits);
+    void zigzag(std::int64_t v);
+    void f32(float v);
+    void vec3(const vne::math::Vec3f& v);
+    void quat(const vne::math::Quatf& q);
+    void pose(const CameraPoseSnapshot& pose);
+    void mouseBinding(const MouseBinding& binding);
+    void keyBinding(const KeyBinding& binding);
+    void keyCode(vne::events::KeyCode key);
+    void modifier(vne::events::ModifierKey mod);
+    void rules(const std::vector<InputRule>& rules);
+    /** Nested blob, varint length first. */
+    void blob(const std::vector<std::uint8_t>& bytes);
+
+    template<typename E>
+    void enumU8(E v) {
+        u8(static_cast<std::uint8_t>(v));
+    }
+
+    [[nodiscard]] std::vector<std::uint8_t> take() noexcept { return std::move(out_); }
+
+   private:
+    void varint(std::uint64_t v);
+
+    std::vector<std::uint8_t> out_;
+};
+
+/**
+ * @brief Bounds-checked field reader.
+ *
+ * The constructor validates the header. The first failed read (short input, non-finite float, enum
+ * out of range) latches @ref ok to false and every later read fails, so callers decode all fields and
+ * test @ref ok once.
+ */
+class StateReader {
+   public:
+    StateReader(const std::uint8_t* data, std::size_t size, StateBlobKind kind) noexcept;
+
+    [[nodiscard]] bool ok() const noexcept { return ok_; }
+    [[nodiscard]] std::uint16_t version() const noexcept { return version_; }
+
+    bool u8(std::uint8_t& v) noexcept;
+    /** Unpack a @ref StateWriter::flags byte; bits beyond @p bits.size() are ignored. */
+    bool flags(std::initializer_list<bool*> bits) noexcept;
+    bool zigzag(std::int64_t& v) noexcept;
+    /** Fails on NaN / infinity. */
+    bool f32(float& v) noexcept;
+    bool vec3(vne::math::Vec3f& v) noexcept;
+    bool quat(vne::math::Quatf& q) noexcept;
+    bool pose(CameraPoseSnapshot& pose) noexcept;
+    bool mouseBinding(MouseBinding& binding) noexcept;
+    bool keyBinding(KeyBinding& binding) noexcept;
+    bool keyCode(vne::events::KeyCode& key) noexcept;
+    bool modifier(vne::events::ModifierKey& mod) noexcept;
+    bool rules(std::vector<InputRule>& rules) noexcept;
+    /** Nested blob; @p data points into the input. */
+    bool blob(const std::uint8_t*& data, std::size_t& size) noexcept;
+
+    /** Read a u8 enum, failing if it exceeds @p max. */
+    template<typename E>
+    bool enumU8(E& v, E max) noexcept {
+        std::uint8_t raw = 0;
+        if (!u8(raw) || raw > static_cast<std::uint8_t>(max)) {
+            return fail();
+        }
+        v = static_cast<E>(raw);
+        return true;
+    }
+
+   private:
+    bool take(const std::uint8_t*& bytes, std::size_t n) noexcept;
+    bool varint(std::uint64_t& v) noexcept;
+    bool fail() noexcept {
+        ok_ = false;
+        return false;
+    }
+
+    const std::uint8_t* p_ = nullptr;
+    const std::uint8_t* end_ = nullptr;
+    std::uint16_t version_ = 0;
+    bool ok_ = true;
+};
+
+/** true when both rule tables hold the same rules in the same order. */
+[[nodiscard]] bool sameInputRules(const std::vector<InputRule>& a, const std::vector<InputRule>& b) noexcept;
+
+}  // namespace vne::interaction::detail
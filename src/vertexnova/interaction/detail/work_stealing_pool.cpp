@@ -0,0 +1,107 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "work_stealing_pool.h"
+
+#include <algorithm>
+
+namespace vne::interaction::detail {
+
+WorkStealingPool::WorkStealingPool(std::size_t worker_threads)
+    : slices_(std::make_unique<Slice[]>(worker_threads + 1)) {
+    workers_.reserve(worker_threads);
+    for (std::size_t lane = 0; lane < worker_threads; ++lane) {
+        workers_.emplace_back([this, lane] { run(lane); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& t : workers_) {
+        t.join();
+    }
+}
+
+void WorkStealingPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& task) noexcept {
+    if (count == 0) {
+        return;
+    }
+    const std::size_t lanes = workers_.size() + 1;
+    if (lanes == 1 || count == 1) {
+        for (std::size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        // A worker that woke late for the previous job may still be scanning its (empty) slices.
+        done_.wait(lock, [this] { return draining_ == 0; });
+        const std::size_t per_lane = (count + lanes - 1) / lanes;
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            slices_[lane].next.store(std::min(lane * per_lane, count), std::memory_order_relaxed);
+            slices_[lane].end = std::min((lane + 1) * per_lane, count);
+        }
+        remaining_.store(count, std::memory_order_relaxed);
+        task_ = &task;
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    drain(lanes - 1, task);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return remaining_.load(std::memory_order_acquire) == 0; });
+}
+
+void WorkStealingPool::run(std::size_t lane) noexcept {
+    std::uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait(lock, [this, seen] { return stopping_ || generation_ != seen; });
+        if (stopping_) {
+            return;
+        }
+        seen = generation_;
+        const std::function<void(std::size_t)>* task = task_;
+        ++draining_;
+        lock.unlock();
+        drain(lane, *task);
+        lock.lock();
+        if (--draining_ == 0) {
+            done_.notify_all();
+        }
+    }
+}
+
+void WorkStealingPool::drain(std::size_t lane, const std::function<void(std::size_t)>& task) noexcept {
+    const std::size_t lanes = workers_.size() + 1;
+    for (std::size_t k = 0; k < lanes; ++k) {
+        Slice& slice = slices_[(lane + k) % lanes];
+        for (;;) {
+            const std::size_t i = slice.next.fetch_add(1, std::memory_order_relaxed);
+            if (i >= slice.end) {
+                break;
+            }
+            task(i);
+            if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                done_.notify_all();
+            }
+        }
+    }
+}
+
+}  // namespace vne::interaction::detail
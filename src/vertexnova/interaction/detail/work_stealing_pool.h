@@ -0,0 +1,77 @@
+#pragma once
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * @file work_stealing_pool.h
+ * @brief WorkStealingPool — fixed set of threads running blocking parallel-for jobs.
+ *
+ * @ref WorkStealingPool::parallelFor splits the index range into one contiguous slice per thread (the
+ * calling thread included). Each thread claims indices from its own slice with an atomic counter and,
+ * once that is empty, claims from the other slices, so uneven task costs still balance without a shared
+ * queue or per-task allocation. Used by ControllerGroup and HeadlessDriver.
+ *
+ * Internal header — not installed.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vne::interaction::detail {
+
+class WorkStealingPool {
+   public:
+    /** Start @p worker_threads threads; with 0, @ref parallelFor runs everything on the caller. */
+    explicit WorkStealingPool(std::size_t worker_threads);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    [[nodiscard]] std::size_t workerThreads() const noexcept { return workers_.size(); }
+
+    /**
+     * @brief Call @p task(i) once for every i in [0, @p count) and return when all calls have finished.
+     *
+     * The caller works too. Not re-entrant: @p task must not call @ref parallelFor on the same pool.
+     */
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)>& task) noexcept;
+
+   private:
+    /** Index slice; padded to a cache line so owners and thieves of different slices do not false-share. */
+    struct alignas(64) Slice {
+        std::atomic<std::size_t> next{0};
+        std::size_t end = 0;
+    };
+
+    void run(std::size_t lane) noexcept;
+    void drain(std::size_t lane, const std::function<void(std::size_t)>& task) noexcept;
+
+    std::vector<std::thread> workers_;
+    std::unique_ptr<Slice[]> slices_;  //!< workers_.size() + 1; the last one belongs to the caller
+    std::mutex mutex_;
+    std::condition_variable wake_;  //!< Workers: a new job or stop
+    std::condition_variable done_;  //!< Caller: all tasks finished / no worker still draining
+    const std::function<void(std::size_t)>* task_ = nullptr;
+    std::uint64_t generation_ = 0;  //!< Bumped per job
+    std::size_t draining_ = 0;      //!< Workers between picking up a job and finishing their drain
+    std::atomic<std::size_t> remaining_{0};
+    bool stopping_ = false;
+};
+
+}  // namespace vne::interaction::detail
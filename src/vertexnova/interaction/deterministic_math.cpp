@@ -0,0 +1,39 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/deterministic_math.h"
+
+#include <atomic>
+
+namespace vne::interaction {
+
+namespace {
+#ifdef VNE_INTERACTION_DETERMINISTIC
+constexpr bool kDeterministicDefault = true;
+#else
+constexpr bool kDeterministicDefault = false;
+#endif
+
+std::atomic<bool>& deterministicFlag() noexcept {
+    static std::atomic<bool> flag{kDeterministicDefault};
+    return flag;
+}
+}  // namespace
+
+void setDeterministicMath(bool enabled) noexcept {
+    deterministicFlag().store(enabled, std::memory_order_relaxed);
+}
+
+bool isDeterministicMath() noexcept {
+    return deterministicFlag().load(std::memory_order_relaxed);
+}
+
+}  // namespace vne::interaction
@@ -10,6 +10,7 @@
  */
 
 #include "vertexnova/interaction/free_look_manipulator.h"
+#include "detail/state_codec.h"
 #include "detail/trackball_behavior.h"
 #include "interaction_utils.h"
 
@@ -42,6 +43,11 @@ constexpr float kFreeLookTrackballScale = 2.5f;
 /** Largest @c float strictly below 1.0 (IEEE-754; same bits as @c std::nextafter(1.0f, 0.0f)) for stable @c asin while
  * honoring the ±89° pitch guard in @ref FreeLookManipulator::clampFpsPitch. */
 constexpr float kPitchAsinSinAbsMax = 0x1.fffffep-1f;
+constexpr float kMaxLatencyLeadS = 0.1f;
+constexpr float kMaxLatencyLeadAngleDeg = 45.0f;
+constexpr float kLatencyLeadSettleRate = 30.0f;   // released lead decays as e^(-rate·t): ~0.1 s to settle
+constexpr float kLatencyLeadSettleAngle = 1e-4f;  // released lead below this (rad) is dropped
+constexpr float kLookVelocityBlendRate = 25.0f;  // EMA rate (1/s) for look angular velocity, as trackball pan
 
 [[nodiscard]] vne::math::Vec3f normalizedWorldUp(const vne::math::Vec3f& w) noexcept {
     const float l = w.length();
@@ -184,6 +190,7 @@ void FreeLookManipulator::syncOrientationFromCamera() noexcept {
     if (!camera_) {
         return;
     }
+    clearLatencyLead();  // the camera pose is authoritative again; any display lead in it is adopted
     orientation_ = camera_->getOrientation().normalized();
 }
 
@@ -200,7 +207,7 @@ void FreeLookManipulator::applyOrientationToCamera() noexcept {
         return;
     }
     camera_->setOrientationView(camera_->getPosition(), orientation_.normalized());
-    camera_->updateMatrices();
+    updateCameraMatrices(*camera_);
 }
 
 void FreeLookManipulator::yawPitchFromOrientation(float& yaw_deg_out, float& pitch_deg_out) const noexcept {
@@ -220,7 +227,7 @@ void FreeLookManipulator::yawPitchFromOrientation(float& yaw_deg_out, float& pit
     }
 
     const float up_comp = vne::math::clamp(f.dot(up_ref), -1.0f, 1.0f);
-    pitch_deg_out = vne::math::radToDeg(vne::math::asin(up_comp));
+    pitch_deg_out = vne::math::radToDeg(interactionAsin(up_comp));
 
     const vne::math::Vec3f horiz = f - up_ref * up_comp;
     const float horiz_len = horiz.length();
@@ -232,29 +239,104 @@ void FreeLookManipulator::yawPitchFromOrientation(float& yaw_deg_out, float& pit
     vne::math::Vec3f ref_fwd;
     vne::math::Vec3f ref_right;
     buildReferenceFrame(up_ref, ref_fwd, ref_right);
-    yaw_deg_out = vne::math::radToDeg(vne::math::atan2(horiz_n.dot(ref_right), horiz_n.dot(ref_fwd)));
+    yaw_deg_out = vne::math::radToDeg(interactionAtan2(horiz_n.dot(ref_right), horiz_n.dot(ref_fwd)));
 }
 
 void FreeLookManipulator::clampFpsPitch() noexcept {
+    clampFpsPitch(orientation_);
+}
+
+void FreeLookManipulator::clampFpsPitch(vne::math::Quatf& q) const noexcept {
     if (mode_ != FreeLookMode::eFps) {
         return;
     }
     const vne::math::Vec3f wu = normalizedWorldUp(world_up_);
-    vne::math::Vec3f f = (-orientation_.getZAxis()).normalized();
+    vne::math::Vec3f f = (-q.getZAxis()).normalized();
     float s = vne::math::clamp(f.dot(wu), -kPitchAsinSinAbsMax, kPitchAsinSinAbsMax);
-    float pitch_rad = std::asin(s);
+    float pitch_rad = interactionAsin(s);
     const float lim = vne::math::degToRad(kPitchMaxDeg);
     if (pitch_rad <= lim && pitch_rad >= -lim) {
         return;
     }
     const float target = vne::math::clamp(pitch_rad, -lim, lim);
     const float excess = pitch_rad - target;
-    const vne::math::Vec3f right_axis = orientation_.getXAxis();
+    const vne::math::Vec3f right_axis = q.getXAxis();
     const float rl = right_axis.length();
     if (rl < kEpsilon) {
         return;
     }
-    orientation_ = (vne::math::Quatf::fromAxisAngle(right_axis / rl, -excess) * orientation_).normalized();
+    q = normalizeQuat(quatFromAxisAngle(right_axis / rl, -excess) * q);
+}
+
+// ---------------------------------------------------------------------------
+// Latency compensation
+// ---------------------------------------------------------------------------
+
+void FreeLookManipulator::setLatencyCompensation(float lead_time_s) noexcept {
+    latency_lead_s_ = std::isfinite(lead_time_s) ? vne::math::clamp(lead_time_s, 0.0f, kMaxLatencyLeadS) : 0.0f;
+    if (latency_lead_s_ <= 0.0f) {
+        dropLatencyLead();
+    }
+}
+
+void FreeLookManipulator::setLatencyCompensationMaxAngle(float degrees) noexcept {
+    if (std::isfinite(degrees)) {
+        latency_max_angle_deg_ = vne::math::clamp(degrees, 0.0f, kMaxLatencyLeadAngleDeg);
+    }
+}
+
+void FreeLookManipulator::applyLookWithLatencyLead(double delta_time) noexcept {
+    // Tracked without a lead too: it is the look rate reported by getMotionState
+    updateAngularVelocity(latency_rot_velocity_, latency_prev_rot_, orientation_, delta_time, kLookVelocityBlendRate);
+    latency_prev_rot_ = orientation_;
+    if (latency_lead_s_ <= 0.0f || !camera_) {
+        applyOrientationToCamera();
+        return;
+    }
+
+    const float max_angle = vne::math::degToRad(latency_max_angle_deg_);
+    vne::math::Vec3f lead = latency_rot_velocity_ * latency_lead_s_;
+    const float angle = lead.length();
+    if (angle > max_angle && angle > kEpsilon) {
+        lead *= max_angle / angle;
+    }
+    latency_rot_lead_ = lead;
+    latency_lead_active_ = true;
+    latency_lead_releasing_ = false;
+    showLatencyLead();
+}
+
+void FreeLookManipulator::showLatencyLead() noexcept {
+    vne::math::Quatf shown = normalizeQuat(quatFromRotationVector(latency_rot_lead_) * orientation_);
+    clampFpsPitch(shown);
+    camera_->setOrientationView(camera_->getPosition(), shown);
+    updateCameraMatrices(*camera_);
+}
+
+void FreeLookManipulator::settleLatencyLead(double delta_time) noexcept {
+    if (!latency_lead_releasing_ || !std::isfinite(delta_time) || delta_time <= 0.0) {
+        return;
+    }
+    latency_rot_lead_ *= interactionExp(-kLatencyLeadSettleRate * static_cast<float>(delta_time));
+    if (latency_rot_lead_.length() < kLatencyLeadSettleAngle) {
+        dropLatencyLead();
+        return;
+    }
+    showLatencyLead();
+}
+
+void FreeLookManipulator::clearLatencyLead() noexcept {
+    latency_lead_active_ = false;
+    latency_lead_releasing_ = false;
+    latency_rot_lead_ = vne::math::Vec3f(0.0f, 0.0f, 0.0f);
+}
+
+void FreeLookManipulator::dropLatencyLead() noexcept {
+    if (!latency_lead_active_) {
+        return;
+    }
+    clearLatencyLead();
+    applyOrientationToCamera();
 }
 
 float FreeLookManipulator::getYawDegrees() const noexcept {
@@ -299,10 +381,10 @@ void FreeLookManipulator::applyDolly(float factor, float mx, float my) noexcept
     ensureAnglesSynced();
     const vne::math::Vec3f f = camera_->getForwardDir();
     const float current_dist = (camera_->getTarget() - camera_->getPosition()).length();
-    const float effective_factor = std::pow(factor, zoom_speed_);
+    const float effective_factor = interactionPow(factor, zoom_speed_);
     const float step = (1.0f - effective_factor) * std::max(current_dist, kEpsilon);
     camera_->setPosition(camera_->getPosition() + f * step);
-    camera_->updateMatrices();
+    updateCameraMatrices(*camera_);
 }
 
 void FreeLookManipulator::setWorldUp(const vne::math::Vec3f& up) noexcept {
@@ -326,9 +408,9 @@ void FreeLookManipulator::setYawPitchDegrees(float yaw_deg, float pitch_deg) noe
 
     const float yaw_rad = vne::math::degToRad(yaw_deg);
     const float pitch_rad = vne::math::degToRad(pitch_use);
-    const float cp = vne::math::cos(pitch_rad);
-    vne::math::Vec3f f = (ref_fwd * vne::math::cos(yaw_rad) + ref_right * vne::math::sin(yaw_rad)) * cp
-                         + up_b * vne::math::sin(pitch_rad);
+    const float cp = interactionCos(pitch_rad);
+    vne::math::Vec3f f = (ref_fwd * interactionCos(yaw_rad) + ref_right * interactionSin(yaw_rad)) * cp
+                         + up_b * interactionSin(pitch_rad);
     const float fl = f.length();
     f = (fl < kEpsilon) ? ref_fwd : (f / fl);
 
@@ -352,7 +434,7 @@ void FreeLookManipulator::setYawPitchDegrees(float yaw_deg, float pitch_deg) noe
     }
 
     camera_->lookAt(pos, pos + f, up_apply);
-    camera_->updateMatrices();
+    updateCameraMatrices(*camera_);
     syncOrientationFromCamera();
     orientation_dirty_ = false;
 }
@@ -360,7 +442,7 @@ void FreeLookManipulator::setYawPitchDegrees(float yaw_deg, float pitch_deg) noe
 float FreeLookManipulator::getWorldUnitsPerPixel() const noexcept {
     if (auto persp = perspCamera()) {
         const float fov_y_rad = vne::math::degToRad(persp->getFieldOfView());
-        return kPerspWorldUnitsScale * vne::math::tan(fov_y_rad * kHalf) / viewport().height;
+        return kPerspWorldUnitsScale * interactionTan(fov_y_rad * kHalf) / viewport().height;
     }
     return 1.0f;
 }
@@ -379,34 +461,119 @@ void FreeLookManipulator::fitToAABB(const vne::math::Vec3f& min_world, const vne
     vne::math::Vec3f eye;
     if (auto persp = perspCamera()) {
         const float fov_y_rad = vne::math::degToRad(persp->getFieldOfView());
-        const float dist = (radius / vne::math::tan(fov_y_rad * kHalf)) * kFitToAabbMargin;
+        const float dist = (radius / interactionTan(fov_y_rad * kHalf)) * kFitToAabbMargin;
         eye = center - f * dist;
     } else {
         eye = center - f * (radius * kFitToAabbDistFactor);
     }
     const vne::math::Vec3f up = (mode_ == FreeLookMode::eFps) ? world_up_ : upVector();
     camera_->lookAt(eye, center, up);
-    camera_->updateMatrices();
+    updateCameraMatrices(*camera_);
     syncOrientationFromCamera();
     orientation_dirty_ = false;
 }
 
-void FreeLookManipulator::resetState() noexcept {
-    input_state_ = FreeLookInputState{};
-    trackball_->reset();
-    syncOrientationFromCamera();
-    orientation_dirty_ = false;
+void FreeLookManipulator::fitToPoints(std::span<const vne::math::Vec3f> points,
+                                      FitBoundsMode mode,
+                                      const ControllerExecutor& executor) noexcept {
+    fitToSet(points, mode, executor);
 }
 
-void FreeLookManipulator::onUpdate(double delta_time) noexcept {
-    if (!enabled_ || !camera_) {
+void FreeLookManipulator::fitToBoxes(std::span<const BoundingBox> boxes,
+                                     FitBoundsMode mode,
+                                     const ControllerExecutor& executor) noexcept {
+    fitToSet(boxes, mode, executor);
+}
+
+template <typename T>
+void FreeLookManipulator::fitToSet(std::span<const T> items,
+                                   FitBoundsMode mode,
+                                   const ControllerExecutor& executor) noexcept {
+    if (!camera_) {
         return;
     }
     ensureAnglesSynced();
-    const auto dt = static_cast<float>(delta_time);
-    if (dt <= 0.0f) {
+    vne::math::Vec3f r;
+    vne::math::Vec3f u;
+    vne::math::Vec3f f;
+    cameraViewAxes(*camera_, r, u, f);
+    if (auto persp = perspCamera(); persp && mode == FitBoundsMode::eFrustum) {
+        const float fov_y_rad = vne::math::degToRad(persp->getFieldOfView());
+        const float tan_half_y = interactionTan(fov_y_rad * kHalf) / kFitToAabbMargin;
+        const float height = std::max(viewport().height, CameraManipulatorBase::kMinOrthoExtent);
+        const float aspect = std::max(viewport().width / height, CameraManipulatorBase::kMinOrthoExtent);
+        FrustumFit fit;
+        if (!computeFrustumFit(items, r, u, f, tan_half_y * aspect, tan_half_y, fit, executor)) {
+            VNE_LOG_WARN << "FreeLookManipulator: fit called without finite input";
+            return;
+        }
+        if (fit.distance >= kEpsilon) {
+            lookFrom(fit.eye, fit.center);
+            return;
+        }
+        FitVolume point;  // everything at one point: the usual fallback radius
+        point.center = fit.center;
+        fitToVolume(point);
+        return;
+    }
+    FitVolume volume;
+    if (!computeFitVolume(items, r, u, f, mode, volume, executor)) {
+        VNE_LOG_WARN << "FreeLookManipulator: fit called without finite input";
         return;
     }
+    fitToVolume(volume);
+}
+
+void FreeLookManipulator::fitToVolume(const FitVolume& volume) noexcept {
+    float half_right = volume.half_right;
+    float half_up = volume.half_up;
+    if (std::max(half_right, half_up) < kEpsilon) {
+        half_right = kMinRadiusFallback;
+        half_up = kMinRadiusFallback;
+    }
+    const vne::math::Vec3f f = front();
+    vne::math::Vec3f eye;
+    if (auto persp = perspCamera()) {
+        const float fov_y_rad = vne::math::degToRad(persp->getFieldOfView());
+        const float height = std::max(viewport().height, CameraManipulatorBase::kMinOrthoExtent);
+        const float aspect = std::max(viewport().width / height, CameraManipulatorBase::kMinOrthoExtent);
+        const float tan_half_y = interactionTan(fov_y_rad * kHalf);
+        const float dist = std::max(half_up / tan_half_y, half_right / (tan_half_y * aspect));
+        eye = volume.center - f * ((dist + volume.half_depth) * kFitToAabbMargin);
+    } else {
+        eye = volume.center - f * (std::max(half_right, half_up) * kFitToAabbDistFactor + volume.half_depth);
+    }
+    lookFrom(eye, volume.center);
+}
+
+void FreeLookManipulator::lookFrom(const vne::math::Vec3f& eye, const vne::math::Vec3f& center) noexcept {
+    const vne::math::Vec3f up = (mode_ == FreeLookMode::eFps) ? world_up_ : upVector();
+    camera_->lookAt(eye, center, up);
+    updateCameraMatrices(*camera_);
+    syncOrientationFromCamera();
+    orientation_dirty_ = false;
+}
+
+void FreeLookManipulator::resetState() noexcept {
+    dropLatencyLead();
+    input_state_ = FreeLookInputState{};
+    latency_rot_velocity_ = vne::math::Vec3f(0.0f, 0.0f, 0.0f);
+    clearZoomRate();
+    trackball_->reset();
+    syncOrientationFromCamera();
+    orientation_dirty_ = false;
+}
+
+void FreeLookManipulator::onHandoff(const CameraPoseSnapshot& pose) noexcept {
+    clearLatencyLead();
+    input_state_.looking = false;
+    trackball_->reset();
+    orientation_ = pose.orientation.normalized();
+    orientation_at_drag_start_ = orientation_;
+    orientation_dirty_ = false;
+}
+
+vne::math::Vec3f FreeLookManipulator::moveVelocity() const noexcept {
     vne::math::Vec3f forward_axis;
     vne::math::Vec3f right_axis;
     vne::math::Vec3f vertical_axis;
@@ -474,7 +641,7 @@ void FreeLookManipulator::onUpdate(double delta_time) noexcept {
     }
     const float move_len = move.length();
     if (move_len <= kEpsilon) {
-        return;
+        return vne::math::Vec3f(0.0f, 0.0f, 0.0f);
     }
     float speed = move_speed_;
     if (input_state_.sprint) {
@@ -484,21 +651,45 @@ void FreeLookManipulator::onUpdate(double delta_time) noexcept {
     }
     const float scene_s = camera_->getSceneScale();
     const float scene_comp = (scene_s > kEpsilon) ? (1.0f / scene_s) : 1.0f;
-    move = (move / move_len) * (speed * dt * scene_comp);
-    camera_->setPosition(camera_->getPosition() + move);
-    camera_->updateMatrices();
+    return (move / move_len) * (speed * scene_comp);
+}
+
+void FreeLookManipulator::onUpdate(double delta_time) noexcept {
+    if (!enabled_ || !camera_) {
+        return;
+    }
+    ensureAnglesSynced();
+    updateZoomRate(delta_time);
+    if (!input_state_.looking) {
+        settleLatencyLead(delta_time);
+    }
+    const auto dt = static_cast<float>(delta_time);
+    if (dt <= 0.0f) {
+        return;
+    }
+    const vne::math::Vec3f velocity = moveVelocity();
+    if (velocity.lengthSquared() <= 0.0f) {
+        return;
+    }
+    camera_->setPosition(camera_->getPosition() + velocity * dt);
+    updateCameraMatrices(*camera_);
 }
 
 bool FreeLookManipulator::onAction(CameraActionType action,
                                    const CameraCommandPayload& payload,
-                                   double /*delta_time*/) noexcept {
+                                   double delta_time) noexcept {
     if (!enabled_) {
         return false;
     }
     switch (action) {
         case CameraActionType::eBeginLook:
             ensureAnglesSynced();
+            if (latency_lead_releasing_) {
+                syncOrientationFromCamera();  // continue from the displayed pose instead of jumping back
+            }
             input_state_.looking = true;
+            latency_prev_rot_ = orientation_;
+            latency_rot_velocity_ = vne::math::Vec3f(0.0f, 0.0f, 0.0f);
             if (rotation_mode_ == FreeLookRotationMode::eTrackball) {
                 trackball_->setViewport({viewportWidth(), viewportHeight()});
                 trackball_->setGraphicsApi(graphicsApi());
@@ -509,6 +700,7 @@ bool FreeLookManipulator::onAction(CameraActionType action,
 
         case CameraActionType::eEndLook:
             input_state_.looking = false;
+            latency_lead_releasing_ = latency_lead_active_;
             if (rotation_mode_ == FreeLookRotationMode::eTrackball) {
                 trackball_->reset();
             }
@@ -524,26 +716,26 @@ bool FreeLookManipulator::onAction(CameraActionType action,
                     const float pitch_rad = -vne::math::degToRad(payload.delta_y_px * mouse_sensitivity_);
                     const vne::math::Vec3f wu_n = normalizedWorldUp(world_up_);
                     if (mode_ == FreeLookMode::eFps) {
-                        const vne::math::Quatf dq_yaw = vne::math::Quatf::fromAxisAngle(wu_n, yaw_rad);
-                        orientation_ = (dq_yaw * orientation_).normalized();
+                        const vne::math::Quatf dq_yaw = quatFromAxisAngle(wu_n, yaw_rad);
+                        orientation_ = normalizeQuat(dq_yaw * orientation_);
                         const vne::math::Vec3f right_ax = orientation_.getXAxis();
                         const float rl = right_ax.length();
                         if (rl >= kEpsilon) {
-                            const vne::math::Quatf dq_pitch = vne::math::Quatf::fromAxisAngle(right_ax / rl, pitch_rad);
-                            orientation_ = (dq_pitch * orientation_).normalized();
+                            const vne::math::Quatf dq_pitch = quatFromAxisAngle(right_ax / rl, pitch_rad);
+                            orientation_ = normalizeQuat(dq_pitch * orientation_);
                         }
                         clampFpsPitch();
                     } else {
                         const vne::math::Vec3f local_up = orientation_.getYAxis();
                         float ul = local_up.length();
                         const vne::math::Vec3f up_n = (ul >= kEpsilon) ? (local_up / ul) : wu_n;
-                        const vne::math::Quatf dq_yaw = vne::math::Quatf::fromAxisAngle(up_n, yaw_rad);
-                        orientation_ = (dq_yaw * orientation_).normalized();
+                        const vne::math::Quatf dq_yaw = quatFromAxisAngle(up_n, yaw_rad);
+                        orientation_ = normalizeQuat(dq_yaw * orientation_);
                         vne::math::Vec3f right_ax = orientation_.getXAxis();
                         ul = right_ax.length();
                         if (ul >= kEpsilon) {
-                            const vne::math::Quatf dq_pitch = vne::math::Quatf::fromAxisAngle(right_ax / ul, pitch_rad);
-                            orientation_ = (dq_pitch * orientation_).normalized();
+                            const vne::math::Quatf dq_pitch = quatFromAxisAngle(right_ax / ul, pitch_rad);
+                            orientation_ = normalizeQuat(dq_pitch * orientation_);
                         }
                     }
                 } else {
@@ -553,13 +745,13 @@ bool FreeLookManipulator::onAction(CameraActionType action,
                     const float eff_scale = mouse_sensitivity_ * kFreeLookTrackballScale;
                     const vne::math::Quatf delta_raw = trackball_->cumulativeDeltaQuaternion(cursor);
                     const vne::math::Quatf delta_q = scaleTrackballQuaternion(delta_raw, eff_scale);
-                    orientation_ = (orientation_at_drag_start_ * delta_q.conjugate()).normalized();
+                    orientation_ = normalizeQuat(orientation_at_drag_start_ * delta_q.conjugate());
                     trackball_->endFrame(cursor);
                     if (mode_ == FreeLookMode::eFps) {
                         clampFpsPitch();
                     }
                 }
-                applyOrientationToCamera();
+                applyLookWithLatencyLead(delta_time);
                 return true;
             }
             return false;
@@ -615,4 +807,158 @@ bool FreeLookManipulator::onAction(CameraActionType action,
     }
 }
 
+// ---------------------------------------------------------------------------
+// Motion state
+// ---------------------------------------------------------------------------
+
+CameraMotionState FreeLookManipulator::getMotionState() const noexcept {
+    CameraMotionState state;
+    if (!enabled_ || !camera_) {
+        return state;
+    }
+    state.zoom_rate = zoomRate();
+    state.dragging = input_state_.looking;
+    if (input_state_.looking) {
+        state.angular_speed = latency_rot_velocity_.length();
+    }
+    if (latency_lead_releasing_) {
+        // The released lead blending out is a short coast of its own
+        const float lead = latency_rot_lead_.length();
+        state.inertia = true;
+        state.angular_speed = lead * kLatencyLeadSettleRate;
+        state.settle_time_s = decaySettleTime(lead, kLatencyLeadSettleRate, kLatencyLeadSettleAngle);
+    }
+    state.linear_speed = moveVelocity().length();
+    return state;
+}
+
+CameraPoseSnapshot FreeLookManipulator::predictPose(double seconds_ahead) const noexcept {
+    if (!camera_) {
+        return {};
+    }
+    CameraPoseSnapshot pose = captureCameraPose(*camera_);
+    if (!enabled_) {
+        return pose;
+    }
+    if (latency_lead_active_) {
+        // The camera shows the lead; predict from the look itself
+        const float dist = (pose.target - pose.position).length();
+        pose.orientation = orientation_;
+        pose.target = pose.position - orientation_.getZAxis() * dist;
+    }
+    const float ahead = lookaheadSeconds(seconds_ahead);
+    if (ahead <= 0.0f) {
+        return pose;
+    }
+    if (input_state_.looking) {
+        const vne::math::Quatf turn = quatFromRotationVector(latency_rot_velocity_ * ahead);
+        vne::math::Quatf turned = normalizeQuat(turn * pose.orientation);
+        clampFpsPitch(turned);
+        rotateCameraPose(pose, normalizeQuat(turned * pose.orientation.conjugate()), pose.position);
+    }
+    const vne::math::Vec3f move = moveVelocity() * ahead;
+    pose.position += move;
+    pose.target += move;
+    return pose;
+}
+
+// ---------------------------------------------------------------------------
+// State serialization
+// ---------------------------------------------------------------------------
+
+std::vector<std::uint8_t> FreeLookManipulator::serialize() const {
+    detail::StateWriter out(detail::StateBlobKind::eFreeLookManipulator);
+    out.flags({enabled_, handle_zoom_, static_cast<bool>(camera_)});
+    out.enumU8(zoom_method_);
+    out.enumU8(mode_);
+    out.enumU8(rotation_mode_);
+    out.enumU8(trackball_projection_mode_);
+    out.f32(fov_zoom_speed_);
+    out.f32(move_speed_);
+    out.f32(mouse_sensitivity_);
+    out.f32(sprint_mult_);
+    out.f32(slow_mult_);
+    out.f32(zoom_speed_);
+    out.f32(latency_lead_s_);
+    out.f32(latency_max_angle_deg_);
+    out.vec3(world_up_);
+    if (camera_) {
+        out.pose(captureCameraPose(*camera_));
+        out.f32(zoom_scale_);
+    }
+    return out.take();
+}
+
+bool FreeLookManipulator::deserialize(const std::uint8_t* data, std::size_t size) noexcept {
+    detail::StateReader in(data, size, detail::StateBlobKind::eFreeLookManipulator);
+    bool enabled = true;
+    bool handle_zoom = true;
+    bool has_pose = false;
+    ZoomMethod zoom_method = ZoomMethod::eSceneScale;
+    FreeLookMode mode = FreeLookMode::eFps;
+    FreeLookRotationMode rotation_mode = FreeLookRotationMode::eYawPitch;
+    TrackballProjectionMode projection = TrackballProjectionMode::eHyperbolic;
+    float fov_zoom_speed = 0.0f;
+    float move_speed = 0.0f;
+    float mouse_sensitivity = 0.0f;
+    float sprint_mult = 0.0f;
+    float slow_mult = 0.0f;
+    float zoom_speed = 0.0f;
+    float latency_lead = 0.0f;
+    float latency_max_angle = 0.0f;
+    vne::math::Vec3f world_up;
+    CameraPoseSnapshot pose;
+    float scene_scale = 1.0f;
+
+    in.flags({&enabled, &handle_zoom, &has_pose});
+    in.enumU8(zoom_method, ZoomMethod::eDollyToCoi);
+    in.enumU8(mode, FreeLookMode::eFly);
+    in.enumU8(rotation_mode, FreeLookRotationMode::eTrackball);
+    in.enumU8(projection, TrackballProjectionMode::eRim);
+    in.f32(fov_zoom_speed);
+    in.f32(move_speed);
+    in.f32(mouse_sensitivity);
+    in.f32(sprint_mult);
+    in.f32(slow_mult);
+    in.f32(zoom_speed);
+    in.f32(latency_lead);
+    in.f32(latency_max_angle);
+    in.vec3(world_up);
+    if (has_pose) {
+        in.pose(pose);
+        in.f32(scene_scale);
+    }
+    if (!in.ok() || world_up.length() < kEpsilon) {
+        VNE_LOG_WARN << "FreeLookManipulator: deserialize rejected a truncated, corrupt or incompatible state blob";
+        return false;
+    }
+
+    clearLatencyLead();  // so no setter below writes the camera
+    input_state_ = FreeLookInputState{};
+
+    enabled_ = enabled;
+    handle_zoom_ = handle_zoom;
+    zoom_method_ = zoom_method;
+    mode_ = mode;
+    setRotationMode(rotation_mode);
+    setTrackballProjectionMode(projection);
+    setFovZoomSpeed(fov_zoom_speed);
+    setMoveSpeed(move_speed);
+    setMouseSensitivity(mouse_sensitivity);
+    setSprintMultiplier(sprint_mult);
+    setSlowMultiplier(slow_mult);
+    setZoomSpeed(zoom_speed);
+    setLatencyCompensation(latency_lead);
+    setLatencyCompensationMaxAngle(latency_max_angle);
+    world_up_ = world_up.normalized();
+
+    if (has_pose && camera_) {
+        zoom_scale_ = vne::math::clamp(scene_scale, kSceneScaleMin, kSceneScaleMax);
+        camera_->setSceneScale(zoom_scale_);
+        applyCameraPose(*camera_, pose, !defer_matrices_);
+        onHandoff(pose);
+    }
+    return true;
+}
+
 }  // namespace vne::interaction
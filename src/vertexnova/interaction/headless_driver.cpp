@@ -0,0 +1,319 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/headless_driver.h"
+#include "vertexnova/interaction/inspect_3d_controller.h"
+#include "vertexnova/interaction/navigation_3d_controller.h"
+#include "vertexnova/interaction/ortho_2d_controller.h"
+
+#include "detail/work_stealing_pool.h"
+#include "interaction_utils.h"
+
+#include "vertexnova/events/key_event.h"
+#include "vertexnova/events/mouse_event.h"
+
+#include <vertexnova/logging/logging.h>
+#include <vertexnova/scene/camera/camera_factory.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace {
+CREATE_VNE_LOGGER_CATEGORY("vne.interaction.headless_driver");
+}  // namespace
+
+namespace vne::interaction {
+
+// ---------------------------------------------------------------------------
+// CameraScript
+// ---------------------------------------------------------------------------
+
+CameraScript& CameraScript::resize(float width_px, float height_px) {
+    Step s;
+    s.kind = StepKind::eResize;
+    s.v[0] = width_px;
+    s.v[1] = height_px;
+    steps_.push_back(std::move(s));
+    return *this;
+}
+
+CameraScript& CameraScript::drag(vne::events::MouseButton button, float x, float y, float dx, float dy, int frames) {
+    Step s;
+    s.kind = StepKind::eDrag;
+    s.frames = std::max(frames, 0);
+    s.code = static_cast<int>(button);
+    s.v[0] = x;
+    s.v[1] = y;
+    s.v[2] = dx;
+    s.v[3] = dy;
+    steps_.push_back(std::move(s));
+    return *this;
+}
+
+CameraScript& CameraScript::scroll(float x, float y, float amount, int count) {
+    Step s;
+    s.kind = StepKind::eScroll;
+    s.frames = std::max(count, 0);
+    s.v[0] = x;
+    s.v[1] = y;
+    s.v[2] = amount;
+    steps_.push_back(std::move(s));
+    return *this;
+}
+
+CameraScript& CameraScript::keyHold(vne::events::KeyCode key, int frames) {
+    Step s;
+    s.kind = StepKind::eKeyHold;
+    s.frames = std::max(frames, 0);
+    s.code = static_cast<int>(key);
+    steps_.push_back(std::move(s));
+    return *this;
+}
+
+CameraScript& CameraScript::fit(const vne::math::Vec3f& min_world, const vne::math::Vec3f& max_world) {
+    Step s;
+    s.kind = StepKind::eFit;
+    s.v[0] = min_world.x();
+    s.v[1] = min_world.y();
+    s.v[2] = min_world.z();
+    s.v[3] = max_world.x();
+    s.v[4] = max_world.y();
+    s.v[5] = max_world.z();
+    steps_.push_back(std::move(s));
+    return *this;
+}
+
+CameraScript& CameraScript::idle(int frames) {
+    Step s;
+    s.kind = StepKind::eIdle;
+    s.frames = std::max(frames, 0);
+    steps_.push_back(std::move(s));
+    return *this;
+}
+
+CameraScript& CameraScript::call(std::function<void(ICameraController&)> fn) {
+    Step s;
+    s.kind = StepKind::eCall;
+    s.fn = std::move(fn);
+    steps_.push_back(std::move(s));
+    return *this;
+}
+
+std::size_t CameraScript::frameCount() const noexcept {
+    std::size_t frames = 0;
+    for (const Step& s : steps_) {
+        frames += static_cast<std::size_t>(s.frames);
+    }
+    return frames;
+}
+
+// ---------------------------------------------------------------------------
+// HeadlessDriver
+// ---------------------------------------------------------------------------
+
+class HeadlessDriver::Impl {
+    friend class HeadlessDriver;
+
+    double timestep = kDefaultTimestep;
+    std::size_t worker_threads = 0;
+    std::unique_ptr<detail::WorkStealingPool> pool;  //!< Started on the first parallel run
+    ControllerExecutor executor;
+};
+
+namespace {
+
+void fitController(ICameraController& ctrl, const vne::math::Vec3f& mn, const vne::math::Vec3f& mx) noexcept {
+    if (auto* inspect = dynamic_cast<Inspect3DController*>(&ctrl)) {
+        inspect->fitToAABB(mn, mx);
+    } else if (auto* nav = dynamic_cast<Navigation3DController*>(&ctrl)) {
+        nav->fitToAABB(mn, mx);
+    } else if (auto* ortho = dynamic_cast<Ortho2DController*>(&ctrl)) {
+        ortho->fitToAABB(mn, mx);
+    }
+}
+
+/** Stand-in camera for a job without one: orthographic for Ortho2D, else perspective, viewing the origin. */
+std::shared_ptr<vne::scene::ICamera> makeDefaultCamera(const ICameraController& ctrl, float width, float height) {
+    constexpr float kNear = 0.1f;
+    constexpr float kFar = 1000.0f;
+    constexpr float kFovYDeg = 45.0f;
+    const float aspect = (width > 0.0f && height > 0.0f) ? width / height : 1.0f;
+    std::shared_ptr<vne::scene::ICamera> camera;
+    if (dynamic_cast<const Ortho2DController*>(&ctrl)) {
+        camera = vne::scene::CameraFactory::createOrthographic(
+            vne::scene::OrthographicCameraParameters(-aspect, aspect, -1.0f, 1.0f, kNear, kFar));
+    } else {
+        camera = vne::scene::CameraFactory::createPerspective(
+            vne::scene::PerspectiveCameraParameters(kFovYDeg, aspect, kNear, kFar));
+    }
+    camera->setPosition(vne::math::Vec3f(0.0f, 0.0f, 5.0f));
+    camera->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    return camera;
+}
+
+}  // namespace
+
+HeadlessDriver::HeadlessDriver(std::size_t worker_threads)
+    : impl_(std::make_unique<Impl>()) {
+    impl_->worker_threads = worker_threads;
+}
+
+HeadlessDriver::~HeadlessDriver() = default;
+HeadlessDriver::HeadlessDriver(HeadlessDriver&&) noexcept = default;
+HeadlessDriver& HeadlessDriver::operator=(HeadlessDriver&&) noexcept = default;
+
+void HeadlessDriver::setTimestep(double seconds) noexcept {
+    if (!std::isfinite(seconds) || seconds <= 0.0) {
+        VNE_LOG_WARN << "HeadlessDriver::setTimestep: timestep must be finite and positive";
+        return;
+    }
+    impl_->timestep = seconds;
+}
+
+double HeadlessDriver::getTimestep() const noexcept {
+    return impl_->timestep;
+}
+
+void HeadlessDriver::setExecutor(ControllerExecutor executor) {
+    impl_->executor = std::move(executor);
+    if (impl_->executor) {
+        impl_->pool.reset();
+    }
+}
+
+bool HeadlessDriver::run(HeadlessJob& job) const noexcept {
+    job.frames.clear();
+    job.succeeded = false;
+    if (!job.controller) {
+        VNE_LOG_WARN << "HeadlessDriver::run: job needs a controller";
+        return false;
+    }
+    if (!job.camera) {
+        job.camera = makeDefaultCamera(*job.controller, job.viewport_width, job.viewport_height);
+    }
+    CameraTrajectoryWriter writer;
+    if (!job.trajectory_path.empty() && !writer.open(job.trajectory_path, job.trajectory_options)) {
+        return false;
+    }
+    if (job.keep_frames) {
+        job.frames.reserve(job.script.frameCount());
+    }
+
+    const double dt = impl_->timestep;
+    ICameraController& ctrl = *job.controller;
+    const vne::scene::ICamera& camera = *job.camera;
+    ctrl.setCamera(job.camera);
+    ctrl.setMatrixUpdatesDeferred(job.defer_matrices);
+    ctrl.onResize(job.viewport_width, job.viewport_height);
+
+    std::size_t frame = 0;
+    auto tick = [&]() {
+        ctrl.onUpdate(dt);
+        ++frame;
+        const CameraTrajectoryFrame f =
+            CameraTrajectoryFrame::fromPose(static_cast<double>(frame) * dt, captureCameraPose(camera));
+        if (job.keep_frames) {
+            job.frames.push_back(f);
+        }
+        writer.append(f);
+    };
+
+    using Kind = CameraScript::StepKind;
+    for (const CameraScript::Step& s : job.script.steps_) {
+        switch (s.kind) {
+            case Kind::eResize:
+                ctrl.onResize(s.v[0], s.v[1]);
+                break;
+            case Kind::eDrag: {
+                const auto button = static_cast<vne::events::MouseButton>(s.code);
+                double x = s.v[0];
+                double y = s.v[1];
+                ctrl.onEvent(vne::events::MouseMovedEvent(x, y), dt);
+                ctrl.onEvent(vne::events::MouseButtonPressedEvent(button, 0, x, y), dt);
+                const double step_x = s.frames > 0 ? static_cast<double>(s.v[2]) / s.frames : 0.0;
+                const double step_y = s.frames > 0 ? static_cast<double>(s.v[3]) / s.frames : 0.0;
+                for (int i = 0; i < s.frames; ++i) {
+                    x += step_x;
+                    y += step_y;
+                    ctrl.onEvent(vne::events::MouseMovedEvent(x, y), dt);
+                    tick();
+                }
+                ctrl.onEvent(vne::events::MouseButtonReleasedEvent(button, 0, x, y), dt);
+                break;
+            }
+            case Kind::eScroll:
+                ctrl.onEvent(vne::events::MouseMovedEvent(s.v[0], s.v[1]), dt);
+                for (int i = 0; i < s.frames; ++i) {
+                    ctrl.onEvent(vne::events::MouseScrolledEvent(0.0, s.v[2]), dt);
+                    tick();
+                }
+                break;
+            case Kind::eKeyHold: {
+                const auto key = static_cast<vne::events::KeyCode>(s.code);
+                ctrl.onEvent(vne::events::KeyPressedEvent(key), dt);
+                for (int i = 0; i < s.frames; ++i) {
+                    tick();
+                }
+                ctrl.onEvent(vne::events::KeyReleasedEvent(key), dt);
+                break;
+            }
+            case Kind::eFit:
+                fitController(ctrl,
+                              vne::math::Vec3f(s.v[0], s.v[1], s.v[2]),
+                              vne::math::Vec3f(s.v[3], s.v[4], s.v[5]));
+                break;
+            case Kind::eIdle:
+                for (int i = 0; i < s.frames; ++i) {
+                    tick();
+                }
+                break;
+            case Kind::eCall:
+                if (s.fn) {
+                    s.fn(ctrl);
+                }
+                break;
+        }
+    }
+
+    if (job.defer_matrices) {
+        ctrl.setMatrixUpdatesDeferred(false);
+        job.camera->updateMatrices();
+    }
+    writer.close();
+    job.succeeded = !writer.hasWriteError();
+    return job.succeeded;
+}
+
+std::size_t HeadlessDriver::runAll(std::vector<HeadlessJob>& jobs) noexcept {
+    std::atomic<std::size_t> succeeded{0};
+    const std::function<void(std::size_t)> task = [this, &jobs, &succeeded](std::size_t i) {
+        if (run(jobs[i])) {
+            succeeded.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+    const std::size_t count = jobs.size();
+    if (impl_->executor) {
+        impl_->executor(count, task);
+    } else if (count < 2 || impl_->worker_threads == 0) {
+        for (std::size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+    } else {
+        if (!impl_->pool) {
+            impl_->pool = std::make_unique<detail::WorkStealingPool>(impl_->worker_threads);
+        }
+        impl_->pool->parallelFor(count, task);
+    }
+    return succeeded.load(std::memory_order_relaxed);
+}
+
+}  // namespace vne::interaction
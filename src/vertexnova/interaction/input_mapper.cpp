@@ -10,6 +10,7 @@
  */
 
 #include "vertexnova/interaction/input_mapper.h"
+#include "interaction_utils.h"
 
 #include <vertexnova/events/types.h>
 #include <vertexnova/logging/logging.h>
@@ -404,7 +405,7 @@ void InputMapper::onMouseScroll(float /*scroll_x*/, float scroll_y, float mouse_
     payload.x_px = mouse_x;
     payload.y_px = mouse_y;
     const float clamped_dy = std::clamp(scroll_y, -kWheelScrollYAbsMax, kWheelScrollYAbsMax);
-    float factor = std::pow(kWheelZoomFactorPerLine, clamped_dy);
+    float factor = interactionPow(kWheelZoomFactorPerLine, clamped_dy);
     factor = std::clamp(factor, kWheelZoomFactorMin, kWheelZoomFactorMax);
     payload.zoom_factor = factor;
 
@@ -15,6 +15,7 @@
 #include "vertexnova/interaction/trackball_manipulator.h"
 
 #include "camera_controller_impl.h"
+#include "detail/state_codec.h"
 
 #include <vertexnova/events/key_event.h>
 #include <vertexnova/logging/logging.h>
@@ -251,7 +252,7 @@ Inspect3DController::Inspect3DController()
                 impl->bumpInteractionScale(1.0f / impl->interaction_speed_step_);
                 return;
             }
-            impl->core_.rig.onAction(a, p, dt);
+            impl->core_.dispatchAction(a, p, dt);
         });
 
     rebuildRules();
@@ -303,6 +304,35 @@ void Inspect3DController::onUpdate(double dt) noexcept {
     impl_->core_.onUpdate(dt);
 }
 
+void Inspect3DController::beginTransition(const CameraPoseSnapshot& from, float duration_s) noexcept {
+    impl_->core_.rig.beginTransition(from, duration_s);
+}
+
+void Inspect3DController::setFixedTimestep(double step_s) noexcept {
+    impl_->core_.rig.setFixedTimestep(step_s);
+}
+
+void Inspect3DController::setMatrixUpdatesDeferred(bool deferred) noexcept {
+    impl_->core_.rig.setMatrixUpdatesDeferred(deferred);
+}
+
+CameraMotionState Inspect3DController::getMotionState() const noexcept {
+    return impl_->core_.rig.getMotionState();
+}
+
+CameraPoseSnapshot Inspect3DController::predictPose(double seconds_ahead) const noexcept {
+    return impl_->core_.rig.predictPose(seconds_ahead);
+}
+
+std::size_t Inspect3DController::predictPoses(std::span<const double> seconds_ahead,
+                                              std::span<CameraPoseSnapshot> out) const noexcept {
+    return impl_->core_.rig.predictPoses(seconds_ahead, out);
+}
+
+void Inspect3DController::setCameraConstraint(std::shared_ptr<CameraConstraint> constraint) noexcept {
+    impl_->core_.rig.setCameraConstraint(std::move(constraint));
+}
+
 // ---------------------------------------------------------------------------
 // Pivot
 // ---------------------------------------------------------------------------
@@ -314,6 +344,12 @@ void Inspect3DController::setPivot(const vne::math::Vec3f& world_pos) noexcept {
     }
 }
 
+void Inspect3DController::setDepthQuery(std::shared_ptr<IDepthQuery> query) noexcept {
+    if (impl_->orbit_) {
+        impl_->orbit_->setDepthQuery(std::move(query));
+    }
+}
+
 void Inspect3DController::setPivotMode(OrbitPivotMode mode) noexcept {
     if (impl_->orbit_) {
         impl_->orbit_->setPivotMode(mode);
@@ -477,9 +513,13 @@ void Inspect3DController::setInteractionSpeedStep(float factor) noexcept {
 // Convenience
 // ---------------------------------------------------------------------------
 
-void Inspect3DController::fitToAABB(const vne::math::Vec3f& mn, const vne::math::Vec3f& mx) noexcept {
+void Inspect3DController::fitToAABB(const vne::math::Vec3f& mn,
+                                    const vne::math::Vec3f& mx,
+                                    FitBoundsMode mode) noexcept {
     if (impl_->orbit_) {
-        impl_->orbit_->fitToAABB(mn, mx);
+        impl_->core_.commitHistory();
+        impl_->orbit_->fitToAABB(mn, mx, mode);
+        impl_->core_.beginHistorySettle();
     }
 }
 
@@ -489,6 +529,117 @@ void Inspect3DController::reset() noexcept {
     impl_->applyOrbitSpeeds();
 }
 
+// ---------------------------------------------------------------------------
+// Undo / redo
+// ---------------------------------------------------------------------------
+
+bool Inspect3DController::undo(float duration_s) noexcept {
+    return impl_->core_.undo(duration_s);
+}
+
+bool Inspect3DController::redo(float duration_s) noexcept {
+    return impl_->core_.redo(duration_s);
+}
+
+CameraHistory& Inspect3DController::cameraHistory() noexcept {
+    return impl_->core_.history;
+}
+
+// ---------------------------------------------------------------------------
+// State serialization
+// ---------------------------------------------------------------------------
+
+std::vector<std::uint8_t> Inspect3DController::serialize() const {
+    detail::StateWriter out(detail::StateBlobKind::eInspect3DController);
+    out.flags({impl_->rotation_enabled_,
+               impl_->pivot_on_double_click_enabled_,
+               impl_->pan_enabled_,
+               impl_->zoom_enabled_});
+    out.mouseBinding(impl_->rotate_bind_);
+    out.mouseBinding(impl_->pan_primary_);
+    out.mouseBinding(impl_->pan_secondary_);
+    out.mouseBinding(impl_->pivot_double_click_);
+    out.modifier(impl_->pan_alt_modifier_);
+    out.modifier(impl_->zoom_scroll_modifier_);
+    out.keyCode(impl_->increase_interaction_key_);
+    out.keyCode(impl_->decrease_interaction_key_);
+    out.f32(impl_->user_rotation_speed_);
+    out.f32(impl_->user_pan_speed_);
+    out.f32(impl_->user_zoom_speed_);
+    out.f32(impl_->interaction_scale_);
+    out.f32(impl_->interaction_speed_step_);
+    out.rules(impl_->core_.mapper.rules());
+    out.blob(impl_->orbit_ ? impl_->orbit_->serialize() : std::vector<std::uint8_t>{});
+    return out.take();
+}
+
+bool Inspect3DController::deserialize(const std::uint8_t* data, std::size_t size) noexcept {
+    detail::StateReader in(data, size, detail::StateBlobKind::eInspect3DController);
+    InspectRuleConfig cfg;
+    float rotation_speed = 0.0f;
+    float pan_speed = 0.0f;
+    float zoom_speed = 0.0f;
+    float interaction_scale = 1.0f;
+    float speed_step = 0.0f;
+    std::vector<InputRule> rules;
+    const std::uint8_t* orbit_blob = nullptr;
+    std::size_t orbit_blob_size = 0;
+
+    in.flags({&cfg.rotation_enabled, &cfg.pivot_on_double_click_enabled, &cfg.pan_enabled, &cfg.zoom_enabled});
+    in.mouseBinding(cfg.rotate_bind);
+    in.mouseBinding(cfg.pan_primary);
+    in.mouseBinding(cfg.pan_secondary);
+    in.mouseBinding(cfg.pivot_double_click);
+    in.modifier(cfg.pan_alt_modifier);
+    in.modifier(cfg.zoom_scroll_modifier);
+    in.keyCode(cfg.increase_interaction_key);
+    in.keyCode(cfg.decrease_interaction_key);
+    in.f32(rotation_speed);
+    in.f32(pan_speed);
+    in.f32(zoom_speed);
+    in.f32(interaction_scale);
+    in.f32(speed_step);
+    in.rules(rules);
+    in.blob(orbit_blob, orbit_blob_size);
+    if (!in.ok()) {
+        VNE_LOG_WARN << "Inspect3DController: deserialize rejected a truncated, corrupt or incompatible state blob";
+        return false;
+    }
+
+    // A running blend would write its old target over the restored pose
+    impl_->core_.rig.cancelTransition();
+    if (impl_->orbit_ && !impl_->orbit_->deserialize(orbit_blob, orbit_blob_size)) {
+        return false;
+    }
+
+    impl_->rotation_enabled_ = cfg.rotation_enabled;
+    impl_->pivot_on_double_click_enabled_ = cfg.pivot_on_double_click_enabled;
+    impl_->pan_enabled_ = cfg.pan_enabled;
+    impl_->zoom_enabled_ = cfg.zoom_enabled;
+    impl_->rotate_bind_ = cfg.rotate_bind;
+    impl_->pan_primary_ = cfg.pan_primary;
+    impl_->pan_secondary_ = cfg.pan_secondary;
+    impl_->pivot_double_click_ = cfg.pivot_double_click;
+    impl_->pan_alt_modifier_ = cfg.pan_alt_modifier;
+    impl_->zoom_scroll_modifier_ = cfg.zoom_scroll_modifier;
+    impl_->increase_interaction_key_ = cfg.increase_interaction_key;
+    impl_->decrease_interaction_key_ = cfg.decrease_interaction_key;
+    impl_->user_rotation_speed_ = std::max(0.0f, rotation_speed);
+    impl_->user_pan_speed_ = std::max(0.0f, pan_speed);
+    impl_->user_zoom_speed_ = std::max(kInspectZoomSensitivityMin, zoom_speed);
+    impl_->interaction_scale_ = std::clamp(interaction_scale, kInspectInteractionScaleMin, kInspectInteractionScaleMax);
+    impl_->interaction_speed_step_ = std::max(kInspectInteractionSpeedStepMin, speed_step);
+    impl_->applyOrbitSpeeds();
+
+    impl_->core_.resetInteraction();
+    rebuildRules();
+    if (!detail::sameInputRules(rules, impl_->core_.mapper.rules())) {
+        impl_->core_.mapper.setRules(rules);  // table was customised through inputMapper()
+    }
+    impl_->core_.resetHistory();
+    return true;
+}
+
 // ---------------------------------------------------------------------------
 // Escape hatches
 // ---------------------------------------------------------------------------
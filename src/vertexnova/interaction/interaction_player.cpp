@@ -0,0 +1,390 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/interaction_player.h"
+
+#include "vertexnova/interaction/camera_controller.h"
+
+#include "detail/interaction_log_format.h"
+#include "detail/mapped_file.h"
+
+#include <vertexnova/events/key_event.h>
+#include <vertexnova/events/mouse_event.h>
+#include <vertexnova/logging/logging.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+namespace {
+CREATE_VNE_LOGGER_CATEGORY("vne.interaction.player");
+
+constexpr std::uint64_t kDefaultMapThresholdBytes = 4u * 1024u * 1024u;
+constexpr std::size_t kDefaultChunkBytes = 64u * 1024u;
+constexpr std::size_t kMinChunkBytes = 16u;
+constexpr double kMicrosecondsPerSecond = 1e6;
+}  // namespace
+
+namespace vne::interaction {
+
+using namespace vne;
+using detail::LogDecodeStatus;
+using detail::LogRecord;
+using detail::LogRecordType;
+
+// ---------------------------------------------------------------------------
+// Pimpl
+// ---------------------------------------------------------------------------
+
+class InteractionPlayer::Impl {
+    friend class InteractionPlayer;
+
+   public:
+    ~Impl() { release(); }
+
+   private:
+    // Settings
+    std::uint64_t map_threshold_ = kDefaultMapThresholdBytes;
+    std::size_t chunk_bytes_ = kDefaultChunkBytes;
+
+    // Source: [data_, data_ + size_) is the readable window; pos_ is the decode cursor within it
+    const std::uint8_t* data_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t pos_ = 0;
+    std::vector<std::uint8_t> buffer_;  //!< Owned bytes (openMemory) or the streaming window
+    std::ifstream file_;
+    bool streaming_ = false;
+    bool stream_eof_ = true;
+    detail::MappedFile map_;
+
+    // Playback
+    bool open_ = false;
+    InteractionRecordingInfo info_;
+    detail::LogCodecState codec_;
+    LogRecord next_;
+    bool has_next_ = false;
+    bool header_applied_ = false;
+    bool finished_ = false;
+    bool error_ = false;
+    std::size_t record_count_ = 0;
+    std::uint64_t time_us_ = 0;
+
+    void release() noexcept {
+        map_.unmap();
+        if (file_.is_open()) {
+            file_.close();
+        }
+        file_.clear();
+        buffer_.clear();
+        buffer_.shrink_to_fit();
+        data_ = nullptr;
+        size_ = 0;
+        pos_ = 0;
+        streaming_ = false;
+        stream_eof_ = true;
+        open_ = false;
+        info_ = {};
+        codec_ = {};
+        has_next_ = false;
+        header_applied_ = false;
+        finished_ = false;
+        error_ = false;
+        record_count_ = 0;
+        time_us_ = 0;
+    }
+
+    /** Drop consumed bytes from the streaming window and append the next chunk. */
+    bool refill() noexcept {
+        if (!streaming_ || stream_eof_) {
+            return false;
+        }
+        buffer_.erase(buffer_.begin(), buffer_.begin() + static_cast<std::ptrdiff_t>(pos_));
+        pos_ = 0;
+        const std::size_t old_size = buffer_.size();
+        buffer_.resize(old_size + chunk_bytes_);
+        file_.read(reinterpret_cast<char*>(buffer_.data() + old_size), static_cast<std::streamsize>(chunk_bytes_));
+        const auto got = static_cast<std::size_t>(std::max<std::streamsize>(file_.gcount(), 0));
+        buffer_.resize(old_size + got);
+        if (got < chunk_bytes_) {
+            stream_eof_ = true;
+        }
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+        return got > 0;
+    }
+
+    void fail(const char* what) noexcept {
+        VNE_LOG_WARN << "InteractionPlayer: " << what;
+        error_ = true;
+        finished_ = true;
+    }
+
+    bool readHeader() noexcept {
+        for (;;) {
+            const std::uint8_t* cursor = data_ + pos_;
+            switch (detail::decodeLogHeader(cursor, data_ + size_, info_)) {
+                case LogDecodeStatus::eOk:
+                    pos_ = static_cast<std::size_t>(cursor - data_);
+                    return true;
+                case LogDecodeStatus::eNeedMore:
+                    if (refill()) {
+                        continue;
+                    }
+                    [[fallthrough]];
+                case LogDecodeStatus::eCorrupt:
+                    VNE_LOG_WARN << "InteractionPlayer: not an interaction log (bad or unsupported header)";
+                    return false;
+            }
+        }
+    }
+
+    /** Decode the next record into @ref next_ if it is not there already. */
+    bool fetchNext() noexcept {
+        if (has_next_) {
+            return true;
+        }
+        if (!open_ || finished_) {
+            return false;
+        }
+        for (;;) {
+            const std::uint8_t* cursor = data_ + pos_;
+            switch (detail::decodeLogRecord(cursor, data_ + size_, codec_, next_)) {
+                case LogDecodeStatus::eOk:
+                    pos_ = static_cast<std::size_t>(cursor - data_);
+                    has_next_ = true;
+                    return true;
+                case LogDecodeStatus::eNeedMore:
+                    if (refill()) {
+                        continue;
+                    }
+                    if (pos_ == size_) {
+                        finished_ = true;
+                    } else {
+                        fail("log is truncated");
+                    }
+                    return false;
+                case LogDecodeStatus::eCorrupt:
+                    fail("log is corrupt");
+                    return false;
+            }
+        }
+    }
+
+    void applyHeader(ICameraController& target) const noexcept {
+        if (info_.viewport_width > 0.0f && info_.viewport_height > 0.0f) {
+            target.onResize(info_.viewport_width, info_.viewport_height);
+        }
+        if (info_.fixed_step_s > 0.0) {
+            target.setFixedTimestep(info_.fixed_step_s);
+        }
+    }
+
+    static void apply(const LogRecord& r, ICameraController& target) noexcept {
+        switch (r.type) {
+            case LogRecordType::eUpdate:
+                target.onUpdate(r.dt);
+                break;
+            case LogRecordType::eResize:
+                target.onResize(static_cast<float>(r.x), static_cast<float>(r.y));
+                break;
+            case LogRecordType::eFixedTimestep:
+                target.setFixedTimestep(r.dt);
+                break;
+            case LogRecordType::eMouseMove: {
+                const events::MouseMovedEvent e(r.x, r.y);
+                target.onEvent(e, r.dt);
+                break;
+            }
+            case LogRecordType::eButtonPress: {
+                const events::MouseButtonPressedEvent e(static_cast<events::MouseButton>(r.code), 0, r.x, r.y);
+                target.onEvent(e, r.dt);
+                break;
+            }
+            case LogRecordType::eButtonRelease: {
+                const events::MouseButtonReleasedEvent e(static_cast<events::MouseButton>(r.code), 0, r.x, r.y);
+                target.onEvent(e, r.dt);
+                break;
+            }
+            case LogRecordType::eDoubleClick: {
+                const events::MouseButtonDoubleClickedEvent e(static_cast<events::MouseButton>(r.code), 0, r.x, r.y);
+                target.onEvent(e, r.dt);
+                break;
+            }
+            case LogRecordType::eScroll: {
+                const events::MouseScrolledEvent e(r.x, r.y);
+                target.onEvent(e, r.dt);
+                break;
+            }
+            case LogRecordType::eKeyPress:
+            case LogRecordType::eKeyRepeat: {
+                // Controllers treat repeat like press; replaying it as a press keeps the same mapper state.
+                const events::KeyPressedEvent e(static_cast<events::KeyCode>(r.code));
+                target.onEvent(e, r.dt);
+                break;
+            }
+            case LogRecordType::eKeyRelease: {
+                const events::KeyReleasedEvent e(static_cast<events::KeyCode>(r.code));
+                target.onEvent(e, r.dt);
+                break;
+            }
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Construction
+// ---------------------------------------------------------------------------
+
+InteractionPlayer::InteractionPlayer() noexcept
+    : impl_(std::make_unique<Impl>()) {}
+
+InteractionPlayer::~InteractionPlayer() = default;
+InteractionPlayer::InteractionPlayer(InteractionPlayer&&) noexcept = default;
+InteractionPlayer& InteractionPlayer::operator=(InteractionPlayer&&) noexcept = default;
+
+// ---------------------------------------------------------------------------
+// Source
+// ---------------------------------------------------------------------------
+
+bool InteractionPlayer::open(const std::string& path) noexcept {
+    close();
+    std::error_code ec;
+    const std::uintmax_t size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        VNE_LOG_WARN << "InteractionPlayer: cannot read '" << path << "'";
+        return false;
+    }
+
+    if (size > 0 && size >= impl_->map_threshold_ && impl_->map_.map(path)) {
+        impl_->data_ = impl_->map_.data();
+        impl_->size_ = impl_->map_.size();
+    } else {
+        impl_->file_.open(path, std::ios::binary);
+        if (!impl_->file_) {
+            VNE_LOG_WARN << "InteractionPlayer: cannot read '" << path << "'";
+            impl_->release();
+            return false;
+        }
+        impl_->streaming_ = true;
+        impl_->stream_eof_ = false;
+        impl_->refill();
+    }
+
+    if (!impl_->readHeader()) {
+        impl_->release();
+        return false;
+    }
+    impl_->open_ = true;
+    return true;
+}
+
+bool InteractionPlayer::openMemory(std::vector<std::uint8_t> bytes) noexcept {
+    close();
+    impl_->buffer_ = std::move(bytes);
+    impl_->data_ = impl_->buffer_.data();
+    impl_->size_ = impl_->buffer_.size();
+    if (!impl_->readHeader()) {
+        impl_->release();
+        return false;
+    }
+    impl_->open_ = true;
+    return true;
+}
+
+void InteractionPlayer::close() noexcept {
+    impl_->release();
+}
+
+bool InteractionPlayer::isOpen() const noexcept {
+    return impl_->open_;
+}
+
+bool InteractionPlayer::isMemoryMapped() const noexcept {
+    return impl_->map_.isMapped();
+}
+
+const InteractionRecordingInfo& InteractionPlayer::getInfo() const noexcept {
+    return impl_->info_;
+}
+
+void InteractionPlayer::setMemoryMapThreshold(std::uint64_t bytes) noexcept {
+    impl_->map_threshold_ = bytes;
+}
+
+std::uint64_t InteractionPlayer::getMemoryMapThreshold() const noexcept {
+    return impl_->map_threshold_;
+}
+
+void InteractionPlayer::setChunkSize(std::size_t bytes) noexcept {
+    impl_->chunk_bytes_ = std::max(bytes, kMinChunkBytes);
+}
+
+std::size_t InteractionPlayer::getChunkSize() const noexcept {
+    return impl_->chunk_bytes_;
+}
+
+// ---------------------------------------------------------------------------
+// Playback
+// ---------------------------------------------------------------------------
+
+bool InteractionPlayer::step(ICameraController& target) noexcept {
+    if (!impl_->fetchNext()) {
+        return false;
+    }
+    if (!impl_->header_applied_) {
+        impl_->applyHeader(target);
+        impl_->header_applied_ = true;
+    }
+    impl_->has_next_ = false;
+    impl_->time_us_ = impl_->next_.time_us;
+    ++impl_->record_count_;
+    const LogRecord record = impl_->next_;
+    Impl::apply(record, target);
+    impl_->fetchNext();  // look ahead so isFinished() turns true right after the last record
+    return true;
+}
+
+std::size_t InteractionPlayer::playUntil(ICameraController& target, double time_s) noexcept {
+    const double limit_us = time_s * kMicrosecondsPerSecond;
+    std::size_t applied = 0;
+    while (impl_->fetchNext() && static_cast<double>(impl_->next_.time_us) <= limit_us) {
+        step(target);
+        ++applied;
+    }
+    return applied;
+}
+
+std::size_t InteractionPlayer::playAll(ICameraController& target) noexcept {
+    std::size_t applied = 0;
+    while (step(target)) {
+        ++applied;
+    }
+    return applied;
+}
+
+double InteractionPlayer::getTime() const noexcept {
+    return static_cast<double>(impl_->time_us_) / kMicrosecondsPerSecond;
+}
+
+std::size_t InteractionPlayer::getRecordCount() const noexcept {
+    return impl_->record_count_;
+}
+
+bool InteractionPlayer::isFinished() const noexcept {
+    return impl_->finished_ && !impl_->has_next_;
+}
+
+bool InteractionPlayer::hasError() const noexcept {
+    return impl_->error_;
+}
+
+}  // namespace vne::interaction
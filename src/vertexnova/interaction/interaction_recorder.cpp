@@ -0,0 +1,312 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/interaction_recorder.h"
+
+#include "vertexnova/interaction/deterministic_math.h"
+
+#include "detail/async_file_writer.h"
+#include "detail/interaction_log_format.h"
+
+#include <vertexnova/events/key_event.h>
+#include <vertexnova/events/mouse_event.h>
+#include <vertexnova/logging/logging.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace {
+CREATE_VNE_LOGGER_CATEGORY("vne.interaction.recorder");
+
+constexpr std::size_t kDefaultChunkBytes = 64u * 1024u;
+constexpr std::size_t kMinChunkBytes = 256u;
+constexpr std::size_t kMaxRecordBytes = 48u;  //!< Upper bound of one encoded record (tag + varints + 2×f64)
+}  // namespace
+
+namespace vne::interaction {
+
+using namespace vne;
+using detail::LogRecord;
+using detail::LogRecordType;
+
+// ---------------------------------------------------------------------------
+// Pimpl
+// ---------------------------------------------------------------------------
+
+class InteractionRecorder::Impl {
+    friend class InteractionRecorder;
+
+    std::shared_ptr<ICameraController> target_;
+
+    // Caller-thread state
+    bool recording_ = false;
+    std::size_t chunk_bytes_ = kDefaultChunkBytes;
+    std::vector<std::uint8_t> chunk_;
+    detail::LogCodecState codec_;
+    std::chrono::steady_clock::time_point start_time_;
+    std::size_t record_count_ = 0;
+    std::uint64_t encoded_bytes_ = 0;
+    std::size_t skipped_events_ = 0;
+    float viewport_w_ = 0.0f;
+    float viewport_h_ = 0.0f;
+    double fixed_step_s_ = 0.0;
+    double cursor_x_ = 0.0;  //!< Last pointer position, for button events that carry none
+    double cursor_y_ = 0.0;
+
+    detail::AsyncFileWriter writer_;
+
+    void append(LogRecord record) noexcept {
+        if (!recording_) {
+            return;
+        }
+        record.time_us = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time_)
+                .count());
+        const std::size_t before = chunk_.size();
+        detail::encodeLogRecord(chunk_, codec_, record);
+        encoded_bytes_ += chunk_.size() - before;
+        ++record_count_;
+        if (chunk_.size() + kMaxRecordBytes > chunk_bytes_) {
+            submitChunk();
+        }
+    }
+
+    void appendEvent(LogRecordType type, double dt, double x, double y, std::int64_t code) noexcept {
+        LogRecord record;
+        record.type = type;
+        record.dt = dt;
+        record.x = x;
+        record.y = y;
+        record.code = code;
+        append(record);
+    }
+
+    void submitChunk() noexcept {
+        writer_.submit(chunk_);
+        chunk_.reserve(chunk_bytes_);
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Construction
+// ---------------------------------------------------------------------------
+
+InteractionRecorder::InteractionRecorder(std::shared_ptr<ICameraController> target) noexcept
+    : impl_(std::make_unique<Impl>()) {
+    impl_->target_ = std::move(target);
+}
+
+InteractionRecorder::~InteractionRecorder() {
+    if (impl_) {
+        stop();
+    }
+}
+
+InteractionRecorder::InteractionRecorder(InteractionRecorder&&) noexcept = default;
+InteractionRecorder& InteractionRecorder::operator=(InteractionRecorder&&) noexcept = default;
+
+// ---------------------------------------------------------------------------
+// Recording
+// ---------------------------------------------------------------------------
+
+bool InteractionRecorder::start(const std::string& path, InteractionRecordingInfo info) noexcept {
+    stop();
+    if (!impl_->writer_.open(path)) {
+        VNE_LOG_WARN << "InteractionRecorder: cannot open '" << path << "' for writing";
+        return false;
+    }
+
+    if (info.viewport_width <= 0.0f || info.viewport_height <= 0.0f) {
+        info.viewport_width = impl_->viewport_w_;
+        info.viewport_height = impl_->viewport_h_;
+    }
+    if (info.fixed_step_s <= 0.0) {
+        info.fixed_step_s = impl_->fixed_step_s_;
+    }
+    info.deterministic_math = isDeterministicMath();
+
+    impl_->chunk_.clear();
+    impl_->chunk_.reserve(impl_->chunk_bytes_);
+    detail::encodeLogHeader(impl_->chunk_, info);
+    impl_->codec_ = {};
+    impl_->record_count_ = 0;
+    impl_->encoded_bytes_ = impl_->chunk_.size();
+    impl_->skipped_events_ = 0;
+    impl_->start_time_ = std::chrono::steady_clock::now();
+    impl_->recording_ = true;
+    return true;
+}
+
+void InteractionRecorder::stop() noexcept {
+    if (!impl_->recording_) {
+        return;
+    }
+    impl_->submitChunk();
+    impl_->recording_ = false;
+    impl_->writer_.close();
+    if (hasWriteError()) {
+        VNE_LOG_WARN << "InteractionRecorder: recording is incomplete (file write failed)";
+    }
+}
+
+bool InteractionRecorder::isRecording() const noexcept {
+    return impl_->recording_;
+}
+
+void InteractionRecorder::flush() noexcept {
+    impl_->submitChunk();
+}
+
+void InteractionRecorder::setChunkSize(std::size_t bytes) noexcept {
+    impl_->chunk_bytes_ = std::max(bytes, kMinChunkBytes);
+}
+
+std::size_t InteractionRecorder::getChunkSize() const noexcept {
+    return impl_->chunk_bytes_;
+}
+
+std::size_t InteractionRecorder::getRecordCount() const noexcept {
+    return impl_->record_count_;
+}
+
+std::uint64_t InteractionRecorder::getEncodedBytes() const noexcept {
+    return impl_->encoded_bytes_;
+}
+
+std::size_t InteractionRecorder::getSkippedEventCount() const noexcept {
+    return impl_->skipped_events_;
+}
+
+bool InteractionRecorder::hasWriteError() const noexcept {
+    return impl_->writer_.hasError();
+}
+
+const std::shared_ptr<ICameraController>& InteractionRecorder::getTarget() const noexcept {
+    return impl_->target_;
+}
+
+// ---------------------------------------------------------------------------
+// ICameraController
+// ---------------------------------------------------------------------------
+
+void InteractionRecorder::setCamera(std::shared_ptr<vne::scene::ICamera> camera) noexcept {
+    if (impl_->target_) {
+        impl_->target_->setCamera(std::move(camera));
+    }
+}
+
+void InteractionRecorder::onResize(float width_px, float height_px) noexcept {
+    impl_->viewport_w_ = width_px;
+    impl_->viewport_h_ = height_px;
+    impl_->appendEvent(LogRecordType::eResize, 0.0, width_px, height_px, 0);
+    if (impl_->target_) {
+        impl_->target_->onResize(width_px, height_px);
+    }
+}
+
+void InteractionRecorder::onUpdate(double delta_time) noexcept {
+    impl_->appendEvent(LogRecordType::eUpdate, delta_time, 0.0, 0.0, 0);
+    if (impl_->target_) {
+        impl_->target_->onUpdate(delta_time);
+    }
+}
+
+void InteractionRecorder::onEvent(const events::Event& event, double delta_time) noexcept {
+    switch (event.type()) {
+        case events::EventType::eMouseMoved: {
+            const auto& e = static_cast<const events::MouseMovedEvent&>(event);
+            impl_->cursor_x_ = e.x();
+            impl_->cursor_y_ = e.y();
+            impl_->appendEvent(LogRecordType::eMouseMove, delta_time, e.x(), e.y(), 0);
+            break;
+        }
+        case events::EventType::eMouseButtonPressed:
+        case events::EventType::eMouseButtonReleased:
+        case events::EventType::eMouseButtonDoubleClicked: {
+            const auto& e = static_cast<const events::MouseButtonEvent&>(event);
+            LogRecordType type = LogRecordType::eDoubleClick;
+            if (event.type() == events::EventType::eMouseButtonPressed) {
+                type = LogRecordType::eButtonPress;
+            } else if (event.type() == events::EventType::eMouseButtonReleased) {
+                type = LogRecordType::eButtonRelease;
+            }
+            // Positionless button events are recorded at the last cursor position, where controllers apply them.
+            if (e.hasPosition()) {
+                impl_->cursor_x_ = e.x();
+                impl_->cursor_y_ = e.y();
+            }
+            impl_->appendEvent(
+                type, delta_time, impl_->cursor_x_, impl_->cursor_y_, static_cast<std::int64_t>(e.button()));
+            break;
+        }
+        case events::EventType::eMouseScrolled: {
+            const auto& e = static_cast<const events::MouseScrolledEvent&>(event);
+            impl_->appendEvent(LogRecordType::eScroll, delta_time, e.xOffset(), e.yOffset(), 0);
+            break;
+        }
+        case events::EventType::eKeyPressed:
+        case events::EventType::eKeyReleased:
+        case events::EventType::eKeyRepeat: {
+            const auto& e = static_cast<const events::KeyEvent&>(event);
+            LogRecordType type = LogRecordType::eKeyRepeat;
+            if (event.type() == events::EventType::eKeyPressed) {
+                type = LogRecordType::eKeyPress;
+            } else if (event.type() == events::EventType::eKeyReleased) {
+                type = LogRecordType::eKeyRelease;
+            }
+            impl_->appendEvent(type, delta_time, 0.0, 0.0, static_cast<std::int64_t>(e.keyCode()));
+            break;
+        }
+        default:
+            if (impl_->recording_) {
+                ++impl_->skipped_events_;
+            }
+            break;
+    }
+    if (impl_->target_) {
+        impl_->target_->onEvent(event, delta_time);
+    }
+}
+
+void InteractionRecorder::beginTransition(const CameraPoseSnapshot& from, float duration_s) noexcept {
+    if (impl_->target_) {
+        impl_->target_->beginTransition(from, duration_s);
+    }
+}
+
+void InteractionRecorder::setFixedTimestep(double step_s) noexcept {
+    impl_->fixed_step_s_ = step_s;
+    impl_->appendEvent(LogRecordType::eFixedTimestep, step_s, 0.0, 0.0, 0);
+    if (impl_->target_) {
+        impl_->target_->setFixedTimestep(step_s);
+    }
+}
+
+void InteractionRecorder::setMatrixUpdatesDeferred(bool deferred) noexcept {
+    if (impl_->target_) {
+        impl_->target_->setMatrixUpdatesDeferred(deferred);
+    }
+}
+
+CameraMotionState InteractionRecorder::getMotionState() const noexcept {
+    return impl_->target_ ? impl_->target_->getMotionState() : CameraMotionState{};
+}
+
+CameraPoseSnapshot InteractionRecorder::predictPose(double seconds_ahead) const noexcept {
+    return impl_->target_ ? impl_->target_->predictPose(seconds_ahead) : CameraPoseSnapshot{};
+}
+
+std::size_t InteractionRecorder::predictPoses(std::span<const double> seconds_ahead,
+                                              std::span<CameraPoseSnapshot> out) const noexcept {
+    return impl_->target_ ? impl_->target_->predictPoses(seconds_ahead, out) : 0;
+}
+
+}  // namespace vne::interaction
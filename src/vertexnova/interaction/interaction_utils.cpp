@@ -10,6 +10,9 @@
  */
 
 #include "interaction_utils.h"
+#include "detail/portable_math.h"
+
+#include "vertexnova/interaction/deterministic_math.h"
 
 #include <algorithm>
 #include <cmath>
@@ -32,7 +35,9 @@ namespace {
     return true;
 }
 
-[[nodiscard]] vne::math::Mat4f safeInverseViewProjection(const vne::math::Mat4f& vp) noexcept {
+}  // namespace
+
+vne::math::Mat4f safeInverseViewProjection(const vne::math::Mat4f& vp) noexcept {
     const vne::math::Mat4f inv = vp.inverse();
     if (!mat4AllFinite(inv)) {
         return vne::math::Mat4f::identity();
@@ -40,7 +45,102 @@ namespace {
     return inv;
 }
 
-}  // namespace
+// -----------------------------------------------------------------------------
+// Interaction-path math
+// -----------------------------------------------------------------------------
+
+float interactionExp(float x) noexcept {
+    return isDeterministicMath() ? detail::portableExp(x) : std::exp(x);
+}
+
+float interactionPow(float base, float exponent) noexcept {
+    return isDeterministicMath() ? detail::portablePow(base, exponent) : std::pow(base, exponent);
+}
+
+float interactionLog(float x) noexcept {
+    return isDeterministicMath() ? detail::portableLog(x) : std::log(x);
+}
+
+float interactionSin(float x) noexcept {
+    return isDeterministicMath() ? detail::portableSin(x) : std::sin(x);
+}
+
+float interactionCos(float x) noexcept {
+    return isDeterministicMath() ? detail::portableCos(x) : std::cos(x);
+}
+
+float interactionTan(float x) noexcept {
+    return isDeterministicMath() ? detail::portableTan(x) : std::tan(x);
+}
+
+float interactionAtan(float x) noexcept {
+    return isDeterministicMath() ? detail::portableAtan(x) : std::atan(x);
+}
+
+float interactionAtan2(float y, float x) noexcept {
+    return isDeterministicMath() ? detail::portableAtan2(y, x) : std::atan2(y, x);
+}
+
+float interactionAsin(float x) noexcept {
+    return isDeterministicMath() ? detail::portableAsin(x) : std::asin(x);
+}
+
+float interactionAcos(float x) noexcept {
+    return isDeterministicMath() ? detail::portableAcos(x) : std::acos(x);
+}
+
+float interactionDamp(float current, float target, float smoothing_time, float dt) noexcept {
+    if (!isDeterministicMath()) {
+        return vne::math::damp(current, target, smoothing_time, dt);
+    }
+    return target + (current - target) * detail::portableExp(-dt / smoothing_time);
+}
+
+vne::math::Quatf quatFromAxisAngle(const vne::math::Vec3f& axis, float angle_rad) noexcept {
+    if (!isDeterministicMath()) {
+        return vne::math::Quatf::fromAxisAngle(axis, angle_rad);
+    }
+    const float half = angle_rad * 0.5f;
+    const float s = detail::portableSin(half);
+    return vne::math::Quatf(axis.x() * s, axis.y() * s, axis.z() * s, detail::portableCos(half));
+}
+
+vne::math::Quatf normalizeQuat(const vne::math::Quatf& q) noexcept {
+    if (!isDeterministicMath()) {
+        return q.normalized();
+    }
+    const float len_sq = ((q.x * q.x + q.y * q.y) + q.z * q.z) + q.w * q.w;
+    if (!(len_sq > 0.0f) || !std::isfinite(len_sq)) {
+        return vne::math::Quatf::identity();
+    }
+    const float len = std::sqrt(len_sq);
+    return vne::math::Quatf(q.x / len, q.y / len, q.z / len, q.w / len);
+}
+
+vne::math::Quatf slerpQuat(const vne::math::Quatf& a, const vne::math::Quatf& b, float t) noexcept {
+    if (!isDeterministicMath()) {
+        return vne::math::Quatf::slerp(a, b, t);
+    }
+    constexpr float kLinearDot = 0.9995f;  // nearly parallel: the normalized linear blend is exact enough
+    float d = ((a.x * b.x + a.y * b.y) + a.z * b.z) + a.w * b.w;
+    const float sign = d < 0.0f ? -1.0f : 1.0f;
+    d *= sign;
+    float wa = 1.0f - t;
+    float wb = t;
+    if (d <= kLinearDot) {
+        const float theta = detail::portableAcos(d);
+        const float s = detail::portableSin(theta);
+        wa = detail::portableSin(wa * theta) / s;
+        wb = detail::portableSin(wb * theta) / s;
+    }
+    wb *= sign;
+    const vne::math::Quatf q(a.x * wa + b.x * wb, a.y * wa + b.y * wb, a.z * wa + b.z * wb, a.w * wa + b.w * wb);
+    return d > kLinearDot ? normalizeQuat(q) : q;
+}
+
+// -----------------------------------------------------------------------------
+// Trackball quaternion
+// -----------------------------------------------------------------------------
 
 vne::math::Quatf scaleTrackballQuaternion(vne::math::Quatf q, float scale) noexcept {
     if (scale <= 0.0f) {
@@ -52,7 +152,7 @@ vne::math::Quatf scaleTrackballQuaternion(vne::math::Quatf q, float scale) noexc
     const float imag_sq = q.x * q.x + q.y * q.y + q.z * q.z;
     constexpr float kTinyAngleRad = 1e-6f;
     if (scale > 1.0f && imag_sq > 0.0f) {
-        const float ang = 2.0f * std::acos(std::clamp(q.w, -1.0f, 1.0f));
+        const float ang = 2.0f * interactionAcos(std::clamp(q.w, -1.0f, 1.0f));
         const float ang_scaled = ang * scale;
         // Identity only if the scaled rotation (same as passed to fromAxisAngle below) is still negligible;
         // a tiny raw ang can become meaningful when scale > 1.
@@ -63,15 +163,49 @@ vne::math::Quatf scaleTrackballQuaternion(vne::math::Quatf q, float scale) noexc
     constexpr float kImagEpsSq = 1e-12f;
     if (imag_sq < kImagEpsSq) {
         if (scale <= 1.0f) {
-            return vne::math::Quatf::slerp(vne::math::Quatf::identity(), q, scale);
+            return slerpQuat(vne::math::Quatf::identity(), q, scale);
         }
         if (imag_sq <= 0.0f) {
             return vne::math::Quatf::identity();
         }
     }
-    const float ang = q.angle();
+    const float ang = isDeterministicMath() ? 2.0f * detail::portableAcos(std::min(q.w, 1.0f)) : q.angle();
     const vne::math::Vec3f axis = vne::math::Vec3f(q.x, q.y, q.z) * (1.0f / std::sqrt(std::max(imag_sq, kImagEpsSq)));
-    return vne::math::Quatf::fromAxisAngle(axis, ang * scale);
+    return quatFromAxisAngle(axis, ang * scale);
+}
+
+vne::math::Vec3f quatToRotationVector(const vne::math::Quatf& q) noexcept {
+    const float sign = (q.w < 0.0f) ? -1.0f : 1.0f;
+    const vne::math::Vec3f v(q.x * sign, q.y * sign, q.z * sign);
+    const float s = v.length();
+    if (s < detail::kManipulatorUtilsEpsilon) {
+        return v * 2.0f;  // small-angle limit: angle ≈ 2|v|
+    }
+    const float angle = 2.0f * interactionAtan2(s, q.w * sign);
+    return v * (angle / s);
+}
+
+vne::math::Quatf quatFromRotationVector(const vne::math::Vec3f& v) noexcept {
+    const float angle = v.length();
+    if (angle < detail::kManipulatorUtilsEpsilon) {
+        return vne::math::Quatf::identity();
+    }
+    return quatFromAxisAngle(v / angle, angle);
+}
+
+void updateAngularVelocity(vne::math::Vec3f& velocity,
+                           const vne::math::Quatf& prev,
+                           const vne::math::Quatf& curr,
+                           double dt,
+                           float blend_rate) noexcept {
+    constexpr double kMinSampleDt = 0.001;
+    if (!std::isfinite(dt) || dt < kMinSampleDt) {
+        return;
+    }
+    // curr = delta * prev  =>  delta = curr * prev^-1 (world-frame rotation since the previous sample)
+    const vne::math::Vec3f sample = quatToRotationVector((curr * prev.conjugate()).normalized()) / static_cast<float>(dt);
+    const float blend = 1.0f - interactionExp(-blend_rate * static_cast<float>(dt));
+    velocity = velocity + (sample - velocity) * blend;
 }
 
 vne::math::Vec2f mouseToApiScreen(float mx,
@@ -142,10 +276,133 @@ vne::math::Vec3f worldUnderCursorPersp(const vne::scene::PerspectiveCamera& pers
                                        const vne::math::Vec3f& right,
                                        const vne::math::Vec3f& up) noexcept {
     const float fov_y_rad = vne::math::degToRad(persp.getFieldOfView());
-    const float half_h = orbit_dist * vne::math::tan(fov_y_rad * 0.5f);
+    const float half_h = orbit_dist * interactionTan(fov_y_rad * 0.5f);
     const float aspect = (viewport_height > 0.0f) ? (viewport_width / viewport_height) : 1.0f;
     const float half_w = half_h * aspect;
     return persp.getPosition() + front * orbit_dist + right * (ndc_x * half_w) + up * (ndc_y * half_h);
 }
 
+CameraPoseSnapshot captureCameraPose(const vne::scene::ICamera& camera) noexcept {
+    CameraPoseSnapshot pose;
+    pose.position = camera.getPosition();
+    pose.orientation = camera.getOrientation().normalized();
+    pose.target = camera.getTarget();
+    if (const auto* persp = dynamic_cast<const vne::scene::PerspectiveCamera*>(&camera)) {
+        pose.fov_deg = persp->getFieldOfView();
+    } else if (const auto* ortho = dynamic_cast<const vne::scene::OrthographicCamera*>(&camera)) {
+        pose.ortho_width = ortho->getWidth();
+        pose.ortho_height = ortho->getHeight();
+    }
+    return pose;
+}
+
+void applyCameraPose(vne::scene::ICamera& camera, const CameraPoseSnapshot& pose, bool update_matrices) noexcept {
+    if (auto* persp = dynamic_cast<vne::scene::PerspectiveCamera*>(&camera)) {
+        if (pose.fov_deg > 0.0f) {
+            persp->setFieldOfView(pose.fov_deg);
+        }
+    } else if (auto* ortho = dynamic_cast<vne::scene::OrthographicCamera*>(&camera)) {
+        if (pose.ortho_width > 0.0f && pose.ortho_height > 0.0f) {
+            const float half_w = pose.ortho_width * 0.5f;
+            const float half_h = pose.ortho_height * 0.5f;
+            ortho->setBounds(-half_w, half_w, -half_h, half_h, ortho->getNearPlane(), ortho->getFarPlane());
+        }
+    }
+    camera.lookAt(pose.position, pose.target, pose.orientation.getYAxis());
+    if (update_matrices) {
+        camera.updateMatrices();
+    }
+}
+
+CameraPoseSnapshot blendCameraPose(const CameraPoseSnapshot& from, const CameraPoseSnapshot& to, float t) noexcept {
+    const float s = vne::math::clamp(t, 0.0f, 1.0f);
+    CameraPoseSnapshot out;
+    out.position = from.position + (to.position - from.position) * s;
+    out.orientation = normalizeQuat(slerpQuat(from.orientation, to.orientation, s));
+
+    const float from_dist = (from.target - from.position).length();
+    const float to_dist = (to.target - to.position).length();
+    const float dist = std::max(from_dist + (to_dist - from_dist) * s, detail::kManipulatorUtilsEpsilon);
+    out.target = out.position - out.orientation.getZAxis() * dist;
+
+    if (from.fov_deg > 0.0f && to.fov_deg > 0.0f) {
+        out.fov_deg = from.fov_deg + (to.fov_deg - from.fov_deg) * s;
+    } else {
+        out.fov_deg = to.fov_deg;
+    }
+    if (from.ortho_width > 0.0f && to.ortho_width > 0.0f && from.ortho_height > 0.0f && to.ortho_height > 0.0f) {
+        out.ortho_width = from.ortho_width + (to.ortho_width - from.ortho_width) * s;
+        out.ortho_height = from.ortho_height + (to.ortho_height - from.ortho_height) * s;
+    } else {
+        out.ortho_width = to.ortho_width;
+        out.ortho_height = to.ortho_height;
+    }
+    return out;
+}
+
+bool cameraPosesMatch(const CameraPoseSnapshot& a, const CameraPoseSnapshot& b, float epsilon) noexcept {
+    return (a.position - b.position).length() <= epsilon && (a.target - b.target).length() <= epsilon
+           && std::abs(vne::math::Quatf::dot(a.orientation, b.orientation)) >= 1.0f - epsilon
+           && std::abs(a.fov_deg - b.fov_deg) <= epsilon && std::abs(a.ortho_width - b.ortho_width) <= epsilon
+           && std::abs(a.ortho_height - b.ortho_height) <= epsilon;
+}
+
+void cameraViewAxes(const vne::scene::ICamera& camera,
+                    vne::math::Vec3f& right,
+                    vne::math::Vec3f& up,
+                    vne::math::Vec3f& forward) noexcept {
+    forward = camera.getForwardDir();
+    right = forward.cross(camera.getUpDir()).normalized();
+    up = right.cross(forward);
+}
+
+float decaySettleTime(float speed, float damping, float threshold) noexcept {
+    if (!(speed > threshold) || !(threshold > 0.0f) || !(damping > 0.0f) || !std::isfinite(speed)) {
+        return 0.0f;
+    }
+    return std::log(speed / threshold) / damping;
+}
+
+float lookaheadSeconds(double seconds) noexcept {
+    return (std::isfinite(seconds) && seconds > 0.0) ? static_cast<float>(seconds) : 0.0f;
+}
+
+float decayTravelTime(float t, float damping) noexcept {
+    if (!(t > 0.0f)) {
+        return 0.0f;
+    }
+    if (!(damping > detail::kManipulatorUtilsEpsilon)) {
+        return t;
+    }
+    return (1.0f - interactionExp(-damping * t)) / damping;
+}
+
+void rotateCameraPose(CameraPoseSnapshot& pose,
+                      const vne::math::Quatf& rotation,
+                      const vne::math::Vec3f& pivot) noexcept {
+    pose.position = pivot + rotation.rotate(pose.position - pivot);
+    pose.target = pivot + rotation.rotate(pose.target - pivot);
+    pose.orientation = normalizeQuat(rotation * pose.orientation);
+}
+
+CameraPoseSnapshot transferCameraMotion(const CameraPoseSnapshot& pose,
+                                        const CameraPoseSnapshot& from,
+                                        const CameraPoseSnapshot& to) noexcept {
+    const vne::math::Quatf turn = normalizeQuat(to.orientation * from.orientation.conjugate());
+    CameraPoseSnapshot out = pose;
+    out.position = to.position + turn.rotate(pose.position - from.position);
+    out.target = to.target + turn.rotate(pose.target - from.target);
+    out.orientation = normalizeQuat(turn * pose.orientation);
+    if (pose.fov_deg > 0.0f && from.fov_deg > 0.0f && to.fov_deg > 0.0f) {
+        out.fov_deg = pose.fov_deg * (to.fov_deg / from.fov_deg);
+    }
+    if (pose.ortho_width > 0.0f && from.ortho_width > 0.0f && to.ortho_width > 0.0f) {
+        out.ortho_width = pose.ortho_width * (to.ortho_width / from.ortho_width);
+    }
+    if (pose.ortho_height > 0.0f && from.ortho_height > 0.0f && to.ortho_height > 0.0f) {
+        out.ortho_height = pose.ortho_height * (to.ortho_height / from.ortho_height);
+    }
+    return out;
+}
+
 }  // namespace vne::interaction
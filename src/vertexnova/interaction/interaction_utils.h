@@ -18,11 +18,21 @@
  *
  * Provides:
  *   - buildReferenceFrame, mouseToNDC, mouseWindowToNDC, mouseWindowDeltaToNDCDelta
- *   - worldUnderCursorOrtho, mouseUnproject, mouseToWorldRay, worldUnderCursor,
- *     worldUnderCursorPersp
+ *   - worldUnderCursorOrtho, safeInverseViewProjection, mouseUnproject, mouseToWorldRay, worldUnderCursor,
+ *     worldUnderCursorPersp (batched public form: screen_rays.h)
+ *   - interactionExp, interactionPow, interactionLog, interactionSin / Cos / Tan, interactionAtan / Atan2 /
+ *     Asin / Acos, interactionDamp, quatFromAxisAngle, normalizeQuat, slerpQuat
+ *     (deterministic-math aware; see deterministic_math.h)
  *   - scaleTrackballQuaternion (shared trackball delta scaling for orbit / free-look)
+ *   - quatToRotationVector, quatFromRotationVector, updateAngularVelocity (latency-compensation lead)
+ *   - captureCameraPose, applyCameraPose, blendCameraPose, cameraPosesMatch (rig handoff transitions, history)
+ *   - cameraViewAxes (frame for the fitToPoints / fitToBoxes view extents)
+ *   - decaySettleTime, lookaheadSeconds, decayTravelTime, rotateCameraPose, transferCameraMotion
+ *     (motion state, pose prediction)
  */
 
+#include "vertexnova/interaction/interaction_types.h"
+
 #include <cmath>
 
 #include <vertexnova/math/core/core.h>
@@ -110,6 +120,43 @@ inline void buildReferenceFrame(const vne::math::Vec3f& world_up,
 [[nodiscard]] vne::math::Vec2f mouseWindowDeltaToNDCDelta(
     float delta_x_px, float delta_y_px, float w, float h, vne::math::GraphicsApi api) noexcept;
 
+// -----------------------------------------------------------------------------
+// Interaction-path math — defined in interaction_utils.cpp
+// (portable implementations from detail/portable_math.h when isDeterministicMath())
+// -----------------------------------------------------------------------------
+
+/** e^x for inertia decay and velocity smoothing. */
+[[nodiscard]] float interactionExp(float x) noexcept;
+
+/** base^exponent for zoom factors and spline knot spacing. */
+[[nodiscard]] float interactionPow(float base, float exponent) noexcept;
+
+/** Natural logarithm for accumulated zoom factors. */
+[[nodiscard]] float interactionLog(float x) noexcept;
+
+/** Sine / cosine / tangent of radians for yaw-pitch directions and view-extent scaling. */
+[[nodiscard]] float interactionSin(float x) noexcept;
+[[nodiscard]] float interactionCos(float x) noexcept;
+[[nodiscard]] float interactionTan(float x) noexcept;
+
+/** Inverse trigonometry for reading angles back from a camera pose or quaternion. */
+[[nodiscard]] float interactionAtan(float x) noexcept;
+[[nodiscard]] float interactionAtan2(float y, float x) noexcept;
+[[nodiscard]] float interactionAsin(float x) noexcept;
+[[nodiscard]] float interactionAcos(float x) noexcept;
+
+/** Exponential approach of @p current toward @p target with time constant @p smoothing_time (vne::math::damp). */
+[[nodiscard]] float interactionDamp(float current, float target, float smoothing_time, float dt) noexcept;
+
+/** Rotation of @p angle_rad about unit @p axis (Quatf::fromAxisAngle). */
+[[nodiscard]] vne::math::Quatf quatFromAxisAngle(const vne::math::Vec3f& axis, float angle_rad) noexcept;
+
+/** Unit quaternion (Quatf::normalized); fixed summation order in deterministic mode. */
+[[nodiscard]] vne::math::Quatf normalizeQuat(const vne::math::Quatf& q) noexcept;
+
+/** Shortest-arc spherical interpolation from @p a to @p b (Quatf::slerp). */
+[[nodiscard]] vne::math::Quatf slerpQuat(const vne::math::Quatf& a, const vne::math::Quatf& b, float t) noexcept;
+
 // -----------------------------------------------------------------------------
 // Trackball quaternion — defined in interaction_utils.cpp
 // -----------------------------------------------------------------------------
@@ -120,6 +167,27 @@ inline void buildReferenceFrame(const vne::math::Vec3f& world_up,
  */
 [[nodiscard]] vne::math::Quatf scaleTrackballQuaternion(vne::math::Quatf q, float scale) noexcept;
 
+/**
+ * @brief Rotation vector (axis × angle in radians) of unit quaternion @a q, shortest arc.
+ */
+[[nodiscard]] vne::math::Vec3f quatToRotationVector(const vne::math::Quatf& q) noexcept;
+
+/**
+ * @brief Unit quaternion rotating by |@a v| radians about @a v; identity for a near-zero vector.
+ */
+[[nodiscard]] vne::math::Quatf quatFromRotationVector(const vne::math::Vec3f& v) noexcept;
+
+/**
+ * @brief Frame-rate independent EMA update of an angular velocity (rad/s, world axis) from two orientation
+ * samples @a dt seconds apart. Leaves @a velocity unchanged when @a dt is not a usable sample interval.
+ * @param blend_rate EMA rate in 1/s (higher follows samples more tightly)
+ */
+void updateAngularVelocity(vne::math::Vec3f& velocity,
+                           const vne::math::Quatf& prev,
+                           const vne::math::Quatf& curr,
+                           double dt,
+                           float blend_rate) noexcept;
+
 // -----------------------------------------------------------------------------
 // worldUnderCursorOrtho — inline
 // -----------------------------------------------------------------------------
@@ -179,6 +247,11 @@ inline void buildReferenceFrame(const vne::math::Vec3f& world_up,
 // World-space camera math — defined in interaction_utils.cpp
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief Inverse of a view-projection matrix, or identity when the inverse is not finite (degenerate camera).
+ */
+[[nodiscard]] vne::math::Mat4f safeInverseViewProjection(const vne::math::Mat4f& vp) noexcept;
+
 /**
  * @brief API-aware unproject from mouse coords (mouse -> API screen -> unproject).
  */
@@ -212,4 +285,82 @@ inline void buildReferenceFrame(const vne::math::Vec3f& world_up,
                                                      const vne::math::Vec3f& right,
                                                      const vne::math::Vec3f& up) noexcept;
 
+// -----------------------------------------------------------------------------
+// Camera pose snapshots — defined in interaction_utils.cpp
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Read eye, orientation, target and lens extent (FOV or ortho width/height) from @a camera.
+ */
+[[nodiscard]] CameraPoseSnapshot captureCameraPose(const vne::scene::ICamera& camera) noexcept;
+
+/**
+ * @brief Write @a pose to @a camera via lookAt (plus FOV / symmetric ortho bounds when non-zero) and
+ * refresh matrices unless @a update_matrices is false. Lens fields that do not match the camera type are ignored.
+ */
+void applyCameraPose(vne::scene::ICamera& camera, const CameraPoseSnapshot& pose, bool update_matrices = true) noexcept;
+
+/**
+ * @brief Interpolate two poses: lerp eye, slerp orientation, lerp target distance along the blended view
+ * direction, lerp lens extents when both poses carry them.
+ * @param t Blend factor in [0, 1] (0 = @a from, 1 = @a to)
+ */
+[[nodiscard]] CameraPoseSnapshot blendCameraPose(const CameraPoseSnapshot& from,
+                                                 const CameraPoseSnapshot& to,
+                                                 float t) noexcept;
+
+/**
+ * @brief true when eye, target, orientation (either quaternion sign) and lens extents all agree within
+ * @a epsilon.
+ */
+[[nodiscard]] bool cameraPosesMatch(const CameraPoseSnapshot& a,
+                                    const CameraPoseSnapshot& b,
+                                    float epsilon = 1e-5f) noexcept;
+
+// -----------------------------------------------------------------------------
+// Fit helpers — defined in interaction_utils.cpp
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Orthonormal right / up / forward axes of @a camera's current view (right = forward × up).
+ */
+void cameraViewAxes(const vne::scene::ICamera& camera,
+                    vne::math::Vec3f& right,
+                    vne::math::Vec3f& up,
+                    vne::math::Vec3f& forward) noexcept;
+
+// -----------------------------------------------------------------------------
+// Motion state and prediction helpers — defined in interaction_utils.cpp
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Seconds until a speed decaying as e^(-damping * t) drops to @a threshold (0 when already below it or
+ * when @a damping is not positive).
+ */
+[[nodiscard]] float decaySettleTime(float speed, float damping, float threshold) noexcept;
+
+/** @brief @a seconds as a float look-ahead: 0 when not finite or not positive. */
+[[nodiscard]] float lookaheadSeconds(double seconds) noexcept;
+
+/**
+ * @brief Distance covered over @a t seconds by a unit speed decaying as e^(-damping * t), i.e.
+ * (1 - e^(-damping * t)) / damping; @a t itself when @a damping is near zero, 0 when @a t is not positive.
+ */
+[[nodiscard]] float decayTravelTime(float t, float damping) noexcept;
+
+/**
+ * @brief Rotate @a pose rigidly by @a rotation about @a pivot (eye, target and orientation; lens unchanged).
+ */
+void rotateCameraPose(CameraPoseSnapshot& pose,
+                      const vne::math::Quatf& rotation,
+                      const vne::math::Vec3f& pivot) noexcept;
+
+/**
+ * @brief Apply the motion from @a from to @a to onto @a pose: the rotation between the two orientations, the
+ * eye and target displacements, and the FOV / ortho extent ratios. @a pose equal to @a from yields @a to.
+ */
+[[nodiscard]] CameraPoseSnapshot transferCameraMotion(const CameraPoseSnapshot& pose,
+                                                      const CameraPoseSnapshot& from,
+                                                      const CameraPoseSnapshot& to) noexcept;
+
 }  // namespace vne::interaction
@@ -15,6 +15,7 @@
 #include "vertexnova/interaction/free_look_manipulator.h"
 
 #include "camera_controller_impl.h"
+#include "detail/state_codec.h"
 #include "vertexnova/events/key_event.h"
 
 #include <vertexnova/logging/logging.h>
@@ -154,6 +155,35 @@ void Navigation3DController::onUpdate(double dt) noexcept {
     impl_->core_.onUpdate(dt);
 }
 
+void Navigation3DController::beginTransition(const CameraPoseSnapshot& from, float duration_s) noexcept {
+    impl_->core_.rig.beginTransition(from, duration_s);
+}
+
+void Navigation3DController::setFixedTimestep(double step_s) noexcept {
+    impl_->core_.rig.setFixedTimestep(step_s);
+}
+
+void Navigation3DController::setMatrixUpdatesDeferred(bool deferred) noexcept {
+    impl_->core_.rig.setMatrixUpdatesDeferred(deferred);
+}
+
+CameraMotionState Navigation3DController::getMotionState() const noexcept {
+    return impl_->core_.rig.getMotionState();
+}
+
+CameraPoseSnapshot Navigation3DController::predictPose(double seconds_ahead) const noexcept {
+    return impl_->core_.rig.predictPose(seconds_ahead);
+}
+
+std::size_t Navigation3DController::predictPoses(std::span<const double> seconds_ahead,
+                                                 std::span<CameraPoseSnapshot> out) const noexcept {
+    return impl_->core_.rig.predictPoses(seconds_ahead, out);
+}
+
+void Navigation3DController::setCameraConstraint(std::shared_ptr<CameraConstraint> constraint) noexcept {
+    impl_->core_.rig.setCameraConstraint(std::move(constraint));
+}
+
 // ---------------------------------------------------------------------------
 // Mode
 // ---------------------------------------------------------------------------
@@ -308,7 +338,9 @@ void Navigation3DController::setMoveSpeedMax(float max_speed) noexcept {
 
 void Navigation3DController::fitToAABB(const vne::math::Vec3f& mn, const vne::math::Vec3f& mx) noexcept {
     if (impl_->free_look_) {
+        impl_->core_.commitHistory();
         impl_->free_look_->fitToAABB(mn, mx);
+        impl_->core_.beginHistorySettle();
     }
 }
 
@@ -316,6 +348,126 @@ void Navigation3DController::reset() noexcept {
     impl_->core_.resetRigAndInteraction();
 }
 
+// ---------------------------------------------------------------------------
+// Undo / redo
+// ---------------------------------------------------------------------------
+
+bool Navigation3DController::undo(float duration_s) noexcept {
+    return impl_->core_.undo(duration_s);
+}
+
+bool Navigation3DController::redo(float duration_s) noexcept {
+    return impl_->core_.redo(duration_s);
+}
+
+CameraHistory& Navigation3DController::cameraHistory() noexcept {
+    return impl_->core_.history;
+}
+
+// ---------------------------------------------------------------------------
+// State serialization
+// ---------------------------------------------------------------------------
+
+std::vector<std::uint8_t> Navigation3DController::serialize() const {
+    detail::StateWriter out(detail::StateBlobKind::eNavigation3DController);
+    out.enumU8(impl_->mode_);
+    out.flags({impl_->look_enabled_, impl_->move_enabled_, impl_->zoom_enabled_});
+    out.keyBinding(impl_->move_forward_);
+    out.keyBinding(impl_->move_backward_);
+    out.keyBinding(impl_->move_left_);
+    out.keyBinding(impl_->move_right_);
+    out.keyBinding(impl_->move_up_);
+    out.keyBinding(impl_->move_down_);
+    out.keyCode(impl_->speed_boost_key_);
+    out.keyCode(impl_->slow_key_);
+    out.mouseBinding(impl_->look_bind_);
+    out.modifier(impl_->zoom_scroll_modifier_);
+    out.keyCode(impl_->increase_move_speed_key_);
+    out.keyCode(impl_->decrease_move_speed_key_);
+    out.f32(impl_->move_speed_step_);
+    out.f32(impl_->move_speed_min_);
+    out.f32(impl_->move_speed_max_);
+    out.rules(impl_->core_.mapper.rules());
+    out.blob(impl_->free_look_ ? impl_->free_look_->serialize() : std::vector<std::uint8_t>{});
+    return out.take();
+}
+
+bool Navigation3DController::deserialize(const std::uint8_t* data, std::size_t size) noexcept {
+    detail::StateReader in(data, size, detail::StateBlobKind::eNavigation3DController);
+    FreeLookMode mode = FreeLookMode::eFps;
+    bool look_enabled = true;
+    bool move_enabled = true;
+    bool zoom_enabled = true;
+    KeyBinding move_keys[6];
+    events::KeyCode speed_boost_key = events::KeyCode::eUnknown;
+    events::KeyCode slow_key = events::KeyCode::eUnknown;
+    MouseBinding look_bind;
+    events::ModifierKey zoom_scroll_modifier = events::ModifierKey::eModNone;
+    events::KeyCode increase_key = events::KeyCode::eUnknown;
+    events::KeyCode decrease_key = events::KeyCode::eUnknown;
+    float speed_step = 0.0f;
+    float speed_min = 0.0f;
+    float speed_max = 0.0f;
+    std::vector<InputRule> rules;
+    const std::uint8_t* free_look_blob = nullptr;
+    std::size_t free_look_blob_size = 0;
+
+    in.enumU8(mode, FreeLookMode::eFly);
+    in.flags({&look_enabled, &move_enabled, &zoom_enabled});
+    for (KeyBinding& key : move_keys) {
+        in.keyBinding(key);
+    }
+    in.keyCode(speed_boost_key);
+    in.keyCode(slow_key);
+    in.mouseBinding(look_bind);
+    in.modifier(zoom_scroll_modifier);
+    in.keyCode(increase_key);
+    in.keyCode(decrease_key);
+    in.f32(speed_step);
+    in.f32(speed_min);
+    in.f32(speed_max);
+    in.rules(rules);
+    in.blob(free_look_blob, free_look_blob_size);
+    if (!in.ok()) {
+        VNE_LOG_WARN << "Navigation3DController: deserialize rejected a truncated, corrupt or incompatible state blob";
+        return false;
+    }
+
+    // A running blend would write its old target over the restored pose
+    impl_->core_.rig.cancelTransition();
+    if (impl_->free_look_ && !impl_->free_look_->deserialize(free_look_blob, free_look_blob_size)) {
+        return false;
+    }
+
+    impl_->mode_ = mode;
+    impl_->look_enabled_ = look_enabled;
+    impl_->move_enabled_ = move_enabled;
+    impl_->zoom_enabled_ = zoom_enabled;
+    impl_->move_forward_ = move_keys[0];
+    impl_->move_backward_ = move_keys[1];
+    impl_->move_left_ = move_keys[2];
+    impl_->move_right_ = move_keys[3];
+    impl_->move_up_ = move_keys[4];
+    impl_->move_down_ = move_keys[5];
+    impl_->speed_boost_key_ = speed_boost_key;
+    impl_->slow_key_ = slow_key;
+    impl_->look_bind_ = look_bind;
+    impl_->zoom_scroll_modifier_ = zoom_scroll_modifier;
+    impl_->increase_move_speed_key_ = increase_key;
+    impl_->decrease_move_speed_key_ = decrease_key;
+    impl_->move_speed_step_ = std::max(kMoveSpeedStepFloor, speed_step);
+    impl_->move_speed_min_ = std::max(kMoveSpeedStepFloor, speed_min);
+    impl_->move_speed_max_ = std::max(impl_->move_speed_min_, speed_max);
+
+    impl_->core_.resetInteraction();
+    rebuild();
+    if (!detail::sameInputRules(rules, impl_->core_.mapper.rules())) {
+        impl_->core_.mapper.setRules(rules);  // table was customised through inputMapper()
+    }
+    impl_->core_.resetHistory();
+    return true;
+}
+
 // ---------------------------------------------------------------------------
 // Escape hatches
 // ---------------------------------------------------------------------------
@@ -485,7 +637,7 @@ void Navigation3DController::rebuild() noexcept {
                 }
                 return;
             }
-            impl->core_.rig.onAction(a, p, dt);
+            impl->core_.dispatchAction(a, p, dt);
             // fpsPreset() does not emit orbit gestures (eBeginRotate / eBeginPan). Scroll and touch pinch map to
             // eZoomAtCursor; after zoom/dolly the camera pose changes—mark yaw/pitch stale so FreeLook's next
             // ensureAnglesSynced (update / movement / look) matches the rig.
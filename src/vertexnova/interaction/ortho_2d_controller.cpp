@@ -15,6 +15,7 @@
 #include "vertexnova/interaction/ortho_2d_manipulator.h"
 
 #include "camera_controller_impl.h"
+#include "detail/state_codec.h"
 
 #include <vertexnova/events/key_event.h>
 #include <vertexnova/logging/logging.h>
@@ -75,7 +76,7 @@ Ortho2DController::Ortho2DController()
     // Capture raw Impl* so the callback stays valid across moves.
     impl_->core_.mapper.setActionCallback([impl = impl_.get()](CameraActionType a,
                                                                const CameraCommandPayload& p,
-                                                               double dt) { impl->core_.rig.onAction(a, p, dt); });
+                                                               double dt) { impl->core_.dispatchAction(a, p, dt); });
 
     rebuildRules();
 }
@@ -126,6 +127,31 @@ void Ortho2DController::onUpdate(double dt) noexcept {
     impl_->core_.onUpdate(dt);
 }
 
+void Ortho2DController::beginTransition(const CameraPoseSnapshot& from, float duration_s) noexcept {
+    impl_->core_.rig.beginTransition(from, duration_s);
+}
+
+void Ortho2DController::setFixedTimestep(double step_s) noexcept {
+    impl_->core_.rig.setFixedTimestep(step_s);
+}
+
+void Ortho2DController::setMatrixUpdatesDeferred(bool deferred) noexcept {
+    impl_->core_.rig.setMatrixUpdatesDeferred(deferred);
+}
+
+CameraMotionState Ortho2DController::getMotionState() const noexcept {
+    return impl_->core_.rig.getMotionState();
+}
+
+CameraPoseSnapshot Ortho2DController::predictPose(double seconds_ahead) const noexcept {
+    return impl_->core_.rig.predictPose(seconds_ahead);
+}
+
+std::size_t Ortho2DController::predictPoses(std::span<const double> seconds_ahead,
+                                            std::span<CameraPoseSnapshot> out) const noexcept {
+    return impl_->core_.rig.predictPoses(seconds_ahead, out);
+}
+
 // ---------------------------------------------------------------------------
 // DOF
 // ---------------------------------------------------------------------------
@@ -258,7 +284,9 @@ void Ortho2DController::setViewDirection(ViewDirection dir) noexcept {
         }
     }
     camera->lookAt(new_pos, target, up);
-    camera->updateMatrices();
+    if (!impl_->core_.rig.isMatrixUpdatesDeferred()) {
+        camera->updateMatrices();
+    }
     if (impl_->ortho2d_behavior_) {
         impl_->ortho2d_behavior_->resetState();
     }
@@ -268,9 +296,15 @@ float Ortho2DController::getWorldUnitsPerPixel() const noexcept {
     return impl_->ortho2d_behavior_ ? impl_->ortho2d_behavior_->getWorldUnitsPerPixel() : 0.0f;
 }
 
+VisibleRegion Ortho2DController::getVisibleRegion(double lookahead_s) const noexcept {
+    return impl_->ortho2d_behavior_ ? impl_->ortho2d_behavior_->getVisibleRegion(lookahead_s) : VisibleRegion{};
+}
+
 void Ortho2DController::fitToAABB(const vne::math::Vec3f& mn, const vne::math::Vec3f& mx) noexcept {
     if (impl_->ortho2d_behavior_) {
+        impl_->core_.commitHistory();
         impl_->ortho2d_behavior_->fitToAABB(mn, mx);
+        impl_->core_.beginHistorySettle();
     }
 }
 
@@ -278,6 +312,82 @@ void Ortho2DController::reset() noexcept {
     impl_->core_.resetRigAndInteraction();
 }
 
+// ---------------------------------------------------------------------------
+// Undo / redo
+// ---------------------------------------------------------------------------
+
+bool Ortho2DController::undo(float duration_s) noexcept {
+    return impl_->core_.undo(duration_s);
+}
+
+bool Ortho2DController::redo(float duration_s) noexcept {
+    return impl_->core_.redo(duration_s);
+}
+
+CameraHistory& Ortho2DController::cameraHistory() noexcept {
+    return impl_->core_.history;
+}
+
+// ---------------------------------------------------------------------------
+// State serialization
+// ---------------------------------------------------------------------------
+
+std::vector<std::uint8_t> Ortho2DController::serialize() const {
+    detail::StateWriter out(detail::StateBlobKind::eOrtho2DController);
+    out.flags({impl_->rotation_enabled_, impl_->pan_enabled_, impl_->zoom_enabled_});
+    out.mouseBinding(impl_->pan_binding_);
+    out.mouseBinding(impl_->rotate_binding_);
+    out.modifier(impl_->zoom_scroll_modifier_);
+    out.rules(impl_->core_.mapper.rules());
+    out.blob(impl_->ortho2d_behavior_ ? impl_->ortho2d_behavior_->serialize() : std::vector<std::uint8_t>{});
+    return out.take();
+}
+
+bool Ortho2DController::deserialize(const std::uint8_t* data, std::size_t size) noexcept {
+    detail::StateReader in(data, size, detail::StateBlobKind::eOrtho2DController);
+    bool rotation_enabled = false;
+    bool pan_enabled = true;
+    bool zoom_enabled = true;
+    MouseBinding pan_binding;
+    MouseBinding rotate_binding;
+    events::ModifierKey zoom_scroll_modifier = events::ModifierKey::eModNone;
+    std::vector<InputRule> rules;
+    const std::uint8_t* behavior_blob = nullptr;
+    std::size_t behavior_blob_size = 0;
+
+    in.flags({&rotation_enabled, &pan_enabled, &zoom_enabled});
+    in.mouseBinding(pan_binding);
+    in.mouseBinding(rotate_binding);
+    in.modifier(zoom_scroll_modifier);
+    in.rules(rules);
+    in.blob(behavior_blob, behavior_blob_size);
+    if (!in.ok()) {
+        VNE_LOG_WARN << "Ortho2DController: deserialize rejected a truncated, corrupt or incompatible state blob";
+        return false;
+    }
+
+    // A running blend would write its old target over the restored pose
+    impl_->core_.rig.cancelTransition();
+    if (impl_->ortho2d_behavior_ && !impl_->ortho2d_behavior_->deserialize(behavior_blob, behavior_blob_size)) {
+        return false;
+    }
+
+    impl_->rotation_enabled_ = rotation_enabled;
+    impl_->pan_enabled_ = pan_enabled;
+    impl_->zoom_enabled_ = zoom_enabled;
+    impl_->pan_binding_ = pan_binding;
+    impl_->rotate_binding_ = rotate_binding;
+    impl_->zoom_scroll_modifier_ = zoom_scroll_modifier;
+
+    impl_->core_.resetInteraction();
+    rebuildRules();
+    if (!detail::sameInputRules(rules, impl_->core_.mapper.rules())) {
+        impl_->core_.mapper.setRules(rules);  // table was customised through inputMapper()
+    }
+    impl_->core_.resetHistory();
+    return true;
+}
+
 // ---------------------------------------------------------------------------
 // Escape hatches
 // ---------------------------------------------------------------------------
@@ -10,6 +10,8 @@
  */
 
 #include "vertexnova/interaction/ortho_2d_manipulator.h"
+#include "detail/state_codec.h"
+#include "interaction_utils.h"
 
 #include "vertexnova/scene/camera/camera.h"
 #include "vertexnova/scene/camera/orthographic_camera.h"
@@ -102,11 +104,12 @@ void Ortho2DManipulator::pan(float delta_x_px, float delta_y_px, double delta_ti
 
     ortho->setPosition(eye + delta_world);
     ortho->setTarget(target + delta_world);
-    ortho->updateMatrices();
+    updateCameraMatrices(*ortho);
 
-    if (pan_inertia_enabled_ && delta_time > 0.0) {
+    // Tracked with inertia off too: getVisibleRegion extrapolates the drag
+    if (delta_time > 0.0) {
         const vne::math::Vec3f sample = delta_world / static_cast<float>(delta_time);
-        const float blend = 1.0f - std::exp(-kPanVelocityBlendRate * static_cast<float>(delta_time));
+        const float blend = 1.0f - interactionExp(-kPanVelocityBlendRate * static_cast<float>(delta_time));
         pan_velocity_ = pan_velocity_ + (sample - pan_velocity_) * blend;
     }
 }
@@ -115,7 +118,7 @@ void Ortho2DManipulator::pan(float delta_x_px, float delta_y_px, double delta_ti
 // In-plane rotation (slice spin about view axis through target)
 // ---------------------------------------------------------------------------
 
-void Ortho2DManipulator::rotateInPlane(float delta_x_px, float /*delta_y_px*/) noexcept {
+void Ortho2DManipulator::rotateInPlane(float delta_x_px, float /*delta_y_px*/, double delta_time) noexcept {
     auto ortho = orthoCamera();
     if (!ortho) {
         VNE_LOG_WARN << "Ortho2DManipulator: rotateInPlane called without orthographic camera";
@@ -127,6 +130,11 @@ void Ortho2DManipulator::rotateInPlane(float delta_x_px, float /*delta_y_px*/) n
                       << ", rotation_deg_per_px=" << rotation_deg_per_px_ << ")";
         return;
     }
+    if (delta_time > 0.0) {
+        const float sample = angle_rad / static_cast<float>(delta_time);
+        const float blend = 1.0f - interactionExp(-kPanVelocityBlendRate * static_cast<float>(delta_time));
+        rotate_velocity_ += (sample - rotate_velocity_) * blend;
+    }
     if (std::abs(angle_rad) < kMinRotationAngleRad) {
         return;
     }
@@ -143,13 +151,13 @@ void Ortho2DManipulator::rotateInPlane(float delta_x_px, float /*delta_y_px*/) n
 
     vne::math::Vec3f offset = eye - target;
     vne::math::Vec3f up = ortho->getUp().normalized();
-    const vne::math::Quatf q = vne::math::Quatf::fromAxisAngle(axis, angle_rad);
+    const vne::math::Quatf q = quatFromAxisAngle(axis, angle_rad);
     offset = q.rotate(offset);
     up = q.rotate(up).normalized();
 
     const vne::math::Vec3f new_position = target + offset;
     ortho->lookAt(new_position, target, up);
-    ortho->updateMatrices();
+    updateCameraMatrices(*ortho);
 }
 
 // ---------------------------------------------------------------------------
@@ -158,6 +166,7 @@ void Ortho2DManipulator::rotateInPlane(float delta_x_px, float /*delta_y_px*/) n
 
 void Ortho2DManipulator::applyInertia(double delta_time) noexcept {
     if (!pan_inertia_enabled_) {
+        pan_velocity_ = vne::math::Vec3f(0.0f, 0.0f, 0.0f);  // drag velocity only; nothing coasts
         return;
     }
     auto ortho = orthoCamera();
@@ -180,12 +189,12 @@ void Ortho2DManipulator::applyInertia(double delta_time) noexcept {
     const vne::math::Vec3f delta = pan_velocity_ * dt;
     ortho->setPosition(ortho->getPosition() + delta);
     ortho->setTarget(ortho->getTarget() + delta);
-    ortho->updateMatrices();
-    pan_velocity_ *= std::exp(-pan_damping_ * dt);
+    updateCameraMatrices(*ortho);
+    pan_velocity_ *= interactionExp(-pan_damping_ * dt);
 }
 
 // ---------------------------------------------------------------------------
-// fitToAABB / getWorldUnitsPerPixel / resetState
+// fitToAABB / fitToPoints / fitToBoxes / getWorldUnitsPerPixel / resetState
 // ---------------------------------------------------------------------------
 
 void Ortho2DManipulator::fitToAABB(const vne::math::Vec3f& min_world, const vne::math::Vec3f& max_world) noexcept {
@@ -217,16 +226,56 @@ void Ortho2DManipulator::fitToAABB(const vne::math::Vec3f& min_world, const vne:
         max_world,
     };
 
-    float max_r = 0.0f;
-    float max_u = 0.0f;
+    FitVolume volume;
+    volume.center = center;
     for (const auto& c : corners) {
         const vne::math::Vec3f d = c - center;
-        max_r = std::max(max_r, std::abs(d.dot(r)));
-        max_u = std::max(max_u, std::abs(d.dot(up)));
+        volume.half_right = std::max(volume.half_right, std::abs(d.dot(r)));
+        volume.half_up = std::max(volume.half_up, std::abs(d.dot(up)));
     }
+    fitToVolume(volume);
+}
 
-    max_r = std::max(max_r * kFitToAabbMargin, kMinOrthoExtent);
-    max_u = std::max(max_u * kFitToAabbMargin, kMinOrthoExtent);
+void Ortho2DManipulator::fitToPoints(std::span<const vne::math::Vec3f> points,
+                                     FitBoundsMode mode,
+                                     const ControllerExecutor& executor) noexcept {
+    fitToSet(points, mode, executor);
+}
+
+void Ortho2DManipulator::fitToBoxes(std::span<const BoundingBox> boxes,
+                                    FitBoundsMode mode,
+                                    const ControllerExecutor& executor) noexcept {
+    fitToSet(boxes, mode, executor);
+}
+
+template <typename T>
+void Ortho2DManipulator::fitToSet(std::span<const T> items,
+                                  FitBoundsMode mode,
+                                  const ControllerExecutor& executor) noexcept {
+    auto ortho = orthoCamera();
+    if (!ortho) {
+        VNE_LOG_WARN << "Ortho2DManipulator: fit called without orthographic camera";
+        return;
+    }
+    vne::math::Vec3f r;
+    vne::math::Vec3f u;
+    vne::math::Vec3f f;
+    cameraViewAxes(*ortho, r, u, f);
+    FitVolume volume;
+    if (!computeFitVolume(items, r, u, f, mode, volume, executor)) {
+        VNE_LOG_WARN << "Ortho2DManipulator: fit called without finite input";
+        return;
+    }
+    fitToVolume(volume);
+}
+
+void Ortho2DManipulator::fitToVolume(const FitVolume& volume) noexcept {
+    auto ortho = orthoCamera();
+    if (!ortho) {
+        return;
+    }
+    float max_r = std::max(volume.half_right * kFitToAabbMargin, kMinOrthoExtent);
+    float max_u = std::max(volume.half_up * kFitToAabbMargin, kMinOrthoExtent);
 
     const float aspect = viewport().width / viewport().height;
     if (max_r / max_u < aspect) {
@@ -235,11 +284,11 @@ void Ortho2DManipulator::fitToAABB(const vne::math::Vec3f& min_world, const vne:
         max_u = max_r / aspect;
     }
 
-    const vne::math::Vec3f eye_offset = eye - target;
+    const vne::math::Vec3f eye_offset = ortho->getPosition() - ortho->getTarget();
     ortho->setBounds(-max_r, max_r, -max_u, max_u, ortho->getNearPlane(), ortho->getFarPlane());
-    ortho->setTarget(center);
-    ortho->setPosition(center + eye_offset);
-    ortho->updateMatrices();
+    ortho->setTarget(volume.center);
+    ortho->setPosition(volume.center + eye_offset);
+    updateCameraMatrices(*ortho);
 }
 
 float Ortho2DManipulator::getWorldUnitsPerPixel() const noexcept {
@@ -251,6 +300,118 @@ void Ortho2DManipulator::resetState() noexcept {
     panning_ = false;
     rotating_ = false;
     pan_velocity_ = vne::math::Vec3f(0.0f, 0.0f, 0.0f);
+    rotate_velocity_ = 0.0f;
+    clearZoomRate();
+}
+
+// ---------------------------------------------------------------------------
+// Visible region
+// ---------------------------------------------------------------------------
+
+vne::math::Vec3f VisibleRegion::corner(int index) const noexcept {
+    const float sx = (index == 1 || index == 2) ? 1.0f : -1.0f;
+    const float sy = (index >= 2) ? 1.0f : -1.0f;
+    return center + axis_x * (sx * half_width) + axis_y * (sy * half_height);
+}
+
+int VisibleRegion::pyramidLevel(float level0_units_per_pixel, int max_level) const noexcept {
+    if (!valid || !(level0_units_per_pixel > 0.0f) || !(world_units_per_pixel > 0.0f) || max_level <= 0) {
+        return 0;
+    }
+    const float level = std::floor(std::log2(world_units_per_pixel / level0_units_per_pixel));
+    if (!std::isfinite(level) || level <= 0.0f) {
+        return 0;
+    }
+    return level >= static_cast<float>(max_level) ? max_level : static_cast<int>(level);
+}
+
+vne::math::Vec3f Ortho2DManipulator::predictedPan(float lookahead_s) const noexcept {
+    if (!(lookahead_s > 0.0f) || rotating_) {
+        return vne::math::Vec3f(0.0f, 0.0f, 0.0f);
+    }
+    if (panning_) {
+        return pan_velocity_ * lookahead_s;
+    }
+    if (!pan_inertia_enabled_ || pan_velocity_.length() < kPanVelocityThreshold) {
+        return vne::math::Vec3f(0.0f, 0.0f, 0.0f);
+    }
+    // Integral of v * e^(-damping * t) over the lookahead (what applyInertia steps towards)
+    return pan_velocity_ * decayTravelTime(lookahead_s, pan_damping_);
+}
+
+VisibleRegion Ortho2DManipulator::getVisibleRegion(double lookahead_s) const noexcept {
+    VisibleRegion region;
+    auto ortho = orthoCamera();
+    if (!ortho || !(viewport().height > 0.0f)) {
+        return region;
+    }
+    vne::math::Vec3f forward;
+    cameraViewAxes(*ortho, region.axis_x, region.axis_y, forward);
+    region.half_width = 0.5f * ortho->getWidth();
+    region.half_height = 0.5f * ortho->getHeight();
+    region.world_units_per_pixel = ortho->getHeight() / viewport().height;
+    const float lookahead = std::isfinite(lookahead_s) ? static_cast<float>(lookahead_s) : 0.0f;
+    region.center = ortho->getTarget() + predictedPan(lookahead);
+
+    // Half extents of the rotated rectangle on each world axis: |axis_x| * hw + |axis_y| * hh
+    const vne::math::Vec3f& ax = region.axis_x;
+    const vne::math::Vec3f& ay = region.axis_y;
+    const vne::math::Vec3f reach(std::abs(ax.x()) * region.half_width + std::abs(ay.x()) * region.half_height,
+                                 std::abs(ax.y()) * region.half_width + std::abs(ay.y()) * region.half_height,
+                                 std::abs(ax.z()) * region.half_width + std::abs(ay.z()) * region.half_height);
+    region.bounds_min = region.center - reach;
+    region.bounds_max = region.center + reach;
+    region.valid = true;
+    return region;
+}
+
+// ---------------------------------------------------------------------------
+// Motion state
+// ---------------------------------------------------------------------------
+
+CameraMotionState Ortho2DManipulator::getMotionState() const noexcept {
+    CameraMotionState state;
+    if (!enabled_ || !camera_) {
+        return state;
+    }
+    state.zoom_rate = zoomRate();
+    state.dragging = panning_ || rotating_;
+    if (rotating_) {
+        state.angular_speed = std::abs(rotate_velocity_);
+    }
+    const float pan_speed = pan_velocity_.length();
+    const bool glides = pan_inertia_enabled_ && pan_speed >= kPanVelocityThreshold;
+    if (panning_ || (!state.dragging && glides)) {
+        state.linear_speed = pan_speed;
+    }
+    state.inertia = !state.dragging && glides;
+    if (glides) {
+        state.settle_time_s = decaySettleTime(pan_speed, pan_damping_, kPanVelocityThreshold);
+    }
+    return state;
+}
+
+CameraPoseSnapshot Ortho2DManipulator::predictPose(double seconds_ahead) const noexcept {
+    if (!camera_) {
+        return {};
+    }
+    CameraPoseSnapshot pose = captureCameraPose(*camera_);
+    const float ahead = lookaheadSeconds(seconds_ahead);
+    if (!enabled_ || ahead <= 0.0f) {
+        return pose;
+    }
+    if (rotating_) {
+        // Same sense as rotateInPlane: about the view axis through the target
+        vne::math::Vec3f axis = pose.target - pose.position;
+        const float axis_len = axis.length();
+        if (axis_len >= kEpsilon) {
+            rotateCameraPose(pose, quatFromAxisAngle(axis / axis_len, rotate_velocity_ * ahead), pose.target);
+        }
+    }
+    const vne::math::Vec3f pan = predictedPan(ahead);
+    pose.position += pan;
+    pose.target += pan;
+    return pose;
 }
 
 // ---------------------------------------------------------------------------
@@ -261,6 +422,7 @@ void Ortho2DManipulator::onUpdate(double delta_time) noexcept {
     if (!enabled_ || !camera_) {
         return;
     }
+    updateZoomRate(delta_time);
     if (!panning_ && !rotating_) {
         applyInertia(delta_time);
     }
@@ -315,6 +477,7 @@ bool Ortho2DManipulator::onAction(CameraActionType action,
                 return false;
             }
             rotating_ = true;
+            rotate_velocity_ = 0.0f;
             pan_velocity_ = vne::math::Vec3f(0.0f, 0.0f, 0.0f);
             return true;
 
@@ -322,7 +485,7 @@ bool Ortho2DManipulator::onAction(CameraActionType action,
             if (!rotate_enabled_) {
                 return false;
             }
-            rotateInPlane(payload.delta_x_px, payload.delta_y_px);
+            rotateInPlane(payload.delta_x_px, payload.delta_y_px, delta_time);
             return true;
 
         case CameraActionType::eEndRotate:
@@ -332,7 +495,7 @@ bool Ortho2DManipulator::onAction(CameraActionType action,
 
         case CameraActionType::eZoomAtCursor:
             if (payload.zoom_factor > 0.0f && payload.zoom_factor != 1.0f && std::isfinite(payload.zoom_factor)) {
-                const float effective_factor = std::pow(payload.zoom_factor, zoom_speed_);
+                const float effective_factor = interactionPow(payload.zoom_factor, zoom_speed_);
                 if (!std::isfinite(effective_factor) || effective_factor <= 0.0f) {
                     return false;
                 }
@@ -351,4 +514,72 @@ bool Ortho2DManipulator::onAction(CameraActionType action,
     }
 }
 
+// ---------------------------------------------------------------------------
+// State serialization
+// ---------------------------------------------------------------------------
+
+std::vector<std::uint8_t> Ortho2DManipulator::serialize() const {
+    detail::StateWriter out(detail::StateBlobKind::eOrtho2DManipulator);
+    out.flags({enabled_, pan_inertia_enabled_, rotate_enabled_, pan_enabled_, static_cast<bool>(camera_)});
+    out.enumU8(zoom_method_);
+    out.f32(fov_zoom_speed_);
+    out.f32(zoom_speed_);
+    out.f32(pan_damping_);
+    out.f32(rotation_deg_per_px_);
+    if (camera_) {
+        out.pose(captureCameraPose(*camera_));
+        out.f32(zoom_scale_);
+    }
+    return out.take();
+}
+
+bool Ortho2DManipulator::deserialize(const std::uint8_t* data, std::size_t size) noexcept {
+    detail::StateReader in(data, size, detail::StateBlobKind::eOrtho2DManipulator);
+    bool enabled = true;
+    bool pan_inertia = true;
+    bool rotate_enabled = true;
+    bool pan_enabled = true;
+    bool has_pose = false;
+    ZoomMethod zoom_method = ZoomMethod::eSceneScale;
+    float fov_zoom_speed = 0.0f;
+    float zoom_speed = 0.0f;
+    float pan_damping = 0.0f;
+    float rotation_deg_per_px = 0.0f;
+    CameraPoseSnapshot pose;
+    float scene_scale = 1.0f;
+
+    in.flags({&enabled, &pan_inertia, &rotate_enabled, &pan_enabled, &has_pose});
+    in.enumU8(zoom_method, ZoomMethod::eDollyToCoi);
+    in.f32(fov_zoom_speed);
+    in.f32(zoom_speed);
+    in.f32(pan_damping);
+    in.f32(rotation_deg_per_px);
+    if (has_pose) {
+        in.pose(pose);
+        in.f32(scene_scale);
+    }
+    if (!in.ok()) {
+        VNE_LOG_WARN << "Ortho2DManipulator: deserialize rejected a truncated, corrupt or incompatible state blob";
+        return false;
+    }
+
+    resetState();
+    enabled_ = enabled;
+    pan_inertia_enabled_ = pan_inertia;
+    rotate_enabled_ = rotate_enabled;
+    pan_enabled_ = pan_enabled;
+    zoom_method_ = zoom_method;
+    setFovZoomSpeed(fov_zoom_speed);
+    setZoomSpeed(zoom_speed);
+    setPanDamping(pan_damping);
+    setRotationSensitivityDegreesPerPixel(rotation_deg_per_px);
+
+    if (has_pose && camera_) {
+        zoom_scale_ = std::clamp(scene_scale, kSceneScaleMin, kSceneScaleMax);
+        camera_->setSceneScale(zoom_scale_);
+        applyCameraPose(*camera_, pose, !defer_matrices_);
+    }
+    return true;
+}
+
 }  // namespace vne::interaction
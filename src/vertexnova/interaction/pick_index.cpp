@@ -0,0 +1,1335 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/pick_index.h"
+
+#include "detail/work_stealing_pool.h"
+
+#include <vertexnova/logging/logging.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace {
+CREATE_VNE_LOGGER_CATEGORY("vne.interaction.pick_index");
+}  // namespace
+
+namespace vne::interaction {
+
+namespace {
+
+constexpr int kBinCount = 16;
+constexpr std::uint32_t kMinLeafSize = 2;          //!< Ranges this small always become leaves
+constexpr std::uint32_t kMaxLeafSize = 8;          //!< Larger ranges are split even when SAH prefers a leaf
+constexpr int kMaxDepth = 60;                      //!< Leaf forced below this; keeps traversal within kStackSize
+constexpr std::size_t kStackSize = 64;
+constexpr float kTraversalCost = 1.0f;             //!< Node visit cost relative to one primitive test
+constexpr std::size_t kParallelMinPrims = 16384;   //!< Smaller builds stay on the calling thread
+constexpr std::size_t kParallelSubtreeMin = 4096;  //!< Upper-level ranges this small become parallel subtrees
+constexpr std::size_t kChunkSize = 16384;          //!< Primitives per parallel bounds / binning task
+constexpr std::uint32_t kInvalid = 0xFFFFFFFFu;
+constexpr float kRayEpsilon = 1e-12f;
+constexpr float kInf = std::numeric_limits<float>::infinity();
+
+struct Aabb {
+    float mn[3] = {kInf, kInf, kInf};
+    float mx[3] = {-kInf, -kInf, -kInf};
+
+    void grow(const float p[3]) noexcept {
+        for (int a = 0; a < 3; ++a) {
+            mn[a] = std::min(mn[a], p[a]);
+            mx[a] = std::max(mx[a], p[a]);
+        }
+    }
+    void grow(const Aabb& b) noexcept {
+        for (int a = 0; a < 3; ++a) {
+            mn[a] = std::min(mn[a], b.mn[a]);
+            mx[a] = std::max(mx[a], b.mx[a]);
+        }
+    }
+    /** Half surface area (the SAH only compares ratios); 0 when empty. */
+    [[nodiscard]] float halfArea() const noexcept {
+        const float dx = mx[0] - mn[0];
+        const float dy = mx[1] - mn[1];
+        const float dz = mx[2] - mn[2];
+        if (dx < 0.0f || dy < 0.0f || dz < 0.0f) {
+            return 0.0f;
+        }
+        return dx * dy + dy * dz + dz * dx;
+    }
+    [[nodiscard]] bool operator==(const Aabb& b) const noexcept {
+        return std::equal(mn, mn + 3, b.mn) && std::equal(mx, mx + 3, b.mx);
+    }
+};
+
+/** 32-byte node; the two children of an interior node are adjacent (left, left + 1). */
+struct Node {
+    float mn[3];
+    std::uint32_t first;  //!< Leaf: first primitive slot. Interior: left child index
+    float mx[3];
+    std::uint32_t count;  //!< Leaf: primitive count. Interior: 0
+
+    void setBounds(const Aabb& b) noexcept {
+        std::copy(b.mn, b.mn + 3, mn);
+        std::copy(b.mx, b.mx + 3, mx);
+    }
+    [[nodiscard]] Aabb bounds() const noexcept {
+        Aabb b;
+        std::copy(mn, mn + 3, b.mn);
+        std::copy(mx, mx + 3, b.mx);
+        return b;
+    }
+};
+
+/** Triangle stored for Möller–Trumbore: first vertex and the two edges from it. */
+struct Triangle {
+    float v0[3];
+    float e1[3];
+    float e2[3];
+
+    [[nodiscard]] Aabb bounds() const noexcept {
+        Aabb b;
+        float p[3];
+        b.grow(v0);
+        for (int a = 0; a < 3; ++a) {
+            p[a] = v0[a] + e1[a];
+        }
+        b.grow(p);
+        for (int a = 0; a < 3; ++a) {
+            p[a] = v0[a] + e2[a];
+        }
+        b.grow(p);
+        return b;
+    }
+};
+
+Triangle makeTriangle(const vne::math::Vec3f& a, const vne::math::Vec3f& b, const vne::math::Vec3f& c) noexcept {
+    Triangle t{};
+    const float pa[3] = {a.x(), a.y(), a.z()};
+    const float pb[3] = {b.x(), b.y(), b.z()};
+    const float pc[3] = {c.x(), c.y(), c.z()};
+    for (int k = 0; k < 3; ++k) {
+        t.v0[k] = pa[k];
+        t.e1[k] = pb[k] - pa[k];
+        t.e2[k] = pc[k] - pa[k];
+    }
+    return t;
+}
+
+bool isFinite(const vne::math::Vec3f& v) noexcept {
+    return std::isfinite(v.x()) && std::isfinite(v.y()) && std::isfinite(v.z());
+}
+
+struct Bin {
+    Aabb bounds;
+    std::uint32_t count = 0;
+};
+
+/** Bounds of a primitive range and of its centroids. */
+struct RangeInfo {
+    Aabb bounds;
+    Aabb centroids;
+
+    void merge(const RangeInfo& o) noexcept {
+        bounds.grow(o.bounds);
+        centroids.grow(o.centroids);
+    }
+};
+
+/** How a range is turned into a node. */
+struct SplitPlan {
+    bool leaf = true;
+    bool halves = false;  //!< Centroids coincide: split the range in the middle
+    int axis = 0;
+    int last_left_bin = 0;
+    float cmin = 0.0f;
+    float scale = 0.0f;
+};
+
+/** Range of the primitive order array that still has to become a subtree rooted at @c node. */
+struct BuildRange {
+    std::uint32_t node = 0;
+    std::uint32_t begin = 0;
+    std::uint32_t end = 0;
+    int depth = 0;
+};
+
+/** Primitive data the build reads: bounds and centroids in input order, and the order being partitioned. */
+struct BuildData {
+    std::vector<Aabb> bounds;
+    std::vector<std::array<float, 3>> centroids;
+    std::vector<std::uint32_t> order;
+};
+
+int binOf(const SplitPlan& plan, const std::array<float, 3>& c) noexcept {
+    const int b = static_cast<int>((c[plan.axis] - plan.cmin) * plan.scale);
+    return std::clamp(b, 0, kBinCount - 1);
+}
+
+RangeInfo rangeInfo(const BuildData& d, std::size_t begin, std::size_t end) noexcept {
+    RangeInfo info;
+    for (std::size_t i = begin; i < end; ++i) {
+        const std::uint32_t p = d.order[i];
+        info.bounds.grow(d.bounds[p]);
+        info.centroids.grow(d.centroids[p].data());
+    }
+    return info;
+}
+
+void binRange(const BuildData& d, const SplitPlan& plan, std::size_t begin, std::size_t end, Bin* bins) noexcept {
+    for (std::size_t i = begin; i < end; ++i) {
+        const std::uint32_t p = d.order[i];
+        Bin& bin = bins[binOf(plan, d.centroids[p])];
+        bin.bounds.grow(d.bounds[p]);
+        ++bin.count;
+    }
+}
+
+/** Choose the split axis and scale from the centroid bounds; @c leaf stays set when no split is needed. */
+SplitPlan prepareSplit(const RangeInfo& info, std::size_t count, int depth) noexcept {
+    SplitPlan plan;
+    if (count <= kMinLeafSize || depth >= kMaxDepth) {
+        return plan;
+    }
+    float extent = -1.0f;
+    for (int a = 0; a < 3; ++a) {
+        const float e = info.centroids.mx[a] - info.centroids.mn[a];
+        if (e > extent) {
+            extent = e;
+            plan.axis = a;
+        }
+    }
+    if (!(extent > 0.0f)) {
+        plan.halves = count > kMaxLeafSize;
+        plan.leaf = !plan.halves;
+        return plan;
+    }
+    plan.leaf = false;
+    plan.cmin = info.centroids.mn[plan.axis];
+    plan.scale = static_cast<float>(kBinCount) * (1.0f - 1e-6f) / extent;
+    return plan;
+}
+
+/** Pick the cheapest bin boundary by the surface area heuristic, or turn the plan into a leaf. */
+void finishSplit(SplitPlan& plan, const RangeInfo& info, const Bin* bins, std::size_t count) noexcept {
+    float left_area[kBinCount - 1];
+    std::uint32_t left_count[kBinCount - 1];
+    Aabb acc;
+    std::uint32_t n = 0;
+    for (int i = 0; i < kBinCount - 1; ++i) {
+        acc.grow(bins[i].bounds);
+        n += bins[i].count;
+        left_area[i] = acc.halfArea();
+        left_count[i] = n;
+    }
+    const float parent_area = std::max(info.bounds.halfArea(), std::numeric_limits<float>::min());
+    float best_cost = kInf;
+    int best = -1;
+    acc = Aabb{};
+    n = 0;
+    for (int i = kBinCount - 1; i > 0; --i) {
+        acc.grow(bins[i].bounds);
+        n += bins[i].count;
+        const std::uint32_t nl = left_count[i - 1];
+        if (nl == 0 || n == 0) {
+            continue;
+        }
+        const float cost = kTraversalCost
+                           + (left_area[i - 1] * static_cast<float>(nl) + acc.halfArea() * static_cast<float>(n))
+                                 / parent_area;
+        if (cost < best_cost) {
+            best_cost = cost;
+            best = i - 1;
+        }
+    }
+    if (best < 0) {
+        plan.leaf = count <= kMaxLeafSize;
+        plan.halves = !plan.leaf;
+        return;
+    }
+    if (best_cost >= static_cast<float>(count) && count <= kMaxLeafSize) {
+        plan.leaf = true;
+        return;
+    }
+    plan.last_left_bin = best;
+}
+
+/** Reorder [begin, end) by @p plan. @return First index of the right child */
+std::uint32_t partitionRange(BuildData& d, const SplitPlan& plan, std::uint32_t begin, std::uint32_t end) noexcept {
+    if (plan.halves) {
+        return begin + (end - begin) / 2;
+    }
+    const auto mid = std::partition(d.order.begin() + begin, d.order.begin() + end, [&](std::uint32_t p) {
+        return binOf(plan, d.centroids[p]) <= plan.last_left_bin;
+    });
+    return static_cast<std::uint32_t>(mid - d.order.begin());
+}
+
+/** Build the subtree for [begin, end) into @p nodes at index @p index, depth first, on the calling thread. */
+void buildSerial(BuildData& d,
+                 std::vector<Node>& nodes,
+                 std::uint32_t index,
+                 std::uint32_t begin,
+                 std::uint32_t end,
+                 int depth) {
+    const RangeInfo info = rangeInfo(d, begin, end);
+    const std::size_t count = end - begin;
+    SplitPlan plan = prepareSplit(info, count, depth);
+    if (!plan.leaf && !plan.halves) {
+        Bin bins[kBinCount];
+        binRange(d, plan, begin, end, bins);
+        finishSplit(plan, info, bins, count);
+    }
+    nodes[index].setBounds(info.bounds);
+    if (plan.leaf) {
+        nodes[index].first = begin;
+        nodes[index].count = static_cast<std::uint32_t>(count);
+        return;
+    }
+    const std::uint32_t mid = partitionRange(d, plan, begin, end);
+    const auto left = static_cast<std::uint32_t>(nodes.size());
+    nodes.emplace_back();
+    nodes.emplace_back();
+    nodes[index].first = left;
+    nodes[index].count = 0;
+    buildSerial(d, nodes, left, begin, mid, depth + 1);
+    buildSerial(d, nodes, left + 1, mid, end, depth + 1);
+}
+
+/** Entry distance of the ray into @p n, or +inf when it misses or starts beyond @p t_max. */
+float slabEntry(const Node& n, const float o[3], const float inv[3], float t_max) noexcept {
+    float t0 = 0.0f;
+    float t1 = t_max;
+    for (int a = 0; a < 3; ++a) {
+        float near_t = (n.mn[a] - o[a]) * inv[a];
+        float far_t = (n.mx[a] - o[a]) * inv[a];
+        if (near_t > far_t) {
+            std::swap(near_t, far_t);
+        }
+        t0 = std::max(t0, near_t);
+        t1 = std::min(t1, far_t);
+    }
+    return t0 <= t1 ? t0 : kInf;
+}
+
+float boxEntry(const Aabb& b, const float o[3], const float inv[3], float t_max) noexcept {
+    Node n{};
+    n.setBounds(b);
+    return slabEntry(n, o, inv, t_max);
+}
+
+/** Two-sided Möller–Trumbore. @return Hit distance, or +inf */
+float triangleHit(const Triangle& tri, const float o[3], const float dir[3], float t_max) noexcept {
+    const float* e1 = tri.e1;
+    const float* e2 = tri.e2;
+    const float p[3] = {
+        dir[1] * e2[2] - dir[2] * e2[1], dir[2] * e2[0] - dir[0] * e2[2], dir[0] * e2[1] - dir[1] * e2[0]};
+    const float det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+    if (std::abs(det) < kRayEpsilon) {
+        return kInf;
+    }
+    const float inv_det = 1.0f / det;
+    const float s[3] = {o[0] - tri.v0[0], o[1] - tri.v0[1], o[2] - tri.v0[2]};
+    const float u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inv_det;
+    if (u < 0.0f || u > 1.0f) {
+        return kInf;
+    }
+    const float q[3] = {s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0]};
+    const float v = (dir[0] * q[0] + dir[1] * q[1] + dir[2] * q[2]) * inv_det;
+    if (v < 0.0f || u + v > 1.0f) {
+        return kInf;
+    }
+    const float t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * inv_det;
+    return (t >= 0.0f && t <= t_max) ? t : kInf;
+}
+
+/** View volume of a depth-range query: depths are measured from @c eye along @c forward. */
+struct DepthVolume {
+    float eye[3];
+    float forward[3];
+    std::span<const vne::math::Vec4f> planes;
+};
+
+/** Depth interval of a box; false when the box lies entirely outside one of the planes. */
+bool boxDepth(const DepthVolume& v, const float mn[3], const float mx[3], float& lo, float& hi) noexcept {
+    float c[3];
+    float e[3];
+    for (int a = 0; a < 3; ++a) {
+        c[a] = 0.5f * (mn[a] + mx[a]);
+        e[a] = 0.5f * (mx[a] - mn[a]);
+    }
+    for (const vne::math::Vec4f& p : v.planes) {
+        const float dist = p.x() * c[0] + p.y() * c[1] + p.z() * c[2] + p.w();
+        const float radius = std::abs(p.x()) * e[0] + std::abs(p.y()) * e[1] + std::abs(p.z()) * e[2];
+        if (dist + radius < 0.0f) {
+            return false;
+        }
+    }
+    float depth = 0.0f;
+    float radius = 0.0f;
+    for (int a = 0; a < 3; ++a) {
+        depth += v.forward[a] * (c[a] - v.eye[a]);
+        radius += std::abs(v.forward[a]) * e[a];
+    }
+    lo = depth - radius;
+    hi = depth + radius;
+    return true;
+}
+
+/** Depth interval of a triangle's vertices; false when all three lie outside one of the planes. */
+bool triangleDepth(const DepthVolume& v, const Triangle& tri, float& lo, float& hi) noexcept {
+    float p[3][3];
+    for (int a = 0; a < 3; ++a) {
+        p[0][a] = tri.v0[a];
+        p[1][a] = tri.v0[a] + tri.e1[a];
+        p[2][a] = tri.v0[a] + tri.e2[a];
+    }
+    for (const vne::math::Vec4f& pl : v.planes) {
+        bool outside = true;
+        for (const auto& q : p) {
+            if (pl.x() * q[0] + pl.y() * q[1] + pl.z() * q[2] + pl.w() >= 0.0f) {
+                outside = false;
+                break;
+            }
+        }
+        if (outside) {
+            return false;
+        }
+    }
+    lo = kInf;
+    hi = -kInf;
+    for (const auto& q : p) {
+        const float d = v.forward[0] * (q[0] - v.eye[0]) + v.forward[1] * (q[1] - v.eye[1])
+                        + v.forward[2] * (q[2] - v.eye[2]);
+        lo = std::min(lo, d);
+        hi = std::max(hi, d);
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Swept sphere
+// ---------------------------------------------------------------------------
+
+float dot3(const float a[3], const float b[3]) noexcept {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+/** Center ray and radius of one sphere cast; the direction is unit length. */
+struct Sweep {
+    float o[3];
+    float dir[3];
+    float inv[3];
+    float r;
+};
+
+/** Contact candidate: travel distance and surface normal toward the sphere. */
+struct SweepContact {
+    float t = kInf;
+    float n[3] = {0.0f, 0.0f, 1.0f};
+};
+
+/**
+ * Entry distance of the sphere into [mn, mx] inflated by the radius, or +inf when it misses or starts beyond
+ * @p t_max. @p axis receives the axis of the entry face, or -1 when the center starts inside.
+ */
+float sweptBoxEntry(const Sweep& s, const float mn[3], const float mx[3], float t_max, int& axis) noexcept {
+    float t0 = 0.0f;
+    float t1 = t_max;
+    axis = -1;
+    for (int a = 0; a < 3; ++a) {
+        float near_t = (mn[a] - s.r - s.o[a]) * s.inv[a];
+        float far_t = (mx[a] + s.r - s.o[a]) * s.inv[a];
+        if (near_t > far_t) {
+            std::swap(near_t, far_t);
+        }
+        if (near_t > t0) {
+            t0 = near_t;
+            axis = a;
+        }
+        t1 = std::min(t1, far_t);
+    }
+    return t0 <= t1 ? t0 : kInf;
+}
+
+/** Sweep against a box primitive; a sphere that starts inside reports 0 only while moving deeper. */
+bool sweepBox(const Sweep& s, const Aabb& b, float t_max, SweepContact& c) noexcept {
+    int axis = -1;
+    const float t = sweptBoxEntry(s, b.mn, b.mx, t_max, axis);
+    if (t == kInf) {
+        return false;
+    }
+    float n[3] = {0.0f, 0.0f, 0.0f};
+    if (axis >= 0) {
+        n[axis] = s.dir[axis] > 0.0f ? -1.0f : 1.0f;
+    } else {
+        // Overlapping at the start: push out through the face of least penetration
+        float best = kInf;
+        for (int a = 0; a < 3; ++a) {
+            const float to_min = s.o[a] - (b.mn[a] - s.r);
+            const float to_max = (b.mx[a] + s.r) - s.o[a];
+            if (to_min < best) {
+                best = to_min;
+                axis = a;
+                n[0] = n[1] = n[2] = 0.0f;
+                n[a] = -1.0f;
+            }
+            if (to_max < best) {
+                best = to_max;
+                axis = a;
+                n[0] = n[1] = n[2] = 0.0f;
+                n[a] = 1.0f;
+            }
+        }
+        if (dot3(n, s.dir) >= 0.0f) {
+            return false;  // leaving the box
+        }
+    }
+    c.t = t;
+    std::copy(n, n + 3, c.n);
+    return true;
+}
+
+/** Sweep against the sphere of radius r around @p p (a triangle vertex). */
+bool sweepPoint(const Sweep& s, const float p[3], float t_max, SweepContact& c) noexcept {
+    const float m[3] = {s.o[0] - p[0], s.o[1] - p[1], s.o[2] - p[2]};
+    const float b = dot3(m, s.dir);
+    const float cc = dot3(m, m) - s.r * s.r;
+    float t = 0.0f;
+    if (cc > 0.0f) {
+        const float disc = b * b - cc;
+        if (b >= 0.0f || disc < 0.0f) {
+            return false;
+        }
+        t = -b - std::sqrt(disc);
+    } else if (b >= 0.0f) {
+        return false;  // overlapping and moving away
+    }
+    if (t > t_max || t >= c.t) {
+        return false;
+    }
+    float n[3];
+    float len = 0.0f;
+    for (int a = 0; a < 3; ++a) {
+        n[a] = m[a] + s.dir[a] * t;
+        len += n[a] * n[a];
+    }
+    len = std::sqrt(len);
+    if (!(len > kRayEpsilon)) {
+        return false;
+    }
+    c.t = t;
+    for (int a = 0; a < 3; ++a) {
+        c.n[a] = n[a] / len;
+    }
+    return true;
+}
+
+/** Sweep against the cylinder of radius r around segment [a, a + e] (a triangle edge, without its ends). */
+bool sweepEdge(const Sweep& s, const float a[3], const float e[3], float t_max, SweepContact& c) noexcept {
+    const float len = std::sqrt(dot3(e, e));
+    if (!(len > kRayEpsilon)) {
+        return false;
+    }
+    const float u[3] = {e[0] / len, e[1] / len, e[2] / len};
+    const float m[3] = {s.o[0] - a[0], s.o[1] - a[1], s.o[2] - a[2]};
+    const float mu = dot3(m, u);
+    const float du = dot3(s.dir, u);
+    const float mp[3] = {m[0] - u[0] * mu, m[1] - u[1] * mu, m[2] - u[2] * mu};
+    const float dp[3] = {s.dir[0] - u[0] * du, s.dir[1] - u[1] * du, s.dir[2] - u[2] * du};
+    const float qa = dot3(dp, dp);
+    const float qb = dot3(mp, dp);
+    const float qc = dot3(mp, mp) - s.r * s.r;
+    if (qa < kRayEpsilon) {
+        return false;  // moving along the edge: the vertex spheres catch it
+    }
+    float t = 0.0f;
+    if (qc > 0.0f) {
+        const float disc = qb * qb - qa * qc;
+        if (qb >= 0.0f || disc < 0.0f) {
+            return false;
+        }
+        t = (-qb - std::sqrt(disc)) / qa;
+    } else if (qb >= 0.0f) {
+        return false;
+    }
+    const float along = mu + du * t;
+    if (t > t_max || t >= c.t || along < 0.0f || along > len) {
+        return false;
+    }
+    float n[3];
+    for (int k = 0; k < 3; ++k) {
+        n[k] = mp[k] + dp[k] * t;
+    }
+    const float n_len = std::sqrt(dot3(n, n));
+    if (!(n_len > kRayEpsilon)) {
+        return false;
+    }
+    c.t = t;
+    for (int k = 0; k < 3; ++k) {
+        c.n[k] = n[k] / n_len;
+    }
+    return true;
+}
+
+/** Whether @p q (on the triangle plane) lies inside the triangle. */
+bool insideTriangle(const Triangle& tri, const float q[3]) noexcept {
+    const float w[3] = {q[0] - tri.v0[0], q[1] - tri.v0[1], q[2] - tri.v0[2]};
+    const float d00 = dot3(tri.e1, tri.e1);
+    const float d01 = dot3(tri.e1, tri.e2);
+    const float d11 = dot3(tri.e2, tri.e2);
+    const float d20 = dot3(w, tri.e1);
+    const float d21 = dot3(w, tri.e2);
+    const float denom = d00 * d11 - d01 * d01;
+    if (!(std::abs(denom) > kRayEpsilon)) {
+        return false;
+    }
+    const float v = (d11 * d20 - d01 * d21) / denom;
+    const float u = (d00 * d21 - d01 * d20) / denom;
+    return v >= 0.0f && u >= 0.0f && v + u <= 1.0f;
+}
+
+/** Two-sided sweep against a triangle: face first, then edges and vertices. */
+bool sweepTriangle(const Sweep& s, const Triangle& tri, float t_max, SweepContact& c) noexcept {
+    float n[3] = {tri.e1[1] * tri.e2[2] - tri.e1[2] * tri.e2[1],
+                  tri.e1[2] * tri.e2[0] - tri.e1[0] * tri.e2[2],
+                  tri.e1[0] * tri.e2[1] - tri.e1[1] * tri.e2[0]};
+    const float n_len = std::sqrt(dot3(n, n));
+    if (n_len > kRayEpsilon) {
+        for (float& k : n) {
+            k /= n_len;
+        }
+        const float m[3] = {s.o[0] - tri.v0[0], s.o[1] - tri.v0[1], s.o[2] - tri.v0[2]};
+        float dist = dot3(m, n);
+        if (dist < 0.0f) {
+            for (float& k : n) {
+                k = -k;
+            }
+            dist = -dist;
+        }
+        const float approach = dot3(s.dir, n);
+        // Face contact: nothing else can be touched earlier, since the sphere has not reached the plane before
+        float t = kInf;
+        if (dist <= s.r) {
+            t = 0.0f;
+        } else if (approach < 0.0f) {
+            t = (dist - s.r) / -approach;
+        }
+        if (t <= t_max && t < c.t) {
+            float q[3];
+            for (int a = 0; a < 3; ++a) {
+                q[a] = s.o[a] + s.dir[a] * t - n[a] * (t == 0.0f ? dist : s.r);
+            }
+            if (insideTriangle(tri, q)) {
+                if (approach >= 0.0f) {
+                    return false;  // overlapping the face and moving away
+                }
+                c.t = t;
+                std::copy(n, n + 3, c.n);
+                return true;
+            }
+        }
+    }
+    float v1[3];
+    float v2[3];
+    float e3[3];
+    for (int a = 0; a < 3; ++a) {
+        v1[a] = tri.v0[a] + tri.e1[a];
+        v2[a] = tri.v0[a] + tri.e2[a];
+        e3[a] = tri.e2[a] - tri.e1[a];
+    }
+    bool hit = sweepEdge(s, tri.v0, tri.e1, t_max, c);
+    hit = sweepEdge(s, tri.v0, tri.e2, t_max, c) || hit;
+    hit = sweepEdge(s, v1, e3, t_max, c) || hit;
+    hit = sweepPoint(s, tri.v0, t_max, c) || hit;
+    hit = sweepPoint(s, v1, t_max, c) || hit;
+    hit = sweepPoint(s, v2, t_max, c) || hit;
+    return hit;
+}
+
+}  // namespace
+
+// ---------------------------------------------------------------------------
+// Impl
+// ---------------------------------------------------------------------------
+
+class PickIndex::Impl {
+    friend class PickIndex;
+
+    static constexpr std::size_t kRequestSlots = 8;
+
+    enum class Mode { eEmpty, eBoxes, eTriangles };
+
+    struct RequestResult {
+        RequestId id = kNoRequest;
+        DepthQueryStatus status = DepthQueryStatus::eMiss;
+        vne::math::Vec3f point{0.0f, 0.0f, 0.0f};
+    };
+
+    Mode mode = Mode::eEmpty;
+    std::vector<Node> nodes;
+    std::vector<Aabb> boxes;                  //!< Box mode: primitives in slot (leaf) order
+    std::vector<Triangle> triangles;          //!< Triangle mode: primitives in slot (leaf) order
+    std::vector<std::uint32_t> slot_prim;     //!< Slot → build-input index
+    std::vector<std::uint32_t> prim_slot;     //!< Build-input index → slot (kInvalid when skipped)
+    std::vector<std::uint32_t> parent;        //!< Node → parent node (kInvalid for the root)
+    std::vector<std::uint32_t> slot_leaf;     //!< Slot → leaf node
+    std::uint64_t revision = 0;
+
+    std::size_t worker_threads = 0;
+    std::unique_ptr<detail::WorkStealingPool> pool;  //!< Started on the first parallel build
+    ControllerExecutor executor;
+
+    std::array<RequestResult, kRequestSlots> requests{};
+    RequestId next_request = 1;
+
+    /** Number of parallel lanes a build of @p count primitives may use (1: serial). */
+    [[nodiscard]] std::size_t lanes(std::size_t count) const noexcept {
+        if (count < kParallelMinPrims) {
+            return 1;
+        }
+        if (executor) {
+            return std::max<std::size_t>(worker_threads, 1) + 1;
+        }
+        return worker_threads + 1;
+    }
+
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)>& task) {
+        if (executor) {
+            executor(count, task);
+            return;
+        }
+        if (count < 2 || worker_threads == 0) {
+            for (std::size_t i = 0; i < count; ++i) {
+                task(i);
+            }
+            return;
+        }
+        if (!pool) {
+            pool = std::make_unique<detail::WorkStealingPool>(worker_threads);
+        }
+        pool->parallelFor(count, task);
+    }
+
+    /** Run @p fn(chunk, begin, end) over [begin, end) in kChunkSize pieces, in parallel. */
+    void forChunks(std::size_t begin,
+                   std::size_t end,
+                   const std::function<void(std::size_t, std::size_t, std::size_t)>& fn) {
+        const std::size_t chunks = (end - begin + kChunkSize - 1) / kChunkSize;
+        parallelFor(chunks, [&](std::size_t c) {
+            const std::size_t b = begin + c * kChunkSize;
+            fn(c, b, std::min(end, b + kChunkSize));
+        });
+    }
+
+    void build(BuildData& d);
+    void finishLayout();
+    void refitFromSlot(std::uint32_t slot) noexcept;
+};
+
+void PickIndex::Impl::build(BuildData& d) {
+    const auto count = static_cast<std::uint32_t>(d.order.size());
+    nodes.clear();
+    nodes.emplace_back();
+    const std::size_t lane_count = lanes(count);
+    const std::size_t target = lane_count > 1 ? lane_count * 4 : 1;
+
+    // Upper levels breadth first, each range's bounds and bins computed in parallel chunks, until there are
+    // enough independent ranges to keep every lane busy.
+    std::vector<BuildRange> work{BuildRange{0, 0, count, 0}};
+    std::vector<BuildRange> subtrees;
+    for (std::size_t w = 0; w < work.size(); ++w) {
+        const BuildRange r = work[w];
+        const std::size_t size = r.end - r.begin;
+        if (size <= kParallelSubtreeMin || subtrees.size() + (work.size() - w) >= target) {
+            subtrees.push_back(r);
+            continue;
+        }
+        std::vector<RangeInfo> partial((size + kChunkSize - 1) / kChunkSize);
+        forChunks(r.begin, r.end, [&](std::size_t c, std::size_t b, std::size_t e) {
+            partial[c] = rangeInfo(d, b, e);
+        });
+        RangeInfo info;
+        for (const RangeInfo& p : partial) {
+            info.merge(p);
+        }
+        SplitPlan plan = prepareSplit(info, size, r.depth);
+        if (!plan.leaf && !plan.halves) {
+            std::vector<std::array<Bin, kBinCount>> chunk_bins(partial.size());
+            forChunks(r.begin, r.end, [&](std::size_t c, std::size_t b, std::size_t e) {
+                binRange(d, plan, b, e, chunk_bins[c].data());
+            });
+            Bin bins[kBinCount];
+            for (const auto& cb : chunk_bins) {
+                for (int i = 0; i < kBinCount; ++i) {
+                    bins[i].bounds.grow(cb[i].bounds);
+                    bins[i].count += cb[i].count;
+                }
+            }
+            finishSplit(plan, info, bins, size);
+        }
+        nodes[r.node].setBounds(info.bounds);
+        if (plan.leaf) {
+            nodes[r.node].first = r.begin;
+            nodes[r.node].count = static_cast<std::uint32_t>(size);
+            continue;
+        }
+        const std::uint32_t mid = partitionRange(d, plan, r.begin, r.end);
+        const auto left = static_cast<std::uint32_t>(nodes.size());
+        nodes.emplace_back();
+        nodes.emplace_back();
+        nodes[r.node].first = left;
+        nodes[r.node].count = 0;
+        work.push_back(BuildRange{left, r.begin, mid, r.depth + 1});
+        work.push_back(BuildRange{left + 1, mid, r.end, r.depth + 1});
+    }
+
+    // Independent subtrees in parallel, each into its own array (root at 0), then appended in order.
+    std::vector<std::vector<Node>> local(subtrees.size());
+    parallelFor(subtrees.size(), [&](std::size_t i) {
+        const BuildRange& r = subtrees[i];
+        local[i].reserve(2 * static_cast<std::size_t>(r.end - r.begin));
+        local[i].emplace_back();
+        buildSerial(d, local[i], 0, r.begin, r.end, r.depth);
+    });
+    std::size_t total = nodes.size();
+    for (const auto& l : local) {
+        total += l.size() - 1;
+    }
+    nodes.reserve(total);
+    for (std::size_t i = 0; i < subtrees.size(); ++i) {
+        const auto base = static_cast<std::uint32_t>(nodes.size());
+        const auto remap = [base](Node n) {
+            if (n.count == 0) {
+                n.first = base + n.first - 1;
+            }
+            return n;
+        };
+        nodes[subtrees[i].node] = remap(local[i][0]);
+        for (std::size_t k = 1; k < local[i].size(); ++k) {
+            nodes.push_back(remap(local[i][k]));
+        }
+    }
+}
+
+void PickIndex::Impl::finishLayout() {
+    parent.assign(nodes.size(), kInvalid);
+    slot_leaf.assign(slot_prim.size(), kInvalid);
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        const Node& n = nodes[i];
+        if (n.count == 0) {
+            parent[n.first] = static_cast<std::uint32_t>(i);
+            parent[n.first + 1] = static_cast<std::uint32_t>(i);
+        } else {
+            const auto first = slot_leaf.begin() + n.first;
+            std::fill(first, first + n.count, static_cast<std::uint32_t>(i));
+        }
+    }
+}
+
+void PickIndex::Impl::refitFromSlot(std::uint32_t slot) noexcept {
+    std::uint32_t node = slot_leaf[slot];
+    Aabb b;
+    const Node& leaf = nodes[node];
+    for (std::uint32_t s = leaf.first; s < leaf.first + leaf.count; ++s) {
+        b.grow(mode == Mode::eBoxes ? boxes[s] : triangles[s].bounds());
+    }
+    nodes[node].setBounds(b);
+    for (node = parent[node]; node != kInvalid; node = parent[node]) {
+        Aabb merged = nodes[nodes[node].first].bounds();
+        merged.grow(nodes[nodes[node].first + 1].bounds());
+        if (merged == nodes[node].bounds()) {
+            break;  // ancestors are unions of unchanged children
+        }
+        nodes[node].setBounds(merged);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Construction
+// ---------------------------------------------------------------------------
+
+PickIndex::PickIndex(std::size_t worker_threads)
+    : impl_(std::make_unique<Impl>()) {
+    impl_->worker_threads = worker_threads;
+}
+
+PickIndex::~PickIndex() = default;
+PickIndex::PickIndex(PickIndex&&) noexcept = default;
+PickIndex& PickIndex::operator=(PickIndex&&) noexcept = default;
+
+void PickIndex::setExecutor(ControllerExecutor executor) {
+    impl_->executor = std::move(executor);
+    if (impl_->executor) {
+        impl_->pool.reset();
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Build
+// ---------------------------------------------------------------------------
+
+void PickIndex::buildFromBoxes(const vne::math::Vec3f* mins, const vne::math::Vec3f* maxs, std::size_t count) {
+    clear();
+    if (count == 0) {
+        return;
+    }
+    if (!mins || !maxs || count >= kInvalid) {
+        VNE_LOG_WARN << "PickIndex::buildFromBoxes: null corner arrays or too many boxes";
+        return;
+    }
+    Impl& m = *impl_;
+    BuildData d;
+    std::vector<std::uint32_t> input_ids;
+    input_ids.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const bool valid = isFinite(mins[i]) && isFinite(maxs[i]) && mins[i].x() <= maxs[i].x()
+                           && mins[i].y() <= maxs[i].y() && mins[i].z() <= maxs[i].z();
+        if (valid) {
+            input_ids.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+    const std::size_t n = input_ids.size();
+    d.bounds.resize(n);
+    d.centroids.resize(n);
+    d.order.resize(n);
+    m.forChunks(0, n, [&](std::size_t, std::size_t b, std::size_t e) {
+        for (std::size_t k = b; k < e; ++k) {
+            const std::uint32_t i = input_ids[k];
+            const float mn[3] = {mins[i].x(), mins[i].y(), mins[i].z()};
+            const float mx[3] = {maxs[i].x(), maxs[i].y(), maxs[i].z()};
+            d.bounds[k].grow(mn);
+            d.bounds[k].grow(mx);
+            for (int a = 0; a < 3; ++a) {
+                d.centroids[k][a] = 0.5f * (mn[a] + mx[a]);
+            }
+            d.order[k] = static_cast<std::uint32_t>(k);
+        }
+    });
+    if (n == 0) {
+        return;
+    }
+    m.build(d);
+
+    m.mode = Impl::Mode::eBoxes;
+    m.boxes.resize(n);
+    m.slot_prim.resize(n);
+    m.prim_slot.assign(count, kInvalid);
+    m.forChunks(0, n, [&](std::size_t, std::size_t b, std::size_t e) {
+        for (std::size_t s = b; s < e; ++s) {
+            const std::uint32_t k = d.order[s];
+            m.boxes[s] = d.bounds[k];
+            m.slot_prim[s] = input_ids[k];
+            m.prim_slot[input_ids[k]] = static_cast<std::uint32_t>(s);
+        }
+    });
+    m.finishLayout();
+    ++m.revision;
+}
+
+void PickIndex::buildFromTriangles(const vne::math::Vec3f* vertices,
+                                   std::size_t vertex_count,
+                                   const std::uint32_t* indices,
+                                   std::size_t triangle_count) {
+    clear();
+    if (triangle_count == 0) {
+        return;
+    }
+    if (!vertices || triangle_count >= kInvalid || (!indices && vertex_count < 3 * triangle_count)) {
+        VNE_LOG_WARN << "PickIndex::buildFromTriangles: null or too few vertices, or too many triangles";
+        return;
+    }
+    Impl& m = *impl_;
+    const auto corner = [&](std::size_t t, int k) -> std::size_t {
+        return indices ? static_cast<std::size_t>(indices[3 * t + k]) : 3 * t + k;
+    };
+    std::vector<std::uint32_t> input_ids;
+    input_ids.reserve(triangle_count);
+    for (std::size_t t = 0; t < triangle_count; ++t) {
+        const std::size_t a = corner(t, 0);
+        const std::size_t b = corner(t, 1);
+        const std::size_t c = corner(t, 2);
+        if (a < vertex_count && b < vertex_count && c < vertex_count && isFinite(vertices[a]) && isFinite(vertices[b])
+            && isFinite(vertices[c])) {
+            input_ids.push_back(static_cast<std::uint32_t>(t));
+        }
+    }
+    const std::size_t n = input_ids.size();
+    std::vector<Triangle> tris(n);
+    BuildData d;
+    d.bounds.resize(n);
+    d.centroids.resize(n);
+    d.order.resize(n);
+    m.forChunks(0, n, [&](std::size_t, std::size_t b, std::size_t e) {
+        for (std::size_t k = b; k < e; ++k) {
+            const std::size_t t = input_ids[k];
+            tris[k] = makeTriangle(vertices[corner(t, 0)], vertices[corner(t, 1)], vertices[corner(t, 2)]);
+            d.bounds[k] = tris[k].bounds();
+            for (int a = 0; a < 3; ++a) {
+                d.centroids[k][a] = 0.5f * (d.bounds[k].mn[a] + d.bounds[k].mx[a]);
+            }
+            d.order[k] = static_cast<std::uint32_t>(k);
+        }
+    });
+    if (n == 0) {
+        return;
+    }
+    m.build(d);
+
+    m.mode = Impl::Mode::eTriangles;
+    m.triangles.resize(n);
+    m.slot_prim.resize(n);
+    m.prim_slot.assign(triangle_count, kInvalid);
+    m.forChunks(0, n, [&](std::size_t, std::size_t b, std::size_t e) {
+        for (std::size_t s = b; s < e; ++s) {
+            const std::uint32_t k = d.order[s];
+            m.triangles[s] = tris[k];
+            m.slot_prim[s] = input_ids[k];
+            m.prim_slot[input_ids[k]] = static_cast<std::uint32_t>(s);
+        }
+    });
+    m.finishLayout();
+    ++m.revision;
+}
+
+void PickIndex::clear() noexcept {
+    Impl& m = *impl_;
+    m.mode = Impl::Mode::eEmpty;
+    m.nodes.clear();
+    m.boxes.clear();
+    m.triangles.clear();
+    m.slot_prim.clear();
+    m.prim_slot.clear();
+    m.parent.clear();
+    m.slot_leaf.clear();
+    ++m.revision;
+}
+
+std::size_t PickIndex::size() const noexcept {
+    return impl_->slot_prim.size();
+}
+
+std::size_t PickIndex::nodeCount() const noexcept {
+    return impl_->mode == Impl::Mode::eEmpty ? 0 : impl_->nodes.size();
+}
+
+std::uint64_t PickIndex::revision() const noexcept {
+    return impl_->revision;
+}
+
+// ---------------------------------------------------------------------------
+// Updates
+// ---------------------------------------------------------------------------
+
+void PickIndex::updateBox(std::size_t index,
+                          const vne::math::Vec3f& min_corner,
+                          const vne::math::Vec3f& max_corner) noexcept {
+    Impl& m = *impl_;
+    if (m.mode != Impl::Mode::eBoxes || index >= m.prim_slot.size() || m.prim_slot[index] == kInvalid) {
+        return;
+    }
+    if (!isFinite(min_corner) || !isFinite(max_corner)) {
+        VNE_LOG_WARN << "PickIndex::updateBox: non-finite corner ignored";
+        return;
+    }
+    const std::uint32_t slot = m.prim_slot[index];
+    Aabb b;
+    const float mn[3] = {min_corner.x(), min_corner.y(), min_corner.z()};
+    const float mx[3] = {max_corner.x(), max_corner.y(), max_corner.z()};
+    b.grow(mn);
+    b.grow(mx);
+    m.boxes[slot] = b;
+    m.refitFromSlot(slot);
+    ++m.revision;
+}
+
+void PickIndex::updateTriangle(std::size_t index,
+                               const vne::math::Vec3f& a,
+                               const vne::math::Vec3f& b,
+                               const vne::math::Vec3f& c) noexcept {
+    Impl& m = *impl_;
+    if (m.mode != Impl::Mode::eTriangles || index >= m.prim_slot.size() || m.prim_slot[index] == kInvalid) {
+        return;
+    }
+    if (!isFinite(a) || !isFinite(b) || !isFinite(c)) {
+        VNE_LOG_WARN << "PickIndex::updateTriangle: non-finite vertex ignored";
+        return;
+    }
+    const std::uint32_t slot = m.prim_slot[index];
+    m.triangles[slot] = makeTriangle(a, b, c);
+    m.refitFromSlot(slot);
+    ++m.revision;
+}
+
+// ---------------------------------------------------------------------------
+// Queries
+// ---------------------------------------------------------------------------
+
+bool PickIndex::raycast(const vne::math::Vec3f& origin,
+                        const vne::math::Vec3f& direction,
+                        PickHit& hit,
+                        float max_distance) const noexcept {
+    const Impl& m = *impl_;
+    const float len = direction.length();
+    if (m.mode == Impl::Mode::eEmpty || !(len > 0.0f) || !std::isfinite(len) || !isFinite(origin)
+        || !(max_distance >= 0.0f)) {
+        return false;
+    }
+    const float o[3] = {origin.x(), origin.y(), origin.z()};
+    const float dir[3] = {direction.x() / len, direction.y() / len, direction.z() / len};
+    float inv[3];
+    for (int a = 0; a < 3; ++a) {
+        inv[a] = 1.0f / (std::abs(dir[a]) > kRayEpsilon ? dir[a] : std::copysign(kRayEpsilon, dir[a]));
+    }
+
+    float best = max_distance;
+    std::uint32_t best_slot = kInvalid;
+    std::uint32_t stack[kStackSize];
+    std::size_t sp = 0;
+    if (slabEntry(m.nodes[0], o, inv, best) == kInf) {
+        return false;
+    }
+    std::uint32_t node = 0;
+    for (;;) {
+        const Node& n = m.nodes[node];
+        if (n.count > 0) {
+            for (std::uint32_t s = n.first; s < n.first + n.count; ++s) {
+                const float t = m.mode == Impl::Mode::eBoxes ? boxEntry(m.boxes[s], o, inv, best)
+                                                              : triangleHit(m.triangles[s], o, dir, best);
+                if (t != kInf && (best_slot == kInvalid ? t <= best : t < best)) {
+                    best = t;
+                    best_slot = s;
+                }
+            }
+        } else {
+            std::uint32_t near_child = n.first;
+            std::uint32_t far_child = n.first + 1;
+            float t_near = slabEntry(m.nodes[near_child], o, inv, best);
+            float t_far = slabEntry(m.nodes[far_child], o, inv, best);
+            if (t_far < t_near) {
+                std::swap(near_child, far_child);
+                std::swap(t_near, t_far);
+            }
+            if (t_near != kInf) {
+                if (t_far != kInf && sp < kStackSize) {
+                    stack[sp++] = far_child;
+                }
+                node = near_child;
+                continue;
+            }
+        }
+        // Pop the next subtree that can still hold a closer hit
+        bool found = false;
+        while (sp > 0) {
+            node = stack[--sp];
+            if (slabEntry(m.nodes[node], o, inv, best) != kInf) {
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            break;
+        }
+    }
+    if (best_slot == kInvalid) {
+        return false;
+    }
+    hit.distance = best;
+    hit.point = vne::math::Vec3f(o[0] + dir[0] * best, o[1] + dir[1] * best, o[2] + dir[2] * best);
+    hit.primitive = m.slot_prim[best_slot];
+    return true;
+}
+
+bool PickIndex::depthRange(const vne::math::Vec3f& eye,
+                           const vne::math::Vec3f& forward,
+                           std::span<const vne::math::Vec4f> planes,
+                           float& near_depth,
+                           float& far_depth) const noexcept {
+    const Impl& m = *impl_;
+    if (m.mode == Impl::Mode::eEmpty || !isFinite(eye) || !isFinite(forward)) {
+        return false;
+    }
+    const DepthVolume v{{eye.x(), eye.y(), eye.z()}, {forward.x(), forward.y(), forward.z()}, planes};
+
+    // Depth-first; a subtree is skipped when it is culled or cannot widen the range found so far.
+    float best_lo = kInf;
+    float best_hi = -kInf;
+    std::uint32_t stack[kStackSize];
+    std::size_t sp = 0;
+    stack[sp++] = 0;
+    while (sp > 0) {
+        const Node& n = m.nodes[stack[--sp]];
+        float lo = 0.0f;
+        float hi = 0.0f;
+        if (!boxDepth(v, n.mn, n.mx, lo, hi) || (lo >= best_lo && hi <= best_hi)) {
+            continue;
+        }
+        if (n.count == 0 && sp + 2 <= kStackSize) {
+            stack[sp++] = n.first;
+            stack[sp++] = n.first + 1;
+            continue;
+        }
+        if (n.count == 0) {
+            // Stack exhausted (not reached with kMaxDepth): the node bounds are a conservative answer
+            best_lo = std::min(best_lo, lo);
+            best_hi = std::max(best_hi, hi);
+            continue;
+        }
+        for (std::uint32_t s = n.first; s < n.first + n.count; ++s) {
+            const bool inside = m.mode == Impl::Mode::eBoxes ? boxDepth(v, m.boxes[s].mn, m.boxes[s].mx, lo, hi)
+                                                              : triangleDepth(v, m.triangles[s], lo, hi);
+            if (inside) {
+                best_lo = std::min(best_lo, lo);
+                best_hi = std::max(best_hi, hi);
+            }
+        }
+    }
+    if (best_lo == kInf) {
+        return false;
+    }
+    near_depth = best_lo;
+    far_depth = best_hi;
+    return true;
+}
+
+bool PickIndex::sphereCast(const vne::math::Vec3f& origin,
+                           const vne::math::Vec3f& direction,
+                           float radius,
+                           float max_distance,
+                           SweepHit& hit,
+                           std::uint32_t hint) const noexcept {
+    const Impl& m = *impl_;
+    const float len = direction.length();
+    if (m.mode == Impl::Mode::eEmpty || !(len > 0.0f) || !std::isfinite(len) || !isFinite(origin)
+        || !(max_distance >= 0.0f) || !std::isfinite(radius)) {
+        return false;
+    }
+    Sweep s{{origin.x(), origin.y(), origin.z()},
+            {direction.x() / len, direction.y() / len, direction.z() / len},
+            {},
+            std::max(radius, 0.0f)};
+    for (int a = 0; a < 3; ++a) {
+        s.inv[a] = 1.0f / (std::abs(s.dir[a]) > kRayEpsilon ? s.dir[a] : std::copysign(kRayEpsilon, s.dir[a]));
+    }
+    const auto sweepSlot = [&](std::uint32_t slot, float t_max, SweepContact& c) {
+        return m.mode == Impl::Mode::eBoxes ? sweepBox(s, m.boxes[slot], t_max, c)
+                                             : sweepTriangle(s, m.triangles[slot], t_max, c);
+    };
+    const auto nodeEntry = [&](std::uint32_t node, float t_max) {
+        int axis = 0;
+        return sweptBoxEntry(s, m.nodes[node].mn, m.nodes[node].mx, t_max, axis);
+    };
+
+    // The previous contact usually bounds the search tightly on coherent frames
+    SweepContact best;
+    std::uint32_t best_slot = kInvalid;
+    if (hint < m.prim_slot.size() && m.prim_slot[hint] != kInvalid) {
+        SweepContact c;
+        if (sweepSlot(m.prim_slot[hint], max_distance, c)) {
+            best = c;
+            best_slot = m.prim_slot[hint];
+        }
+    }
+    const auto limit = [&] { return best_slot == kInvalid ? max_distance : best.t; };
+
+    std::uint32_t stack[kStackSize];
+    std::size_t sp = 0;
+    if (nodeEntry(0, limit()) == kInf) {
+        return false;
+    }
+    std::uint32_t node = 0;
+    for (;;) {
+        const Node& n = m.nodes[node];
+        if (n.count > 0) {
+            for (std::uint32_t slot = n.first; slot < n.first + n.count; ++slot) {
+                SweepContact c;
+                if (slot != best_slot && sweepSlot(slot, limit(), c) && (best_slot == kInvalid || c.t < best.t)) {
+                    best = c;
+                    best_slot = slot;
+                }
+            }
+        } else {
+            std::uint32_t near_child = n.first;
+            std::uint32_t far_child = n.first + 1;
+            float t_near = nodeEntry(near_child, limit());
+            float t_far = nodeEntry(far_child, limit());
+            if (t_far < t_near) {
+                std::swap(near_child, far_child);
+                std::swap(t_near, t_far);
+            }
+            if (t_near != kInf) {
+                if (t_far != kInf && sp < kStackSize) {
+                    stack[sp++] = far_child;
+                }
+                node = near_child;
+                continue;
+            }
+        }
+        bool found = false;
+        while (sp > 0) {
+            node = stack[--sp];
+            if (nodeEntry(node, limit()) != kInf) {
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            break;
+        }
+    }
+    if (best_slot == kInvalid) {
+        return false;
+    }
+    const vne::math::Vec3f normal(best.n[0], best.n[1], best.n[2]);
+    const vne::math::Vec3f center(
+        s.o[0] + s.dir[0] * best.t, s.o[1] + s.dir[1] * best.t, s.o[2] + s.dir[2] * best.t);
+    hit.distance = best.t;
+    hit.point = center - normal * s.r;
+    hit.normal = normal;
+    hit.primitive = m.slot_prim[best_slot];
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// IDepthQuery
+// ---------------------------------------------------------------------------
+
+IDepthQuery::RequestId PickIndex::requestDepth(const DepthRequest& request) noexcept {
+    Impl& m = *impl_;
+    const RequestId id = m.next_request++;
+    Impl::RequestResult& r = m.requests[id % Impl::kRequestSlots];
+    r.id = id;
+    PickHit hit;
+    if (raycast(request.ray_origin, request.ray_direction, hit)) {
+        r.status = DepthQueryStatus::eHit;
+        r.point = hit.point;
+    } else {
+        r.status = DepthQueryStatus::eMiss;
+    }
+    return id;
+}
+
+DepthQueryStatus PickIndex::pollDepth(RequestId id, vne::math::Vec3f& world_point) noexcept {
+    const Impl::RequestResult& r = impl_->requests[id % Impl::kRequestSlots];
+    if (r.id != id || id == kNoRequest) {
+        return DepthQueryStatus::eMiss;  // superseded by later requests
+    }
+    if (r.status == DepthQueryStatus::eHit) {
+        world_point = r.point;
+    }
+    return r.status;
+}
+
+}  // namespace vne::interaction
@@ -0,0 +1,147 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/screen_rays.h"
+
+#include "interaction_utils.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace vne::interaction {
+
+namespace {
+
+/** Points per kernel block; the inner loops have this fixed trip count. */
+constexpr std::size_t kBlock = 16;
+constexpr std::size_t kLanes = 4;  //!< Homogeneous components (x, y, z, w)
+
+/** NDC depth of the near plane: OpenGL clips z to [-1, 1], the other APIs to [0, 1]. */
+[[nodiscard]] float ndcNearDepth(vne::math::GraphicsApi api) noexcept {
+    return api == vne::math::GraphicsApi::eOpenGL ? -1.0f : 0.0f;
+}
+
+[[nodiscard]] bool isFinite(const vne::math::Vec3f& v) noexcept {
+    return std::isfinite(v.x()) && std::isfinite(v.y()) && std::isfinite(v.z());
+}
+
+/**
+ * Pixel → homogeneous world point as two affine maps: near = base + px·mx + py·my, far = near + depth.
+ * Built once per batch by folding the pixel → NDC map into the inverse view-projection.
+ */
+struct RayKernel {
+    float base[kLanes] = {};
+    float px[kLanes] = {};
+    float py[kLanes] = {};
+    float depth[kLanes] = {};
+};
+
+[[nodiscard]] RayKernel makeKernel(const vne::math::Mat4f& inv_vp,
+                                   const vne::math::Viewport& vp,
+                                   vne::math::GraphicsApi api) noexcept {
+    // The pixel → NDC map is affine; sample it at three pixels so the API conventions come from the same
+    // mouseToApiScreen / screenToNDC path as the single-point helpers.
+    const auto ndcAt = [&](float mx, float my) {
+        return vne::math::screenToNDC(mouseToApiScreen(mx, my, vp, api), vp, api);
+    };
+    const vne::math::Vec2f o = ndcAt(0.0f, 0.0f);
+    const vne::math::Vec2f dx = ndcAt(1.0f, 0.0f) - o;
+    const vne::math::Vec2f dy = ndcAt(0.0f, 1.0f) - o;
+    const float z_near = ndcNearDepth(api);
+
+    RayKernel k;
+    for (std::size_t r = 0; r < kLanes; ++r) {
+        const float c0 = inv_vp[0][r];
+        const float c1 = inv_vp[1][r];
+        const float c2 = inv_vp[2][r];
+        const float c3 = inv_vp[3][r];
+        k.base[r] = c0 * o.x() + c1 * o.y() + c2 * z_near + c3;
+        k.px[r] = c0 * dx.x() + c1 * dx.y();
+        k.py[r] = c0 * dy.x() + c1 * dy.y();
+        k.depth[r] = c2 * (1.0f - z_near);
+    }
+    return k;
+}
+
+}  // namespace
+
+std::size_t screenToWorldRays(const vne::scene::ICamera& camera,
+                              const vne::math::Viewport& viewport,
+                              std::span<const vne::math::Vec2f> points_px,
+                              std::span<vne::math::Ray> rays) noexcept {
+    if (!(viewport.width > 0.0f) || !(viewport.height > 0.0f)) {
+        return 0;
+    }
+    const std::size_t count = std::min(points_px.size(), rays.size());
+    if (count == 0) {
+        return 0;
+    }
+
+    const RayKernel k = makeKernel(
+        safeInverseViewProjection(camera.getViewProjectionMatrix()), viewport, camera.getGraphicsApi());
+    const bool from_eye = dynamic_cast<const vne::scene::OrthographicCamera*>(&camera) == nullptr;
+    const vne::math::Vec3f eye = camera.getPosition();
+    const vne::math::Vec3f fallback_dir = camera.getForwardDir();
+
+    // Structure-of-arrays scratch for one block: pixel in, near point and unit direction out.
+    float mx[kBlock];
+    float my[kBlock];
+    float nx[kBlock];
+    float ny[kBlock];
+    float nz[kBlock];
+    float dx[kBlock];
+    float dy[kBlock];
+    float dz[kBlock];
+
+    for (std::size_t first = 0; first < count; first += kBlock) {
+        const std::size_t n = std::min(kBlock, count - first);
+        for (std::size_t i = 0; i < n; ++i) {
+            mx[i] = points_px[first + i].x();
+            my[i] = points_px[first + i].y();
+        }
+        for (std::size_t i = n; i < kBlock; ++i) {
+            mx[i] = 0.0f;
+            my[i] = 0.0f;
+        }
+
+        for (std::size_t i = 0; i < kBlock; ++i) {
+            const float hx = k.base[0] + k.px[0] * mx[i] + k.py[0] * my[i];
+            const float hy = k.base[1] + k.px[1] * mx[i] + k.py[1] * my[i];
+            const float hz = k.base[2] + k.px[2] * mx[i] + k.py[2] * my[i];
+            const float hw = k.base[3] + k.px[3] * mx[i] + k.py[3] * my[i];
+            const float inv_nw = 1.0f / hw;
+            const float inv_fw = 1.0f / (hw + k.depth[3]);
+            nx[i] = hx * inv_nw;
+            ny[i] = hy * inv_nw;
+            nz[i] = hz * inv_nw;
+            const float ex = (hx + k.depth[0]) * inv_fw - nx[i];
+            const float ey = (hy + k.depth[1]) * inv_fw - ny[i];
+            const float ez = (hz + k.depth[2]) * inv_fw - nz[i];
+            const float inv_len = 1.0f / std::sqrt(ex * ex + ey * ey + ez * ez);
+            dx[i] = ex * inv_len;
+            dy[i] = ey * inv_len;
+            dz[i] = ez * inv_len;
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            vne::math::Vec3f origin = from_eye ? eye : vne::math::Vec3f(nx[i], ny[i], nz[i]);
+            vne::math::Vec3f dir(dx[i], dy[i], dz[i]);
+            if (!isFinite(dir) || !isFinite(origin)) {
+                origin = eye;  // degenerate matrix (zero-size projection, point behind the eye)
+                dir = fallback_dir;
+            }
+            rays[first + i] = vne::math::Ray(origin, dir);
+        }
+    }
+    return count;
+}
+
+}  // namespace vne::interaction
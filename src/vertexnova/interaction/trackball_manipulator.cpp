@@ -11,6 +11,7 @@
 
 #include "vertexnova/interaction/trackball_manipulator.h"
 #include "interaction_utils.h"
+#include "detail/state_codec.h"
 #include "detail/trackball_behavior.h"
 
 #include "vertexnova/scene/camera/camera.h"
@@ -35,6 +36,7 @@ struct OrbitalTrackballRotation {
     static constexpr float kVectorEpsilon = 1e-6f;
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers) — periodic quat renormalize cadence
     static constexpr int kOrientationRenormalizePeriod = 64;
+    static constexpr float kInertiaSpeedThreshold = 1e-4f;  //!< rad/s below which rotation inertia stops
 
     TrackballBehavior trackball;
     vne::math::Quatf orientation{0.0f, 0.0f, 0.0f, 1.0f};
@@ -68,14 +70,21 @@ struct OrbitalTrackballRotation {
         if (!camera) {
             return;
         }
-        vne::math::Vec3f back = camera->getPosition() - coi_world;
+        syncFromEye(camera->getPosition(), camera->getUp(), coi_world, world_up);
+    }
+
+    void syncFromEye(const vne::math::Vec3f& eye,
+                     const vne::math::Vec3f& eye_up,
+                     const vne::math::Vec3f& coi_world,
+                     const vne::math::Vec3f& world_up) noexcept {
+        vne::math::Vec3f back = eye - coi_world;
         const float back_len = back.length();
         if (back_len < kVectorEpsilon) {
             return;  // Degenerate eye–COI (e.g. zero-size fit); keep last valid orientation_.
         }
         back /= back_len;
 
-        vne::math::Vec3f up = camera->getUp();
+        vne::math::Vec3f up = eye_up;
         const float up_len = up.length();
         up = (up_len < kVectorEpsilon) ? world_up : (up / up_len);
 
@@ -94,7 +103,7 @@ struct OrbitalTrackballRotation {
                                    vne::math::Vec4f(up.x(), up.y(), up.z(), 0.0f),
                                    vne::math::Vec4f(back.x(), back.y(), back.z(), 0.0f),
                                    vne::math::Vec4f(0.0f, 0.0f, 0.0f, 1.0f));
-        orientation = vne::math::Quatf(rot).normalized();
+        orientation = normalizeQuat(vne::math::Quatf(rot));
         normalize_counter = 0;
     }
 
@@ -134,7 +143,7 @@ struct OrbitalTrackballRotation {
         const float trackball_rot = rotation_speed * trackball_rotation_scale;
         const vne::math::Quatf delta_q =
             scaleTrackballQuaternion(trackball.cumulativeDeltaQuaternion(cursor), trackball_rot);
-        orientation = (orientation_at_drag_start * delta_q.conjugate()).normalized();
+        orientation = normalizeQuat(orientation_at_drag_start * delta_q.conjugate());
 
         updateInertiaFromSpheres(prev_sphere, curr_sphere, trackball_rot, delta_time);
         trackball.endFrame(cursor);
@@ -147,21 +156,20 @@ struct OrbitalTrackballRotation {
     }
 
     bool stepInertia(float dt, float damping) noexcept {
-        constexpr float kThreshold = 1e-4f;
         constexpr float kMinDamping = 1e-6f;
-        if (std::abs(inertia_rot_speed) <= kThreshold) {
+        if (std::abs(inertia_rot_speed) <= kInertiaSpeedThreshold) {
             return false;
         }
         if (!std::isfinite(dt) || dt <= 0.0f || !std::isfinite(damping) || damping <= kMinDamping) {
             inertia_rot_speed = 0.0f;
             return false;
         }
-        const vne::math::Quatf q = vne::math::Quatf::fromAxisAngle(inertia_rot_axis, inertia_rot_speed * dt);
-        orientation = (q * orientation).normalized();
-        inertia_rot_speed = vne::math::damp(inertia_rot_speed, 0.0f, 1.0f / damping, dt);
+        const vne::math::Quatf q = quatFromAxisAngle(inertia_rot_axis, inertia_rot_speed * dt);
+        orientation = normalizeQuat(q * orientation);
+        inertia_rot_speed = interactionDamp(inertia_rot_speed, 0.0f, 1.0f / damping, dt);
         normalize_counter++;
         if (normalize_counter >= kOrientationRenormalizePeriod) {
-            orientation = orientation.normalized();
+            orientation = normalizeQuat(orientation);
             normalize_counter = 0;
         }
         return true;
@@ -175,9 +183,9 @@ struct OrbitalTrackballRotation {
         buildReferenceFrame(up, ref_fwd, ref_right);
         const float yaw_rad = vne::math::degToRad(yaw_deg);
         const float pitch_rad = vne::math::degToRad(pitch_deg);
-        const float cp = vne::math::cos(pitch_rad);
-        vne::math::Vec3f front = (ref_fwd * vne::math::cos(yaw_rad) + ref_right * vne::math::sin(yaw_rad)) * cp
-                                 + up * vne::math::sin(pitch_rad);
+        const float cp = interactionCos(pitch_rad);
+        vne::math::Vec3f front = (ref_fwd * interactionCos(yaw_rad) + ref_right * interactionSin(yaw_rad)) * cp
+                                 + up * interactionSin(pitch_rad);
         const float front_len = front.length();
         front = (front_len < kVectorEpsilon) ? ref_fwd : (front / front_len);
         const bool polar_pitch = std::abs(std::abs(pitch_rad) - vne::math::kHalfPi) <= 1e-3f;
@@ -215,7 +223,7 @@ struct OrbitalTrackballRotation {
                                    vne::math::Vec4f(u.x(), u.y(), u.z(), 0.0f),
                                    vne::math::Vec4f(back.x(), back.y(), back.z(), 0.0f),
                                    vne::math::Vec4f(0.0f, 0.0f, 0.0f, 1.0f));
-        orientation = vne::math::Quatf(rot).normalized();
+        orientation = normalizeQuat(vne::math::Quatf(rot));
         normalize_counter = 0;
     }
 
@@ -288,6 +296,29 @@ struct OrbitalAnimation {
         elapsed = 0.0f;
         animate_rotation = false;
     }
+
+    /**
+     * Eased pivot, distance and (when @c animate_rotation) orientation @p at_s seconds into the animation.
+     * @return true when @p at_s reaches the end (the outputs are then exactly the targets)
+     */
+    bool sample(float at_s, vne::math::Vec3f& coi, float& dist, vne::math::Quatf& rot) const noexcept {
+        const float t = vne::math::clamp(at_s / duration, 0.0f, 1.0f);
+        if (t >= 1.0f) {
+            coi = coi_to;
+            dist = dist_to;
+            if (animate_rotation) {
+                rot = rot_to;
+            }
+            return true;
+        }
+        const float et = vne::math::ease(easing, t);
+        dist = dist_from + (dist_to - dist_from) * et;
+        coi = coi_from + (coi_to - coi_from) * et;
+        if (animate_rotation) {
+            rot = slerpQuat(rot_from, rot_to, et);
+        }
+        return false;
+    }
 };
 
 namespace {
@@ -303,9 +334,21 @@ constexpr float kInertiaPanSpeedThreshold = 1e-4f;
 constexpr float kZoomToCursorStrength = 0.5f;
 /** Minimum @a delta_time (seconds) for pan inertia EMA sampling; skips noisy ultra-short frames. */
 constexpr double kMinDeltaTimeForInertia = 0.001;
+constexpr float kMaxLatencyLeadS = 0.1f;
+constexpr float kMaxLatencyLeadAngleDeg = 45.0f;
+constexpr float kLatencyLeadSettleRate = 30.0f;   // released lead decays as e^(-rate·t): ~0.1 s to settle
+constexpr float kLatencyLeadSettleAngle = 1e-4f;  // released lead below this (rad) is dropped
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers) — degenerate cross-product length squared
 constexpr float kRightVectorLenSqEpsilon = 1e-12f;
 constexpr float kZoomCursorMaxOrbitFactor = 2.0f;
+/** Cursor travel (pixels) within which a depth-anchored zoom keeps its surface point. */
+constexpr float kDepthAnchorTolerancePx = 3.0f;
+/** Minimum |dot| between orbit orientations for the camera to count as not rotated since a depth request. */
+constexpr float kDepthAnchorOrientationDot = 0.99999f;
+/** Eye drift, relative to orbit distance, beyond which the camera counts as moved since the last anchored zoom. */
+constexpr float kDepthAnchorEyeTolerance = 1e-4f;
+/** Step (seconds) over which getMotionState differentiates a running animation. */
+constexpr float kMotionSampleStepS = 1.0f / 120.0f;
 constexpr float kAabbCenterScale = 0.5f;
 constexpr float kPerspWorldUnitsScale = 2.0f;
 constexpr float kYawDegBack = 180.0f;
@@ -373,6 +416,16 @@ void viewDirectionYawPitch(ViewDirection dir, float& yaw, float& pitch) noexcept
     return view_dir_unit.cross(right).normalized();
 }
 
+/** Orbit pose as applyToCamera writes it: eye @a dist behind @a coi along the back axis of @a rot. */
+void setOrbitPose(CameraPoseSnapshot& pose,
+                  const vne::math::Vec3f& coi,
+                  float dist,
+                  const vne::math::Quatf& rot) noexcept {
+    pose.orientation = normalizeQuat(rot);
+    pose.target = coi;
+    pose.position = coi + pose.orientation.getZAxis() * dist;
+}
+
 }  // namespace
 
 // ---------------------------------------------------------------------------
@@ -414,6 +467,7 @@ void TrackballManipulator::setCamera(std::shared_ptr<vne::scene::ICamera> camera
     if (!camera_) {
         VNE_LOG_DEBUG << "TrackballManipulator: camera detached (null camera)";
     }
+    cancelDepthRequests();
     syncFromCamera();
 }
 
@@ -440,6 +494,12 @@ void TrackballManipulator::syncFromCamera() noexcept {
     if (!camera_) {
         return;
     }
+    if (latency_lead_releasing_) {
+        // The camera already shows the led pose: adopt it rather than jump back to the plain pose
+        clearLatencyLead();
+    } else {
+        dropLatencyLead();
+    }
     syncCoiAndDistanceFromCamera();
     orbital_rot_->syncFromCamera(camera_, coi_world_, world_up_);
 }
@@ -448,12 +508,104 @@ void TrackballManipulator::applyToCamera() noexcept {
     if (!camera_) {
         return;
     }
-    const vne::math::Vec3f back = orbital_rot_->computeBackDirection();
+    vne::math::Vec3f back = orbital_rot_->computeBackDirection();
+    vne::math::Vec3f up_hint = orbital_rot_->computeUpHint();
+    vne::math::Vec3f coi = coi_world_;
+    if (latency_lead_active_) {
+        const vne::math::Quatf lead = normalizeQuat(latency_rot_lead_ * orbital_rot_->orientation);
+        back = lead.getZAxis();
+        up_hint = lead.getYAxis();
+        coi += latency_pan_lead_;
+    }
     const vne::math::Vec3f view_dir = (-back).normalized();
-    const vne::math::Vec3f up_hint = orbital_rot_->computeUpHint();
     const vne::math::Vec3f up = stableCameraUpForLookAt(up_hint, view_dir, world_up_);
-    camera_->lookAt(coi_world_ + back * orbit_distance_, coi_world_, up);
-    camera_->updateMatrices();
+    camera_->lookAt(coi + back * orbit_distance_, coi, up);
+    updateCameraMatrices(*camera_);
+}
+
+// ---------------------------------------------------------------------------
+// Latency compensation
+// ---------------------------------------------------------------------------
+
+void TrackballManipulator::setLatencyCompensation(float lead_time_s) noexcept {
+    latency_lead_s_ = std::isfinite(lead_time_s) ? vne::math::clamp(lead_time_s, 0.0f, kMaxLatencyLeadS) : 0.0f;
+    if (latency_lead_s_ <= 0.0f) {
+        dropLatencyLead();
+    }
+}
+
+void TrackballManipulator::setLatencyCompensationMaxAngle(float degrees) noexcept {
+    if (std::isfinite(degrees)) {
+        latency_max_angle_deg_ = vne::math::clamp(degrees, 0.0f, kMaxLatencyLeadAngleDeg);
+    }
+}
+
+void TrackballManipulator::updateLatencyLead(bool rotating, double delta_time) noexcept {
+    if (latency_lead_s_ <= 0.0f) {
+        return;
+    }
+    const float max_angle = vne::math::degToRad(latency_max_angle_deg_);
+    if (rotating) {
+        const vne::math::Quatf& curr = orbital_rot_->orientation;
+        updateAngularVelocity(latency_rot_velocity_, latency_prev_rot_, curr, delta_time, kPanVelocityBlendRate);
+        latency_prev_rot_ = curr;
+        vne::math::Vec3f lead = latency_rot_velocity_ * latency_lead_s_;
+        const float angle = lead.length();
+        if (angle > max_angle && angle > kEpsilon) {
+            lead *= max_angle / angle;
+        }
+        latency_rot_lead_ = quatFromRotationVector(lead);
+        latency_pan_lead_ = vne::math::Vec3f(0.0f, 0.0f, 0.0f);
+    } else {
+        if (pivot_mode_ == OrbitPivotMode::eFixed) {
+            return;  // Pan moves the camera directly in eFixed; there is no separate display pose to lead.
+        }
+        vne::math::Vec3f lead = inertia_pan_velocity_ * latency_lead_s_;
+        const float max_len = orbit_distance_ * interactionTan(max_angle);
+        const float len = lead.length();
+        if (len > max_len && len > kEpsilon) {
+            lead *= max_len / len;
+        }
+        latency_rot_lead_ = vne::math::Quatf(0.0f, 0.0f, 0.0f, 1.0f);
+        latency_pan_lead_ = lead;
+    }
+    latency_lead_active_ = true;
+    latency_lead_releasing_ = false;
+}
+
+void TrackballManipulator::releaseLatencyLead() noexcept {
+    latency_lead_releasing_ = latency_lead_active_;
+}
+
+void TrackballManipulator::settleLatencyLead(double delta_time) noexcept {
+    if (!latency_lead_releasing_ || !std::isfinite(delta_time) || delta_time <= 0.0) {
+        return;
+    }
+    const float keep = interactionExp(-kLatencyLeadSettleRate * static_cast<float>(delta_time));
+    const vne::math::Vec3f rot_lead = quatToRotationVector(latency_rot_lead_) * keep;
+    latency_pan_lead_ *= keep;
+    if (rot_lead.length() < kLatencyLeadSettleAngle
+        && latency_pan_lead_.length() < kLatencyLeadSettleAngle * orbit_distance_) {
+        dropLatencyLead();
+        return;
+    }
+    latency_rot_lead_ = quatFromRotationVector(rot_lead);
+    applyToCamera();
+}
+
+void TrackballManipulator::clearLatencyLead() noexcept {
+    latency_lead_active_ = false;
+    latency_lead_releasing_ = false;
+    latency_rot_lead_ = vne::math::Quatf(0.0f, 0.0f, 0.0f, 1.0f);
+    latency_pan_lead_ = vne::math::Vec3f(0.0f, 0.0f, 0.0f);
+}
+
+void TrackballManipulator::dropLatencyLead() noexcept {
+    if (!latency_lead_active_) {
+        return;
+    }
+    clearLatencyLead();
+    applyToCamera();
 }
 
 void TrackballManipulator::onPivotChanged() noexcept {
@@ -471,17 +623,21 @@ void TrackballManipulator::beginRotate(float x_px, float y_px) noexcept {
     interaction_.last_y_px = y_px;
     syncFromCamera();
     orbital_rot_->beginRotate(x_px, y_px, camera_, coi_world_, world_up_, viewport(), graphicsApi());
+    latency_prev_rot_ = orbital_rot_->orientation;
+    latency_rot_velocity_ = vne::math::Vec3f(0.0f, 0.0f, 0.0f);
 }
 
 void TrackballManipulator::dragRotate(
     float x_px, float y_px, float /*delta_x_px*/, float /*delta_y_px*/, double delta_time) noexcept {
     orbital_rot_
         ->dragRotate(x_px, y_px, delta_time, rotation_speed_, trackball_rotation_scale_, viewport(), graphicsApi());
+    updateLatencyLead(true, delta_time);
     applyToCamera();
 }
 
 void TrackballManipulator::endRotate(double /*delta_time*/) noexcept {
     interaction_.rotating = false;
+    releaseLatencyLead();
     orbital_rot_->endRotate(rotation_inertia_enabled_);
 }
 
@@ -505,7 +661,7 @@ void TrackballManipulator::applyPanDeltaWorld(const vne::math::Vec3f& delta_worl
     if (pivot_mode_ == OrbitPivotMode::eFixed) {
         camera_->setPosition(camera_->getPosition() + delta_world);
         camera_->setTarget(camera_->getTarget() + delta_world);
-        camera_->updateMatrices();
+        updateCameraMatrices(*camera_);
         orbit_distance_ = std::max((camera_->getPosition() - coi_world_).length(), kMinOrbitDistance);
     } else {
         coi_world_ += delta_world;
@@ -515,9 +671,7 @@ void TrackballManipulator::applyPanDeltaWorld(const vne::math::Vec3f& delta_worl
 
 void TrackballManipulator::updatePanInertiaFromDragSample(const vne::math::Vec3f& delta_world,
                                                           double delta_time) noexcept {
-    if (!pan_inertia_enabled_) {
-        return;
-    }
+    // Tracked with inertia off too: it is the drag speed reported by getMotionState
     constexpr double kMinDt = kMinDeltaTimeForInertia;
     const double dt = delta_time;
     if (!std::isfinite(dt) || dt <= 0.0 || dt < kMinDt) {
@@ -528,7 +682,7 @@ void TrackballManipulator::updatePanInertiaFromDragSample(const vne::math::Vec3f
         return;
     }
     const vne::math::Vec3f sample = delta_world * static_cast<float>(inv);
-    const float blend = 1.0f - std::exp(-kPanVelocityBlendRate * static_cast<float>(dt));
+    const float blend = 1.0f - interactionExp(-kPanVelocityBlendRate * static_cast<float>(dt));
     inertia_pan_velocity_ = inertia_pan_velocity_ + (sample - inertia_pan_velocity_) * blend;
 }
 
@@ -547,7 +701,7 @@ void TrackballManipulator::dragPan(
 
     if (auto persp = perspCamera()) {
         const float fov_y_rad = vne::math::degToRad(persp->getFieldOfView());
-        const float half_h = orbit_distance_ * vne::math::tan(fov_y_rad * 0.5f);
+        const float half_h = orbit_distance_ * interactionTan(fov_y_rad * 0.5f);
         const float half_w = (vh > 0.0f) ? half_h * (vw / vh) : half_h;
         delta_world = r * (-ndc_d.x() * half_w * pan_speed_) + u * (-ndc_d.y() * half_h * pan_speed_);
     } else if (auto ortho = orthoCamera()) {
@@ -556,16 +710,19 @@ void TrackballManipulator::dragPan(
         delta_world = r * (-ndc_d.x() * half_w * pan_speed_) + u * (-ndc_d.y() * half_h * pan_speed_);
     }
 
-    applyPanDeltaWorld(delta_world);
     updatePanInertiaFromDragSample(delta_world, delta_time);
+    updateLatencyLead(false, delta_time);
+    applyPanDeltaWorld(delta_world);
 }
 
 void TrackballManipulator::endPan(double) noexcept {
     interaction_.panning = false;
+    releaseLatencyLead();
     if (!pan_inertia_enabled_) {
         inertia_pan_velocity_ = vne::math::Vec3f(0.0f, 0.0f, 0.0f);
     }
-    if (pivot_mode_ == OrbitPivotMode::eViewCenter && camera_) {
+    // While a lead blends out the camera is ahead of the orbit state, which stays authoritative
+    if (pivot_mode_ == OrbitPivotMode::eViewCenter && camera_ && !latency_lead_active_) {
         coi_world_ = camera_->getTarget();
         orbit_distance_ = std::max((camera_->getPosition() - coi_world_).length(), kMinOrbitDistance);
         onPivotChanged();
@@ -581,6 +738,7 @@ void TrackballManipulator::dispatchZoom(float factor, float mx, float my) noexce
         return;
     }
     anim_->stop();
+    recordZoom(zoom_method_ == ZoomMethod::eDollyToCoi ? interactionPow(factor, zoom_speed_) : factor);
     switch (zoom_method_) {
         case ZoomMethod::eSceneScale:
             CameraManipulatorBase::applySceneScaleZoom(factor);
@@ -599,7 +757,7 @@ void TrackballManipulator::applyDolly(float factor, float mx, float my) noexcept
         return;
     }
     syncFromCamera();
-    const float effective_factor = std::pow(factor, zoom_speed_);
+    const float effective_factor = interactionPow(factor, zoom_speed_);
 
     if (orthoCamera()) {
         CameraManipulatorBase::applyOrthoZoomToCursor(effective_factor, mx, my);
@@ -607,6 +765,33 @@ void TrackballManipulator::applyDolly(float factor, float mx, float my) noexcept
         return;
     }
     if (auto persp = perspCamera()) {
+        if (depth_query_ && pivot_mode_ != OrbitPivotMode::eFixed && !isZoomAnchorUsable(mx, my)) {
+            zoom_anchor_valid_ = false;
+            const bool same_cursor = zoom_depth_request_ != IDepthQuery::kNoRequest
+                                     && std::abs(mx - zoom_depth_px_.x()) <= kDepthAnchorTolerancePx
+                                     && std::abs(my - zoom_depth_px_.y()) <= kDepthAnchorTolerancePx;
+            if (!same_cursor) {
+                if (zoom_depth_request_ != IDepthQuery::kNoRequest) {
+                    depth_query_->cancelDepth(zoom_depth_request_);
+                }
+                zoom_depth_request_ = depth_query_->requestDepth(makeDepthRequest(mx, my));
+                zoom_depth_px_ = vne::math::Vec2f(mx, my);
+                zoom_depth_orientation_ = orbital_rot_->orientation;
+                pollDepthRequests();
+            }
+        }
+        if (pivot_mode_ != OrbitPivotMode::eFixed && isZoomAnchorUsable(mx, my)) {
+            // Scale eye and COI about the surface point: it stays under the cursor, orientation is unchanged.
+            const float new_dist =
+                vne::math::clamp(orbit_distance_ * effective_factor, kMinOrbitDistance, kMaxOrbitDistance);
+            const float scale = new_dist / orbit_distance_;
+            coi_world_ = zoom_anchor_world_ + (coi_world_ - zoom_anchor_world_) * scale;
+            orbit_distance_ = new_dist;
+            applyToCamera();
+            syncCoiAndDistanceFromCamera();
+            zoom_anchor_eye_ = camera_->getPosition();
+            return;
+        }
         const float old_dist = orbit_distance_;
         orbit_distance_ = vne::math::clamp(orbit_distance_ * effective_factor, kMinOrbitDistance, kMaxOrbitDistance);
         const vne::math::Vec3f r = orbital_rot_->viewRight();
@@ -616,7 +801,7 @@ void TrackballManipulator::applyDolly(float factor, float mx, float my) noexcept
         if (vw > 0.0f && vh > 0.0f) {
             const vne::math::Vec2f ndc = mouseWindowToNDC(mx, my, vw, vh, graphicsApi());
             const float fov_y_rad = vne::math::degToRad(persp->getFieldOfView());
-            const float half_h = old_dist * vne::math::tan(fov_y_rad * 0.5f);
+            const float half_h = old_dist * interactionTan(fov_y_rad * 0.5f);
             const float half_w = half_h * (vw / vh);
             const vne::math::Vec3f cursor_world = coi_world_ + r * (ndc.x() * half_w) + u * (ndc.y() * half_h);
             const vne::math::Vec3f to_cursor = cursor_world - coi_world_;
@@ -631,6 +816,99 @@ void TrackballManipulator::applyDolly(float factor, float mx, float my) noexcept
     }
 }
 
+// ---------------------------------------------------------------------------
+// Depth queries
+// ---------------------------------------------------------------------------
+
+void TrackballManipulator::setDepthQuery(std::shared_ptr<IDepthQuery> query) noexcept {
+    cancelDepthRequests();
+    depth_query_ = std::move(query);
+}
+
+DepthRequest TrackballManipulator::makeDepthRequest(float mx, float my) const noexcept {
+    DepthRequest request;
+    request.x_px = mx;
+    request.y_px = my;
+    if (!camera_) {
+        return request;
+    }
+    const float vw = viewportWidth();
+    const float vh = viewportHeight();
+    const vne::math::Vec2f ndc =
+        (vw > 0.0f && vh > 0.0f) ? mouseWindowToNDC(mx, my, vw, vh, graphicsApi()) : vne::math::Vec2f(0.0f, 0.0f);
+    const vne::math::Vec3f front = orbital_rot_->viewFront();
+    const vne::math::Vec3f r = orbital_rot_->viewRight();
+    const vne::math::Vec3f u = orbital_rot_->viewUp();
+    const vne::math::Vec3f eye = camera_->getPosition();
+    request.ray_origin = eye;
+    request.ray_direction = front;
+    if (auto ortho = orthoCamera()) {
+        request.ray_origin = eye + r * (ndc.x() * ortho->getWidth() * 0.5f) + u * (ndc.y() * ortho->getHeight() * 0.5f);
+    } else if (auto persp = perspCamera()) {
+        const float half_h = interactionTan(vne::math::degToRad(persp->getFieldOfView()) * 0.5f);
+        const float half_w = vh > 0.0f ? half_h * (vw / vh) : half_h;
+        request.ray_direction = (front + r * (ndc.x() * half_w) + u * (ndc.y() * half_h)).normalized();
+    }
+    return request;
+}
+
+void TrackballManipulator::pollDepthRequests() noexcept {
+    if (!depth_query_) {
+        return;
+    }
+    vne::math::Vec3f point(0.0f, 0.0f, 0.0f);
+    if (pivot_depth_request_ != IDepthQuery::kNoRequest) {
+        const DepthQueryStatus status = depth_query_->pollDepth(pivot_depth_request_, point);
+        if (status != DepthQueryStatus::ePending) {
+            pivot_depth_request_ = IDepthQuery::kNoRequest;
+        }
+        if (status == DepthQueryStatus::eHit && camera_) {
+            setPivot(point, CenterOfInterestSpace::eWorldSpace);
+        }
+    }
+    if (zoom_depth_request_ != IDepthQuery::kNoRequest) {
+        const DepthQueryStatus status = depth_query_->pollDepth(zoom_depth_request_, point);
+        if (status != DepthQueryStatus::ePending) {
+            zoom_depth_request_ = IDepthQuery::kNoRequest;
+        }
+        // A hit is only meaningful while the view still looks the way it did when the request was issued.
+        if (status == DepthQueryStatus::eHit && camera_
+            && std::abs(zoom_depth_orientation_.dot(orbital_rot_->orientation)) >= kDepthAnchorOrientationDot) {
+            zoom_anchor_world_ = point;
+            zoom_anchor_px_ = zoom_depth_px_;
+            zoom_anchor_eye_ = camera_->getPosition();
+            zoom_anchor_valid_ = true;
+        }
+    }
+}
+
+void TrackballManipulator::cancelDepthRequests() noexcept {
+    if (depth_query_) {
+        if (pivot_depth_request_ != IDepthQuery::kNoRequest) {
+            depth_query_->cancelDepth(pivot_depth_request_);
+        }
+        if (zoom_depth_request_ != IDepthQuery::kNoRequest) {
+            depth_query_->cancelDepth(zoom_depth_request_);
+        }
+    }
+    pivot_depth_request_ = IDepthQuery::kNoRequest;
+    zoom_depth_request_ = IDepthQuery::kNoRequest;
+    zoom_anchor_valid_ = false;
+}
+
+bool TrackballManipulator::isZoomAnchorUsable(float mx, float my) const noexcept {
+    if (!zoom_anchor_valid_ || !camera_) {
+        return false;
+    }
+    if (std::abs(mx - zoom_anchor_px_.x()) > kDepthAnchorTolerancePx
+        || std::abs(my - zoom_anchor_px_.y()) > kDepthAnchorTolerancePx) {
+        return false;
+    }
+    const float eye_tolerance = kDepthAnchorEyeTolerance * std::max(orbit_distance_, 1.0f);
+    return (camera_->getPosition() - zoom_anchor_eye_).length() <= eye_tolerance
+           && std::abs(zoom_depth_orientation_.dot(orbital_rot_->orientation)) >= kDepthAnchorOrientationDot;
+}
+
 // ---------------------------------------------------------------------------
 // Inertia
 // ---------------------------------------------------------------------------
@@ -650,7 +928,7 @@ void TrackballManipulator::applyInertia(double delta_time) noexcept {
     bool pan_changed = false;
     if (pan_inertia_enabled_ && inertia_pan_velocity_.length() > kInertiaPanSpeedThreshold) {
         const vne::math::Vec3f delta = inertia_pan_velocity_ * dt;
-        inertia_pan_velocity_ *= std::exp(-pan_damping_ * dt);
+        inertia_pan_velocity_ *= interactionExp(-pan_damping_ * dt);
         if (pivot_mode_ == OrbitPivotMode::eFixed) {
             pan_delta_fixed = delta;
         } else {
@@ -667,50 +945,35 @@ void TrackballManipulator::applyInertia(double delta_time) noexcept {
         const vne::math::Vec3f new_eye = camera_->getPosition() + pan_delta_fixed;
         const vne::math::Vec3f new_target = camera_->getTarget() + pan_delta_fixed;
         camera_->lookAt(new_eye, new_target, camera_->getUp());
-        camera_->updateMatrices();
+        updateCameraMatrices(*camera_);
         orbit_distance_ = std::max((camera_->getPosition() - coi_world_).length(), kMinOrbitDistance);
     }
 }
 
 // ---------------------------------------------------------------------------
-// fitToAABB
+// fitToAABB / fitToPoints / fitToBoxes
 // ---------------------------------------------------------------------------
 
-void TrackballManipulator::fitToAABB(const vne::math::Vec3f& min_world, const vne::math::Vec3f& max_world) noexcept {
+void TrackballManipulator::fitToAABB(const vne::math::Vec3f& min_world,
+                                     const vne::math::Vec3f& max_world,
+                                     FitBoundsMode mode) noexcept {
     if (!camera_) {
         return;
     }
-    const vne::math::Vec3f center = (min_world + max_world) * kAabbCenterScale;
-    const vne::math::Vec3f extents = max_world - min_world;
-    float radius = extents.length() * kAabbCenterScale;
-    if (radius < kEpsilon) {
-        radius = kMinRadiusFallback;
-    }
-
-    if (auto persp = perspCamera()) {
-        const float fov_y_rad = vne::math::degToRad(persp->getFieldOfView());
-        const float height = std::max(viewport().height, CameraManipulatorBase::kMinOrthoExtent);
-        const float aspect = std::max(viewport().width / height, CameraManipulatorBase::kMinOrthoExtent);
-        const float fov_x_rad = 2.0f * vne::math::atan(vne::math::tan(fov_y_rad * 0.5f) * aspect);
-        const float dist_y = radius / vne::math::tan(fov_y_rad * 0.5f);
-        const float dist_x = radius / vne::math::tan(fov_x_rad * 0.5f);
-        const float dist_target = std::max(dist_x, dist_y) * kFitToAabbMargin;
-        if (fit_anim_duration_ <= 0.0f || !orbit_animation_enabled_) {
-            coi_world_ = center;
-            orbit_distance_ = dist_target;
-            anim_->stop();
-            applyToCamera();
-            onPivotChanged();
-            return;
-        }
-        anim_->coi_from = coi_world_;
-        anim_->coi_to = center;
-        anim_->dist_from = orbit_distance_;
-        anim_->dist_to = dist_target;
-        anim_->animate_rotation = false;
-        anim_->start(fit_anim_duration_);
+    if (mode != FitBoundsMode::eBoundingSphere) {
+        BoundingBox box;
+        box.min_corner = min_world;
+        box.max_corner = max_world;
+        fitToSet(std::span<const BoundingBox>(&box, 1), mode, {});
         return;
-    } else if (auto ortho = orthoCamera()) {
+    }
+    FitVolume volume;
+    volume.center = (min_world + max_world) * kAabbCenterScale;
+    if (perspCamera()) {
+        const float radius = (max_world - min_world).length() * kAabbCenterScale;
+        volume.half_right = radius;
+        volume.half_up = radius;
+    } else {
         const vne::math::Vec3f r = orbital_rot_->viewRight();
         const vne::math::Vec3f u = orbital_rot_->viewUp();
         const vne::math::Vec3f corners[8] = {
@@ -723,15 +986,85 @@ void TrackballManipulator::fitToAABB(const vne::math::Vec3f& min_world, const vn
             {min_world.x(), max_world.y(), max_world.z()},
             max_world,
         };
-        float max_r = 0.0f;
-        float max_u = 0.0f;
         for (const auto& c : corners) {
-            const vne::math::Vec3f d = c - center;
-            max_r = std::max(max_r, std::abs(d.dot(r)));
-            max_u = std::max(max_u, std::abs(d.dot(u)));
+            const vne::math::Vec3f d = c - volume.center;
+            volume.half_right = std::max(volume.half_right, std::abs(d.dot(r)));
+            volume.half_up = std::max(volume.half_up, std::abs(d.dot(u)));
+        }
+    }
+    fitToVolume(volume);
+}
+
+void TrackballManipulator::fitToPoints(std::span<const vne::math::Vec3f> points,
+                                       FitBoundsMode mode,
+                                       const ControllerExecutor& executor) noexcept {
+    fitToSet(points, mode, executor);
+}
+
+void TrackballManipulator::fitToBoxes(std::span<const BoundingBox> boxes,
+                                      FitBoundsMode mode,
+                                      const ControllerExecutor& executor) noexcept {
+    fitToSet(boxes, mode, executor);
+}
+
+template <typename T>
+void TrackballManipulator::fitToSet(std::span<const T> items,
+                                    FitBoundsMode mode,
+                                    const ControllerExecutor& executor) noexcept {
+    if (!camera_) {
+        return;
+    }
+    vne::math::Vec3f r;
+    vne::math::Vec3f u;
+    vne::math::Vec3f f;
+    cameraViewAxes(*camera_, r, u, f);
+    if (auto persp = perspCamera(); persp && mode == FitBoundsMode::eFrustum) {
+        // The margin narrows the frustum instead of scaling the distance: a border of the same screen fraction
+        const float fov_y_rad = vne::math::degToRad(persp->getFieldOfView());
+        const float tan_half_y = interactionTan(fov_y_rad * 0.5f) / kFitToAabbMargin;
+        const float height = std::max(viewport().height, CameraManipulatorBase::kMinOrthoExtent);
+        const float aspect = std::max(viewport().width / height, CameraManipulatorBase::kMinOrthoExtent);
+        FrustumFit fit;
+        if (!computeFrustumFit(items, r, u, f, tan_half_y * aspect, tan_half_y, fit, executor)) {
+            VNE_LOG_WARN << "TrackballManipulator: fit called without finite input";
+            return;
+        }
+        if (fit.distance < kEpsilon) {
+            FitVolume point;  // everything at one point: the usual fallback radius
+            point.center = fit.center;
+            fitToVolume(point);
+            return;
+        }
+        fitToOrbit(fit.center, fit.distance);
+        return;
+    }
+    FitVolume volume;
+    if (!computeFitVolume(items, r, u, f, mode, volume, executor)) {
+        VNE_LOG_WARN << "TrackballManipulator: fit called without finite input";
+        return;
+    }
+    fitToVolume(volume);
+}
+
+void TrackballManipulator::fitToVolume(const FitVolume& volume) noexcept {
+    if (auto persp = perspCamera()) {
+        float half_right = volume.half_right;
+        float half_up = volume.half_up;
+        if (std::max(half_right, half_up) < kEpsilon) {
+            half_right = kMinRadiusFallback;
+            half_up = kMinRadiusFallback;
         }
-        max_r = std::max(max_r * kFitToAabbMargin, CameraManipulatorBase::kMinOrthoExtent);
-        max_u = std::max(max_u * kFitToAabbMargin, CameraManipulatorBase::kMinOrthoExtent);
+        const float fov_y_rad = vne::math::degToRad(persp->getFieldOfView());
+        const float height = std::max(viewport().height, CameraManipulatorBase::kMinOrthoExtent);
+        const float aspect = std::max(viewport().width / height, CameraManipulatorBase::kMinOrthoExtent);
+        const float fov_x_rad = 2.0f * interactionAtan(interactionTan(fov_y_rad * 0.5f) * aspect);
+        const float dist_y = half_up / interactionTan(fov_y_rad * 0.5f);
+        const float dist_x = half_right / interactionTan(fov_x_rad * 0.5f);
+        // The near face of the volume sits half_depth in front of the center
+        fitToOrbit(volume.center, (std::max(dist_x, dist_y) + volume.half_depth) * kFitToAabbMargin);
+    } else if (auto ortho = orthoCamera()) {
+        float max_r = std::max(volume.half_right * kFitToAabbMargin, CameraManipulatorBase::kMinOrthoExtent);
+        float max_u = std::max(volume.half_up * kFitToAabbMargin, CameraManipulatorBase::kMinOrthoExtent);
         const float safe_h = std::max(viewport().height, CameraManipulatorBase::kMinOrthoExtent);
         const float aspect = std::max(viewport().width / safe_h, CameraManipulatorBase::kMinOrthoExtent);
         if (max_r / max_u < aspect) {
@@ -740,13 +1073,30 @@ void TrackballManipulator::fitToAABB(const vne::math::Vec3f& min_world, const vn
             max_u = max_r / aspect;
         }
         ortho->setBounds(-max_r, max_r, -max_u, max_u, ortho->getNearPlane(), ortho->getFarPlane());
-        coi_world_ = center;
+        coi_world_ = volume.center;
         anim_->stop();
         applyToCamera();
         onPivotChanged();
     }
 }
 
+void TrackballManipulator::fitToOrbit(const vne::math::Vec3f& coi, float distance) noexcept {
+    if (fit_anim_duration_ <= 0.0f || !orbit_animation_enabled_) {
+        coi_world_ = coi;
+        orbit_distance_ = distance;
+        anim_->stop();
+        applyToCamera();
+        onPivotChanged();
+        return;
+    }
+    anim_->coi_from = coi_world_;
+    anim_->coi_to = coi;
+    anim_->dist_from = orbit_distance_;
+    anim_->dist_to = distance;
+    anim_->animate_rotation = false;
+    anim_->start(fit_anim_duration_);
+}
+
 // ---------------------------------------------------------------------------
 // getWorldUnitsPerPixel
 // ---------------------------------------------------------------------------
@@ -761,7 +1111,7 @@ float TrackballManipulator::getWorldUnitsPerPixel() const noexcept {
     }
     if (auto persp = perspCamera()) {
         const float fov_y_rad = vne::math::degToRad(persp->getFieldOfView());
-        return kPerspWorldUnitsScale * orbit_distance_ * vne::math::tan(fov_y_rad * kAabbCenterScale) / vh;
+        return kPerspWorldUnitsScale * orbit_distance_ * interactionTan(fov_y_rad * kAabbCenterScale) / vh;
     }
     return 0.0f;
 }
@@ -771,13 +1121,33 @@ float TrackballManipulator::getWorldUnitsPerPixel() const noexcept {
 // ---------------------------------------------------------------------------
 
 void TrackballManipulator::resetState() noexcept {
+    dropLatencyLead();
     interaction_.rotating = false;
     interaction_.panning = false;
     inertia_pan_velocity_ = vne::math::Vec3f(0.0f, 0.0f, 0.0f);
     anim_->stop();
+    cancelDepthRequests();
+    clearZoomRate();
     orbital_rot_->reset(camera_, coi_world_, world_up_);
 }
 
+void TrackballManipulator::onHandoff(const CameraPoseSnapshot& pose) noexcept {
+    clearLatencyLead();
+    interaction_.rotating = false;
+    interaction_.panning = false;
+    inertia_pan_velocity_ = vne::math::Vec3f(0.0f, 0.0f, 0.0f);
+    anim_->stop();
+    if (pivot_mode_ != OrbitPivotMode::eFixed) {
+        coi_world_ = pose.target;
+    }
+    orbit_distance_ = vne::math::clamp((pose.position - coi_world_).length(), kMinOrbitDistance, kMaxOrbitDistance);
+    orbital_rot_->setOrientationQuat(pose.orientation);
+    if (pivot_mode_ == OrbitPivotMode::eFixed) {
+        // Fixed pivot may sit off the view axis: orbit frame looks from the eye at the pivot, as syncFromCamera does.
+        orbital_rot_->syncFromEye(pose.position, pose.orientation.getYAxis(), coi_world_, world_up_);
+    }
+}
+
 // ---------------------------------------------------------------------------
 // Public setters that need logic
 // ---------------------------------------------------------------------------
@@ -812,7 +1182,7 @@ void TrackballManipulator::setPivot(const vne::math::Vec3f& pos, CenterOfInteres
     }
     orbit_distance_ = std::max((camera_->getPosition() - coi_world_).length(), kMinOrbitDistance);
     camera_->setTarget(coi_world_);
-    camera_->updateMatrices();
+    updateCameraMatrices(*camera_);
     pivot_mode_ = OrbitPivotMode::eCoi;
     syncFromCamera();
 }
@@ -824,7 +1194,7 @@ void TrackballManipulator::setLandmark(const vne::math::Vec3f& world_pos) noexce
     if (camera_) {
         orbit_distance_ = std::max((camera_->getPosition() - coi_world_).length(), kMinOrbitDistance);
         camera_->setTarget(coi_world_);
-        camera_->updateMatrices();
+        updateCameraMatrices(*camera_);
     }
 }
 
@@ -878,6 +1248,122 @@ void TrackballManipulator::setOrbitAnimationEnabled(bool enabled) noexcept {
     }
 }
 
+// ---------------------------------------------------------------------------
+// Motion state
+// ---------------------------------------------------------------------------
+
+CameraMotionState TrackballManipulator::getMotionState() const noexcept {
+    CameraMotionState state;
+    if (!enabled_ || !camera_) {
+        return state;
+    }
+    state.zoom_rate = zoomRate();
+    if (orbit_animation_enabled_ && anim_->active) {
+        const float remaining = std::max(anim_->duration - anim_->elapsed, 0.0f);
+        state.animating = true;
+        state.settle_time_s = remaining;
+        const float h = std::min(remaining, kMotionSampleStepS);
+        if (h > kEpsilon) {
+            vne::math::Vec3f coi0 = coi_world_;
+            vne::math::Vec3f coi1 = coi_world_;
+            float dist0 = orbit_distance_;
+            float dist1 = orbit_distance_;
+            vne::math::Quatf rot0 = orbital_rot_->orientation;
+            vne::math::Quatf rot1 = orbital_rot_->orientation;
+            anim_->sample(anim_->elapsed, coi0, dist0, rot0);
+            anim_->sample(anim_->elapsed + h, coi1, dist1, rot1);
+            state.linear_speed = (coi1 - coi0).length() / h;
+            state.angular_speed = quatToRotationVector(normalizeQuat(rot1 * rot0.conjugate())).length() / h;
+            if (dist0 > kEpsilon && dist1 > kEpsilon) {
+                state.zoom_rate = std::log(dist1 / dist0) / h;
+            }
+        }
+        return state;
+    }
+
+    // Drag velocities are tracked whether or not inertia is on; only the enabled channels glide after release
+    const float rot_speed = std::abs(orbital_rot_->inertia_rot_speed);
+    const float pan_speed = inertia_pan_velocity_.length();
+    constexpr float kRotThreshold = OrbitalTrackballRotation::kInertiaSpeedThreshold;
+    const bool rot_glides = rotation_inertia_enabled_ && rot_speed > kRotThreshold;
+    const bool pan_glides = pan_inertia_enabled_ && pan_speed > kInertiaPanSpeedThreshold;
+    state.dragging = interaction_.rotating || interaction_.panning;
+    state.inertia = !state.dragging && (rot_glides || pan_glides);
+    if (interaction_.rotating || (!state.dragging && rot_glides)) {
+        state.angular_speed = rot_speed;
+    }
+    if (interaction_.panning || (!state.dragging && pan_glides)) {
+        state.linear_speed = pan_speed;
+    }
+    if (rot_glides) {
+        state.settle_time_s = decaySettleTime(rot_speed, rot_damping_, kRotThreshold);
+    }
+    if (pan_glides) {
+        state.settle_time_s =
+            std::max(state.settle_time_s, decaySettleTime(pan_speed, pan_damping_, kInertiaPanSpeedThreshold));
+    }
+    if (latency_lead_releasing_) {
+        // The released lead blending out is a short coast of its own
+        const float rot_lead = quatToRotationVector(latency_rot_lead_).length();
+        const float pan_lead = latency_pan_lead_.length();
+        const float lead = std::max(rot_lead, pan_lead / std::max(orbit_distance_, kMinOrbitDistance));
+        state.inertia = true;
+        state.angular_speed = std::max(state.angular_speed, rot_lead * kLatencyLeadSettleRate);
+        state.linear_speed = std::max(state.linear_speed, pan_lead * kLatencyLeadSettleRate);
+        state.settle_time_s =
+            std::max(state.settle_time_s, decaySettleTime(lead, kLatencyLeadSettleRate, kLatencyLeadSettleAngle));
+    }
+    return state;
+}
+
+CameraPoseSnapshot TrackballManipulator::predictPose(double seconds_ahead) const noexcept {
+    if (!camera_) {
+        return {};
+    }
+    CameraPoseSnapshot pose = captureCameraPose(*camera_);
+    if (!enabled_) {
+        return pose;
+    }
+    const float ahead = lookaheadSeconds(seconds_ahead);
+    vne::math::Vec3f pivot = coi_world_;
+    float glide = ahead;  // seconds of drag or inertia motion within the look-ahead
+    if (orbit_animation_enabled_ && anim_->active) {
+        float dist = orbit_distance_;
+        vne::math::Quatf rot = orbital_rot_->orientation;
+        anim_->sample(anim_->elapsed + ahead, pivot, dist, rot);
+        setOrbitPose(pose, pivot, dist, rot);
+        // Inertia is held while the animation runs and resumes once it ends
+        glide = std::max(anim_->elapsed + ahead - anim_->duration, 0.0f);
+    } else if (latency_lead_active_) {
+        // The camera shows the lead; predict from the drag itself
+        setOrbitPose(pose, coi_world_, orbit_distance_, orbital_rot_->orientation);
+    }
+    if (glide <= 0.0f) {
+        return pose;
+    }
+
+    const float rot_speed = orbital_rot_->inertia_rot_speed;
+    float angle = 0.0f;
+    if (interaction_.rotating) {
+        angle = rot_speed * glide;
+    } else if (rotation_inertia_enabled_ && std::abs(rot_speed) > OrbitalTrackballRotation::kInertiaSpeedThreshold) {
+        angle = rot_speed * decayTravelTime(glide, rot_damping_);
+    }
+    if (std::abs(angle) > kEpsilon) {
+        rotateCameraPose(pose, quatFromAxisAngle(orbital_rot_->inertia_rot_axis, angle), pivot);
+    }
+
+    vne::math::Vec3f pan(0.0f, 0.0f, 0.0f);
+    if (interaction_.panning) {
+        pan = inertia_pan_velocity_ * glide;
+    } else if (pan_inertia_enabled_ && inertia_pan_velocity_.length() > kInertiaPanSpeedThreshold) {
+        pan = inertia_pan_velocity_ * decayTravelTime(glide, pan_damping_);
+    }
+    pose.position += pan;
+    pose.target += pan;
+    return pose;
+}
+
 // ---------------------------------------------------------------------------
 // onUpdate
 // ---------------------------------------------------------------------------
@@ -886,25 +1372,20 @@ void TrackballManipulator::onUpdate(double delta_time) noexcept {
     if (!enabled_ || !camera_) {
         return;
     }
+    pollDepthRequests();
+    updateZoomRate(delta_time);
+    if (!interaction_.rotating && !interaction_.panning) {
+        settleLatencyLead(delta_time);
+    }
     if (orbit_animation_enabled_ && anim_->active && delta_time > 0.0) {
         anim_->elapsed += static_cast<float>(delta_time);
-        const float t = vne::math::clamp(anim_->elapsed / anim_->duration, 0.0f, 1.0f);
-        const float et = vne::math::ease(anim_->easing, t);
-
-        orbit_distance_ = anim_->dist_from + (anim_->dist_to - anim_->dist_from) * et;
-        coi_world_ = anim_->coi_from + (anim_->coi_to - anim_->coi_from) * et;
+        vne::math::Quatf rot = orbital_rot_->orientation;
+        const bool finished = anim_->sample(anim_->elapsed, coi_world_, orbit_distance_, rot);
         if (anim_->animate_rotation) {
-            orbital_rot_->setOrientationQuat(vne::math::Quatf::slerp(anim_->rot_from, anim_->rot_to, et));
+            orbital_rot_->setOrientationQuat(rot);
         }
         applyToCamera();
-
-        if (t >= 1.0f) {
-            orbit_distance_ = anim_->dist_to;
-            coi_world_ = anim_->coi_to;
-            if (anim_->animate_rotation) {
-                orbital_rot_->setOrientationQuat(anim_->rot_to);
-            }
-            applyToCamera();
+        if (finished) {
             anim_->stop();
             onPivotChanged();
         }
@@ -996,8 +1477,16 @@ bool TrackballManipulator::onAction(CameraActionType action,
             orbit_distance_ = std::max((camera_->getPosition() - coi_world_).length(), kMinOrbitDistance);
             pivot_mode_ = OrbitPivotMode::eCoi;
             camera_->setTarget(coi_world_);
-            camera_->updateMatrices();
+            updateCameraMatrices(*camera_);
             onPivotChanged();
+            if (depth_query_) {
+                // The view-ray COI above stays until the surface point under the cursor is known.
+                if (pivot_depth_request_ != IDepthQuery::kNoRequest) {
+                    depth_query_->cancelDepth(pivot_depth_request_);
+                }
+                pivot_depth_request_ = depth_query_->requestDepth(makeDepthRequest(payload.x_px, payload.y_px));
+                pollDepthRequests();
+            }
             return true;
         }
 
@@ -1039,4 +1528,128 @@ void TrackballManipulator::setOrientation(const vne::math::Quatf& rotation) noex
     applyToCamera();
 }
 
+// ---------------------------------------------------------------------------
+// State serialization
+// ---------------------------------------------------------------------------
+
+std::vector<std::uint8_t> TrackballManipulator::serialize() const {
+    detail::StateWriter out(detail::StateBlobKind::eTrackballManipulator);
+    out.flags({enabled_,
+               rotation_inertia_enabled_,
+               pan_inertia_enabled_,
+               rotate_enabled_,
+               pan_enabled_,
+               orbit_animation_enabled_,
+               static_cast<bool>(camera_)});
+    out.enumU8(zoom_method_);
+    out.enumU8(pivot_mode_);
+    out.enumU8(trackball_projection_mode_);
+    out.f32(fov_zoom_speed_);
+    out.f32(rotation_speed_);
+    out.f32(trackball_rotation_scale_);
+    out.f32(pan_speed_);
+    out.f32(rot_damping_);
+    out.f32(pan_damping_);
+    out.f32(zoom_speed_);
+    out.f32(latency_lead_s_);
+    out.f32(latency_max_angle_deg_);
+    out.f32(fit_anim_duration_);
+    out.vec3(world_up_);
+    out.vec3(coi_world_);
+    if (camera_) {
+        out.pose(captureCameraPose(*camera_));
+        out.f32(zoom_scale_);
+    }
+    return out.take();
+}
+
+bool TrackballManipulator::deserialize(const std::uint8_t* data, std::size_t size) noexcept {
+    detail::StateReader in(data, size, detail::StateBlobKind::eTrackballManipulator);
+    bool enabled = true;
+    bool rotation_inertia = true;
+    bool pan_inertia = true;
+    bool rotate_enabled = true;
+    bool pan_enabled = true;
+    bool orbit_animation = true;
+    bool has_pose = false;
+    ZoomMethod zoom_method = ZoomMethod::eSceneScale;
+    OrbitPivotMode pivot_mode = OrbitPivotMode::eCoi;
+    TrackballProjectionMode projection = TrackballProjectionMode::eHyperbolic;
+    float fov_zoom_speed = 0.0f;
+    float rotation_speed = 0.0f;
+    float rotation_scale = 0.0f;
+    float pan_speed = 0.0f;
+    float rot_damping = 0.0f;
+    float pan_damping = 0.0f;
+    float zoom_speed = 0.0f;
+    float latency_lead = 0.0f;
+    float latency_max_angle = 0.0f;
+    float fit_duration = 0.0f;
+    vne::math::Vec3f world_up;
+    vne::math::Vec3f coi;
+    CameraPoseSnapshot pose;
+    float scene_scale = 1.0f;
+
+    in.flags({&enabled, &rotation_inertia, &pan_inertia, &rotate_enabled, &pan_enabled, &orbit_animation, &has_pose});
+    in.enumU8(zoom_method, ZoomMethod::eDollyToCoi);
+    in.enumU8(pivot_mode, OrbitPivotMode::eFixed);
+    in.enumU8(projection, TrackballProjectionMode::eRim);
+    in.f32(fov_zoom_speed);
+    in.f32(rotation_speed);
+    in.f32(rotation_scale);
+    in.f32(pan_speed);
+    in.f32(rot_damping);
+    in.f32(pan_damping);
+    in.f32(zoom_speed);
+    in.f32(latency_lead);
+    in.f32(latency_max_angle);
+    in.f32(fit_duration);
+    in.vec3(world_up);
+    in.vec3(coi);
+    if (has_pose) {
+        in.pose(pose);
+        in.f32(scene_scale);
+    }
+    if (!in.ok() || world_up.length() < kEpsilon) {
+        VNE_LOG_WARN << "TrackballManipulator: deserialize rejected a truncated, corrupt or incompatible state blob";
+        return false;
+    }
+
+    // Display-only lead and animations are dropped up front so no setter below writes the camera
+    clearLatencyLead();
+    anim_->stop();
+
+    enabled_ = enabled;
+    rotation_inertia_enabled_ = rotation_inertia;
+    pan_inertia_enabled_ = pan_inertia;
+    rotate_enabled_ = rotate_enabled;
+    pan_enabled_ = pan_enabled;
+    orbit_animation_enabled_ = orbit_animation;
+    zoom_method_ = zoom_method;
+    pivot_mode_ = pivot_mode;
+    setTrackballProjectionMode(projection);
+    setFovZoomSpeed(fov_zoom_speed);
+    setRotationSpeed(rotation_speed);
+    setTrackballRotationScale(rotation_scale);
+    setPanSpeed(pan_speed);
+    setRotationDamping(rot_damping);
+    setPanDamping(pan_damping);
+    setZoomSpeed(zoom_speed);
+    setLatencyCompensation(latency_lead);
+    setLatencyCompensationMaxAngle(latency_max_angle);
+    setFitAnimationDuration(fit_duration);
+    world_up_ = world_up.normalized();
+    coi_world_ = coi;
+
+    if (has_pose && camera_) {
+        zoom_scale_ = vne::math::clamp(scene_scale, kSceneScaleMin, kSceneScaleMax);
+        camera_->setSceneScale(zoom_scale_);
+        applyCameraPose(*camera_, pose, !defer_matrices_);
+        onHandoff(pose);  // orbit frame from the pose without writing the camera again
+    } else {
+        resetState();
+    }
+    return true;
+}
+
 }  // namespace vne::interaction
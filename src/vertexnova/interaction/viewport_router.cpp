@@ -0,0 +1,478 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+#include "vertexnova/interaction/viewport_router.h"
+
+#include "vertexnova/events/key_event.h"
+#include "vertexnova/events/mouse_event.h"
+#include "vertexnova/events/touch_event.h"
+
+#include <vertexnova/logging/logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace {
+CREATE_VNE_LOGGER_CATEGORY("vne.interaction.viewport_router");
+}  // namespace
+
+namespace vne::interaction {
+
+// ---------------------------------------------------------------------------
+// Impl
+// ---------------------------------------------------------------------------
+
+class ViewportRouter::Impl {
+    friend class ViewportRouter;
+
+    struct Viewport {
+        std::shared_ptr<ICameraController> controller;
+        ViewportRect rect;
+    };
+
+    /** Uniform grid over the layout bounds; cell c lists viewports [cell_start[c], cell_start[c + 1]). */
+    struct Grid {
+        float x0 = 0.0f;
+        float y0 = 0.0f;
+        float inv_cell_w = 0.0f;
+        float inv_cell_h = 0.0f;
+        int cols = 0;
+        int rows = 0;
+        std::vector<std::uint32_t> cell_start;
+        std::vector<std::uint32_t> items;  //!< Ascending viewport index per cell
+    };
+
+    std::vector<Viewport> viewports;
+    mutable Grid grid;  //!< Hit-test cache, rebuilt on demand after rectangle changes
+    mutable bool grid_dirty = true;
+
+    std::size_t focused = kNoViewport;
+    std::size_t captured = kNoViewport;
+    std::uint32_t buttons_down = 0;  //!< Bit per mouse button held while captured
+    std::size_t touched = kNoViewport;  //!< Viewport that got the touch press, until the release
+    std::vector<std::pair<events::KeyCode, std::size_t>> held_keys;  //!< Key → viewport that got the press
+
+    double cursor_x = 0.0;  //!< Last window-space pointer position
+    double cursor_y = 0.0;
+
+    // -------------------------------------------------------------------------
+    // Hit testing
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] int cellColumn(float x) const noexcept {
+        return std::clamp(static_cast<int>(std::floor((x - grid.x0) * grid.inv_cell_w)), 0, grid.cols - 1);
+    }
+
+    [[nodiscard]] int cellRow(float y) const noexcept {
+        return std::clamp(static_cast<int>(std::floor((y - grid.y0) * grid.inv_cell_h)), 0, grid.rows - 1);
+    }
+
+    void rebuildGrid() const {
+        grid_dirty = false;
+        grid.cols = 0;
+        grid.rows = 0;
+        float x0 = 0.0f;
+        float y0 = 0.0f;
+        float x1 = 0.0f;
+        float y1 = 0.0f;
+        bool any = false;
+        for (const Viewport& v : viewports) {
+            if (v.rect.width <= 0.0f || v.rect.height <= 0.0f) {
+                continue;
+            }
+            x0 = any ? std::min(x0, v.rect.x) : v.rect.x;
+            y0 = any ? std::min(y0, v.rect.y) : v.rect.y;
+            x1 = any ? std::max(x1, v.rect.x + v.rect.width) : v.rect.x + v.rect.width;
+            y1 = any ? std::max(y1, v.rect.y + v.rect.height) : v.rect.y + v.rect.height;
+            any = true;
+        }
+        if (!any) {
+            return;
+        }
+        // About one viewport per cell for tiled layouts
+        const int side = std::max(1, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(viewports.size())))));
+        grid.cols = side;
+        grid.rows = side;
+        grid.x0 = x0;
+        grid.y0 = y0;
+        grid.inv_cell_w = static_cast<float>(side) / (x1 - x0);
+        grid.inv_cell_h = static_cast<float>(side) / (y1 - y0);
+
+        // Counting pass, then fill: cells hold viewport indices in ascending (z) order
+        const std::size_t cells = static_cast<std::size_t>(side) * static_cast<std::size_t>(side);
+        grid.cell_start.assign(cells + 1, 0);
+        auto forEachCell = [this](const ViewportRect& r, auto&& fn) {
+            const int c0 = cellColumn(r.x);
+            const int c1 = cellColumn(std::nextafter(r.x + r.width, r.x));
+            const int r0 = cellRow(r.y);
+            const int r1 = cellRow(std::nextafter(r.y + r.height, r.y));
+            for (int row = r0; row <= r1; ++row) {
+                for (int col = c0; col <= c1; ++col) {
+                    fn(static_cast<std::size_t>(row) * static_cast<std::size_t>(grid.cols)
+                       + static_cast<std::size_t>(col));
+                }
+            }
+        };
+        for (const Viewport& v : viewports) {
+            if (v.rect.width > 0.0f && v.rect.height > 0.0f) {
+                forEachCell(v.rect, [this](std::size_t cell) { ++grid.cell_start[cell + 1]; });
+            }
+        }
+        for (std::size_t c = 0; c < cells; ++c) {
+            grid.cell_start[c + 1] += grid.cell_start[c];
+        }
+        grid.items.resize(grid.cell_start[cells]);
+        std::vector<std::uint32_t> fill(grid.cell_start.begin(), grid.cell_start.end() - 1);
+        for (std::size_t i = 0; i < viewports.size(); ++i) {
+            const ViewportRect& r = viewports[i].rect;
+            if (r.width > 0.0f && r.height > 0.0f) {
+                forEachCell(r, [this, &fill, i](std::size_t cell) {
+                    grid.items[fill[cell]++] = static_cast<std::uint32_t>(i);
+                });
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t hitTest(float x, float y) const noexcept {
+        if (viewports.size() < kGridThreshold) {
+            for (std::size_t i = viewports.size(); i-- > 0;) {
+                if (viewports[i].rect.contains(x, y)) {
+                    return i;
+                }
+            }
+            return kNoViewport;
+        }
+        if (grid_dirty) {
+            rebuildGrid();
+        }
+        if (grid.cols == 0) {
+            return kNoViewport;
+        }
+        const float gx = (x - grid.x0) * grid.inv_cell_w;
+        const float gy = (y - grid.y0) * grid.inv_cell_h;
+        if (!(gx >= 0.0f && gy >= 0.0f && gx < static_cast<float>(grid.cols) && gy < static_cast<float>(grid.rows))) {
+            return kNoViewport;
+        }
+        const std::size_t cell = static_cast<std::size_t>(cellRow(y)) * static_cast<std::size_t>(grid.cols)
+                                 + static_cast<std::size_t>(cellColumn(x));
+        for (std::uint32_t k = grid.cell_start[cell + 1]; k-- > grid.cell_start[cell];) {
+            const std::uint32_t i = grid.items[k];
+            if (viewports[i].rect.contains(x, y)) {
+                return i;
+            }
+        }
+        return kNoViewport;
+    }
+
+    // -------------------------------------------------------------------------
+    // Dispatch helpers
+    // -------------------------------------------------------------------------
+
+    /** Viewport for a pointer event at the last cursor position: the capture owner, else the one under it. */
+    [[nodiscard]] std::size_t pointerTarget() const noexcept {
+        return captured != kNoViewport ? captured
+                                       : hitTest(static_cast<float>(cursor_x), static_cast<float>(cursor_y));
+    }
+
+    [[nodiscard]] double localX(std::size_t index) const noexcept {
+        return cursor_x - static_cast<double>(viewports[index].rect.x);
+    }
+
+    [[nodiscard]] double localY(std::size_t index) const noexcept {
+        return cursor_y - static_cast<double>(viewports[index].rect.y);
+    }
+
+    [[nodiscard]] std::size_t keyHolder(events::KeyCode key) const noexcept {
+        for (const auto& [k, index] : held_keys) {
+            if (k == key) {
+                return index;
+            }
+        }
+        return kNoViewport;
+    }
+
+    /**
+     * Focus @p target. Keys still held move with the focus: the viewport that got the press receives a release
+     * and @p target a press, so neither controller keeps a key the user is no longer holding for it.
+     */
+    void moveFocus(std::size_t target, double delta_time) noexcept {
+        if (target == focused) {
+            return;
+        }
+        focused = target;
+        for (auto& [key, index] : held_keys) {
+            if (index == target) {
+                continue;
+            }
+            viewports[index].controller->onEvent(events::KeyReleasedEvent(key), delta_time);
+            index = target;
+            if (target != kNoViewport) {
+                viewports[target].controller->onEvent(events::KeyPressedEvent(key), delta_time);
+            }
+        }
+        held_keys.erase(std::remove_if(held_keys.begin(),
+                                       held_keys.end(),
+                                       [](const auto& held) { return held.second == kNoViewport; }),
+                        held_keys.end());
+    }
+
+    /** Keep focus, capture and held keys pointing at the same viewports after @p removed is erased. */
+    void onViewportRemoved(std::size_t removed) noexcept {
+        auto shift = [removed](std::size_t& index) {
+            if (index == kNoViewport) {
+                return;
+            }
+            if (index == removed) {
+                index = kNoViewport;
+            } else if (index > removed) {
+                --index;
+            }
+        };
+        shift(focused);
+        shift(captured);
+        shift(touched);
+        if (captured == kNoViewport) {
+            buttons_down = 0;
+        }
+        for (auto& held : held_keys) {
+            shift(held.second);
+        }
+        held_keys.erase(std::remove_if(held_keys.begin(),
+                                       held_keys.end(),
+                                       [](const auto& held) { return held.second == kNoViewport; }),
+                        held_keys.end());
+        grid_dirty = true;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Construction
+// ---------------------------------------------------------------------------
+
+ViewportRouter::ViewportRouter()
+    : impl_(std::make_unique<Impl>()) {}
+
+ViewportRouter::~ViewportRouter() = default;
+ViewportRouter::ViewportRouter(ViewportRouter&&) noexcept = default;
+ViewportRouter& ViewportRouter::operator=(ViewportRouter&&) noexcept = default;
+
+// ---------------------------------------------------------------------------
+// Viewports
+// ---------------------------------------------------------------------------
+
+std::size_t ViewportRouter::addViewport(std::shared_ptr<ICameraController> controller, const ViewportRect& rect) {
+    if (!controller) {
+        VNE_LOG_WARN << "ViewportRouter::addViewport: null controller ignored";
+        return kNoViewport;
+    }
+    controller->onResize(rect.width, rect.height);
+    impl_->viewports.push_back({std::move(controller), rect});
+    impl_->grid_dirty = true;
+    return impl_->viewports.size() - 1;
+}
+
+void ViewportRouter::setViewportRect(std::size_t index, const ViewportRect& rect) noexcept {
+    if (index >= impl_->viewports.size()) {
+        return;
+    }
+    Impl::Viewport& v = impl_->viewports[index];
+    const bool resized = v.rect.width != rect.width || v.rect.height != rect.height;
+    v.rect = rect;
+    impl_->grid_dirty = true;
+    if (resized) {
+        v.controller->onResize(rect.width, rect.height);
+    }
+}
+
+std::shared_ptr<ICameraController> ViewportRouter::removeViewport(std::size_t index) noexcept {
+    auto& list = impl_->viewports;
+    if (index >= list.size()) {
+        return nullptr;
+    }
+    std::shared_ptr<ICameraController> removed = std::move(list[index].controller);
+    list.erase(list.begin() + static_cast<std::ptrdiff_t>(index));
+    impl_->onViewportRemoved(index);
+    return removed;
+}
+
+void ViewportRouter::clear() noexcept {
+    impl_->viewports.clear();
+    impl_->focused = kNoViewport;
+    impl_->captured = kNoViewport;
+    impl_->buttons_down = 0;
+    impl_->touched = kNoViewport;
+    impl_->held_keys.clear();
+    impl_->grid_dirty = true;
+}
+
+std::size_t ViewportRouter::size() const noexcept {
+    return impl_->viewports.size();
+}
+
+ViewportRect ViewportRouter::viewportRect(std::size_t index) const noexcept {
+    return index < impl_->viewports.size() ? impl_->viewports[index].rect : ViewportRect{};
+}
+
+const std::shared_ptr<ICameraController>& ViewportRouter::controller(std::size_t index) const noexcept {
+    static const std::shared_ptr<ICameraController> kNone;
+    return index < impl_->viewports.size() ? impl_->viewports[index].controller : kNone;
+}
+
+std::size_t ViewportRouter::viewportAt(float x, float y) const noexcept {
+    return impl_->hitTest(x, y);
+}
+
+// ---------------------------------------------------------------------------
+// Focus and capture
+// ---------------------------------------------------------------------------
+
+void ViewportRouter::setFocusedViewport(std::size_t index) noexcept {
+    impl_->moveFocus(index < impl_->viewports.size() ? index : kNoViewport, 0.0);
+}
+
+std::size_t ViewportRouter::focusedViewport() const noexcept {
+    return impl_->focused;
+}
+
+std::size_t ViewportRouter::capturedViewport() const noexcept {
+    return impl_->captured;
+}
+
+// ---------------------------------------------------------------------------
+// Event feed
+// ---------------------------------------------------------------------------
+
+bool ViewportRouter::onEvent(const events::Event& event, double delta_time) noexcept {
+    Impl& d = *impl_;
+    switch (event.type()) {
+        case events::EventType::eMouseMoved: {
+            const auto& e = static_cast<const events::MouseMovedEvent&>(event);
+            d.cursor_x = e.x();
+            d.cursor_y = e.y();
+            const std::size_t target = d.pointerTarget();
+            if (target == kNoViewport) {
+                return false;
+            }
+            d.viewports[target].controller->onEvent(
+                events::MouseMovedEvent(d.localX(target), d.localY(target)), delta_time);
+            return true;
+        }
+        case events::EventType::eMouseButtonPressed:
+        case events::EventType::eMouseButtonReleased:
+        case events::EventType::eMouseButtonDoubleClicked: {
+            const auto& e = static_cast<const events::MouseButtonEvent&>(event);
+            if (e.hasPosition()) {
+                d.cursor_x = e.x();
+                d.cursor_y = e.y();
+            }
+            const std::size_t target = d.pointerTarget();
+            if (target == kNoViewport) {
+                return false;
+            }
+            const int button = static_cast<int>(e.button());
+            const std::uint32_t bit = button >= 0 && button < 32 ? (1u << button) : 0u;
+            ICameraController& ctrl = *d.viewports[target].controller;
+            const double lx = d.localX(target);
+            const double ly = d.localY(target);
+            if (event.type() == events::EventType::eMouseButtonPressed) {
+                d.captured = target;
+                d.buttons_down |= bit;
+                d.moveFocus(target, delta_time);
+                ctrl.onEvent(events::MouseButtonPressedEvent(e.button(), 0, lx, ly), delta_time);
+            } else if (event.type() == events::EventType::eMouseButtonReleased) {
+                d.buttons_down &= ~bit;
+                if (d.buttons_down == 0) {
+                    d.captured = kNoViewport;
+                }
+                ctrl.onEvent(events::MouseButtonReleasedEvent(e.button(), 0, lx, ly), delta_time);
+            } else {
+                d.moveFocus(target, delta_time);
+                ctrl.onEvent(events::MouseButtonDoubleClickedEvent(e.button(), 0, lx, ly), delta_time);
+            }
+            return true;
+        }
+        case events::EventType::eMouseScrolled: {
+            const std::size_t target = d.pointerTarget();
+            if (target == kNoViewport) {
+                return false;
+            }
+            d.viewports[target].controller->onEvent(event, delta_time);
+            return true;
+        }
+        case events::EventType::eKeyPressed:
+        case events::EventType::eKeyRepeat: {
+            const auto& e = static_cast<const events::KeyEvent&>(event);
+            std::size_t target = d.keyHolder(e.keyCode());
+            if (target == kNoViewport) {
+                target = d.focused;
+                if (target == kNoViewport) {
+                    return false;
+                }
+                d.held_keys.emplace_back(e.keyCode(), target);
+            }
+            d.viewports[target].controller->onEvent(event, delta_time);
+            return true;
+        }
+        case events::EventType::eKeyReleased: {
+            const auto& e = static_cast<const events::KeyEvent&>(event);
+            const auto it = std::find_if(d.held_keys.begin(), d.held_keys.end(), [&e](const auto& held) {
+                return held.first == e.keyCode();
+            });
+            const std::size_t target = it != d.held_keys.end() ? it->second : d.focused;
+            if (it != d.held_keys.end()) {
+                d.held_keys.erase(it);
+            }
+            if (target == kNoViewport) {
+                return false;
+            }
+            d.viewports[target].controller->onEvent(event, delta_time);
+            return true;
+        }
+        case events::EventType::eTouchPress:
+        case events::EventType::eTouchMove:
+        case events::EventType::eTouchRelease: {
+            // One touch stream, captured like a mouse button from press to release
+            const auto& e = static_cast<const events::TouchEvent&>(event);
+            const std::size_t target =
+                d.touched != kNoViewport ? d.touched : d.hitTest(static_cast<float>(e.x()), static_cast<float>(e.y()));
+            if (target == kNoViewport) {
+                return false;
+            }
+            ICameraController& ctrl = *d.viewports[target].controller;
+            const double lx = e.x() - static_cast<double>(d.viewports[target].rect.x);
+            const double ly = e.y() - static_cast<double>(d.viewports[target].rect.y);
+            if (event.type() == events::EventType::eTouchPress) {
+                d.touched = target;
+                d.moveFocus(target, delta_time);
+                ctrl.onEvent(events::TouchPressEvent(lx, ly), delta_time);
+            } else if (event.type() == events::EventType::eTouchMove) {
+                ctrl.onEvent(events::TouchMoveEvent(lx, ly), delta_time);
+            } else {
+                d.touched = kNoViewport;
+                ctrl.onEvent(events::TouchReleaseEvent(lx, ly), delta_time);
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+void ViewportRouter::onUpdate(double delta_time) noexcept {
+    for (const Impl::Viewport& v : impl_->viewports) {
+        v.controller->onUpdate(delta_time);
+    }
+}
+
+}  // namespace vne::interaction
@@ -0,0 +1,265 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * Bounds reduction tests: point / box bounds with NaN and invalid inputs, parallel results equal to serial,
+ * exact frustum fits, and fitToPoints / fitToBoxes on the trackball, free-look and 2D manipulators.
+ */
+
+#include "vertexnova/interaction/bounds_reduction.h"
+#include "vertexnova/interaction/free_look_manipulator.h"
+#include "vertexnova/interaction/ortho_2d_manipulator.h"
+#include "vertexnova/interaction/trackball_manipulator.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace vne_interaction_test {
+
+namespace {
+
+using vne::interaction::BoundingBox;
+using vne::interaction::FitBoundsMode;
+using vne::math::Vec3f;
+
+std::shared_ptr<vne::scene::PerspectiveCamera> makePerspCamera(const Vec3f& eye, const Vec3f& target) {
+    auto camera = vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(60.0f, 1.0f, 0.1f, 1000.0f));
+    camera->lookAt(eye, target, Vec3f(0.0f, 1.0f, 0.0f));
+    camera->updateMatrices();
+    return camera;
+}
+
+/** Deterministic cloud inside [-50, 50]^3 with one NaN point mixed in. */
+std::vector<Vec3f> makeCloud(std::size_t count) {
+    std::vector<Vec3f> points(count);
+    std::uint32_t state = 12345u;
+    auto next = [&state]() {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / static_cast<float>(1u << 24) * 100.0f - 50.0f;
+    };
+    for (auto& p : points) {
+        const float x = next();
+        const float y = next();
+        p = Vec3f(x, y, next());
+    }
+    points[count / 3] = Vec3f(std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f);
+    return points;
+}
+
+}  // namespace
+
+TEST(BoundsReduction, PointAndBoxBoundsSkipNaNAndInvalidInput) {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const std::vector<Vec3f> points = {Vec3f(1.0f, -2.0f, 3.0f), Vec3f(nan, 100.0f, 0.0f), Vec3f(-4.0f, 5.0f, 0.5f)};
+    const BoundingBox bounds = vne::interaction::computeBounds(points);
+    ASSERT_TRUE(bounds.isValid());
+    EXPECT_EQ(bounds.min_corner.x(), -4.0f);
+    EXPECT_EQ(bounds.min_corner.y(), -2.0f);
+    EXPECT_EQ(bounds.max_corner.y(), 100.0f);  // the NaN point's finite coordinates still count
+    EXPECT_EQ(bounds.max_corner.z(), 3.0f);
+    EXPECT_FALSE(vne::interaction::computeBounds(std::span<const Vec3f>()).isValid());
+
+    std::vector<BoundingBox> boxes(3);
+    boxes[0].min_corner = Vec3f(0.0f, 0.0f, 0.0f);
+    boxes[0].max_corner = Vec3f(1.0f, 1.0f, 1.0f);
+    boxes[2].min_corner = Vec3f(2.0f, 2.0f, 2.0f);
+    boxes[2].max_corner = Vec3f(4.0f, 3.0f, 2.0f);  // boxes[1] stays empty
+    const BoundingBox merged = vne::interaction::computeBounds(boxes);
+    EXPECT_EQ(merged.min_corner.x(), 0.0f);
+    EXPECT_EQ(merged.max_corner.x(), 4.0f);
+    EXPECT_NEAR(vne::interaction::computeBoundingRadius(boxes, Vec3f(0.0f, 0.0f, 0.0f)),
+                std::sqrt(16.0f + 9.0f + 4.0f),
+                1e-5f);
+
+    // View extents of a box rotated 45 degrees about Z: the support along the diagonal axis
+    const float s = std::sqrt(0.5f);
+    const BoundingBox view = vne::interaction::computeViewExtents(
+        std::span<const BoundingBox>(boxes.data(), 1), Vec3f(s, s, 0.0f), Vec3f(-s, s, 0.0f), Vec3f(0.0f, 0.0f, -1.0f));
+    EXPECT_NEAR(view.min_corner.x(), 0.0f, 1e-5f);
+    EXPECT_NEAR(view.max_corner.x(), 2.0f * s, 1e-5f);
+    EXPECT_NEAR(view.min_corner.y(), -s, 1e-5f);
+    EXPECT_NEAR(view.max_corner.z(), 0.0f, 1e-5f);
+}
+
+TEST(BoundsReduction, ParallelReductionMatchesSerial) {
+    const std::vector<Vec3f> cloud = makeCloud((1u << 19) + 37u);
+    float lo[3] = {1e30f, 1e30f, 1e30f};
+    float hi[3] = {-1e30f, -1e30f, -1e30f};
+    float radius2 = 0.0f;
+    for (const Vec3f& p : cloud) {
+        const float c[3] = {p.x(), p.y(), p.z()};
+        for (int a = 0; a < 3; ++a) {
+            lo[a] = c[a] < lo[a] ? c[a] : lo[a];
+            hi[a] = c[a] > hi[a] ? c[a] : hi[a];
+        }
+    }
+
+    // Shared pool
+    const BoundingBox pooled = vne::interaction::computeBounds(cloud);
+    EXPECT_EQ(pooled.min_corner.x(), lo[0]);
+    EXPECT_EQ(pooled.min_corner.y(), lo[1]);
+    EXPECT_EQ(pooled.min_corner.z(), lo[2]);
+    EXPECT_EQ(pooled.max_corner.x(), hi[0]);
+    EXPECT_EQ(pooled.max_corner.y(), hi[1]);
+    EXPECT_EQ(pooled.max_corner.z(), hi[2]);
+
+    // Caller executor: split into several tasks, same answer
+    std::atomic<std::size_t> tasks{0};
+    const vne::interaction::ControllerExecutor executor = [&tasks](std::size_t count,
+                                                                   const std::function<void(std::size_t)>& task) {
+        tasks = count;
+        for (std::size_t i = count; i-- > 0;) {
+            task(i);
+        }
+    };
+    const BoundingBox executed = vne::interaction::computeBounds(cloud, executor);
+    EXPECT_GT(tasks.load(), 1u);
+    EXPECT_EQ(executed.min_corner.x(), pooled.min_corner.x());
+    EXPECT_EQ(executed.max_corner.z(), pooled.max_corner.z());
+
+    const Vec3f center = pooled.center();
+    for (const Vec3f& p : cloud) {
+        const float d2 = (p - center).dot(p - center);
+        radius2 = d2 > radius2 ? d2 : radius2;
+    }
+    EXPECT_FLOAT_EQ(vne::interaction::computeBoundingRadius(cloud, center, executor), std::sqrt(radius2));
+    EXPECT_FLOAT_EQ(vne::interaction::computeBoundingRadius(cloud, center), std::sqrt(radius2));
+}
+
+TEST(BoundsReduction, FrustumFitTouchesTheViewAndBoxesMatchTheirCorners) {
+    std::vector<BoundingBox> boxes(2);
+    boxes[0].min_corner = Vec3f(-1.0f, -0.5f, -10.0f);
+    boxes[0].max_corner = Vec3f(1.0f, 0.5f, 10.0f);
+    boxes[1].min_corner = Vec3f(3.0f, 2.0f, -1.0f);
+    boxes[1].max_corner = Vec3f(4.0f, 2.5f, 0.0f);
+    std::vector<Vec3f> corners;
+    for (const BoundingBox& b : boxes) {
+        for (int i = 0; i < 8; ++i) {
+            corners.emplace_back((i & 1) ? b.max_corner.x() : b.min_corner.x(),
+                                 (i & 2) ? b.max_corner.y() : b.min_corner.y(),
+                                 (i & 4) ? b.max_corner.z() : b.min_corner.z());
+        }
+    }
+    const Vec3f right(1.0f, 0.0f, 0.0f);
+    const Vec3f up(0.0f, 1.0f, 0.0f);
+    const Vec3f forward(0.0f, 0.0f, -1.0f);
+    const float tx = 0.8f;
+    const float ty = 0.5f;
+
+    vne::interaction::FrustumFit from_boxes;
+    vne::interaction::FrustumFit from_corners;
+    ASSERT_TRUE(vne::interaction::computeFrustumFit(boxes, right, up, forward, tx, ty, from_boxes));
+    ASSERT_TRUE(vne::interaction::computeFrustumFit(corners, right, up, forward, tx, ty, from_corners));
+    EXPECT_NEAR((from_boxes.eye - from_corners.eye).length(), 0.0f, 1e-4f);
+    EXPECT_NEAR(from_boxes.distance, from_corners.distance, 1e-4f);
+
+    // Every corner is inside, and the binding pair of planes touches the set on both sides
+    float widest_x = 0.0f;
+    float widest_y = 0.0f;
+    for (const Vec3f& c : corners) {
+        const Vec3f d = c - from_boxes.eye;
+        const float depth = d.dot(forward);
+        ASSERT_GT(depth, 0.0f);
+        widest_x = std::max(widest_x, std::abs(d.dot(right)) / (tx * depth));
+        widest_y = std::max(widest_y, std::abs(d.dot(up)) / (ty * depth));
+    }
+    EXPECT_LE(widest_x, 1.0f + 1e-5f);
+    EXPECT_LE(widest_y, 1.0f + 1e-5f);
+    EXPECT_NEAR(std::max(widest_x, widest_y), 1.0f, 1e-5f);
+    EXPECT_NEAR(from_boxes.center.z(), 0.0f, 1e-4f);  // halfway through the depth range z in [-10, 10]
+
+    vne::interaction::FrustumFit unchanged;
+    EXPECT_FALSE(vne::interaction::computeFrustumFit(std::span<const Vec3f>(), right, up, forward, tx, ty, unchanged));
+    EXPECT_FALSE(vne::interaction::computeFrustumFit(corners, right, up, forward, 0.0f, ty, unchanged));
+}
+
+TEST(BoundsReduction, TrackballFitsSphereOrViewExtents) {
+    // A rod along the view axis: its sphere is ten times wider than what the camera actually sees
+    std::vector<Vec3f> rod;
+    for (int i = -10; i <= 10; ++i) {
+        rod.emplace_back(-1.0f, 0.0f, static_cast<float>(i));
+        rod.emplace_back(1.0f, 0.0f, static_cast<float>(i));
+    }
+    auto camera = makePerspCamera(Vec3f(0.0f, 0.0f, 50.0f), Vec3f(0.0f, 0.0f, 0.0f));
+    vne::interaction::TrackballManipulator trackball;
+    trackball.setCamera(camera);
+    trackball.onResize(800.0f, 800.0f);
+    trackball.setFitAnimationDuration(0.0f);
+
+    const float tan_half = std::tan(vne::math::degToRad(30.0f));
+    trackball.fitToPoints(rod);
+    EXPECT_NEAR(trackball.getOrbitDistance(), std::sqrt(101.0f) / tan_half * 1.1f, 1e-3f);
+
+    trackball.fitToPoints(rod, FitBoundsMode::eViewExtents);
+    EXPECT_NEAR(trackball.getOrbitDistance(), (1.0f / tan_half + 10.0f) * 1.1f, 1e-3f);
+    EXPECT_NEAR(camera->getPosition().z(), trackball.getOrbitDistance(), 1e-3f);
+
+    // Exact frustum fit: the near corners of the rod touch the narrowed frustum
+    trackball.fitToPoints(rod, FitBoundsMode::eFrustum);
+    EXPECT_NEAR(trackball.getOrbitDistance(), 1.1f / tan_half + 10.0f, 1e-3f);
+    EXPECT_NEAR(trackball.getCenterOfInterestWorld().z(), 0.0f, 1e-4f);
+    trackball.fitToAABB(Vec3f(-1.0f, 0.0f, -10.0f), Vec3f(1.0f, 0.0f, 10.0f), FitBoundsMode::eFrustum);
+    EXPECT_NEAR(trackball.getOrbitDistance(), 1.1f / tan_half + 10.0f, 1e-3f);
+    EXPECT_NEAR(camera->getPosition().z(), trackball.getOrbitDistance(), 1e-3f);
+
+    // Empty input leaves the camera alone
+    const float before = trackball.getOrbitDistance();
+    trackball.fitToBoxes({});
+    EXPECT_EQ(trackball.getOrbitDistance(), before);
+}
+
+TEST(BoundsReduction, FreeLookAndOrtho2DFitBoxes) {
+    std::vector<BoundingBox> boxes(2);
+    boxes[0].min_corner = Vec3f(8.0f, -1.0f, -1.0f);
+    boxes[0].max_corner = Vec3f(10.0f, 1.0f, 1.0f);
+    boxes[1].min_corner = Vec3f(10.0f, -1.0f, -1.0f);
+    boxes[1].max_corner = Vec3f(12.0f, 1.0f, 1.0f);
+
+    auto camera = makePerspCamera(Vec3f(0.0f, 0.0f, 5.0f), Vec3f(0.0f, 0.0f, 4.0f));
+    vne::interaction::FreeLookManipulator free_look;
+    free_look.setCamera(camera);
+    free_look.onResize(800.0f, 800.0f);
+    free_look.fitToBoxes(boxes, FitBoundsMode::eViewExtents);
+    const float tan_half = std::tan(vne::math::degToRad(30.0f));
+    EXPECT_NEAR(camera->getPosition().x(), 10.0f, 1e-4f);
+    EXPECT_NEAR(camera->getPosition().z(), (2.0f / tan_half + 1.0f) * 1.1f, 1e-3f);
+    EXPECT_NEAR(camera->getForwardDir().z(), -1.0f, 1e-5f);
+
+    auto ortho = vne::scene::CameraFactory::createOrthographic(
+        vne::scene::OrthographicCameraParameters(-5.0f, 5.0f, -5.0f, 5.0f, 0.1f, 1000.0f));
+    ortho->lookAt(Vec3f(0.0f, 0.0f, 10.0f), Vec3f(0.0f, 0.0f, 0.0f), Vec3f(0.0f, 1.0f, 0.0f));
+    ortho->updateMatrices();
+    vne::interaction::Ortho2DManipulator ortho_2d;
+    ortho_2d.setCamera(ortho);
+    ortho_2d.onResize(800.0f, 400.0f);
+    ortho_2d.fitToBoxes(boxes);
+    EXPECT_NEAR(ortho->getTarget().x(), 10.0f, 1e-4f);
+    EXPECT_NEAR(ortho->getHeight(), 2.0f * std::sqrt(6.0f) * 1.1f, 1e-3f);  // sphere of the two boxes
+    EXPECT_NEAR(ortho->getWidth(), 2.0f * ortho->getHeight(), 1e-3f);
+
+    ortho_2d.fitToBoxes(boxes, FitBoundsMode::eViewExtents);
+    EXPECT_NEAR(ortho->getWidth(), 4.0f * 1.1f, 1e-3f);
+    EXPECT_NEAR(ortho->getPosition().z() - ortho->getTarget().z(), 10.0f, 1e-4f);
+}
+
+}  // namespace vne_interaction_test
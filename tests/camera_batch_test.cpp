@@ -0,0 +1,203 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * CameraBatch tests: inertia decay, view-matrix layout, animation, mixed lanes, and dense removal.
+ */
+
+#include "vertexnova/interaction/camera_batch.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace vne_interaction_test {
+
+namespace {
+
+constexpr float kFrameDt = 1.0f / 60.0f;
+
+void expectVecNear(const vne::math::Vec3f& a, const vne::math::Vec3f& b, float tol = 1e-3f) {
+    EXPECT_NEAR(a.x(), b.x(), tol);
+    EXPECT_NEAR(a.y(), b.y(), tol);
+    EXPECT_NEAR(a.z(), b.z(), tol);
+}
+
+/** Column-major 4x4 (16 floats) times point. */
+vne::math::Vec3f transformPoint(const float* m, const vne::math::Vec3f& p) {
+    return {m[0] * p.x() + m[4] * p.y() + m[8] * p.z() + m[12],
+            m[1] * p.x() + m[5] * p.y() + m[9] * p.z() + m[13],
+            m[2] * p.x() + m[6] * p.y() + m[10] * p.z() + m[14]};
+}
+
+const vne::math::Quatf kIdentity(0.0f, 0.0f, 0.0f, 1.0f);
+
+}  // namespace
+
+TEST(CameraBatch, InertiaSpinsAndDecaysLikeTrackball) {
+    vne::interaction::CameraBatch batch(2);
+    const std::size_t spinning = batch.add(vne::math::Vec3f(0.0f, 0.0f, 0.0f), 5.0f, kIdentity);
+    const std::size_t still = batch.add(vne::math::Vec3f(1.0f, 0.0f, 0.0f), 2.0f, kIdentity);
+    expectVecNear(batch.eye(spinning), vne::math::Vec3f(0.0f, 0.0f, 5.0f));
+
+    const float speed0 = 2.0f;
+    const float damping = 4.0f;
+    batch.setRotationDamping(spinning, damping);
+    batch.setInertia(spinning, vne::math::Vec3f(0.0f, 3.0f, 0.0f), speed0);
+    EXPECT_TRUE(batch.hasInertia(spinning));
+    EXPECT_FALSE(batch.hasInertia(still));
+
+    // Reference: angle advances by speed·dt, then speed decays by exp(-damping·dt)
+    float angle = 0.0f;
+    float speed = speed0;
+    for (int i = 0; i < 30; ++i) {
+        batch.update(kFrameDt, nullptr);
+        angle += speed * kFrameDt;
+        speed *= std::exp(-damping * kFrameDt);
+    }
+    expectVecNear(batch.eye(spinning), vne::math::Vec3f(5.0f * std::sin(angle), 0.0f, 5.0f * std::cos(angle)));
+    EXPECT_NEAR(batch.orientation(spinning).length(), 1.0f, 1e-5f);
+    expectVecNear(batch.eye(still), vne::math::Vec3f(1.0f, 0.0f, 2.0f), 0.0f);
+
+    for (int i = 0; i < 600; ++i) {
+        batch.update(kFrameDt, nullptr);
+    }
+    EXPECT_FALSE(batch.hasInertia(spinning));
+    const vne::math::Vec3f rest = batch.eye(spinning);
+    batch.update(kFrameDt, nullptr);
+    expectVecNear(batch.eye(spinning), rest, 0.0f);
+}
+
+TEST(CameraBatch, WritesColumnMajorLookAtMatrices) {
+    vne::interaction::CameraBatch batch;
+    const vne::math::Quatf tilted = vne::math::Quatf::fromAxisAngle(vne::math::Vec3f(1.0f, 1.0f, 0.0f), 0.7f);
+    batch.add(vne::math::Vec3f(0.0f, 0.0f, 0.0f), 3.0f, kIdentity);
+    batch.add(vne::math::Vec3f(2.0f, -1.0f, 4.0f), 7.5f, tilted);
+
+    std::vector<float> views(batch.size() * vne::interaction::CameraBatch::kViewMatrixFloats, -1.0f);
+    batch.update(kFrameDt, views.data());
+
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        const float* m = views.data() + i * vne::interaction::CameraBatch::kViewMatrixFloats;
+        expectVecNear(transformPoint(m, batch.eye(i)), vne::math::Vec3f(0.0f, 0.0f, 0.0f));
+        expectVecNear(transformPoint(m, batch.coi(i)), vne::math::Vec3f(0.0f, 0.0f, -batch.distance(i)));
+        EXPECT_FLOAT_EQ(m[3], 0.0f);
+        EXPECT_FLOAT_EQ(m[15], 1.0f);
+    }
+    // Identity orientation: view = translate(0, 0, -3)
+    EXPECT_FLOAT_EQ(views[0], 1.0f);
+    EXPECT_FLOAT_EQ(views[5], 1.0f);
+    EXPECT_FLOAT_EQ(views[10], 1.0f);
+    EXPECT_FLOAT_EQ(views[14], -3.0f);
+
+    std::vector<float> again(views.size(), 0.0f);
+    batch.writeViewMatrices(again.data());
+    EXPECT_EQ(views, again);
+}
+
+TEST(CameraBatch, AnimatesToTargetAndStopsInertia) {
+    vne::interaction::CameraBatch batch;
+    const std::size_t i = batch.add(vne::math::Vec3f(0.0f, 0.0f, 0.0f), 2.0f, kIdentity);
+    batch.setInertia(i, vne::math::Vec3f(0.0f, 1.0f, 0.0f), 3.0f);
+
+    const vne::math::Quatf turned = vne::math::Quatf::fromAxisAngle(vne::math::Vec3f(0.0f, 1.0f, 0.0f), 1.0f);
+    batch.animateTo(i, vne::math::Vec3f(4.0f, 0.0f, 0.0f), 6.0f, turned, 1.0f, vne::math::EaseType::eLinear);
+    EXPECT_TRUE(batch.isAnimating(i));
+    EXPECT_FALSE(batch.hasInertia(i));
+
+    batch.update(0.5, nullptr);
+    expectVecNear(batch.coi(i), vne::math::Vec3f(2.0f, 0.0f, 0.0f));
+    EXPECT_NEAR(batch.distance(i), 4.0f, 1e-4f);
+
+    batch.update(0.6, nullptr);
+    EXPECT_FALSE(batch.isAnimating(i));
+    expectVecNear(batch.coi(i), vne::math::Vec3f(4.0f, 0.0f, 0.0f), 0.0f);
+    EXPECT_FLOAT_EQ(batch.distance(i), 6.0f);
+    expectVecNear(batch.eye(i), vne::math::Vec3f(4.0f + 6.0f * std::sin(1.0f), 0.0f, 6.0f * std::cos(1.0f)));
+
+    // A new spin cancels an animation in progress where it stands
+    batch.animateTo(i, vne::math::Vec3f(0.0f, 0.0f, 0.0f), 6.0f, turned, 1.0f, vne::math::EaseType::eLinear);
+    batch.update(0.25, nullptr);
+    const vne::math::Vec3f mid = batch.coi(i);
+    batch.setInertia(i, vne::math::Vec3f(0.0f, 1.0f, 0.0f), 1.0f);
+    EXPECT_FALSE(batch.isAnimating(i));
+    batch.update(0.25, nullptr);
+    expectVecNear(batch.coi(i), mid, 0.0f);
+}
+
+TEST(CameraBatch, MixedLanesMatchSingleCameraBatches) {
+    // Odd count with spinning and resting cameras interleaved: vector body and scalar tail must agree
+    constexpr std::size_t kCount = 37;
+    vne::interaction::CameraBatch batch(kCount);
+    std::vector<vne::interaction::CameraBatch> singles(kCount);
+    const vne::math::Vec3f axis(0.3f, 1.0f, -0.2f);
+    for (std::size_t k = 0; k < kCount; ++k) {
+        const vne::math::Quatf start = vne::math::Quatf::fromAxisAngle(vne::math::Vec3f(1.0f, 0.0f, 0.0f),
+                                                                       0.05f * static_cast<float>(k));
+        batch.add(vne::math::Vec3f(0.0f, 0.0f, 0.0f), 4.0f, start);
+        singles[k].add(vne::math::Vec3f(0.0f, 0.0f, 0.0f), 4.0f, start);
+        if (k % 3 != 0) {
+            const float speed = 0.5f + static_cast<float>(k);
+            batch.setInertia(k, axis, speed);
+            singles[k].setInertia(0, axis, speed);
+        }
+    }
+    // Damped so hard that one step uses up the speed
+    batch.setRotationDamping(4, 1e4f);
+    singles[4].setRotationDamping(0, 1e4f);
+
+    for (int step = 0; step < 20; ++step) {
+        batch.update(kFrameDt, nullptr);
+        for (auto& single : singles) {
+            single.update(kFrameDt, nullptr);
+        }
+    }
+    for (std::size_t k = 0; k < kCount; ++k) {
+        expectVecNear(batch.eye(k), singles[k].eye(0), 1e-5f);
+        EXPECT_EQ(batch.hasInertia(k), singles[k].hasInertia(0));
+        EXPECT_NEAR(batch.orientation(k).length(), 1.0f, 1e-6f);
+    }
+    EXPECT_FALSE(batch.hasInertia(4));
+    EXPECT_TRUE(batch.hasInertia(5));
+    expectVecNear(batch.eye(3), singles[3].eye(0), 0.0f);  // at rest: untouched
+}
+
+TEST(CameraBatch, RemoveKeepsIndicesDense) {
+    vne::interaction::CameraBatch batch;
+    for (int k = 0; k < 4; ++k) {
+        batch.add(vne::math::Vec3f(static_cast<float>(k), 0.0f, 0.0f), 1.0f + static_cast<float>(k), kIdentity);
+    }
+    batch.animateTo(3, vne::math::Vec3f(10.0f, 0.0f, 0.0f), 1.0f, kIdentity, 1.0f);
+
+    batch.remove(1);
+    ASSERT_EQ(batch.size(), 3u);
+    EXPECT_FLOAT_EQ(batch.coi(1).x(), 3.0f);  // last camera moved into the slot
+    EXPECT_FLOAT_EQ(batch.distance(1), 4.0f);
+    EXPECT_TRUE(batch.isAnimating(1));
+
+    batch.remove(7);  // ignored
+    EXPECT_EQ(batch.size(), 3u);
+    batch.finishAnimation(1);
+    EXPECT_FLOAT_EQ(batch.coi(1).x(), 10.0f);
+
+    // Bad input is sanitized rather than propagated into the lanes
+    const std::size_t j =
+        batch.add(vne::math::Vec3f(0.0f, 0.0f, 0.0f), -5.0f, vne::math::Quatf(0.0f, 0.0f, 0.0f, 0.0f));
+    EXPECT_GT(batch.distance(j), 0.0f);
+    EXPECT_FLOAT_EQ(batch.orientation(j).w, 1.0f);
+
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+    batch.update(kFrameDt, nullptr);
+}
+
+}  // namespace vne_interaction_test
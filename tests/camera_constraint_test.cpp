@@ -0,0 +1,221 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * CameraConstraint tests: sliding along a wall, keep-in bounds, spring arm with cached frames, and rig
+ * integration in both modes.
+ */
+
+#include "vertexnova/interaction/camera_constraint.h"
+#include "vertexnova/interaction/camera_rig.h"
+#include "vertexnova/interaction/pick_index.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace vne_interaction_test {
+
+namespace {
+
+using vne::interaction::CameraConstraint;
+using vne::interaction::CameraPoseSnapshot;
+using vne::interaction::ConstraintMode;
+using vne::interaction::PickIndex;
+using vne::math::Vec3f;
+
+/** 20 x 20 wall of two triangles in the z = 0 plane. */
+std::shared_ptr<PickIndex> makeWall() {
+    const std::vector<Vec3f> v = {
+        Vec3f(-10.0f, -10.0f, 0.0f), Vec3f(10.0f, -10.0f, 0.0f), Vec3f(10.0f, 10.0f, 0.0f), Vec3f(-10.0f, 10.0f, 0.0f)};
+    const std::vector<std::uint32_t> indices = {0, 1, 2, 0, 2, 3};
+    auto index = std::make_shared<PickIndex>(0);
+    index->buildFromTriangles(v.data(), v.size(), indices.data(), 2);
+    return index;
+}
+
+/** Slab z in [3, 3.5] between the origin and an eye on +Z. */
+std::shared_ptr<PickIndex> makeSlab() {
+    const Vec3f mn(-10.0f, -10.0f, 3.0f);
+    const Vec3f mx(10.0f, 10.0f, 3.5f);
+    auto index = std::make_shared<PickIndex>(0);
+    index->buildFromBoxes(&mn, &mx, 1);
+    return index;
+}
+
+/** Eye at @p eye looking down -Z. */
+CameraPoseSnapshot poseAt(const Vec3f& eye) {
+    CameraPoseSnapshot pose;
+    pose.position = eye;
+    pose.target = eye + Vec3f(0.0f, 0.0f, -1.0f);
+    return pose;
+}
+
+std::shared_ptr<vne::scene::PerspectiveCamera> makeCamera(const Vec3f& eye, const Vec3f& target) {
+    auto camera = vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(60.0f, 1.0f, 0.1f, 1000.0f));
+    camera->lookAt(eye, target, Vec3f(0.0f, 1.0f, 0.0f));
+    camera->updateMatrices();
+    return camera;
+}
+
+}  // namespace
+
+TEST(CameraConstraint, SlidesAlongAWallInsteadOfPassingThrough) {
+    CameraConstraint constraint;
+    constraint.setSceneQuery(makeWall());
+    constraint.setRadius(0.5f);
+    CameraPoseSnapshot out;
+    EXPECT_FALSE(constraint.constrain(poseAt(Vec3f(0.0f, 0.0f, 5.0f)), out));
+
+    // Diagonal move through the wall: stopped in front of it, the sideways part of the motion is kept
+    ASSERT_TRUE(constraint.constrain(poseAt(Vec3f(4.0f, 0.0f, -5.0f)), out));
+    EXPECT_NEAR(out.position.x(), 4.0f, 1e-4f);
+    EXPECT_GT(out.position.z(), 0.5f);
+    EXPECT_LT(out.position.z(), 0.5f + 2.0f * constraint.getSkin());
+    EXPECT_NEAR((out.target - out.position - Vec3f(0.0f, 0.0f, -1.0f)).length(), 0.0f, 1e-5f);
+    EXPECT_TRUE(constraint.hasContact());
+    EXPECT_NEAR(constraint.getLastContact().normal.z(), 1.0f, 1e-5f);
+
+    // The camera now sits at the corrected pose: no motion, no cast
+    const std::uint64_t queries = constraint.getQueryCount();
+    EXPECT_FALSE(constraint.constrain(out, out));
+    EXPECT_EQ(constraint.getQueryCount(), queries);
+
+    // Backing away is free; after a reset the next pose is taken as-is
+    EXPECT_FALSE(constraint.constrain(poseAt(Vec3f(4.0f, 0.0f, 3.0f)), out));
+    constraint.reset();
+    EXPECT_FALSE(constraint.constrain(poseAt(Vec3f(4.0f, 0.0f, -3.0f)), out));
+}
+
+TEST(CameraConstraint, KeepsTheEyeInsideTheBounds) {
+    CameraConstraint constraint;
+    constraint.setRadius(0.5f);
+    constraint.setBounds(Vec3f(5.0f, 5.0f, 5.0f), Vec3f(-5.0f, -5.0f, -5.0f));
+    ASSERT_TRUE(constraint.hasBounds());
+    EXPECT_EQ(constraint.getBoundsMin().x(), -5.0f);
+
+    CameraPoseSnapshot out;
+    ASSERT_TRUE(constraint.constrain(poseAt(Vec3f(10.0f, 0.0f, -7.0f)), out));
+    EXPECT_NEAR((out.position - Vec3f(4.5f, 0.0f, -4.5f)).length(), 0.0f, 1e-5f);
+
+    // Spring arm: the eye is pulled in along the arm, the target stays
+    constraint.setMode(ConstraintMode::eSpringArm);
+    CameraPoseSnapshot orbit;
+    orbit.position = Vec3f(0.0f, 0.0f, 10.0f);
+    orbit.target = Vec3f(0.0f, 0.0f, 0.0f);
+    ASSERT_TRUE(constraint.constrain(orbit, out));
+    EXPECT_NEAR((out.position - Vec3f(0.0f, 0.0f, 4.5f)).length(), 0.0f, 1e-5f);
+    EXPECT_EQ(out.target.z(), 0.0f);
+
+    constraint.clearBounds();
+    EXPECT_FALSE(constraint.constrain(orbit, out));
+}
+
+TEST(CameraConstraint, SpringArmShortensTheArmAndReusesUnchangedFrames) {
+    auto slab = makeSlab();
+    CameraConstraint constraint;
+    constraint.setMode(ConstraintMode::eSpringArm);
+    constraint.setSceneQuery(slab);
+    constraint.setRadius(0.5f);
+    CameraPoseSnapshot orbit;
+    orbit.position = Vec3f(0.0f, 0.0f, 10.0f);
+    orbit.target = Vec3f(0.0f, 0.0f, 0.0f);
+
+    CameraPoseSnapshot out;
+    ASSERT_TRUE(constraint.constrain(orbit, out));
+    EXPECT_NEAR(out.position.z(), 2.5f - constraint.getSkin(), 1e-4f);
+    EXPECT_EQ(constraint.getQueryCount(), 1u);
+
+    // Same pose, same geometry: cached
+    ASSERT_TRUE(constraint.constrain(orbit, out));
+    EXPECT_NEAR(out.position.z(), 2.5f - constraint.getSkin(), 1e-4f);
+    EXPECT_EQ(constraint.getQueryCount(), 1u);
+
+    // The slab moves out of the way: the arm extends again
+    slab->updateBox(0, Vec3f(-10.0f, -10.0f, 30.0f), Vec3f(10.0f, 10.0f, 31.0f));
+    EXPECT_FALSE(constraint.constrain(orbit, out));
+    EXPECT_EQ(constraint.getQueryCount(), 2u);
+    EXPECT_FALSE(constraint.hasContact());
+}
+
+TEST(CameraConstraint, RigCommitsSlidesAndOverridesSpringArm) {
+    // Spring arm on a trackball: the camera shows the shortened arm, the manipulator keeps its distance
+    auto slab = makeSlab();
+    auto orbit = std::make_shared<CameraConstraint>();
+    orbit->setMode(ConstraintMode::eSpringArm);
+    orbit->setSceneQuery(slab);
+    orbit->setRadius(0.5f);
+    auto camera = makeCamera(Vec3f(0.0f, 0.0f, 10.0f), Vec3f(0.0f, 0.0f, 0.0f));
+    auto rig = vne::interaction::CameraRig::makeTrackball();
+    rig.setCamera(camera);
+    rig.onResize(800.0f, 800.0f);
+    rig.setCameraConstraint(orbit);
+    EXPECT_EQ(rig.getCameraConstraint(), orbit);
+
+    rig.onUpdate(0.016);
+    EXPECT_NEAR(camera->getPosition().z(), 2.5f - orbit->getSkin(), 1e-3f);
+    EXPECT_NEAR(rig.getManipulatorPose().position.z(), 10.0f, 1e-4f);
+    slab->updateBox(0, Vec3f(-10.0f, -10.0f, 30.0f), Vec3f(10.0f, 10.0f, 31.0f));
+    rig.onUpdate(0.016);
+    EXPECT_NEAR(camera->getPosition().z(), 10.0f, 1e-4f);
+
+    // Slide on a walkthrough rig: the corrected pose becomes the camera's own
+    auto walk = std::make_shared<CameraConstraint>();
+    walk->setSceneQuery(makeWall());
+    walk->setRadius(0.5f);
+    auto fps_camera = makeCamera(Vec3f(0.0f, 0.0f, 5.0f), Vec3f(0.0f, 0.0f, 4.0f));
+    auto fps = vne::interaction::CameraRig::makeFps();
+    fps.setCamera(fps_camera);
+    fps.onResize(800.0f, 800.0f);
+    fps.setCameraConstraint(walk);
+    fps.onUpdate(0.016);
+    EXPECT_NEAR(fps_camera->getPosition().z(), 5.0f, 1e-5f);
+
+    fps_camera->lookAt(Vec3f(0.0f, 0.0f, -5.0f), Vec3f(0.0f, 0.0f, -6.0f), Vec3f(0.0f, 1.0f, 0.0f));
+    fps.onUpdate(0.016);
+    EXPECT_GT(fps_camera->getPosition().z(), 0.5f);
+    EXPECT_LT(fps_camera->getPosition().z(), 0.6f);
+    EXPECT_NEAR(fps.getManipulatorPose().position.z(), fps_camera->getPosition().z(), 1e-5f);
+    EXPECT_NEAR(fps_camera->getTarget().z(), fps_camera->getPosition().z() - 1.0f, 1e-4f);
+}
+
+TEST(CameraConstraint, RigCommitsSlidesUnderFixedTimestep) {
+    // Walk forward into the bounds with and without fixed-step interpolation: both stop at the same wall
+    auto walkInto = [](double fixed_step_s) {
+        auto bounds = std::make_shared<CameraConstraint>();
+        bounds->setRadius(0.1f);
+        bounds->setBounds(Vec3f(-5.0f, -5.0f, -0.2f), Vec3f(5.0f, 5.0f, 10.0f));
+        auto camera = makeCamera(Vec3f(0.0f, 0.0f, 0.5f), Vec3f(0.0f, 0.0f, -0.5f));
+        auto rig = vne::interaction::CameraRig::makeFps();
+        rig.setCamera(camera);
+        rig.onResize(800.0f, 800.0f);
+        rig.setFixedTimestep(fixed_step_s);
+        rig.setCameraConstraint(bounds);
+        vne::interaction::CameraCommandPayload p;
+        p.pressed = true;
+        rig.onAction(vne::interaction::CameraActionType::eMoveForward, p, 0.0);
+        for (int i = 0; i < 120; ++i) {
+            rig.onUpdate(1.0 / 60.0);
+        }
+        return camera->getPosition().z();
+    };
+    const float free_z = walkInto(0.0);
+    const float fixed_z = walkInto(1.0 / 240.0);
+    EXPECT_NEAR(free_z, -0.1f, 1e-4f);
+    EXPECT_NEAR(fixed_z, free_z, 1e-4f);
+}
+
+}  // namespace vne_interaction_test
@@ -0,0 +1,179 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * CameraHistory tests: ring overwrite, coalescing, undo / redo branches, and controller gesture commits.
+ */
+
+#include "vertexnova/interaction/camera_history.h"
+#include "vertexnova/interaction/inspect_3d_controller.h"
+#include "vertexnova/interaction/ortho_2d_controller.h"
+#include "vertexnova/events/mouse_event.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <gtest/gtest.h>
+
+namespace vne_interaction_test {
+
+namespace {
+
+constexpr double kFrameDt = 1.0 / 60.0;
+
+vne::interaction::CameraPoseSnapshot poseAtX(float x) {
+    vne::interaction::CameraPoseSnapshot p;
+    p.position = vne::math::Vec3f(x, 0.0f, 5.0f);
+    p.target = vne::math::Vec3f(x, 0.0f, 0.0f);
+    return p;
+}
+
+void expectVecNear(const vne::math::Vec3f& a, const vne::math::Vec3f& b, float tol = 1e-3f) {
+    EXPECT_NEAR(a.x(), b.x(), tol);
+    EXPECT_NEAR(a.y(), b.y(), tol);
+    EXPECT_NEAR(a.z(), b.z(), tol);
+}
+
+void settle(vne::interaction::ICameraController& ctrl, int frames = 120) {
+    for (int i = 0; i < frames; ++i) {
+        ctrl.onUpdate(kFrameDt);
+    }
+}
+
+void dragLeft(vne::interaction::ICameraController& ctrl, float x0, float x1) {
+    ctrl.onEvent(vne::events::MouseMovedEvent(x0, 360.0), kFrameDt);
+    ctrl.onEvent(vne::events::MouseButtonPressedEvent(vne::events::MouseButton::eLeft, 0, x0, 360.0), kFrameDt);
+    for (int i = 1; i <= 10; ++i) {
+        ctrl.onEvent(vne::events::MouseMovedEvent(x0 + (x1 - x0) * static_cast<float>(i) / 10.0f, 360.0),
+                     kFrameDt);
+        ctrl.onUpdate(kFrameDt);
+    }
+    ctrl.onEvent(vne::events::MouseButtonReleasedEvent(vne::events::MouseButton::eLeft, 0, x1, 360.0), kFrameDt);
+}
+
+}  // namespace
+
+TEST(CameraHistory, RingKeepsNewestEntries) {
+    vne::interaction::CameraHistory history(3);
+    EXPECT_EQ(history.capacity(), 3u);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(history.push(poseAtX(static_cast<float>(i))));
+    }
+    EXPECT_EQ(history.size(), 3u);
+    EXPECT_EQ(history.capacity(), 3u);
+    EXPECT_FALSE(history.canRedo());
+
+    vne::interaction::CameraPoseSnapshot out;
+    ASSERT_TRUE(history.undo(poseAtX(4.0f), out));
+    EXPECT_FLOAT_EQ(out.position.x(), 3.0f);
+    ASSERT_TRUE(history.undo(out, out));
+    EXPECT_FLOAT_EQ(out.position.x(), 2.0f);
+    EXPECT_FALSE(history.undo(out, out));  // 0 and 1 were overwritten
+    EXPECT_FLOAT_EQ(out.position.x(), 2.0f);
+
+    ASSERT_TRUE(history.redo(out, out));
+    EXPECT_FLOAT_EQ(out.position.x(), 3.0f);
+
+    // Pushing drops the redo step (4)
+    EXPECT_TRUE(history.push(poseAtX(7.0f)));
+    EXPECT_FALSE(history.canRedo());
+    EXPECT_EQ(history.size(), 3u);
+    EXPECT_FLOAT_EQ(history.current().position.x(), 7.0f);
+
+    history.clear();
+    EXPECT_TRUE(history.empty());
+    EXPECT_FALSE(history.undo(poseAtX(1.0f), out));
+    EXPECT_EQ(history.size(), 1u);
+}
+
+TEST(CameraHistory, CoalescesAndCommitsPendingChange) {
+    vne::interaction::CameraHistory history;
+    EXPECT_TRUE(history.push(poseAtX(0.0f)));
+    EXPECT_FALSE(history.push(poseAtX(0.0f)));
+    EXPECT_EQ(history.size(), 1u);
+
+    // Camera moved without a commit: undo keeps that pose as a redo step
+    vne::interaction::CameraPoseSnapshot out;
+    ASSERT_TRUE(history.undo(poseAtX(2.0f), out));
+    EXPECT_FLOAT_EQ(out.position.x(), 0.0f);
+    ASSERT_TRUE(history.redo(out, out));
+    EXPECT_FLOAT_EQ(out.position.x(), 2.0f);
+
+    // Moving after undo discards the redo branch
+    ASSERT_TRUE(history.undo(out, out));
+    EXPECT_FALSE(history.redo(poseAtX(5.0f), out));
+    EXPECT_FALSE(history.canRedo());
+    EXPECT_FLOAT_EQ(history.current().position.x(), 5.0f);
+}
+
+TEST(CameraHistory, Inspect3DUndoesWholeGestureIncludingInertia) {
+    vne::interaction::Inspect3DController ctrl;
+    auto cam = vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(45.0f, 16.0f / 9.0f, 0.1f, 1000.0f));
+    cam->setPosition(vne::math::Vec3f(0.0f, 0.0f, 5.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    ctrl.setCamera(cam);
+    ctrl.onResize(1280.0f, 720.0f);
+    const vne::math::Vec3f start = cam->getPosition();
+
+    dragLeft(ctrl, 500.0f, 800.0f);
+    settle(ctrl);
+    const vne::math::Vec3f after_drag = cam->getPosition();
+    EXPECT_GT((after_drag - start).length(), 0.5f);
+    EXPECT_EQ(ctrl.cameraHistory().size(), 2u);  // start, settled end of the drag
+
+    ctrl.fitToAABB(vne::math::Vec3f(9.0f, -1.0f, -1.0f), vne::math::Vec3f(11.0f, 1.0f, 1.0f));
+    settle(ctrl);
+    const vne::math::Vec3f after_fit = cam->getPosition();
+    EXPECT_EQ(ctrl.cameraHistory().size(), 3u);
+
+    ASSERT_TRUE(ctrl.undo(0.25f));
+    ctrl.onUpdate(0.1);
+    EXPECT_GT((cam->getPosition() - after_drag).length(), 1e-2f);  // still easing
+    settle(ctrl, 30);
+    expectVecNear(cam->getPosition(), after_drag);
+
+    ASSERT_TRUE(ctrl.undo(0.0f));
+    expectVecNear(cam->getPosition(), start);
+    EXPECT_FALSE(ctrl.undo());
+
+    ASSERT_TRUE(ctrl.redo(0.0f));
+    ASSERT_TRUE(ctrl.redo(0.0f));
+    expectVecNear(cam->getPosition(), after_fit);
+    EXPECT_FALSE(ctrl.redo());
+
+    // The restored pose is the manipulator's own: a new gesture continues from it
+    ctrl.undo(0.0f);
+    dragLeft(ctrl, 600.0f, 640.0f);
+    settle(ctrl);
+    EXPECT_FALSE(ctrl.cameraHistory().canRedo());
+    EXPECT_LT((cam->getPosition() - after_drag).length(), (after_fit - after_drag).length());
+}
+
+TEST(CameraHistory, Ortho2DUndoesFit) {
+    vne::interaction::Ortho2DController ctrl;
+    auto cam = vne::scene::CameraFactory::createOrthographic(
+        vne::scene::OrthographicCameraParameters(-8.0f, 8.0f, -4.5f, 4.5f, 0.1f, 100.0f));
+    cam->setPosition(vne::math::Vec3f(0.0f, 0.0f, 10.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    ctrl.setCamera(cam);
+    ctrl.onResize(1280.0f, 720.0f);
+    const float width = cam->getWidth();
+
+    ctrl.fitToAABB(vne::math::Vec3f(20.0f, 20.0f, -1.0f), vne::math::Vec3f(60.0f, 40.0f, 1.0f));
+    settle(ctrl, 2);
+    EXPECT_GT(cam->getPosition().x(), 10.0f);
+
+    ASSERT_TRUE(ctrl.undo(0.0f));
+    expectVecNear(cam->getPosition(), vne::math::Vec3f(0.0f, 0.0f, 10.0f));
+    EXPECT_NEAR(cam->getWidth(), width, 1e-3f);
+}
+
+}  // namespace vne_interaction_test
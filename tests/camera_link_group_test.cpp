@@ -0,0 +1,199 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * CameraLinkGroup tests: zoom / pan mirrored across slice views, channel masks, center linking, 3D zoom, slow
+ * orbits.
+ */
+
+#include "vertexnova/interaction/camera_link_group.h"
+#include "vertexnova/interaction/ortho_2d_controller.h"
+#include "vertexnova/interaction/ortho_2d_manipulator.h"
+#include "vertexnova/events/mouse_event.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace vne_interaction_test {
+
+namespace {
+
+constexpr float kTol = 1e-4f;
+
+/** Orthographic slice camera 10 units from the origin along @p back, 20 x 20 units wide. */
+std::shared_ptr<vne::scene::OrthographicCamera> makeSlice(const vne::math::Vec3f& back, const vne::math::Vec3f& up) {
+    auto cam = vne::scene::CameraFactory::createOrthographic(
+        vne::scene::OrthographicCameraParameters(-10.0f, 10.0f, -10.0f, 10.0f, 0.1f, 100.0f));
+    cam->setPosition(back * 10.0f);
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), up);
+    cam->updateMatrices();
+    return cam;
+}
+
+void expectVecNear(const vne::math::Vec3f& a, const vne::math::Vec3f& b) {
+    EXPECT_NEAR(a.x(), b.x(), kTol);
+    EXPECT_NEAR(a.y(), b.y(), kTol);
+    EXPECT_NEAR(a.z(), b.z(), kTol);
+}
+
+/** Zoom @p cam by @p factor and move it (eye and target) by @p pan. */
+void zoomAndPan(vne::scene::OrthographicCamera& cam, float factor, const vne::math::Vec3f& pan) {
+    const float half_w = cam.getWidth() * 0.5f * factor;
+    const float half_h = cam.getHeight() * 0.5f * factor;
+    cam.setBounds(-half_w, half_w, -half_h, half_h, cam.getNearPlane(), cam.getFarPlane());
+    const vne::math::Vec3f up = cam.getUp();
+    cam.setPosition(cam.getPosition() + pan);
+    cam.lookAt(cam.getTarget() + pan, up);
+    cam.updateMatrices();
+}
+
+}  // namespace
+
+TEST(CameraLinkGroup, MirrorsZoomAndProjectsPanPerSlice) {
+    using vne::math::Vec3f;
+    auto axial = makeSlice(Vec3f(0.0f, 0.0f, 1.0f), Vec3f(0.0f, 1.0f, 0.0f));
+    auto sagittal = makeSlice(Vec3f(1.0f, 0.0f, 0.0f), Vec3f(0.0f, 0.0f, 1.0f));
+    auto coronal = makeSlice(Vec3f(0.0f, -1.0f, 0.0f), Vec3f(0.0f, 0.0f, 1.0f));
+
+    vne::interaction::CameraLinkGroup links;
+    EXPECT_EQ(links.addView(axial, vne::interaction::kLinkZoom | vne::interaction::kLinkPan), 0u);
+    EXPECT_EQ(links.addView(sagittal, vne::interaction::kLinkZoom | vne::interaction::kLinkPan), 1u);
+    EXPECT_EQ(links.addView(coronal, vne::interaction::kLinkZoom), 2u);
+    EXPECT_EQ(links.addView(axial), 0u);  // already linked
+    links.addView(nullptr);
+    EXPECT_EQ(links.size(), 3u);
+    EXPECT_EQ(links.sync(), vne::interaction::CameraLinkGroup::kNoSource);
+
+    zoomAndPan(*axial, 0.5f, Vec3f(2.0f, 3.0f, 0.0f));
+    EXPECT_EQ(links.sync(), 0u);
+
+    // Sagittal sees the axial plane's Y motion only; its X (depth) stays on the slice
+    EXPECT_NEAR(sagittal->getWidth(), 10.0f, kTol);
+    EXPECT_NEAR(sagittal->getHeight(), 10.0f, kTol);
+    expectVecNear(sagittal->getTarget(), Vec3f(0.0f, 3.0f, 0.0f));
+    expectVecNear(sagittal->getPosition(), Vec3f(10.0f, 3.0f, 0.0f));
+
+    // Coronal links zoom but not pan
+    EXPECT_NEAR(coronal->getWidth(), 10.0f, kTol);
+    expectVecNear(coronal->getTarget(), Vec3f(0.0f, 0.0f, 0.0f));
+
+    // Linked writes are not mistaken for new user moves
+    EXPECT_EQ(links.sync(), vne::interaction::CameraLinkGroup::kNoSource);
+
+    // Now the coronal view drives: X/Z pan reaches the axial view as X only, sagittal as Z only
+    links.setChannels(0, vne::interaction::kLinkPan);
+    EXPECT_EQ(links.getChannels(0), vne::interaction::kLinkPan);
+    zoomAndPan(*coronal, 2.0f, Vec3f(1.0f, 0.0f, -4.0f));
+    EXPECT_EQ(links.sync(), 2u);
+    EXPECT_NEAR(axial->getWidth(), 10.0f, kTol);
+    expectVecNear(axial->getTarget(), Vec3f(3.0f, 3.0f, 0.0f));
+    EXPECT_NEAR(sagittal->getWidth(), 20.0f, kTol);
+    expectVecNear(sagittal->getTarget(), Vec3f(0.0f, 3.0f, -4.0f));
+}
+
+TEST(CameraLinkGroup, CenterLinkAlignsTargetsAndPerspectiveZoomScalesDistance) {
+    using vne::math::Vec3f;
+    auto axial = makeSlice(Vec3f(0.0f, 0.0f, 1.0f), Vec3f(0.0f, 1.0f, 0.0f));
+    auto volume = vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(45.0f, 1.0f, 0.1f, 1000.0f));
+    volume->setPosition(Vec3f(0.0f, -8.0f, 6.0f));
+    volume->lookAt(Vec3f(0.0f, 0.0f, 0.0f), Vec3f(0.0f, 0.0f, 1.0f));
+    volume->updateMatrices();
+
+    vne::interaction::CameraLinkGroup links;
+    links.addView(axial, vne::interaction::kLinkNone);
+    links.addView(volume, vne::interaction::kLinkZoom | vne::interaction::kLinkCenter);
+
+    zoomAndPan(*axial, 0.5f, Vec3f(2.0f, -1.0f, 0.0f));
+    EXPECT_EQ(links.sync(), 0u);
+    expectVecNear(volume->getTarget(), Vec3f(2.0f, -1.0f, 0.0f));
+    EXPECT_NEAR((volume->getPosition() - volume->getTarget()).length(), 5.0f, kTol);
+
+    // A source-only view is never written by the others
+    volume->setPosition(volume->getPosition() + Vec3f(0.0f, 0.0f, 1.0f));
+    volume->lookAt(volume->getTarget(), Vec3f(0.0f, 0.0f, 1.0f));
+    volume->updateMatrices();
+    EXPECT_EQ(links.sync(), 1u);
+    EXPECT_NEAR(axial->getWidth(), 10.0f, kTol);
+    expectVecNear(axial->getTarget(), Vec3f(2.0f, -1.0f, 0.0f));
+}
+
+TEST(CameraLinkGroup, ControllerDrivenSourceAndBaseline) {
+    using vne::math::Vec3f;
+    auto axial = makeSlice(Vec3f(0.0f, 0.0f, 1.0f), Vec3f(0.0f, 1.0f, 0.0f));
+    auto sagittal = makeSlice(Vec3f(1.0f, 0.0f, 0.0f), Vec3f(0.0f, 0.0f, 1.0f));
+    vne::interaction::Ortho2DController axial_ctrl;
+    vne::interaction::Ortho2DController sagittal_ctrl;
+    axial_ctrl.setCamera(axial);
+    axial_ctrl.onResize(512.0f, 512.0f);
+    sagittal_ctrl.setCamera(sagittal);
+    sagittal_ctrl.onResize(512.0f, 512.0f);
+
+    // Scene-scale zoom never touches the camera; link the lens extent instead
+    axial_ctrl.ortho2DManipulator().setZoomMethod(vne::interaction::ZoomMethod::eChangeFov);
+
+    vne::interaction::CameraLinkGroup links;
+    links.addView(axial, vne::interaction::kLinkAll, &axial_ctrl.ortho2DManipulator());
+    links.addView(sagittal, vne::interaction::kLinkAll, &sagittal_ctrl.ortho2DManipulator());
+
+    axial_ctrl.onEvent(vne::events::MouseMovedEvent(256.0, 256.0), 0.016);
+    axial_ctrl.onEvent(vne::events::MouseScrolledEvent(0.0, 1.0), 0.016);
+    axial_ctrl.onUpdate(0.016);
+    ASSERT_LT(axial->getWidth(), 20.0f);
+    EXPECT_EQ(links.sync(), 0u);
+    EXPECT_NEAR(sagittal->getWidth(), axial->getWidth(), 1e-3f);
+    EXPECT_NEAR(sagittal->getTarget().x(), 0.0f, kTol);
+
+    // Programmatic moves are adopted without being mirrored
+    sagittal->setBounds(-3.0f, 3.0f, -3.0f, 3.0f, 0.1f, 100.0f);
+    links.resetBaseline();
+    EXPECT_EQ(links.sync(), vne::interaction::CameraLinkGroup::kNoSource);
+    EXPECT_NEAR(sagittal->getWidth(), 6.0f, kTol);
+
+    EXPECT_TRUE(links.removeView(sagittal.get()));
+    EXPECT_FALSE(links.removeView(sagittal.get()));
+    links.clear();
+    EXPECT_TRUE(links.empty());
+}
+
+TEST(CameraLinkGroup, SlowOrbitReachesLinkedViews) {
+    using vne::math::Vec3f;
+    auto makeVolume = []() {
+        auto cam = vne::scene::CameraFactory::createPerspective(
+            vne::scene::PerspectiveCameraParameters(45.0f, 1.0f, 0.1f, 1000.0f));
+        cam->setPosition(Vec3f(0.0f, 0.0f, 5.0f));
+        cam->lookAt(Vec3f(0.0f, 0.0f, 0.0f), Vec3f(0.0f, 1.0f, 0.0f));
+        cam->updateMatrices();
+        return cam;
+    };
+    auto source = makeVolume();
+    auto linked = makeVolume();
+    vne::interaction::CameraLinkGroup links;
+    links.addView(source, vne::interaction::kLinkNone);
+    links.addView(linked, vne::interaction::kLinkRotate);
+
+    // 100 syncs of 0.1 degrees each about +Y
+    const auto step = vne::math::Quatf::fromAxisAngle(Vec3f(0.0f, 1.0f, 0.0f), vne::math::degToRad(0.1f));
+    for (int i = 0; i < 100; ++i) {
+        source->setPosition(step.rotate(source->getPosition()));
+        source->lookAt(Vec3f(0.0f, 0.0f, 0.0f), Vec3f(0.0f, 1.0f, 0.0f));
+        source->updateMatrices();
+        EXPECT_EQ(links.sync(), 0u);
+    }
+    ASSERT_GT(source->getPosition().x(), 0.8f);
+    EXPECT_NEAR(linked->getPosition().x(), source->getPosition().x(), 1e-3f);
+    EXPECT_NEAR(linked->getPosition().z(), source->getPosition().z(), 1e-3f);
+}
+
+}  // namespace vne_interaction_test
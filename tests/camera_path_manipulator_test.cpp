@@ -0,0 +1,188 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * CameraPathManipulator tests: path build, arc-length sampling, playback, look-at keys, rig wiring.
+ */
+
+#include "vertexnova/interaction/camera_path_manipulator.h"
+#include "vertexnova/interaction/camera_rig.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace vne_interaction_test {
+
+static std::shared_ptr<vne::scene::PerspectiveCamera> makePerspCamera() {
+    return vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(45.0f, 16.0f / 9.0f, 0.1f, 1000.0f));
+}
+
+static vne::interaction::CameraPathKeyframe lookAtKey(const vne::math::Vec3f& pos, const vne::math::Vec3f& target) {
+    vne::interaction::CameraPathKeyframe k;
+    k.position = pos;
+    k.look_at = target;
+    k.use_look_at = true;
+    return k;
+}
+
+/** Four keys on a square around the origin, all looking at the origin. */
+static std::vector<vne::interaction::CameraPathKeyframe> squareKeys() {
+    const vne::math::Vec3f o(0.0f, 0.0f, 0.0f);
+    return {lookAtKey({10.0f, 0.0f, 0.0f}, o),
+            lookAtKey({0.0f, 0.0f, 10.0f}, o),
+            lookAtKey({-10.0f, 0.0f, 0.0f}, o),
+            lookAtKey({0.0f, 0.0f, -10.0f}, o)};
+}
+
+TEST(CameraPathManipulator, RejectsSingleKeyframe) {
+    vne::interaction::CameraPathManipulator m;
+    EXPECT_FALSE(m.setKeyframes({lookAtKey({0.0f, 0.0f, 5.0f}, {0.0f, 0.0f, 0.0f})}));
+    EXPECT_FALSE(m.isValid());
+    EXPECT_FLOAT_EQ(m.getLength(), 0.0f);
+    vne::interaction::CameraPathSample s;
+    EXPECT_FALSE(m.sampleAtDistance(0.0f, s));
+}
+
+TEST(CameraPathManipulator, StraightLineLengthAndConstantSpeed) {
+    vne::interaction::CameraPathManipulator m;
+    const vne::math::Vec3f t(0.0f, 0.0f, -100.0f);
+    ASSERT_TRUE(m.setKeyframes({lookAtKey({0.0f, 0.0f, 0.0f}, t),
+                                lookAtKey({0.0f, 0.0f, -2.0f}, t),
+                                lookAtKey({0.0f, 0.0f, -10.0f}, t)}));
+    EXPECT_NEAR(m.getLength(), 10.0f, 1e-3f);
+
+    // Uneven key spacing must not leak into the sampled speed.
+    vne::interaction::CameraPathSample s;
+    for (int i = 0; i <= 10; ++i) {
+        ASSERT_TRUE(m.sampleAtDistance(static_cast<float>(i), s));
+        EXPECT_NEAR(s.position.z(), -static_cast<float>(i), 2e-2f);
+        EXPECT_NEAR(s.position.x(), 0.0f, 1e-4f);
+    }
+}
+
+TEST(CameraPathManipulator, PassesThroughKeyframes) {
+    vne::interaction::CameraPathManipulator m;
+    const auto keys = squareKeys();
+    ASSERT_TRUE(m.setKeyframes(keys));
+
+    vne::interaction::CameraPathSample s;
+    ASSERT_TRUE(m.sampleAtDistance(0.0f, s));
+    EXPECT_NEAR((s.position - keys.front().position).length(), 0.0f, 1e-4f);
+    ASSERT_TRUE(m.sampleAtDistance(m.getLength(), s));
+    EXPECT_NEAR((s.position - keys.back().position).length(), 0.0f, 1e-3f);
+}
+
+TEST(CameraPathManipulator, LoopingWrapsDistance) {
+    vne::interaction::CameraPathManipulator m;
+    m.setLooping(true);
+    ASSERT_TRUE(m.setKeyframes(squareKeys()));
+    const float len = m.getLength();
+    ASSERT_GT(len, 0.0f);
+
+    vne::interaction::CameraPathSample a;
+    vne::interaction::CameraPathSample b;
+    ASSERT_TRUE(m.sampleAtDistance(0.25f * len, a));
+    ASSERT_TRUE(m.sampleAtDistance(1.25f * len, b));
+    EXPECT_NEAR((a.position - b.position).length(), 0.0f, 1e-3f);
+}
+
+TEST(CameraPathManipulator, PlaybackMovesCameraAndStopsAtEnd) {
+    auto cam = makePerspCamera();
+    vne::interaction::CameraPathManipulator m;
+    m.setCamera(cam);
+    m.onResize(1280.0f, 720.0f);
+    ASSERT_TRUE(m.setKeyframes(squareKeys()));
+    m.setSpeed(m.getLength());  // whole path in one second
+
+    m.play();
+    EXPECT_TRUE(m.isPlaying());
+    for (int i = 0; i < 10; ++i) {
+        m.onUpdate(0.05);
+    }
+    EXPECT_NEAR(m.getDistance(), 0.5f * m.getLength(), 1e-3f);
+    EXPECT_TRUE(m.isPlaying());
+
+    for (int i = 0; i < 20; ++i) {
+        m.onUpdate(0.05);
+    }
+    EXPECT_FALSE(m.isPlaying());
+    EXPECT_NEAR((cam->getPosition() - vne::math::Vec3f(0.0f, 0.0f, -10.0f)).length(), 0.0f, 1e-3f);
+
+    // Look-at keys: camera keeps facing the origin.
+    const vne::math::Vec3f fwd = cam->getForwardDir().normalized();
+    const vne::math::Vec3f to_origin = (-cam->getPosition()).normalized();
+    EXPECT_GT(fwd.dot(to_origin), 0.99f);
+}
+
+TEST(CameraPathManipulator, FovTrackInterpolates) {
+    auto cam = makePerspCamera();
+    vne::interaction::CameraPathManipulator m;
+    m.setCamera(cam);
+    auto keys = squareKeys();
+    keys[0].fov_deg = 30.0f;
+    keys[1].fov_deg = 40.0f;
+    keys[2].fov_deg = 50.0f;
+    keys[3].fov_deg = 60.0f;
+    ASSERT_TRUE(m.setKeyframes(keys));
+
+    m.seekNormalized(1.0f);
+    EXPECT_NEAR(cam->getFieldOfView(), 60.0f, 1e-2f);
+    m.seekNormalized(0.0f);
+    EXPECT_NEAR(cam->getFieldOfView(), 30.0f, 1e-2f);
+}
+
+TEST(CameraPathManipulator, RigFactoryAndResetView) {
+    auto rig = vne::interaction::CameraRig::makeCameraPath();
+    ASSERT_EQ(rig.manipulators().size(), 1u);
+    auto path = std::dynamic_pointer_cast<vne::interaction::CameraPathManipulator>(rig.manipulators()[0]);
+    ASSERT_NE(path, nullptr);
+
+    auto cam = makePerspCamera();
+    rig.setCamera(cam);
+    rig.onResize(1280.0f, 720.0f);
+    ASSERT_TRUE(path->setKeyframes(squareKeys()));
+    path->setSpeed(5.0f);
+    path->play();
+    rig.onUpdate(0.5);
+    EXPECT_GT(path->getDistance(), 0.0f);
+
+    rig.onAction(vne::interaction::CameraActionType::eResetView, {}, 0.0);
+    EXPECT_FLOAT_EQ(path->getDistance(), 0.0f);
+    EXPECT_NEAR((cam->getPosition() - vne::math::Vec3f(10.0f, 0.0f, 0.0f)).length(), 0.0f, 1e-4f);
+}
+
+TEST(CameraPathManipulator, PredictPoseSamplesAheadAndClampsAtEnd) {
+    auto cam = makePerspCamera();
+    vne::interaction::CameraPathManipulator m;
+    m.setCamera(cam);
+    m.onResize(1280.0f, 720.0f);
+    ASSERT_TRUE(m.setKeyframes(squareKeys()));
+    m.setSpeed(m.getLength());  // whole path in one second
+    m.play();
+    m.onUpdate(0.2);
+
+    const vne::interaction::CameraPoseSnapshot ahead = m.predictPose(0.3);
+    const vne::interaction::CameraPoseSnapshot past_end = m.predictPose(5.0);
+    EXPECT_NEAR(m.getDistance(), 0.2f * m.getLength(), 1e-3f);  // prediction does not advance playback
+    m.onUpdate(0.3);
+    EXPECT_NEAR((ahead.position - cam->getPosition()).length(), 0.0f, 1e-4f);
+    EXPECT_GT(std::abs(ahead.orientation.dot(cam->getOrientation())), 1.0f - 1e-5f);
+    EXPECT_NEAR((past_end.position - vne::math::Vec3f(0.0f, 0.0f, -10.0f)).length(), 0.0f, 1e-3f);
+
+    m.pause();
+    EXPECT_NEAR((m.predictPose(0.3).position - cam->getPosition()).length(), 0.0f, 1e-6f);
+}
+
+}  // namespace vne_interaction_test
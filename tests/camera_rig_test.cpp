@@ -9,6 +9,7 @@
  * ----------------------------------------------------------------------
  */
 
+#include "vertexnova/interaction/camera_path_manipulator.h"
 #include "vertexnova/interaction/camera_rig.h"
 #include "vertexnova/interaction/free_look_manipulator.h"
 #include "vertexnova/interaction/trackball_manipulator.h"
@@ -17,6 +18,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+
 namespace vne_interaction_test {
 
 static std::shared_ptr<vne::scene::PerspectiveCamera> makePerspCamera() {
@@ -73,4 +77,268 @@ TEST(CameraRig, OnActionDispatchesToManipulators) {
     EXPECT_GT((cam->getPosition() - vne::math::Vec3f(0.0f, 0.0f, 5.0f)).length(), 0.01f);
 }
 
+TEST(CameraRig, SwitchToRejectsUnregisteredManipulator) {
+    vne::interaction::CameraRig rig;
+    auto trackball = std::make_shared<vne::interaction::TrackballManipulator>();
+    rig.addManipulator(trackball);
+    EXPECT_FALSE(rig.switchTo(std::make_shared<vne::interaction::FreeLookManipulator>()));
+    EXPECT_FALSE(rig.switchTo(nullptr));
+    EXPECT_TRUE(trackball->isEnabled());
+}
+
+TEST(CameraRig, SwitchToHandsOrientationToFreeLook) {
+    vne::interaction::CameraRig rig;
+    auto trackball = std::make_shared<vne::interaction::TrackballManipulator>();
+    auto free_look = std::make_shared<vne::interaction::FreeLookManipulator>();
+    rig.addManipulator(trackball);
+    rig.addManipulator(free_look);
+    free_look->setEnabled(false);
+
+    auto cam = makePerspCamera();
+    cam->setPosition(vne::math::Vec3f(0.0f, 0.0f, 5.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    rig.setCamera(cam);
+    rig.onResize(1280.0f, 720.0f);
+
+    // Camera moves while free-look is disabled (its cached orientation goes stale).
+    cam->lookAt(vne::math::Vec3f(5.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    cam->updateMatrices();
+    const vne::math::Vec3f eye_before = cam->getPosition();
+    const vne::math::Vec3f fwd_before = cam->getForwardDir();
+
+    ASSERT_TRUE(rig.switchTo(free_look, 0.0f));
+    EXPECT_FALSE(trackball->isEnabled());
+    EXPECT_TRUE(free_look->isEnabled());
+    EXPECT_FALSE(rig.isTransitioning());
+
+    const vne::math::Vec3f handed_fwd = -free_look->getOrientation().getZAxis();
+    EXPECT_GT(handed_fwd.dot(fwd_before), 0.999f);
+    rig.onUpdate(0.016);
+    EXPECT_NEAR((cam->getPosition() - eye_before).length(), 0.0f, 1e-4f);
+}
+
+TEST(CameraRig, SwitchToBlendsIntoIncomingPose) {
+    vne::interaction::CameraRig rig;
+    auto trackball = std::make_shared<vne::interaction::TrackballManipulator>();
+    auto path = std::make_shared<vne::interaction::CameraPathManipulator>();
+    rig.addManipulator(trackball);
+    rig.addManipulator(path);
+    path->setEnabled(false);
+
+    auto cam = makePerspCamera();
+    cam->setPosition(vne::math::Vec3f(0.0f, 0.0f, 5.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    rig.setCamera(cam);
+    rig.onResize(1280.0f, 720.0f);
+
+    vne::interaction::CameraPathKeyframe a;
+    a.position = vne::math::Vec3f(20.0f, 0.0f, 0.0f);
+    a.look_at = vne::math::Vec3f(0.0f, 0.0f, 0.0f);
+    a.use_look_at = true;
+    vne::interaction::CameraPathKeyframe b = a;
+    b.position = vne::math::Vec3f(20.0f, 10.0f, 0.0f);
+    ASSERT_TRUE(path->setKeyframes({a, b}));
+    path->setSpeed(0.0f);
+    path->play();
+
+    const vne::math::Vec3f start(0.0f, 0.0f, 5.0f);
+    ASSERT_TRUE(rig.switchTo(path, 1.0f));
+    EXPECT_TRUE(rig.isTransitioning());
+    EXPECT_NEAR((cam->getPosition() - start).length(), 0.0f, 1e-4f);  // no jump on the switch frame
+
+    rig.onUpdate(0.5);
+    const float halfway_to_path = (cam->getPosition() - a.position).length();
+    EXPECT_GT(halfway_to_path, 0.1f);
+    EXPECT_GT((cam->getPosition() - start).length(), 0.1f);
+    EXPECT_TRUE(rig.isTransitioning());
+
+    rig.onUpdate(0.6);
+    EXPECT_FALSE(rig.isTransitioning());
+    EXPECT_NEAR((cam->getPosition() - a.position).length(), 0.0f, 1e-3f);
+}
+
+TEST(CameraRig, DirectCameraMoveDuringTransitionIsKept) {
+    vne::interaction::CameraRig rig;
+    auto trackball = std::make_shared<vne::interaction::TrackballManipulator>();
+    rig.addManipulator(trackball);
+    auto cam = makePerspCamera();
+    cam->setPosition(vne::math::Vec3f(0.0f, 0.0f, 5.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    rig.setCamera(cam);
+
+    vne::interaction::CameraPoseSnapshot from = vne::interaction::CameraRig::capturePose(*cam);
+    from.position = vne::math::Vec3f(0.0f, 0.0f, 50.0f);
+    rig.beginTransition(from, 1.0f);
+    ASSERT_TRUE(rig.isTransitioning());
+    EXPECT_NEAR(cam->getPosition().z(), 50.0f, 1e-3f);
+
+    // Outside the rig: manipulator writes a new pose directly; it becomes the blend target.
+    trackball->setOrbitDistance(10.0f);
+    rig.onUpdate(2.0);
+    EXPECT_FALSE(rig.isTransitioning());
+    EXPECT_NEAR(cam->getPosition().z(), 10.0f, 1e-3f);
+}
+
+/** Rig with one FreeLookManipulator holding "move forward" from the origin, looking down -Z. */
+static std::shared_ptr<vne::scene::PerspectiveCamera> setUpMovingFreeLook(vne::interaction::CameraRig& rig) {
+    auto look = std::make_shared<vne::interaction::FreeLookManipulator>();
+    look->setMoveSpeed(1.0f);
+    rig.addManipulator(look);
+    auto cam = makePerspCamera();
+    cam->setPosition(vne::math::Vec3f(0.0f, 0.0f, 0.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, -1.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    rig.setCamera(cam);
+    rig.onResize(1280.0f, 720.0f);
+
+    vne::interaction::CameraCommandPayload p;
+    p.pressed = true;
+    rig.onAction(vne::interaction::CameraActionType::eMoveForward, p, 0.0);
+    return cam;
+}
+
+TEST(CameraRig, FixedTimestepShowsInterpolatedPose) {
+    vne::interaction::CameraRig rig;
+    rig.setFixedTimestep(0.1);
+    EXPECT_TRUE(rig.isFixedTimestepEnabled());
+    auto cam = setUpMovingFreeLook(rig);
+
+    // One whole step: simulated pose advanced, shown pose is the start of that step (alpha = 0).
+    rig.onUpdate(0.1);
+    const float z0 = cam->getPosition().z();
+    EXPECT_NEAR(rig.getInterpolationAlpha(), 0.0f, 1e-5f);
+
+    // Half a step: no simulation, the camera shows the midpoint of the last two states.
+    rig.onUpdate(0.05);
+    EXPECT_NEAR(rig.getInterpolationAlpha(), 0.5f, 1e-5f);
+    const float z_half = cam->getPosition().z();
+
+    rig.onUpdate(0.05);
+    const float z1 = cam->getPosition().z();
+    EXPECT_LT(z1, z0);
+    EXPECT_NEAR(z_half, 0.5f * (z0 + z1), 1e-4f);
+}
+
+TEST(CameraRig, FixedTimestepIsFrameRateIndependent) {
+    vne::interaction::CameraRig smooth;
+    vne::interaction::CameraRig jittery;
+    smooth.setFixedTimestep(1.0 / 240.0);
+    jittery.setFixedTimestep(1.0 / 240.0);
+
+    // Same motion (trackball rotation inertia, which damps per step) under two different frame pacings.
+    auto setUp = [](vne::interaction::CameraRig& rig) {
+        auto trackball = std::make_shared<vne::interaction::TrackballManipulator>();
+        rig.addManipulator(trackball);
+        auto cam = makePerspCamera();
+        cam->setPosition(vne::math::Vec3f(0.0f, 0.0f, 5.0f));
+        cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+        rig.setCamera(cam);
+        rig.onResize(800.0f, 600.0f);
+        vne::interaction::CameraCommandPayload p;
+        p.x_px = 400.0f;
+        p.y_px = 300.0f;
+        rig.onAction(vne::interaction::CameraActionType::eBeginRotate, p, 0.016);
+        p.x_px = 520.0f;
+        rig.onAction(vne::interaction::CameraActionType::eRotateDelta, p, 0.016);
+        rig.onAction(vne::interaction::CameraActionType::eEndRotate, p, 0.016);
+        return cam;
+    };
+    auto cam_smooth = setUp(smooth);
+    auto cam_jittery = setUp(jittery);
+
+    // Both pacings cover 120 steps (0.5 s); frame lengths are whole steps so both end at alpha = 0.
+    for (int i = 0; i < 30; ++i) {
+        smooth.onUpdate(4.0 / 240.0);
+    }
+    const int pattern[] = {1, 7, 2, 6, 3, 5, 8};  // sums to 32 steps
+    int steps = 0;
+    for (int i = 0; steps < 120; i = (i + 1) % 7) {
+        const int n = std::min(pattern[i], 120 - steps);
+        jittery.onUpdate(static_cast<double>(n) / 240.0);
+        steps += n;
+    }
+    EXPECT_GT((cam_smooth->getPosition() - vne::math::Vec3f(0.0f, 0.0f, 5.0f)).length(), 1e-3f);
+    EXPECT_NEAR((cam_smooth->getPosition() - cam_jittery->getPosition()).length(), 0.0f, 1e-4f);
+}
+
+TEST(CameraRig, FixedTimestepCapsStepsPerFrame) {
+    vne::interaction::CameraRig capped;
+    vne::interaction::CameraRig reference;
+    capped.setFixedTimestep(0.01);
+    capped.setMaxFixedSteps(4);
+    EXPECT_EQ(capped.getMaxFixedSteps(), 4);
+    reference.setFixedTimestep(0.01);
+    auto cam_capped = setUpMovingFreeLook(capped);
+    auto cam_reference = setUpMovingFreeLook(reference);
+
+    capped.onUpdate(1.0);     // 100 steps due, only 4 simulated; the rest is dropped
+    reference.onUpdate(0.04);  // same 4 steps
+    EXPECT_NEAR((cam_capped->getPosition() - cam_reference->getPosition()).length(), 0.0f, 1e-4f);
+    EXPECT_LT(capped.getInterpolationAlpha(), 1.0f);
+
+    capped.setMaxFixedSteps(0);
+    EXPECT_EQ(capped.getMaxFixedSteps(), 1);
+}
+
+TEST(CameraRig, FixedTimestepKeepsDirectCameraMove) {
+    vne::interaction::CameraRig rig;
+    rig.setFixedTimestep(0.1);
+    auto cam = setUpMovingFreeLook(rig);
+    rig.onUpdate(0.1);
+    rig.onUpdate(0.05);  // camera shows an interpolated pose
+
+    cam->setPosition(vne::math::Vec3f(3.0f, 0.0f, 0.0f));
+    rig.onUpdate(0.0);
+    EXPECT_NEAR(cam->getPosition().x(), 3.0f, 1e-4f);
+
+    rig.setFixedTimestep(0.0);
+    EXPECT_FALSE(rig.isFixedTimestepEnabled());
+    EXPECT_FLOAT_EQ(rig.getInterpolationAlpha(), 0.0f);
+}
+
+TEST(CameraRig, MotionStateMergesManipulatorsAndTransition) {
+    vne::interaction::CameraRig rig;
+    auto cam = setUpMovingFreeLook(rig);
+    const vne::interaction::CameraMotionState walking = rig.getMotionState();
+    EXPECT_TRUE(walking.isMoving());
+    EXPECT_NEAR(walking.linear_speed, 1.0f, 1e-5f);
+    EXPECT_FALSE(walking.animating);
+
+    vne::interaction::CameraPoseSnapshot from = vne::interaction::CameraRig::capturePose(*cam);
+    from.position = vne::math::Vec3f(0.0f, 0.0f, 50.0f);
+    rig.beginTransition(from, 1.0f);
+    rig.onUpdate(0.25);
+    const vne::interaction::CameraMotionState blending = rig.getMotionState();
+    EXPECT_TRUE(blending.animating);
+    EXPECT_NEAR(blending.settle_time_s, 0.75f, 1e-4f);
+    EXPECT_NEAR(blending.linear_speed, 1.0f, 1e-5f);
+
+    vne::interaction::CameraCommandPayload p;
+    p.pressed = false;
+    rig.onAction(vne::interaction::CameraActionType::eMoveForward, p, 0.0);
+    rig.onUpdate(1.0);
+    EXPECT_FALSE(rig.getMotionState().isMoving());
+}
+
+TEST(CameraRig, PredictPoseCarriesMotionThroughTransition) {
+    vne::interaction::CameraRig rig;
+    const std::array<double, 3> ahead = {0.0, 0.25, 2.0};
+    std::array<vne::interaction::CameraPoseSnapshot, 3> poses;
+    EXPECT_EQ(rig.predictPoses(ahead, poses), 0u);  // no camera
+    auto cam = setUpMovingFreeLook(rig);
+    vne::interaction::CameraPoseSnapshot from = vne::interaction::CameraRig::capturePose(*cam);
+    from.position = vne::math::Vec3f(0.0f, 0.0f, 50.0f);
+    rig.beginTransition(from, 1.0f);
+    rig.onUpdate(0.25);
+
+    // The walk continues under the blend, which moves on to its later progress
+    ASSERT_EQ(rig.predictPoses(ahead, poses), 3u);
+    EXPECT_NEAR((poses[0].position - cam->getPosition()).length(), 0.0f, 1e-4f);
+    EXPECT_NEAR((poses[2].position - vne::math::Vec3f(0.0f, 0.0f, -2.25f)).length(), 0.0f, 1e-4f);
+    EXPECT_NEAR((rig.predictPose(0.25).position - poses[1].position).length(), 0.0f, 1e-6f);
+
+    rig.onUpdate(0.25);
+    EXPECT_NEAR((poses[1].position - cam->getPosition()).length(), 0.0f, 1e-3f);
+    EXPECT_NEAR((rig.getManipulatorPose().position - vne::math::Vec3f(0.0f, 0.0f, -0.5f)).length(), 0.0f, 1e-4f);
+}
+
 }  // namespace vne_interaction_test
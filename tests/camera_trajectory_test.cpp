@@ -0,0 +1,273 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * CameraTrajectoryWriter / CameraTrajectoryReader tests: quantization bounds, random vs bulk access,
+ * size of a long session, unfinished files, and CameraRig export.
+ */
+
+#include "vertexnova/interaction/camera_rig.h"
+#include "vertexnova/interaction/camera_trajectory.h"
+#include "vertexnova/interaction/free_look_manipulator.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace vne_interaction_test {
+
+namespace {
+
+using vne::interaction::CameraTrajectoryFrame;
+using vne::interaction::CameraTrajectoryReader;
+using vne::interaction::CameraTrajectoryWriter;
+using vne::interaction::TrajectoryChannel;
+
+constexpr double kFrameDt = 1.0 / 120.0;
+
+class TempFile {
+   public:
+    explicit TempFile(const char* name)
+        : path_((std::filesystem::temp_directory_path() / name).string()) {}
+    ~TempFile() {
+        std::error_code ec;
+        std::filesystem::remove(path_, ec);
+    }
+    TempFile(const TempFile&) = delete;
+    TempFile& operator=(const TempFile&) = delete;
+
+    [[nodiscard]] const std::string& path() const { return path_; }
+
+   private:
+    std::string path_;
+};
+
+/** Camera orbiting the origin at @p radius, slowly bobbing and zooming. */
+CameraTrajectoryFrame orbitFrame(std::size_t i, float radius = 10.0f) {
+    const double t = static_cast<double>(i) * kFrameDt;
+    const auto angle = static_cast<float>(0.5 * t);
+    const auto height = static_cast<float>(2.0 * std::sin(0.1 * t));
+    CameraTrajectoryFrame f;
+    f.time_s = t;
+    f.center = vne::math::Vec3f(0.0f, 0.0f, 0.0f);
+    f.position = vne::math::Vec3f(radius * std::sin(angle), height, radius * std::cos(angle));
+    f.orientation = vne::math::Quatf(0.0f, std::sin(0.5f * angle), 0.0f, std::cos(0.5f * angle));
+    f.distance = (f.center - f.position).length();
+    f.fov_deg = 45.0f + static_cast<float>(5.0 * std::sin(0.05 * t));
+    return f;
+}
+
+void expectFrameNear(const CameraTrajectoryFrame& a, const CameraTrajectoryFrame& b) {
+    constexpr float kPos = 1e-4f;  // half the default step plus float rounding
+    EXPECT_NEAR(a.time_s, b.time_s, 1e-5);
+    EXPECT_NEAR(a.position.x(), b.position.x(), kPos);
+    EXPECT_NEAR(a.position.y(), b.position.y(), kPos);
+    EXPECT_NEAR(a.position.z(), b.position.z(), kPos);
+    EXPECT_NEAR(a.center.x(), b.center.x(), kPos);
+    EXPECT_NEAR(a.center.y(), b.center.y(), kPos);
+    EXPECT_NEAR(a.center.z(), b.center.z(), kPos);
+    EXPECT_NEAR(a.distance, b.distance, kPos);
+    EXPECT_NEAR(a.fov_deg, b.fov_deg, 1e-3f);
+    // q and -q are the same rotation
+    const float dot = a.orientation.x * b.orientation.x + a.orientation.y * b.orientation.y
+                      + a.orientation.z * b.orientation.z + a.orientation.w * b.orientation.w;
+    EXPECT_NEAR(std::fabs(dot), 1.0f, 1e-5f);
+}
+
+}  // namespace
+
+TEST(CameraTrajectory, RoundTripIsWithinQuantizationStep) {
+    TempFile file("vne_trajectory_roundtrip.vnct");
+    std::vector<CameraTrajectoryFrame> frames;
+    {
+        CameraTrajectoryWriter writer;
+        vne::interaction::CameraTrajectoryOptions options;
+        options.frames_per_block = 64;
+        ASSERT_TRUE(writer.open(file.path(), options));
+        for (std::size_t i = 0; i < 1000; ++i) {
+            frames.push_back(orbitFrame(i * 7));  // faster motion than real frames
+            if (i == 500) {
+                frames.back().orientation = vne::math::Quatf(-frames.back().orientation.x,
+                                                             -frames.back().orientation.y,
+                                                             -frames.back().orientation.z,
+                                                             -frames.back().orientation.w);
+                frames.back().position = vne::math::Vec3f(100.0f, -50.0f, 3.0f);  // teleport
+            }
+            writer.append(frames.back());
+        }
+        EXPECT_EQ(writer.getFrameCount(), frames.size());
+        writer.close();
+        EXPECT_FALSE(writer.hasWriteError());
+    }
+
+    CameraTrajectoryReader reader;
+    ASSERT_TRUE(reader.open(file.path()));
+    EXPECT_EQ(reader.getOptions().frames_per_block, 64u);
+    ASSERT_EQ(reader.getFrameCount(), frames.size());
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        CameraTrajectoryFrame out;
+        ASSERT_TRUE(reader.readFrame(i, out));
+        expectFrameNear(out, frames[i]);
+    }
+    CameraTrajectoryFrame out;
+    EXPECT_FALSE(reader.readFrame(frames.size(), out));
+}
+
+TEST(CameraTrajectory, RandomAccessMatchesColumns) {
+    TempFile file("vne_trajectory_columns.vnct");
+    {
+        CameraTrajectoryWriter writer;
+        ASSERT_TRUE(writer.open(file.path()));
+        for (std::size_t i = 0; i < 2000; ++i) {
+            writer.append(orbitFrame(i));
+        }
+        // Non-finite values fall back to raw storage for their block
+        CameraTrajectoryFrame bad = orbitFrame(2000);
+        bad.fov_deg = std::numeric_limits<float>::infinity();
+        writer.append(bad);
+        writer.close();
+    }
+
+    CameraTrajectoryReader reader;
+    ASSERT_TRUE(reader.open(file.path()));
+    ASSERT_EQ(reader.getFrameCount(), 2001u);
+
+    const std::vector<double> x = reader.readColumn(TrajectoryChannel::ePositionX);
+    ASSERT_EQ(x.size(), 2001u);
+    for (std::size_t i : {0u, 1u, 255u, 256u, 257u, 1023u, 1999u, 2000u}) {
+        EXPECT_EQ(reader.readValue(i, TrajectoryChannel::ePositionX), x[i]) << i;
+    }
+
+    // Partial range across a block boundary, clamped at the end of the file
+    std::vector<double> fov(600, -1.0);
+    EXPECT_EQ(reader.readColumn(TrajectoryChannel::eFovDeg, 1500, fov.size(), fov.data()), 501u);
+    for (std::size_t i = 0; i < 500; ++i) {
+        EXPECT_EQ(fov[i], reader.readValue(1500 + i, TrajectoryChannel::eFovDeg));
+        EXPECT_NEAR(fov[i], orbitFrame(1500 + i).fov_deg, 1e-3);
+    }
+    EXPECT_TRUE(std::isinf(fov[500]));
+    EXPECT_EQ(fov[501], -1.0);
+    EXPECT_EQ(reader.readColumn(TrajectoryChannel::eTime, 2001, 4, fov.data()), 0u);
+}
+
+TEST(CameraTrajectory, HourAt120HzStaysInLowMegabytes) {
+    TempFile file("vne_trajectory_hour.vnct");
+    constexpr std::size_t kFrames = 3600 * 120;
+    CameraTrajectoryWriter writer;
+    ASSERT_TRUE(writer.open(file.path()));
+    for (std::size_t i = 0; i < kFrames; ++i) {
+        writer.append(orbitFrame(i));
+    }
+    writer.close();
+
+    const auto bytes = std::filesystem::file_size(file.path());
+    EXPECT_LT(bytes, 4u * 1024u * 1024u);  // raw float frames would take ~26 MB
+
+    CameraTrajectoryReader reader;
+    ASSERT_TRUE(reader.open(file.path()));
+    ASSERT_EQ(reader.getFrameCount(), kFrames);
+    for (std::size_t i : {std::size_t{0}, kFrames / 3, kFrames - 1}) {
+        CameraTrajectoryFrame out;
+        ASSERT_TRUE(reader.readFrame(i, out));
+        expectFrameNear(out, orbitFrame(i));
+    }
+}
+
+TEST(CameraTrajectory, UnfinishedFileIsReadableUpToLastBlock) {
+    TempFile file("vne_trajectory_unfinished.vnct");
+    TempFile torn("vne_trajectory_torn.vnct");
+    {
+        CameraTrajectoryWriter writer;
+        vne::interaction::CameraTrajectoryOptions options;
+        options.frames_per_block = 16;
+        ASSERT_TRUE(writer.open(file.path(), options));
+        for (std::size_t i = 0; i < 100; ++i) {
+            writer.append(orbitFrame(i));
+        }
+        writer.close();
+    }
+    std::vector<char> bytes;
+    {
+        std::ifstream in(file.path(), std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    // Drop the index and half of the last (partial) block, as if the application had crashed
+    const std::size_t footer_bytes = 7 * 8 + 8 + 8 + 8 + 4;
+    bytes.resize(bytes.size() - footer_bytes - 20);
+    {
+        std::ofstream out(torn.path(), std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    CameraTrajectoryReader reader;
+    ASSERT_TRUE(reader.open(torn.path()));
+    EXPECT_EQ(reader.getFrameCount(), 96u);
+    CameraTrajectoryFrame out;
+    ASSERT_TRUE(reader.readFrame(95, out));
+    expectFrameNear(out, orbitFrame(95));
+
+    EXPECT_FALSE(reader.open(file.path() + ".missing"));
+    EXPECT_FALSE(reader.isOpen());
+    CameraTrajectoryWriter writer;
+    vne::interaction::CameraTrajectoryOptions bad;
+    bad.position_step = 0.0;
+    EXPECT_FALSE(writer.open(file.path(), bad));
+}
+
+TEST(CameraTrajectory, RigAppendsShownPoseEveryUpdate) {
+    TempFile file("vne_trajectory_rig.vnct");
+    auto writer = std::make_shared<CameraTrajectoryWriter>();
+    ASSERT_TRUE(writer->open(file.path()));
+
+    vne::interaction::CameraRig rig;
+    auto look = std::make_shared<vne::interaction::FreeLookManipulator>();
+    look->setMoveSpeed(1.0f);
+    rig.addManipulator(look);
+    auto cam = vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(45.0f, 16.0f / 9.0f, 0.1f, 1000.0f));
+    cam->setPosition(vne::math::Vec3f(0.0f, 0.0f, 0.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, -1.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    rig.setCamera(cam);
+    rig.onResize(1280.0f, 720.0f);
+    rig.setTrajectoryWriter(writer);
+
+    vne::interaction::CameraCommandPayload p;
+    p.pressed = true;
+    rig.onAction(vne::interaction::CameraActionType::eMoveForward, p, 0.0);
+    for (int i = 0; i < 10; ++i) {
+        rig.onUpdate(0.1);
+    }
+    rig.setTrajectoryWriter(nullptr);
+    rig.onUpdate(0.1);
+    writer->close();
+
+    CameraTrajectoryReader reader;
+    ASSERT_TRUE(reader.open(file.path()));
+    ASSERT_EQ(reader.getFrameCount(), 10u);
+    CameraTrajectoryFrame first;
+    CameraTrajectoryFrame last;
+    ASSERT_TRUE(reader.readFrame(0, first));
+    ASSERT_TRUE(reader.readFrame(9, last));
+    EXPECT_EQ(first.time_s, 0.0);  // timestamps start at 0
+    EXPECT_NEAR(last.time_s, 0.9, 1e-5);
+    EXPECT_NEAR(last.fov_deg, 45.0f, 1e-3f);
+    EXPECT_LT(reader.readValue(0, TrajectoryChannel::ePositionZ), 0.0);
+    EXPECT_LT(last.position.z(), reader.readValue(0, TrajectoryChannel::ePositionZ) - 0.5);
+}
+
+}  // namespace vne_interaction_test
@@ -0,0 +1,157 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * ClipPlaneManager tests: sphere fit with view culling, hysteresis, depth-ratio floor, PickIndex bounds and
+ * rig integration.
+ */
+
+#include "vertexnova/interaction/clip_plane_manager.h"
+#include "vertexnova/interaction/camera_rig.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+namespace vne_interaction_test {
+
+namespace {
+
+using vne::interaction::ClipPlaneManager;
+using vne::interaction::ClipSphere;
+using vne::math::Vec3f;
+
+/** Place @p camera at @p eye looking down -Z. */
+void moveTo(vne::scene::ICamera& camera, const Vec3f& eye) {
+    camera.lookAt(eye, Vec3f(eye.x(), eye.y(), eye.z() - 1.0f), Vec3f(0.0f, 1.0f, 0.0f));
+    camera.updateMatrices();
+}
+
+std::shared_ptr<vne::scene::PerspectiveCamera> makeCamera(const Vec3f& eye) {
+    auto camera = vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(60.0f, 1.0f, 0.1f, 1000.0f));
+    moveTo(*camera, eye);
+    return camera;
+}
+
+}  // namespace
+
+TEST(ClipPlaneManager, FitsVisibleSpheresWithPadding) {
+    ClipPlaneManager clip;
+    const std::vector<ClipSphere> spheres = {
+        {Vec3f(0.0f, 0.0f, 0.0f), 1.0f},
+        {Vec3f(0.0f, 0.0f, 20.0f), 1.0f},    // behind the camera
+        {Vec3f(1000.0f, 0.0f, 0.0f), 1.0f},  // outside the field of view
+    };
+    clip.setSpheres(spheres);
+
+    auto camera = makeCamera(Vec3f(0.0f, 0.0f, 10.0f));
+    EXPECT_TRUE(clip.update(*camera));
+    EXPECT_NEAR(camera->getNearPlane(), 9.0f / 1.05f, 1e-3f);
+    EXPECT_NEAR(camera->getFarPlane(), 11.0f * 1.05f, 1e-3f);
+    EXPECT_EQ(clip.getPlaneChangeCount(), 1u);
+
+    // Nothing changed: no refit, no write
+    EXPECT_FALSE(clip.update(*camera));
+    EXPECT_EQ(clip.getPlaneChangeCount(), 1u);
+
+    // The camera is not perspective: left alone
+    auto ortho = vne::scene::CameraFactory::createOrthographic(
+        vne::scene::OrthographicCameraParameters(-5.0f, 5.0f, -5.0f, 5.0f, 0.1f, 1000.0f));
+    EXPECT_FALSE(clip.update(*ortho));
+    float n = 0.0f;
+    float f = 0.0f;
+    EXPECT_FALSE(clip.computePlanes(*ortho, n, f));
+}
+
+TEST(ClipPlaneManager, HysteresisDelaysTighteningButNotClipping) {
+    ClipPlaneManager clip;
+    const ClipSphere sphere{Vec3f(0.0f, 0.0f, 0.0f), 1.0f};
+    clip.setSpheres({&sphere, 1});
+    auto camera = makeCamera(Vec3f(0.0f, 0.0f, 10.0f));
+    ASSERT_TRUE(clip.update(*camera));
+    const float near0 = camera->getNearPlane();
+    const float far0 = camera->getFarPlane();
+
+    // A small step keeps the scene inside the planes and below the hysteresis: no projection change
+    moveTo(*camera, Vec3f(0.0f, 0.0f, 9.8f));
+    EXPECT_FALSE(clip.update(*camera));
+    EXPECT_EQ(camera->getNearPlane(), near0);
+    EXPECT_EQ(camera->getFarPlane(), far0);
+
+    // Moving close would clip the sphere: updated at once
+    moveTo(*camera, Vec3f(0.0f, 0.0f, 5.0f));
+    EXPECT_TRUE(clip.update(*camera));
+    EXPECT_NEAR(camera->getNearPlane(), 4.0f / 1.05f, 1e-3f);
+
+    // Moving far away makes the planes loose beyond the hysteresis: tightened
+    moveTo(*camera, Vec3f(0.0f, 0.0f, 30.0f));
+    EXPECT_TRUE(clip.update(*camera));
+    EXPECT_NEAR(camera->getNearPlane(), 29.0f / 1.05f, 1e-3f);
+    EXPECT_NEAR(camera->getFarPlane(), 31.0f * 1.05f, 1e-3f);
+    EXPECT_EQ(clip.getPlaneChangeCount(), 3u);
+
+    // Host edits to the planes are noticed
+    camera->setNearPlane(100.0f);
+    camera->setFarPlane(200.0f);
+    EXPECT_TRUE(clip.update(*camera));
+    EXPECT_NEAR(camera->getNearPlane(), 29.0f / 1.05f, 1e-3f);
+}
+
+TEST(ClipPlaneManager, EyeInsideBoundsUsesTheDepthRatioFloor) {
+    ClipPlaneManager clip;
+    clip.setMaxDepthRatio(1e4f);
+    const ClipSphere world{Vec3f(0.0f, 0.0f, 0.0f), 1e4f};
+    clip.setSpheres({&world, 1});
+    auto camera = makeCamera(Vec3f(0.0f, 0.0f, 0.0f));
+    ASSERT_TRUE(clip.update(*camera));
+    EXPECT_NEAR(camera->getFarPlane(), 1.05e4f, 1.0f);
+    EXPECT_NEAR(camera->getNearPlane(), 1.05f, 1e-3f);
+
+    clip.setMaxDepthRatio(1e9f);
+    clip.update(*camera);
+    EXPECT_NEAR(camera->getNearPlane(), clip.getMinNear(), 1e-6f);
+}
+
+TEST(ClipPlaneManager, FollowsPickIndexUpdatesThroughTheRig) {
+    std::vector<Vec3f> mins = {Vec3f(-1.0f, -1.0f, -1.0f), Vec3f(2.0f, 0.0f, -6.0f), Vec3f(500.0f, 0.0f, -5.0f)};
+    std::vector<Vec3f> maxs = {Vec3f(1.0f, 1.0f, 1.0f), Vec3f(3.0f, 1.0f, -5.0f), Vec3f(501.0f, 1.0f, -4.0f)};
+    auto picks = std::make_shared<vne::interaction::PickIndex>(0);
+    picks->buildFromBoxes(mins.data(), maxs.data(), mins.size());
+
+    auto clip = std::make_shared<ClipPlaneManager>();
+    clip->setHierarchy(picks);
+    auto camera = makeCamera(Vec3f(0.0f, 0.0f, 10.0f));
+    auto rig = vne::interaction::CameraRig::makeTrackball();
+    rig.setCamera(camera);
+    rig.onResize(800.0f, 800.0f);
+    rig.setClipPlaneManager(clip);
+    EXPECT_EQ(rig.getClipPlaneManager(), clip);
+
+    rig.onUpdate(0.016);
+    EXPECT_NEAR(camera->getNearPlane(), 9.0f / 1.05f, 1e-3f);
+    EXPECT_NEAR(camera->getFarPlane(), 16.0f * 1.05f, 1e-3f);  // box at z = -6; the box at x = 500 is culled
+
+    // Moving a visible box deeper widens the far plane on the next frame
+    picks->updateBox(1, Vec3f(2.0f, 0.0f, -41.0f), Vec3f(3.0f, 1.0f, -40.0f));
+    rig.onUpdate(0.016);
+    EXPECT_NEAR(camera->getFarPlane(), 51.0f * 1.05f, 1e-3f);
+
+    rig.setClipPlaneManager(nullptr);
+    picks->updateBox(1, Vec3f(2.0f, 0.0f, -91.0f), Vec3f(3.0f, 1.0f, -90.0f));
+    rig.onUpdate(0.016);
+    EXPECT_NEAR(camera->getFarPlane(), 51.0f * 1.05f, 1e-3f);
+}
+
+}  // namespace vne_interaction_test
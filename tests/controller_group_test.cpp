@@ -0,0 +1,171 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * ControllerGroup tests: parallel updates match serial ones, custom executors, membership.
+ */
+
+#include "vertexnova/interaction/controller_group.h"
+#include "vertexnova/interaction/inspect_3d_controller.h"
+#include "vertexnova/events/mouse_event.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace vne_interaction_test {
+
+namespace {
+
+constexpr double kFrameDt = 1.0 / 60.0;
+
+/** Counts updates; checks that no two threads are inside onUpdate at once. */
+class CountingController : public vne::interaction::ICameraController {
+   public:
+    void setCamera(std::shared_ptr<vne::scene::ICamera>) noexcept override {}
+    void onResize(float, float) noexcept override {}
+    void onEvent(const vne::events::Event&, double) noexcept override {}
+    void onUpdate(double) noexcept override {
+        if (inside.exchange(true)) {
+            overlapped = true;
+        }
+        ++updates;
+        inside = false;
+    }
+
+    std::atomic<bool> inside{false};
+    bool overlapped = false;
+    int updates = 0;
+};
+
+struct View {
+    std::shared_ptr<vne::scene::ICamera> camera;
+    std::shared_ptr<vne::interaction::Inspect3DController> controller;
+};
+
+View makeView(int k) {
+    auto cam = vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(45.0f, 16.0f / 9.0f, 0.1f, 1000.0f));
+    cam->setPosition(vne::math::Vec3f(static_cast<float>(k), 1.0f, 6.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    auto ctrl = std::make_shared<vne::interaction::Inspect3DController>();
+    ctrl->setCamera(cam);
+    ctrl->onResize(1280.0f, 720.0f);
+    return {cam, ctrl};
+}
+
+/** Start a drag-induced spin (even k) or an animated fit (odd k). */
+void startMotion(vne::interaction::Inspect3DController& ctrl, int k) {
+    if (k % 2 == 1) {
+        const float c = static_cast<float>(k);
+        ctrl.fitToAABB(vne::math::Vec3f(c, -1.0f, -1.0f), vne::math::Vec3f(c + 2.0f, 1.0f, 1.0f));
+        return;
+    }
+    const float x0 = 400.0f + 10.0f * static_cast<float>(k);
+    ctrl.onEvent(vne::events::MouseMovedEvent(x0, 360.0), kFrameDt);
+    ctrl.onEvent(vne::events::MouseButtonPressedEvent(vne::events::MouseButton::eLeft, 0, x0, 360.0), kFrameDt);
+    for (int i = 1; i <= 5; ++i) {
+        ctrl.onEvent(vne::events::MouseMovedEvent(x0 + 40.0f * static_cast<float>(i), 360.0), kFrameDt);
+        ctrl.onUpdate(kFrameDt);
+    }
+    ctrl.onEvent(vne::events::MouseButtonReleasedEvent(vne::events::MouseButton::eLeft, 0, x0 + 200.0f, 360.0),
+                 kFrameDt);
+}
+
+}  // namespace
+
+TEST(ControllerGroup, ParallelUpdateMatchesSerial) {
+    constexpr int kControllers = 24;
+    std::vector<View> serial;
+    std::vector<View> parallel;
+    vne::interaction::ControllerGroup group(3);
+    EXPECT_EQ(group.workerThreads(), 3u);
+    for (int k = 0; k < kControllers; ++k) {
+        serial.push_back(makeView(k));
+        parallel.push_back(makeView(k));
+        startMotion(*serial.back().controller, k);
+        startMotion(*parallel.back().controller, k);
+        EXPECT_EQ(group.add(parallel.back().controller), static_cast<std::size_t>(k));
+    }
+
+    for (int frame = 0; frame < 90; ++frame) {
+        for (auto& v : serial) {
+            v.controller->onUpdate(kFrameDt);
+        }
+        group.onUpdate(kFrameDt);
+    }
+    for (int k = 0; k < kControllers; ++k) {
+        const vne::math::Vec3f a = serial[k].camera->getPosition();
+        const vne::math::Vec3f b = parallel[k].camera->getPosition();
+        EXPECT_EQ(a.x(), b.x()) << "controller " << k;
+        EXPECT_EQ(a.y(), b.y()) << "controller " << k;
+        EXPECT_EQ(a.z(), b.z()) << "controller " << k;
+    }
+}
+
+TEST(ControllerGroup, EveryControllerUpdatedOncePerCall) {
+    vne::interaction::ControllerGroup group(4);
+    std::vector<std::shared_ptr<CountingController>> members;
+    for (int k = 0; k < 37; ++k) {
+        members.push_back(std::make_shared<CountingController>());
+        group.add(members.back());
+    }
+    for (int frame = 0; frame < 50; ++frame) {
+        group.onUpdate(kFrameDt);
+    }
+    for (const auto& m : members) {
+        EXPECT_EQ(m->updates, 50);
+        EXPECT_FALSE(m->overlapped);
+    }
+
+    // Caller-provided executor: the group must not need its own threads
+    std::size_t calls = 0;
+    group.setExecutor([&calls](std::size_t count, const std::function<void(std::size_t)>& task) {
+        ++calls;
+        for (std::size_t i = count; i-- > 0;) {
+            task(i);
+        }
+    });
+    group.onUpdate(kFrameDt);
+    EXPECT_EQ(calls, 1u);
+    for (const auto& m : members) {
+        EXPECT_EQ(m->updates, 51);
+    }
+}
+
+TEST(ControllerGroup, Membership) {
+    vne::interaction::ControllerGroup group(0);
+    auto a = std::make_shared<CountingController>();
+    auto b = std::make_shared<CountingController>();
+    EXPECT_EQ(group.add(a), 0u);
+    EXPECT_EQ(group.add(b), 1u);
+    EXPECT_EQ(group.add(a), 0u);  // already a member
+    group.add(nullptr);
+    EXPECT_EQ(group.size(), 2u);
+
+    group.onUpdate(kFrameDt);  // no workers: runs on the caller
+    EXPECT_EQ(a->updates, 1);
+    EXPECT_EQ(b->updates, 1);
+
+    EXPECT_TRUE(group.remove(a.get()));
+    EXPECT_FALSE(group.remove(a.get()));
+    EXPECT_EQ(group.controller(0).get(), b.get());
+    EXPECT_EQ(group.controller(5), nullptr);
+    EXPECT_EQ(group.removeAt(0).get(), b.get());
+    EXPECT_TRUE(group.empty());
+    group.onUpdate(kFrameDt);
+}
+
+}  // namespace vne_interaction_test
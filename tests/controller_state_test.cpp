@@ -0,0 +1,260 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * Controller / manipulator state blob tests: settings, bindings and pose round trips, customised rule
+ * tables, and rejection of truncated, foreign or newer blobs.
+ */
+
+#include "vertexnova/interaction/inspect_3d_controller.h"
+#include "vertexnova/interaction/input_mapper.h"
+#include "vertexnova/interaction/navigation_3d_controller.h"
+#include "vertexnova/interaction/ortho_2d_controller.h"
+#include "vertexnova/interaction/ortho_2d_manipulator.h"
+#include "vertexnova/interaction/trackball_manipulator.h"
+#include "vertexnova/events/mouse_event.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+namespace vne_interaction_test {
+
+namespace {
+
+using vne::events::KeyCode;
+using vne::events::ModifierKey;
+using vne::interaction::InputRule;
+using vne::interaction::MouseButton;
+
+constexpr double kFrameDt = 1.0 / 60.0;
+
+std::shared_ptr<vne::scene::ICamera> makePerspective(const vne::math::Vec3f& eye) {
+    auto cam = vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(45.0f, 16.0f / 9.0f, 0.1f, 1000.0f));
+    cam->setPosition(eye);
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    return cam;
+}
+
+void expectVecNear(const vne::math::Vec3f& a, const vne::math::Vec3f& b, float tol = 1e-4f) {
+    EXPECT_NEAR(a.x(), b.x(), tol);
+    EXPECT_NEAR(a.y(), b.y(), tol);
+    EXPECT_NEAR(a.z(), b.z(), tol);
+}
+
+void expectSameRules(const std::vector<InputRule>& a, const std::vector<InputRule>& b) {
+    ASSERT_EQ(a.size(), b.size());
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        EXPECT_EQ(a[i].trigger, b[i].trigger) << i;
+        EXPECT_EQ(a[i].code, b[i].code) << i;
+        EXPECT_EQ(a[i].modifier_mask, b[i].modifier_mask) << i;
+        EXPECT_EQ(a[i].on_press, b[i].on_press) << i;
+        EXPECT_EQ(a[i].on_release, b[i].on_release) << i;
+        EXPECT_EQ(a[i].on_delta, b[i].on_delta) << i;
+    }
+}
+
+void dragLeft(vne::interaction::ICameraController& ctrl, float x0, float x1) {
+    ctrl.onEvent(vne::events::MouseMovedEvent(x0, 360.0), kFrameDt);
+    ctrl.onEvent(vne::events::MouseButtonPressedEvent(MouseButton::eLeft, 0, x0, 360.0), kFrameDt);
+    for (int i = 1; i <= 10; ++i) {
+        ctrl.onEvent(vne::events::MouseMovedEvent(x0 + (x1 - x0) * static_cast<float>(i) / 10.0f, 360.0),
+                     kFrameDt);
+        ctrl.onUpdate(kFrameDt);
+    }
+    ctrl.onEvent(vne::events::MouseButtonReleasedEvent(MouseButton::eLeft, 0, x1, 360.0), kFrameDt);
+    for (int i = 0; i < 120; ++i) {
+        ctrl.onUpdate(kFrameDt);
+    }
+}
+
+}  // namespace
+
+TEST(ControllerState, TrackballRoundTripsSettingsAndPose) {
+    vne::interaction::TrackballManipulator src;
+    auto src_cam = makePerspective(vne::math::Vec3f(3.0f, 2.0f, 6.0f));
+    src.setCamera(src_cam);
+    src.setRotationSpeed(0.35f);
+    src.setPanSpeed(1.7f);
+    src.setRotationDamping(3.0f);
+    src.setPanInertiaEnabled(false);
+    src.setZoomMethod(vne::interaction::ZoomMethod::eDollyToCoi);
+    src.setTrackballProjectionMode(vne::interaction::TrackballProjectionMode::eRim);
+    src.setLatencyCompensation(0.02f);
+    src.setFitAnimationDuration(0.0f);
+    src.setLandmark(vne::math::Vec3f(1.0f, 0.5f, -1.0f));  // fixed pivot off the view axis
+
+    const std::vector<std::uint8_t> blob = src.serialize();
+    EXPECT_LT(blob.size(), 200u);
+    EXPECT_EQ(blob, src.serialize());
+
+    vne::interaction::TrackballManipulator dst;
+    auto dst_cam = makePerspective(vne::math::Vec3f(0.0f, 0.0f, 10.0f));
+    dst.setCamera(dst_cam);
+    ASSERT_TRUE(dst.deserialize(blob.data(), blob.size()));
+
+    EXPECT_FLOAT_EQ(dst.getRotationSpeed(), 0.35f);
+    EXPECT_FLOAT_EQ(dst.getPanSpeed(), 1.7f);
+    EXPECT_FLOAT_EQ(dst.getRotationDamping(), 3.0f);
+    EXPECT_FALSE(dst.isPanInertiaEnabled());
+    EXPECT_EQ(dst.getZoomMethod(), vne::interaction::ZoomMethod::eDollyToCoi);
+    EXPECT_EQ(dst.getTrackballProjectionMode(), vne::interaction::TrackballProjectionMode::eRim);
+    EXPECT_FLOAT_EQ(dst.getLatencyCompensation(), 0.02f);
+    EXPECT_FLOAT_EQ(dst.getFitAnimationDuration(), 0.0f);
+    EXPECT_EQ(dst.getPivotMode(), vne::interaction::OrbitPivotMode::eFixed);
+    expectVecNear(dst.getCenterOfInterestWorld(), vne::math::Vec3f(1.0f, 0.5f, -1.0f));
+    expectVecNear(dst_cam->getPosition(), src_cam->getPosition());
+    EXPECT_NEAR(dst.getOrbitDistance(), src.getOrbitDistance(), 1e-4f);
+
+    // Restored orbit state is live: the same step moves both cameras the same way
+    src.setViewDirection(vne::interaction::ViewDirection::eTop);
+    dst.setViewDirection(vne::interaction::ViewDirection::eTop);
+    expectVecNear(dst_cam->getPosition(), src_cam->getPosition());
+}
+
+TEST(ControllerState, Inspect3DRestoresBindingsRulesAndPose) {
+    vne::interaction::Inspect3DController src;
+    auto src_cam = makePerspective(vne::math::Vec3f(0.0f, 0.0f, 5.0f));
+    src.setCamera(src_cam);
+    src.onResize(1280.0f, 720.0f);
+    src.setRotateButton(MouseButton::eLeft, ModifierKey::eModCtrl);
+    src.setPanButton(MouseButton::eMiddle);
+    src.setPivotOnDoubleClickEnabled(false);
+    src.setZoomScrollModifier(ModifierKey::eModShift);
+    src.setIncreaseInteractionSpeedKey(KeyCode::eEqual);
+    src.setDecreaseInteractionSpeedKey(KeyCode::eMinus);
+    src.setRotateSensitivity(0.5f);
+    src.setPivotMode(vne::interaction::OrbitPivotMode::eViewCenter);
+    src.setRotateButton(MouseButton::eLeft);
+    dragLeft(src, 500.0f, 700.0f);
+
+    const std::vector<std::uint8_t> blob = src.serialize();
+
+    vne::interaction::Inspect3DController dst;
+    auto dst_cam = makePerspective(vne::math::Vec3f(0.0f, 4.0f, 9.0f));
+    dst.setCamera(dst_cam);
+    dst.onResize(1280.0f, 720.0f);
+    dragLeft(dst, 600.0f, 620.0f);
+    ASSERT_TRUE(dst.deserialize(blob.data(), blob.size()));
+
+    expectSameRules(dst.inputMapper().rules(), src.inputMapper().rules());
+    expectVecNear(dst_cam->getPosition(), src_cam->getPosition());
+    EXPECT_FALSE(dst.isPivotOnDoubleClickEnabled());
+    EXPECT_EQ(dst.getPivotMode(), vne::interaction::OrbitPivotMode::eViewCenter);
+    EXPECT_FLOAT_EQ(dst.trackballManipulator().getRotationSpeed(), src.trackballManipulator().getRotationSpeed());
+    EXPECT_EQ(dst.cameraHistory().size(), 1u);  // history restarts at the restored pose
+    EXPECT_FALSE(dst.undo(0.0f));
+
+    // Same gesture from the restored state lands on the same pose
+    dragLeft(src, 640.0f, 560.0f);
+    dragLeft(dst, 640.0f, 560.0f);
+    expectVecNear(dst_cam->getPosition(), src_cam->getPosition(), 1e-3f);
+}
+
+TEST(ControllerState, CustomisedRuleTablesSurviveRestore) {
+    vne::interaction::Navigation3DController src;
+    src.setCamera(makePerspective(vne::math::Vec3f(0.0f, 1.0f, 5.0f)));
+    src.setMode(vne::interaction::FreeLookMode::eFly);
+    src.setMoveForwardKey(KeyCode::eUp);
+    src.setMoveSpeed(12.0f);
+    src.setMoveSpeedMax(40.0f);
+    src.setLookButton(MouseButton::eLeft, ModifierKey::eModAlt);
+    InputRule extra;
+    extra.trigger = InputRule::Trigger::eKey;
+    extra.code = static_cast<int>(KeyCode::eSpace);
+    extra.on_press = vne::interaction::CameraActionType::eMoveUp;
+    extra.on_release = vne::interaction::CameraActionType::eMoveUp;
+    src.inputMapper().addRule(extra);
+
+    const std::vector<std::uint8_t> blob = src.serialize();
+
+    vne::interaction::Navigation3DController dst;
+    auto dst_cam = makePerspective(vne::math::Vec3f(9.0f, 9.0f, 9.0f));
+    dst.setCamera(dst_cam);
+    ASSERT_TRUE(dst.deserialize(blob.data(), blob.size()));
+    expectSameRules(dst.inputMapper().rules(), src.inputMapper().rules());
+    EXPECT_EQ(dst.getMode(), vne::interaction::FreeLookMode::eFly);
+    EXPECT_FLOAT_EQ(dst.getMoveSpeed(), 12.0f);
+    expectVecNear(dst_cam->getPosition(), vne::math::Vec3f(0.0f, 1.0f, 5.0f));
+
+    vne::interaction::Ortho2DController ortho_src;
+    auto ortho_cam = vne::scene::CameraFactory::createOrthographic(
+        vne::scene::OrthographicCameraParameters(-8.0f, 8.0f, -4.5f, 4.5f, 0.1f, 100.0f));
+    ortho_cam->setPosition(vne::math::Vec3f(3.0f, -2.0f, 10.0f));
+    ortho_cam->lookAt(vne::math::Vec3f(3.0f, -2.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    ortho_src.setCamera(ortho_cam);
+    ortho_src.setRotationEnabled(true);
+    ortho_src.setPanDamping(4.0f);
+    const std::vector<std::uint8_t> ortho_blob = ortho_src.serialize();
+
+    vne::interaction::Ortho2DController ortho_dst;
+    auto ortho_dst_cam = vne::scene::CameraFactory::createOrthographic(
+        vne::scene::OrthographicCameraParameters(-1.0f, 1.0f, -1.0f, 1.0f, 0.1f, 100.0f));
+    ortho_dst.setCamera(ortho_dst_cam);
+    ASSERT_TRUE(ortho_dst.deserialize(ortho_blob.data(), ortho_blob.size()));
+    EXPECT_TRUE(ortho_dst.isRotationEnabled());
+    EXPECT_FLOAT_EQ(ortho_dst.ortho2DManipulator().getPanDamping(), 4.0f);
+    expectSameRules(ortho_dst.inputMapper().rules(), ortho_src.inputMapper().rules());
+    expectVecNear(ortho_dst_cam->getPosition(), ortho_cam->getPosition());
+    EXPECT_NEAR(ortho_dst_cam->getWidth(), 16.0f, 1e-4f);
+}
+
+TEST(ControllerState, RejectsTruncatedForeignAndNewerBlobs) {
+    vne::interaction::Inspect3DController src;
+    src.setCamera(makePerspective(vne::math::Vec3f(0.0f, 0.0f, 5.0f)));
+    src.setPanEnabled(false);
+    const std::vector<std::uint8_t> blob = src.serialize();
+
+    // Header: magic, little-endian u16 version, kind
+    ASSERT_GT(blob.size(), 7u);
+    EXPECT_EQ(std::memcmp(blob.data(), "VNCS", 4), 0);
+    EXPECT_EQ(blob[4], 1u);
+    EXPECT_EQ(blob[5], 0u);
+
+    vne::interaction::Inspect3DController dst;
+    auto dst_cam = makePerspective(vne::math::Vec3f(0.0f, 3.0f, 7.0f));
+    dst.setCamera(dst_cam);
+    const std::vector<InputRule> rules_before = dst.inputMapper().rules();
+    const vne::math::Vec3f eye_before = dst_cam->getPosition();
+
+    for (std::size_t n = 0; n < blob.size(); ++n) {
+        EXPECT_FALSE(dst.deserialize(blob.data(), n)) << n;
+    }
+    EXPECT_FALSE(dst.deserialize(nullptr, blob.size()));
+
+    std::vector<std::uint8_t> newer = blob;
+    newer[4] = 2u;
+    EXPECT_FALSE(dst.deserialize(newer.data(), newer.size()));
+
+    const std::vector<std::uint8_t> trackball = src.trackballManipulator().serialize();
+    EXPECT_FALSE(dst.deserialize(trackball.data(), trackball.size()));
+
+    // Non-finite settings are rejected
+    std::vector<std::uint8_t> bad = trackball;
+    const std::uint8_t nan_le[4] = {0x00, 0x00, 0xC0, 0x7F};
+    std::memcpy(bad.data() + 11, nan_le, sizeof(nan_le));  // fov zoom speed, after header, flags and enums
+    EXPECT_FALSE(dst.trackballManipulator().deserialize(bad.data(), bad.size()));
+
+    expectSameRules(dst.inputMapper().rules(), rules_before);
+    expectVecNear(dst_cam->getPosition(), eye_before);
+
+    // Trailing bytes from a later minor addition are ignored
+    std::vector<std::uint8_t> longer = blob;
+    longer.push_back(0xAB);
+    EXPECT_TRUE(dst.deserialize(longer.data(), longer.size()));
+    expectSameRules(dst.inputMapper().rules(), src.inputMapper().rules());
+}
+
+}  // namespace vne_interaction_test
@@ -0,0 +1,195 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * IDepthQuery tests: surface-anchored dolly zoom, delayed pivot results, fallback while pending, stale anchors.
+ */
+
+#include "vertexnova/interaction/depth_query.h"
+#include "vertexnova/interaction/trackball_manipulator.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace vne_interaction_test {
+
+namespace {
+
+using vne::interaction::CameraActionType;
+using vne::interaction::CameraCommandPayload;
+using vne::interaction::DepthQueryStatus;
+using vne::interaction::IDepthQuery;
+
+/** Ray cast against the plane z = @c plane_z, answered after @c delay pending polls (0: on the first poll). */
+class PlaneDepthQuery : public IDepthQuery {
+   public:
+    RequestId requestDepth(const vne::interaction::DepthRequest& request) noexcept override {
+        requests.push_back(request);
+        polls.push_back(0);
+        return requests.size();
+    }
+
+    DepthQueryStatus pollDepth(RequestId id, vne::math::Vec3f& world_point) noexcept override {
+        const std::size_t i = id - 1;
+        if (polls[i]++ < delay) {
+            return DepthQueryStatus::ePending;
+        }
+        const vne::interaction::DepthRequest& r = requests[i];
+        if (std::abs(r.ray_direction.z()) < 1e-6f) {
+            return DepthQueryStatus::eMiss;
+        }
+        const float t = (plane_z - r.ray_origin.z()) / r.ray_direction.z();
+        if (t <= 0.0f) {
+            return DepthQueryStatus::eMiss;
+        }
+        world_point = r.ray_origin + r.ray_direction * t;
+        return DepthQueryStatus::eHit;
+    }
+
+    void cancelDepth(RequestId) noexcept override { ++cancelled; }
+
+    float plane_z = -2.0f;
+    int delay = 0;
+    int cancelled = 0;
+    std::vector<vne::interaction::DepthRequest> requests;
+    std::vector<int> polls;
+};
+
+/** Perspective camera at (0, 0, 10) looking at the origin, dolly zoom at unit speed. */
+struct Rig {
+    std::shared_ptr<vne::scene::PerspectiveCamera> camera = vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(45.0f, 4.0f / 3.0f, 0.1f, 1000.0f));
+    vne::interaction::TrackballManipulator manip;
+
+    Rig() {
+        camera->setPosition(vne::math::Vec3f(0.0f, 0.0f, 10.0f));
+        camera->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+        manip.setCamera(camera);
+        manip.onResize(800.0f, 600.0f);
+        manip.setZoomMethod(vne::interaction::ZoomMethod::eDollyToCoi);
+        manip.setZoomSpeed(1.0f);
+    }
+
+    void zoom(float x, float y, float factor) {
+        CameraCommandPayload p;
+        p.x_px = x;
+        p.y_px = y;
+        p.zoom_factor = factor;
+        manip.onAction(CameraActionType::eZoomAtCursor, p, 0.016);
+    }
+};
+
+void expectNear(const vne::math::Vec3f& a, const vne::math::Vec3f& b, float tol = 1e-3f) {
+    EXPECT_NEAR(a.x(), b.x(), tol);
+    EXPECT_NEAR(a.y(), b.y(), tol);
+    EXPECT_NEAR(a.z(), b.z(), tol);
+}
+
+}  // namespace
+
+TEST(DepthQuery, ImmediateHitAnchorsZoomOnTheSurface) {
+    Rig rig;
+    auto query = std::make_shared<PlaneDepthQuery>();
+    rig.manip.setDepthQuery(query);
+
+    const vne::math::Vec3f eye0 = rig.camera->getPosition();
+    rig.zoom(600.0f, 200.0f, 0.8f);
+    ASSERT_EQ(query->requests.size(), 1u);
+    const vne::interaction::DepthRequest& req = query->requests[0];
+    EXPECT_NEAR(req.ray_direction.length(), 1.0f, 1e-5f);
+    EXPECT_GT(req.ray_direction.x(), 0.0f);  // right of center
+    EXPECT_GT(req.ray_direction.y(), 0.0f);  // above center (top-left pixel origin)
+
+    const vne::math::Vec3f anchor = req.ray_origin + req.ray_direction * ((-2.0f - 10.0f) / req.ray_direction.z());
+    const vne::math::Vec3f eye1 = rig.camera->getPosition();
+    expectNear(eye1, anchor + (eye0 - anchor) * 0.8f);
+
+    // Further steps at the same cursor reuse the anchor; the surface point stays on the cursor ray
+    rig.zoom(601.0f, 200.0f, 0.8f);
+    rig.zoom(601.0f, 201.0f, 1.25f);
+    EXPECT_EQ(query->requests.size(), 1u);
+    const vne::math::Vec3f eye3 = rig.camera->getPosition();
+    expectNear(eye3, anchor + (eye0 - anchor) * 0.8f);
+    expectNear((anchor - eye3).normalized(), req.ray_direction, 1e-4f);
+}
+
+TEST(DepthQuery, DelayedPivotKeepsViewRayCoiUntilTheResultArrives) {
+    Rig rig;
+    auto query = std::make_shared<PlaneDepthQuery>();
+    query->delay = 2;
+    rig.manip.setDepthQuery(query);
+
+    CameraCommandPayload p;
+    p.x_px = 400.0f;
+    p.y_px = 300.0f;
+    EXPECT_TRUE(rig.manip.onAction(CameraActionType::eSetPivotAtCursor, p, 0.0));
+    expectNear(rig.manip.getCenterOfInterestWorld(), vne::math::Vec3f(0.0f, 0.0f, 0.0f));
+
+    rig.manip.onUpdate(0.016);  // still pending
+    expectNear(rig.manip.getCenterOfInterestWorld(), vne::math::Vec3f(0.0f, 0.0f, 0.0f));
+    rig.manip.onUpdate(0.016);
+    expectNear(rig.manip.getCenterOfInterestWorld(), vne::math::Vec3f(0.0f, 0.0f, -2.0f));
+    EXPECT_NEAR(rig.manip.getOrbitDistance(), 12.0f, 1e-3f);
+    expectNear(rig.camera->getPosition(), vne::math::Vec3f(0.0f, 0.0f, 10.0f));
+
+    // A miss (plane behind the camera) keeps the view-ray pivot
+    query->plane_z = 20.0f;
+    query->delay = 0;
+    rig.manip.onAction(CameraActionType::eSetPivotAtCursor, p, 0.0);
+    EXPECT_NEAR(rig.manip.getOrbitDistance(), 12.0f, 1e-3f);
+}
+
+TEST(DepthQuery, PendingZoomFallsBackAndStaleAnchorsAreDropped) {
+    Rig plain;
+    Rig rig;
+    auto query = std::make_shared<PlaneDepthQuery>();
+    query->delay = 1;
+    rig.manip.setDepthQuery(query);
+
+    // While the lookup is pending, zoom matches a manipulator without a depth query
+    plain.zoom(200.0f, 450.0f, 0.8f);
+    rig.zoom(200.0f, 450.0f, 0.8f);
+    expectNear(rig.camera->getPosition(), plain.camera->getPosition(), 1e-5f);
+    rig.zoom(200.0f, 450.0f, 0.8f);  // same cursor: no second request
+    EXPECT_EQ(query->requests.size(), 1u);
+
+    rig.manip.onUpdate(0.016);  // result arrives
+    const vne::math::Vec3f eye = rig.camera->getPosition();
+    const vne::interaction::DepthRequest req = query->requests[0];
+    const vne::math::Vec3f anchor = req.ray_origin + req.ray_direction * ((-2.0f - 10.0f) / req.ray_direction.z());
+    rig.zoom(200.0f, 450.0f, 0.5f);
+    expectNear(rig.camera->getPosition(), anchor + (eye - anchor) * 0.5f);
+
+    // Rotating invalidates the anchor: the next zoom asks again
+    CameraCommandPayload p;
+    p.x_px = 400.0f;
+    p.y_px = 300.0f;
+    rig.manip.onAction(CameraActionType::eBeginRotate, p, 0.016);
+    p.x_px = 460.0f;
+    p.delta_x_px = 60.0f;
+    rig.manip.onAction(CameraActionType::eRotateDelta, p, 0.016);
+    rig.manip.onAction(CameraActionType::eEndRotate, p, 0.016);
+    rig.zoom(200.0f, 450.0f, 0.8f);
+    EXPECT_EQ(query->requests.size(), 2u);
+
+    rig.manip.resetState();
+    EXPECT_EQ(query->cancelled, 1);
+    rig.manip.setDepthQuery(nullptr);
+    rig.zoom(200.0f, 450.0f, 0.8f);
+    EXPECT_EQ(query->requests.size(), 2u);
+}
+
+}  // namespace vne_interaction_test
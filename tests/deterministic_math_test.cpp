@@ -0,0 +1,237 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * Deterministic math: pinned bit patterns of the portable functions, and camera poses for a recorded input
+ * stream replayed through InputMapper → CameraRig (fixed timestep) → TrackballManipulator — bit-identical within
+ * a process, and equal to a golden pose in a VNE_INTERACTION_DETERMINISTIC build.
+ */
+
+#include "vertexnova/interaction/camera_rig.h"
+#include "vertexnova/interaction/deterministic_math.h"
+#include "vertexnova/interaction/detail/portable_math.h"
+#include "vertexnova/interaction/input_mapper.h"
+#include "vertexnova/interaction/trackball_manipulator.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <vertexnova/events/types.h>
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace vne_interaction_test {
+
+namespace {
+
+/** Restores the process-wide deterministic-math flag when a test ends. */
+class ScopedDeterministicMath {
+   public:
+    explicit ScopedDeterministicMath(bool enabled) noexcept
+        : previous_(vne::interaction::isDeterministicMath()) {
+        vne::interaction::setDeterministicMath(enabled);
+    }
+    ~ScopedDeterministicMath() { vne::interaction::setDeterministicMath(previous_); }
+    ScopedDeterministicMath(const ScopedDeterministicMath&) = delete;
+    ScopedDeterministicMath& operator=(const ScopedDeterministicMath&) = delete;
+
+   private:
+    bool previous_;
+};
+
+[[nodiscard]] std::int32_t ulpDistance(float a, float b) noexcept {
+    return std::abs(std::bit_cast<std::int32_t>(a) - std::bit_cast<std::int32_t>(b));
+}
+
+/** One recorded input sample; frames advance the rig by @c dt. */
+struct RecordedInput {
+    enum class Kind : std::uint8_t { eButton, eMove, eScroll, eFrame };
+    Kind kind;
+    float x;
+    float y;
+    float value;  // pressed (0/1), scroll lines, or unused
+};
+
+/** Orbit drag, release with inertia, then two wheel notches — as captured from a 60 Hz session. */
+std::vector<RecordedInput> recordedOrbitSession() {
+    using K = RecordedInput::Kind;
+    std::vector<RecordedInput> s;
+    s.push_back({K::eButton, 400.0f, 300.0f, 1.0f});
+    float x = 400.0f;
+    float y = 300.0f;
+    for (int i = 0; i < 8; ++i) {
+        x += 14.0f;
+        y += 4.0f;
+        s.push_back({K::eMove, x, y, 0.0f});
+        s.push_back({K::eFrame, 0.0f, 0.0f, 0.0f});
+    }
+    s.push_back({K::eButton, x, y, 0.0f});
+    for (int i = 0; i < 20; ++i) {
+        s.push_back({K::eFrame, 0.0f, 0.0f, 0.0f});
+    }
+    s.push_back({K::eScroll, x, y, 1.0f});
+    s.push_back({K::eFrame, 0.0f, 0.0f, 0.0f});
+    s.push_back({K::eScroll, x, y, -0.5f});
+    s.push_back({K::eFrame, 0.0f, 0.0f, 0.0f});
+    return s;
+}
+
+struct ReplayResult {
+    vne::math::Vec3f position;
+    vne::math::Vec3f target;
+};
+
+ReplayResult replay(const std::vector<RecordedInput>& session) {
+    constexpr double kFrameDt = 1.0 / 60.0;
+    auto cam = vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(45.0f, 4.0f / 3.0f, 0.1f, 1000.0f));
+    cam->setPosition(vne::math::Vec3f(0.0f, 0.0f, 5.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+
+    auto trackball = std::make_shared<vne::interaction::TrackballManipulator>();
+    trackball->setZoomMethod(vne::interaction::ZoomMethod::eDollyToCoi);
+    vne::interaction::CameraRig rig;
+    rig.addManipulator(trackball);
+    rig.setCamera(cam);
+    rig.onResize(800.0f, 600.0f);
+    rig.setFixedTimestep(1.0 / 240.0);
+
+    vne::interaction::InputMapper mapper;
+    mapper.setRules(vne::interaction::InputMapper::orbitPreset());
+    mapper.setActionCallback([&rig](vne::interaction::CameraActionType a,
+                                    const vne::interaction::CameraCommandPayload& p,
+                                    double dt) { rig.onAction(a, p, dt); });
+
+    const int left = static_cast<int>(vne::events::MouseButton::eLeft);
+    float last_x = 0.0f;
+    float last_y = 0.0f;
+    for (const RecordedInput& in : session) {
+        switch (in.kind) {
+            case RecordedInput::Kind::eButton:
+                mapper.onMouseButton(left, in.value > 0.5f, in.x, in.y, kFrameDt);
+                last_x = in.x;
+                last_y = in.y;
+                break;
+            case RecordedInput::Kind::eMove:
+                mapper.onMouseMove(in.x, in.y, in.x - last_x, in.y - last_y, kFrameDt);
+                last_x = in.x;
+                last_y = in.y;
+                break;
+            case RecordedInput::Kind::eScroll:
+                mapper.onMouseScroll(0.0f, in.value, in.x, in.y, kFrameDt);
+                break;
+            case RecordedInput::Kind::eFrame:
+                rig.onUpdate(kFrameDt);
+                break;
+        }
+    }
+    return {cam->getPosition(), cam->getTarget()};
+}
+
+}  // namespace
+
+TEST(DeterministicMath, PortableFunctionsMatchPinnedBits) {
+    using namespace vne::interaction::detail;
+    EXPECT_EQ(std::bit_cast<std::uint32_t>(portableExp(1.0f)), 0x402DF854u);
+    EXPECT_EQ(std::bit_cast<std::uint32_t>(portableExp(-0.5f)), 0x3F1B4598u);
+    EXPECT_EQ(std::bit_cast<std::uint32_t>(portablePow(1.1f, -3.0f)), 0x3F40562Au);
+    EXPECT_EQ(std::bit_cast<std::uint32_t>(portablePow(0.9f, 0.5f)), 0x3F72DCE8u);
+    EXPECT_EQ(std::bit_cast<std::uint32_t>(portableSin(0.3f)), 0x3E974E6Du);
+    EXPECT_EQ(std::bit_cast<std::uint32_t>(portableCos(0.3f)), 0x3F7490EFu);
+    EXPECT_EQ(std::bit_cast<std::uint32_t>(portableLog(10.0f)), 0x40135D8Eu);
+    EXPECT_EQ(std::bit_cast<std::uint32_t>(portableTan(0.3f)), 0x3E9E6153u);
+    EXPECT_EQ(std::bit_cast<std::uint32_t>(portableAtan(2.0f)), 0x3F8DB70Du);
+    EXPECT_EQ(std::bit_cast<std::uint32_t>(portableAtan2(0.5f, -0.8f)), 0x40254FC3u);
+    EXPECT_EQ(std::bit_cast<std::uint32_t>(portableAsin(0.3f)), 0x3E9C00ADu);
+    EXPECT_EQ(std::bit_cast<std::uint32_t>(portableAcos(0.3f)), 0x3FA20FAFu);
+}
+
+TEST(DeterministicMath, PortableFunctionsTrackLibm) {
+    using namespace vne::interaction::detail;
+    for (float x = -60.0f; x < 60.0f; x += 0.173f) {
+        EXPECT_LE(ulpDistance(portableExp(x), std::exp(x)), 2) << x;
+    }
+    for (float b = 0.05f; b < 20.0f; b *= 1.37f) {
+        for (float e = -6.0f; e < 6.0f; e += 0.71f) {
+            EXPECT_LE(ulpDistance(portablePow(b, e), std::pow(b, e)), 2) << b << "^" << e;
+        }
+    }
+    for (float a = -10.0f; a < 10.0f; a += 0.0917f) {
+        EXPECT_NEAR(portableSin(a), std::sin(a), 1e-7f) << a;
+        EXPECT_NEAR(portableCos(a), std::cos(a), 1e-7f) << a;
+    }
+    for (float a = -1.5f; a < 1.5f; a += 0.0137f) {
+        EXPECT_LE(ulpDistance(portableTan(a), std::tan(a)), 2) << a;
+        EXPECT_LE(ulpDistance(portableAtan(a * 7.0f), std::atan(a * 7.0f)), 2) << a;
+    }
+    for (float v = -1.0f; v <= 1.0f; v += 0.0093f) {
+        EXPECT_LE(ulpDistance(portableAsin(v), std::asin(v)), 2) << v;
+        EXPECT_LE(ulpDistance(portableAcos(v), std::acos(v)), 2) << v;
+    }
+    for (float y = -3.0f; y < 3.0f; y += 0.37f) {
+        for (float x = -3.0f; x < 3.0f; x += 0.41f) {
+            EXPECT_LE(ulpDistance(portableAtan2(y, x), std::atan2(y, x)), 2) << y << ", " << x;
+        }
+    }
+    EXPECT_EQ(portableAtan2(0.0f, -1.0f), std::atan2(0.0f, -1.0f));
+    EXPECT_EQ(portableAtan2(-0.0f, -1.0f), std::atan2(-0.0f, -1.0f));
+    EXPECT_TRUE(std::isnan(portableAcos(1.5f)));
+    EXPECT_EQ(portableExp(-1000.0f), 0.0f);
+    EXPECT_TRUE(std::isinf(portableExp(1000.0f)));
+    EXPECT_TRUE(std::isnan(portableLog(-1.0f)));
+    EXPECT_FLOAT_EQ(portablePow(-2.0f, 3.0f), -8.0f);
+    EXPECT_FLOAT_EQ(portablePow(0.0f, 2.0f), 0.0f);
+}
+
+TEST(DeterministicMath, ToggleIsProcessWide) {
+    ScopedDeterministicMath on(true);
+    EXPECT_TRUE(vne::interaction::isDeterministicMath());
+    {
+        ScopedDeterministicMath off(false);
+        EXPECT_FALSE(vne::interaction::isDeterministicMath());
+    }
+    EXPECT_TRUE(vne::interaction::isDeterministicMath());
+}
+
+TEST(DeterministicMath, RecordedSessionReplaysBitIdentically) {
+    ScopedDeterministicMath on(true);
+    const auto session = recordedOrbitSession();
+    const ReplayResult a = replay(session);
+    const ReplayResult b = replay(session);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(std::bit_cast<std::uint32_t>(a.position[i]), std::bit_cast<std::uint32_t>(b.position[i]));
+        EXPECT_EQ(std::bit_cast<std::uint32_t>(a.target[i]), std::bit_cast<std::uint32_t>(b.target[i]));
+    }
+}
+
+#ifdef VNE_INTERACTION_DETERMINISTIC
+// Only a deterministic build pins vne::math / vne::scene arithmetic too (no FP contraction); elsewhere their
+// quaternion and lookAt code may fuse differently per target, and only the same-process replay above holds.
+TEST(DeterministicMath, RecordedSessionMatchesGoldenPose) {
+    ScopedDeterministicMath on(true);
+    const ReplayResult r = replay(recordedOrbitSession());
+    // Golden pose captured from a deterministic-mode run, pinned exactly: any change in the interaction path's
+    // arithmetic (libm leaking in, contraction, reordering) shows up here.
+    EXPECT_EQ(r.position.x(), -0x1.b1f59ap+0f);
+    EXPECT_EQ(r.position.y(), 0x1.61a68p-13f);
+    EXPECT_EQ(r.position.z(), 0x1.19d212p+2f);
+    EXPECT_EQ(r.target.x(), 0x1.4da28p-6f);
+    EXPECT_EQ(r.target.y(), -0x1.88e31cp-8f);
+    EXPECT_EQ(r.target.z(), 0x1.01a8p-7f);
+}
+#endif  // VNE_INTERACTION_DETERMINISTIC
+
+}  // namespace vne_interaction_test
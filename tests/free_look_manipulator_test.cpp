@@ -20,6 +20,7 @@
 
 #include <vertexnova/math/core/core.h>
 
+#include <algorithm>
 #include <cmath>
 
 #include <gtest/gtest.h>
@@ -301,4 +302,128 @@ TEST(FreeLookManipulator, ExternalPoseHandoff_OrthoFlyMoveUpAlongCameraUp) {
     EXPECT_NEAR(vb.dot(va), 1.0f, 1e-3f);
 }
 
+/** Drive a horizontal mouse-look gesture of @p steps samples and return the camera used. */
+static std::shared_ptr<vne::scene::PerspectiveCamera> lookGesture(vne::interaction::FreeLookManipulator& m,
+                                                                   int steps,
+                                                                   float dx_px,
+                                                                   bool end_look) {
+    auto cam = makePerspCamera();
+    cam->setPosition(vne::math::Vec3f(0.0f, 0.0f, 0.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, -1.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    m.setCamera(cam);
+    m.onResize(1280.0f, 720.0f);
+
+    vne::interaction::CameraCommandPayload p;
+    m.onAction(vne::interaction::CameraActionType::eBeginLook, p, 0.016);
+    for (int i = 0; i < steps; ++i) {
+        p.delta_x_px = dx_px;
+        p.delta_y_px = 0.0f;
+        m.onAction(vne::interaction::CameraActionType::eLookDelta, p, 0.016);
+    }
+    if (end_look) {
+        m.onAction(vne::interaction::CameraActionType::eEndLook, p, 0.016);
+    }
+    return cam;
+}
+
+static float angleBetweenDeg(const vne::math::Vec3f& a, const vne::math::Vec3f& b) {
+    const float c = std::clamp(a.normalized().dot(b.normalized()), -1.0f, 1.0f);
+    return vne::math::radToDeg(std::acos(c));
+}
+
+TEST(FreeLookManipulator, LatencyCompensationLeadsLookAndSettlesOnRelease) {
+    vne::interaction::FreeLookManipulator plain;
+    vne::interaction::FreeLookManipulator led;
+    led.setLatencyCompensation(0.05f);
+    EXPECT_FLOAT_EQ(led.getLatencyCompensation(), 0.05f);
+
+    auto cam_plain = lookGesture(plain, 6, 10.0f, false);
+    auto cam_led = lookGesture(led, 6, 10.0f, false);
+    const float lead_deg = angleBetweenDeg(cam_plain->getForwardDir(), cam_led->getForwardDir());
+    EXPECT_GT(lead_deg, 0.1f);
+    EXPECT_LE(lead_deg, led.getLatencyCompensationMaxAngle() + 1e-3f);
+
+    // The lead continues the gesture (further along the same turn), not against it.
+    const vne::math::Vec3f start(0.0f, 0.0f, -1.0f);
+    EXPECT_GT(angleBetweenDeg(start, cam_led->getForwardDir()), angleBetweenDeg(start, cam_plain->getForwardDir()));
+
+    // Release: no snap back; onUpdate blends the lead out and the camera lands on the true look pose.
+    const vne::math::Vec3f shown = cam_led->getForwardDir();
+    vne::interaction::CameraCommandPayload p;
+    plain.onAction(vne::interaction::CameraActionType::eEndLook, p, 0.016);
+    led.onAction(vne::interaction::CameraActionType::eEndLook, p, 0.016);
+    EXPECT_LT(angleBetweenDeg(shown, cam_led->getForwardDir()), 1e-3f);
+    EXPECT_TRUE(led.getMotionState().isMoving());
+    float gap = angleBetweenDeg(cam_plain->getForwardDir(), cam_led->getForwardDir());
+    for (int i = 0; i < 30; ++i) {
+        plain.onUpdate(0.016);
+        led.onUpdate(0.016);
+        const float next = angleBetweenDeg(cam_plain->getForwardDir(), cam_led->getForwardDir());
+        EXPECT_LE(next, gap + 1e-3f);
+        gap = next;
+    }
+    EXPECT_LT(gap, 1e-2f);
+    EXPECT_FALSE(led.getMotionState().isMoving());
+}
+
+TEST(FreeLookManipulator, LatencyCompensationClampedByMaxAngle) {
+    vne::interaction::FreeLookManipulator plain;
+    vne::interaction::FreeLookManipulator led;
+    led.setLatencyCompensation(0.1f);
+    led.setLatencyCompensationMaxAngle(1.0f);
+
+    auto cam_plain = lookGesture(plain, 4, 80.0f, false);
+    auto cam_led = lookGesture(led, 4, 80.0f, false);
+    EXPECT_LE(angleBetweenDeg(cam_plain->getForwardDir(), cam_led->getForwardDir()), 1.0f + 1e-2f);
+
+    led.setLatencyCompensation(1.0f);
+    EXPECT_FLOAT_EQ(led.getLatencyCompensation(), 0.1f);
+    led.setLatencyCompensationMaxAngle(90.0f);
+    EXPECT_FLOAT_EQ(led.getLatencyCompensationMaxAngle(), 45.0f);
+}
+
+TEST(FreeLookManipulator, LatencyCompensationOffMatchesPlainLook) {
+    vne::interaction::FreeLookManipulator plain;
+    vne::interaction::FreeLookManipulator zero;
+    zero.setLatencyCompensation(0.0f);
+    auto cam_plain = lookGesture(plain, 5, 12.0f, false);
+    auto cam_zero = lookGesture(zero, 5, 12.0f, false);
+    EXPECT_LT(angleBetweenDeg(cam_plain->getForwardDir(), cam_zero->getForwardDir()), 1e-4f);
+}
+
+TEST(FreeLookManipulator, PredictPoseContinuesLookAndHeldKeys) {
+    vne::interaction::FreeLookManipulator m;
+    m.setMoveSpeed(2.0f);
+    auto cam = lookGesture(m, 20, 10.0f, true);
+
+    // Held key: straight along the view at the move speed; the camera itself does not move
+    vne::interaction::CameraCommandPayload p;
+    p.pressed = true;
+    m.onAction(vne::interaction::CameraActionType::eMoveForward, p, 0.0);
+    const vne::math::Vec3f start = cam->getPosition();
+    const vne::interaction::CameraPoseSnapshot walk = m.predictPose(0.5);
+    EXPECT_EQ((cam->getPosition() - start).length(), 0.0f);
+    EXPECT_NEAR((walk.position - (start + cam->getForwardDir() * 1.0f)).length(), 0.0f, 1e-4f);
+    EXPECT_NEAR((walk.target - walk.position).normalized().dot(cam->getForwardDir()), 1.0f, 1e-5f);
+    p.pressed = false;
+    m.onAction(vne::interaction::CameraActionType::eMoveForward, p, 0.0);
+    EXPECT_NEAR((m.predictPose(0.5).position - start).length(), 0.0f, 1e-5f);
+
+    // Steady look drag: the turn continues at the drag rate
+    p = {};
+    m.onAction(vne::interaction::CameraActionType::eBeginLook, p, 0.016);
+    p.delta_x_px = 10.0f;
+    for (int i = 0; i < 20; ++i) {
+        m.onAction(vne::interaction::CameraActionType::eLookDelta, p, 0.016);
+    }
+    const vne::math::Vec3f before = cam->getForwardDir();
+    const vne::interaction::CameraPoseSnapshot turned = m.predictPose(6 * 0.016);
+    for (int i = 0; i < 6; ++i) {
+        m.onAction(vne::interaction::CameraActionType::eLookDelta, p, 0.016);
+    }
+    const float actual_deg = angleBetweenDeg(before, cam->getForwardDir());
+    EXPECT_GT(actual_deg, 1.0f);
+    EXPECT_NEAR(angleBetweenDeg(-turned.orientation.getZAxis(), cam->getForwardDir()), 0.0f, actual_deg * 0.02f);
+}
+
 }  // namespace vne_interaction_test
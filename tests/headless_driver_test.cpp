@@ -0,0 +1,208 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * HeadlessDriver tests: one pose per scripted frame, parallel runs match serial ones, deferred matrices leave
+ * poses unchanged, trajectory output, default cameras for jobs without one.
+ */
+
+#include "vertexnova/interaction/headless_driver.h"
+#include "vertexnova/interaction/camera_rig.h"
+#include "vertexnova/interaction/free_look_manipulator.h"
+#include "vertexnova/interaction/inspect_3d_controller.h"
+#include "vertexnova/interaction/navigation_3d_controller.h"
+#include "vertexnova/interaction/ortho_2d_controller.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/orthographic_camera.h"
+#include "vertexnova/scene/camera/perspective_camera.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace vne_interaction_test {
+
+namespace {
+
+std::shared_ptr<vne::scene::ICamera> makeCamera(int k) {
+    auto cam = vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(45.0f, 16.0f / 9.0f, 0.1f, 1000.0f));
+    cam->setPosition(vne::math::Vec3f(static_cast<float>(k), 2.0f, 8.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    return cam;
+}
+
+vne::interaction::CameraScript makeScript() {
+    vne::interaction::CameraScript script;
+    script.fit(vne::math::Vec3f(-1.0f, -1.0f, -1.0f), vne::math::Vec3f(1.0f, 1.0f, 1.0f))
+        .idle(40)
+        .drag(vne::events::MouseButton::eLeft, 640.0f, 360.0f, 240.0f, 60.0f, 20)
+        .idle(30)
+        .scroll(700.0f, 300.0f, -1.0f, 5)
+        .keyHold(vne::events::KeyCode::eW, 10);
+    return script;
+}
+
+/** Job k: Inspect3D for even k, Navigation3D (walks on W) for odd k. */
+vne::interaction::HeadlessJob makeJob(int k, const vne::interaction::CameraScript& script) {
+    vne::interaction::HeadlessJob job;
+    if (k % 2 == 0) {
+        job.controller = std::make_shared<vne::interaction::Inspect3DController>();
+    } else {
+        job.controller = std::make_shared<vne::interaction::Navigation3DController>();
+    }
+    job.camera = makeCamera(k);
+    job.script = script;
+    return job;
+}
+
+}  // namespace
+
+TEST(HeadlessDriver, RecordsOnePosePerFrame) {
+    const vne::interaction::CameraScript script = makeScript();
+    EXPECT_EQ(script.frameCount(), 105u);
+
+    vne::interaction::HeadlessDriver driver(0);
+    driver.setTimestep(0.01);
+    driver.setTimestep(-1.0);  // rejected
+    EXPECT_DOUBLE_EQ(driver.getTimestep(), 0.01);
+
+    vne::interaction::HeadlessJob job = makeJob(0, script);
+    ASSERT_TRUE(driver.run(job));
+    ASSERT_EQ(job.frames.size(), script.frameCount());
+    EXPECT_NEAR(job.frames.front().time_s, 0.01, 1e-12);
+    EXPECT_NEAR(job.frames.back().time_s, 1.05, 1e-9);
+
+    // The fit moved the camera onto the box, and the drag then orbited it
+    const vne::math::Vec3f after_fit = job.frames[39].position;
+    const vne::math::Vec3f after_drag = job.frames[89].position;
+    EXPECT_LT(job.frames[39].center.length(), 1e-3f);
+    EXPECT_GT((after_drag - after_fit).length(), 0.1f);
+
+    vne::interaction::HeadlessJob broken;
+    broken.script = script;
+    EXPECT_FALSE(driver.run(broken));
+    EXPECT_FALSE(broken.succeeded);
+}
+
+TEST(HeadlessDriver, ParallelRunsMatchSerialRuns) {
+    const vne::interaction::CameraScript script = makeScript();
+    std::vector<vne::interaction::HeadlessJob> serial;
+    std::vector<vne::interaction::HeadlessJob> parallel;
+    for (int k = 0; k < 12; ++k) {
+        serial.push_back(makeJob(k, script));
+        parallel.push_back(makeJob(k, script));
+    }
+    vne::interaction::HeadlessDriver serial_driver(0);
+    vne::interaction::HeadlessDriver parallel_driver(3);
+    EXPECT_EQ(serial_driver.runAll(serial), serial.size());
+    EXPECT_EQ(parallel_driver.runAll(parallel), parallel.size());
+
+    for (std::size_t k = 0; k < serial.size(); ++k) {
+        ASSERT_EQ(serial[k].frames.size(), parallel[k].frames.size());
+        for (std::size_t f = 0; f < serial[k].frames.size(); ++f) {
+            const auto& a = serial[k].frames[f];
+            const auto& b = parallel[k].frames[f];
+            ASSERT_EQ(a.position.x(), b.position.x()) << "job " << k << " frame " << f;
+            ASSERT_EQ(a.position.y(), b.position.y()) << "job " << k << " frame " << f;
+            ASSERT_EQ(a.position.z(), b.position.z()) << "job " << k << " frame " << f;
+        }
+    }
+    // Navigation jobs walked forward while W was held
+    EXPECT_GT((serial[1].frames.back().position - serial[1].frames[94].position).length(), 0.01f);
+}
+
+TEST(HeadlessDriver, DeferredMatricesLeavePosesUnchanged) {
+    const vne::interaction::CameraScript script = makeScript();
+    vne::interaction::HeadlessDriver driver(0);
+    for (int k = 0; k < 2; ++k) {
+        vne::interaction::HeadlessJob deferred = makeJob(k, script);
+        vne::interaction::HeadlessJob immediate = makeJob(k, script);
+        immediate.defer_matrices = false;
+        ASSERT_TRUE(driver.run(deferred));
+        ASSERT_TRUE(driver.run(immediate));
+        ASSERT_EQ(deferred.frames.size(), immediate.frames.size());
+        for (std::size_t f = 0; f < deferred.frames.size(); ++f) {
+            const auto& a = deferred.frames[f];
+            const auto& b = immediate.frames[f];
+            ASSERT_EQ(a.position.x(), b.position.x()) << "job " << k << " frame " << f;
+            ASSERT_EQ(a.position.y(), b.position.y()) << "job " << k << " frame " << f;
+            ASSERT_EQ(a.position.z(), b.position.z()) << "job " << k << " frame " << f;
+            ASSERT_EQ(a.fov_deg, b.fov_deg) << "job " << k << " frame " << f;
+        }
+    }
+
+    // A rig applies the setting to manipulators added before and after it
+    vne::interaction::CameraRig rig = vne::interaction::CameraRig::makeTrackball();
+    rig.setMatrixUpdatesDeferred(true);
+    auto later = std::make_shared<vne::interaction::FreeLookManipulator>();
+    rig.addManipulator(later);
+    EXPECT_TRUE(later->isMatrixUpdatesDeferred());
+    rig.setMatrixUpdatesDeferred(false);
+    EXPECT_FALSE(later->isMatrixUpdatesDeferred());
+}
+
+TEST(HeadlessDriver, WritesTrajectoryFiles) {
+    const std::string path = (std::filesystem::temp_directory_path() / "vne_headless_driver_test.vnetraj").string();
+    vne::interaction::HeadlessJob job = makeJob(0, makeScript());
+    job.keep_frames = false;
+    job.trajectory_path = path;
+
+    std::size_t calls = 0;
+    vne::interaction::HeadlessDriver driver;
+    driver.setExecutor([&calls](std::size_t count, const std::function<void(std::size_t)>& task) {
+        ++calls;
+        for (std::size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+    });
+    std::vector<vne::interaction::HeadlessJob> jobs;
+    jobs.push_back(std::move(job));
+    EXPECT_EQ(driver.runAll(jobs), 1u);
+    EXPECT_EQ(calls, 1u);
+    EXPECT_TRUE(jobs[0].frames.empty());
+
+    vne::interaction::CameraTrajectoryReader reader;
+    ASSERT_TRUE(reader.open(path));
+    EXPECT_EQ(reader.getFrameCount(), jobs[0].script.frameCount());
+    reader.close();
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+TEST(HeadlessDriver, SuppliesCameraWhenJobHasNone) {
+    const vne::interaction::CameraScript script = makeScript();
+    vne::interaction::HeadlessDriver driver(0);
+
+    vne::interaction::HeadlessJob inspect;
+    inspect.controller = std::make_shared<vne::interaction::Inspect3DController>();
+    inspect.script = script;
+    ASSERT_TRUE(driver.run(inspect));
+    ASSERT_TRUE(std::dynamic_pointer_cast<vne::scene::PerspectiveCamera>(inspect.camera));
+    ASSERT_EQ(inspect.frames.size(), script.frameCount());
+    EXPECT_LT(inspect.frames[39].center.length(), 1e-3f);
+    EXPECT_GT((inspect.frames[89].position - inspect.frames[39].position).length(), 0.1f);
+
+    vne::interaction::HeadlessJob ortho;
+    ortho.controller = std::make_shared<vne::interaction::Ortho2DController>();
+    ortho.script.drag(vne::events::MouseButton::eLeft, 640.0f, 360.0f, 200.0f, 0.0f, 10);
+    ASSERT_TRUE(driver.run(ortho));
+    ASSERT_TRUE(std::dynamic_pointer_cast<vne::scene::OrthographicCamera>(ortho.camera));
+    ASSERT_EQ(ortho.frames.size(), 10u);
+    EXPECT_GT((ortho.frames.back().position - ortho.frames.front().position).length(), 1e-3f);
+}
+
+}  // namespace vne_interaction_test
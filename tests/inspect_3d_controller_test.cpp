@@ -21,6 +21,8 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+
 namespace vne_interaction_test {
 
 namespace {
@@ -170,4 +172,23 @@ TEST(Inspect3DController, OnEventNoCrash) {
     EXPECT_NO_FATAL_FAILURE(ctrl.onEvent(scroll, 0.016));
 }
 
+TEST(Inspect3DController, PredictPoseDelegatesToRig) {
+    vne::interaction::Inspect3DController ctrl;
+    auto cam = makePerspCamera();
+    ctrl.setCamera(cam);
+    ctrl.onResize(1280.0f, 720.0f);
+
+    // Animated fit: the prediction reaches the box while the camera has not moved yet
+    const vne::math::Vec3f target_before = cam->getTarget();
+    ctrl.fitToAABB(vne::math::Vec3f(9.0f, -1.0f, -1.0f), vne::math::Vec3f(11.0f, 1.0f, 1.0f));
+    EXPECT_NEAR((ctrl.predictPose(5.0).target - vne::math::Vec3f(10.0f, 0.0f, 0.0f)).length(), 0.0f, 1e-3f);
+    EXPECT_NEAR((cam->getTarget() - target_before).length(), 0.0f, 1e-5f);
+
+    const std::array<double, 2> ahead = {0.0, 5.0};
+    std::array<vne::interaction::CameraPoseSnapshot, 2> poses;
+    ASSERT_EQ(ctrl.predictPoses(ahead, poses), 2u);
+    EXPECT_NEAR((poses[0].position - cam->getPosition()).length(), 0.0f, 1e-5f);
+    EXPECT_NEAR(poses[1].target.x(), 10.0f, 1e-3f);
+}
+
 }  // namespace vne_interaction_test
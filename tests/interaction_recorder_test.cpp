@@ -0,0 +1,287 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * InteractionRecorder / InteractionPlayer tests: exact round trip of calls, header, encoding size,
+ * streamed vs memory-mapped playback, controller replay, and damaged logs.
+ */
+
+#include "vertexnova/interaction/interaction_player.h"
+#include "vertexnova/interaction/interaction_recorder.h"
+#include "vertexnova/interaction/inspect_3d_controller.h"
+#include "vertexnova/events/key_event.h"
+#include "vertexnova/events/mouse_event.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace vne_interaction_test {
+
+namespace {
+
+constexpr double kFrameDt = 1.0 / 60.0;
+
+/** One observed controller call: kind plus its arguments. */
+struct Call {
+    int kind = 0;  // 0 update, 1 resize, 2 fixed step, otherwise 10 + EventType
+    double a = 0.0;
+    double b = 0.0;
+    double dt = 0.0;
+    int code = 0;
+
+    bool operator==(const Call& o) const {
+        return kind == o.kind && a == o.a && b == o.b && dt == o.dt && code == o.code;
+    }
+};
+
+/** Controller that logs every call it receives. */
+class CaptureController : public vne::interaction::ICameraController {
+   public:
+    std::vector<Call> calls;
+
+    void setCamera(std::shared_ptr<vne::scene::ICamera>) noexcept override {}
+    void onResize(float w, float h) noexcept override { calls.push_back({1, w, h, 0.0, 0}); }
+    void onUpdate(double dt) noexcept override { calls.push_back({0, 0.0, 0.0, dt, 0}); }
+    void setFixedTimestep(double step_s) noexcept override { calls.push_back({2, step_s, 0.0, 0.0, 0}); }
+    void onEvent(const vne::events::Event& event, double dt) noexcept override {
+        Call c;
+        c.kind = 10 + static_cast<int>(event.type());
+        c.dt = dt;
+        switch (event.type()) {
+            case vne::events::EventType::eMouseMoved: {
+                const auto& e = static_cast<const vne::events::MouseMovedEvent&>(event);
+                c.a = e.x();
+                c.b = e.y();
+                break;
+            }
+            case vne::events::EventType::eMouseButtonPressed:
+            case vne::events::EventType::eMouseButtonReleased: {
+                const auto& e = static_cast<const vne::events::MouseButtonEvent&>(event);
+                c.a = e.x();
+                c.b = e.y();
+                c.code = static_cast<int>(e.button());
+                break;
+            }
+            case vne::events::EventType::eMouseScrolled: {
+                const auto& e = static_cast<const vne::events::MouseScrolledEvent&>(event);
+                c.a = e.xOffset();
+                c.b = e.yOffset();
+                break;
+            }
+            case vne::events::EventType::eKeyPressed:
+            case vne::events::EventType::eKeyReleased: {
+                const auto& e = static_cast<const vne::events::KeyEvent&>(event);
+                c.code = static_cast<int>(e.keyCode());
+                break;
+            }
+            default:
+                break;
+        }
+        calls.push_back(c);
+    }
+};
+
+/** Temporary log file removed when the test ends. */
+class TempLog {
+   public:
+    explicit TempLog(const char* name)
+        : path_((std::filesystem::temp_directory_path() / name).string()) {}
+    ~TempLog() {
+        std::error_code ec;
+        std::filesystem::remove(path_, ec);
+    }
+    TempLog(const TempLog&) = delete;
+    TempLog& operator=(const TempLog&) = delete;
+
+    [[nodiscard]] const std::string& path() const { return path_; }
+
+   private:
+    std::string path_;
+};
+
+std::shared_ptr<vne::scene::PerspectiveCamera> makePerspCamera() {
+    auto cam = vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(45.0f, 16.0f / 9.0f, 0.1f, 1000.0f));
+    cam->setPosition(vne::math::Vec3f(0.0f, 0.0f, 5.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    return cam;
+}
+
+/** Orbit drag with sub-pixel coordinates, a wheel zoom and inertia frames. */
+void driveSession(vne::interaction::ICameraController& ctrl) {
+    ctrl.onResize(1280.0f, 720.0f);
+    ctrl.onEvent(vne::events::MouseMovedEvent(640.0, 360.0), kFrameDt);
+    ctrl.onEvent(vne::events::MouseButtonPressedEvent(vne::events::MouseButton::eLeft, 0, 640.0, 360.0), kFrameDt);
+    for (int i = 1; i <= 20; ++i) {
+        ctrl.onEvent(vne::events::MouseMovedEvent(640.0 + 7.3 * i, 360.0 - 2.1 * i), kFrameDt);
+        ctrl.onUpdate(kFrameDt);
+    }
+    ctrl.onEvent(vne::events::MouseButtonReleasedEvent(vne::events::MouseButton::eLeft, 0, 786.0, 318.0), kFrameDt);
+    ctrl.onEvent(vne::events::MouseScrolledEvent(0.0, 1.5), kFrameDt);
+    for (int i = 0; i < 30; ++i) {
+        ctrl.onUpdate(kFrameDt);
+    }
+}
+
+}  // namespace
+
+TEST(InteractionRecorder, RoundTripReproducesCallsExactly) {
+    TempLog log("vne_recorder_calls.vnir");
+    auto recorded = std::make_shared<CaptureController>();
+    {
+        vne::interaction::InteractionRecorder recorder(recorded);
+        ASSERT_TRUE(recorder.start(log.path()));
+        EXPECT_TRUE(recorder.isRecording());
+        recorder.setFixedTimestep(1.0 / 120.0);
+        driveSession(recorder);
+        recorder.onEvent(vne::events::KeyPressedEvent(vne::events::KeyCode::eW), 0.0);
+        recorder.onEvent(vne::events::MouseMovedEvent(-0.1, 1e300), 0.25);
+        recorder.onEvent(vne::events::KeyReleasedEvent(vne::events::KeyCode::eW), 0.0);
+        EXPECT_EQ(recorder.getRecordCount(), recorded->calls.size());
+        recorder.stop();
+        EXPECT_FALSE(recorder.isRecording());
+        EXPECT_FALSE(recorder.hasWriteError());
+    }
+
+    vne::interaction::InteractionPlayer player;
+    player.setChunkSize(16);  // records straddle chunk boundaries
+    player.setMemoryMapThreshold(1ull << 40);
+    ASSERT_TRUE(player.open(log.path()));
+    EXPECT_FALSE(player.isMemoryMapped());
+
+    CaptureController replayed;
+    EXPECT_EQ(player.playAll(replayed), recorded->calls.size());
+    EXPECT_TRUE(player.isFinished());
+    EXPECT_FALSE(player.hasError());
+
+    // Header replays the viewport / step first only when they were known at start; here they were not.
+    ASSERT_EQ(replayed.calls.size(), recorded->calls.size());
+    for (std::size_t i = 0; i < replayed.calls.size(); ++i) {
+        EXPECT_TRUE(replayed.calls[i] == recorded->calls[i]) << "call " << i;
+    }
+}
+
+TEST(InteractionRecorder, HeaderCarriesSessionConfig) {
+    TempLog log("vne_recorder_header.vnir");
+    vne::interaction::InteractionRecorder recorder(std::make_shared<CaptureController>());
+    recorder.onResize(800.0f, 600.0f);
+    recorder.setFixedTimestep(0.01);
+
+    vne::interaction::InteractionRecordingInfo info;
+    info.controller = "inspect_3d";
+    info.config = {1, 2, 3, 250};
+    ASSERT_TRUE(recorder.start(log.path(), info));
+    recorder.onUpdate(kFrameDt);
+    recorder.stop();
+
+    vne::interaction::InteractionPlayer player;
+    ASSERT_TRUE(player.open(log.path()));
+    EXPECT_EQ(player.getInfo().controller, "inspect_3d");
+    EXPECT_EQ(player.getInfo().config, (std::vector<std::uint8_t>{1, 2, 3, 250}));
+    EXPECT_FLOAT_EQ(player.getInfo().viewport_width, 800.0f);
+    EXPECT_FLOAT_EQ(player.getInfo().viewport_height, 600.0f);
+    EXPECT_DOUBLE_EQ(player.getInfo().fixed_step_s, 0.01);
+
+    // The header configures the target before the first record.
+    CaptureController replayed;
+    EXPECT_EQ(player.playUntil(replayed, -1.0), 0u);
+    EXPECT_EQ(player.playAll(replayed), 1u);
+    ASSERT_EQ(replayed.calls.size(), 3u);
+    EXPECT_EQ(replayed.calls[0].kind, 1);
+    EXPECT_EQ(replayed.calls[1].kind, 2);
+    EXPECT_EQ(replayed.calls[2].kind, 0);
+}
+
+TEST(InteractionRecorder, PixelMovesEncodeCompactly) {
+    TempLog log("vne_recorder_size.vnir");
+    vne::interaction::InteractionRecorder recorder;
+    ASSERT_TRUE(recorder.start(log.path()));
+    const std::uint64_t header_bytes = recorder.getEncodedBytes();
+    constexpr int kMoves = 2000;
+    for (int i = 0; i < kMoves; ++i) {
+        recorder.onEvent(vne::events::MouseMovedEvent(100.0 + (i % 50), 200.0 - (i % 30)), kFrameDt);
+    }
+    const double bytes_per_move = static_cast<double>(recorder.getEncodedBytes() - header_bytes) / kMoves;
+    recorder.stop();
+    EXPECT_LT(bytes_per_move, 8.0);
+    EXPECT_EQ(std::filesystem::file_size(log.path()), recorder.getEncodedBytes());
+}
+
+TEST(InteractionRecorder, ReplayDrivesControllerToSamePose) {
+    TempLog log("vne_recorder_replay.vnir");
+    auto live_cam = makePerspCamera();
+    auto live = std::make_shared<vne::interaction::Inspect3DController>();
+    live->setCamera(live_cam);
+    {
+        vne::interaction::InteractionRecorder recorder(live);
+        vne::interaction::InteractionRecordingInfo info;
+        info.controller = "inspect_3d";
+        ASSERT_TRUE(recorder.start(log.path(), info));
+        driveSession(recorder);
+        EXPECT_EQ(recorder.getMotionState().angular_speed, live->getMotionState().angular_speed);
+        EXPECT_EQ(recorder.getMotionState().settle_time_s, live->getMotionState().settle_time_s);
+        recorder.stop();
+    }
+    ASSERT_GT((live_cam->getPosition() - vne::math::Vec3f(0.0f, 0.0f, 5.0f)).length(), 0.1f);
+
+    for (const bool mapped : {false, true}) {
+        vne::interaction::InteractionPlayer player;
+        player.setMemoryMapThreshold(mapped ? 0u : 1ull << 40);
+        ASSERT_TRUE(player.open(log.path()));
+#if defined(__unix__) || defined(__APPLE__)
+        EXPECT_EQ(player.isMemoryMapped(), mapped);
+#endif
+        auto replay_cam = makePerspCamera();
+        vne::interaction::Inspect3DController replay;
+        replay.setCamera(replay_cam);
+        player.playAll(replay);
+        EXPECT_FALSE(player.hasError());
+
+        EXPECT_EQ(replay_cam->getPosition().x(), live_cam->getPosition().x());
+        EXPECT_EQ(replay_cam->getPosition().y(), live_cam->getPosition().y());
+        EXPECT_EQ(replay_cam->getPosition().z(), live_cam->getPosition().z());
+        EXPECT_EQ(replay_cam->getTarget().x(), live_cam->getTarget().x());
+        EXPECT_EQ(replay_cam->getTarget().y(), live_cam->getTarget().y());
+        EXPECT_EQ(replay_cam->getTarget().z(), live_cam->getTarget().z());
+    }
+}
+
+TEST(InteractionRecorder, DamagedLogsAreReported) {
+    vne::interaction::InteractionPlayer player;
+    EXPECT_FALSE(player.openMemory({'n', 'o', 'p', 'e', 0, 0, 0, 0}));
+    EXPECT_FALSE(player.isOpen());
+    EXPECT_FALSE(player.open("/nonexistent/dir/log.vnir"));
+
+    TempLog log("vne_recorder_truncated.vnir");
+    {
+        vne::interaction::InteractionRecorder recorder;
+        ASSERT_TRUE(recorder.start(log.path()));
+        driveSession(recorder);
+        recorder.stop();
+    }
+    std::ifstream in(log.path(), std::ios::binary);
+    std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    bytes.push_back(4);  // mouse-move tag with its payload missing
+
+    ASSERT_TRUE(player.openMemory(bytes));
+    CaptureController replayed;
+    EXPECT_GT(player.playAll(replayed), 0u);
+    EXPECT_TRUE(player.hasError());
+    EXPECT_TRUE(player.isFinished());
+}
+
+}  // namespace vne_interaction_test
@@ -48,6 +48,19 @@ TEST(Ortho2DController, FitToAABB) {
     EXPECT_NO_FATAL_FAILURE(ctrl.fitToAABB(vne::math::Vec3f(-2.0f, -2.0f, 0.0f), vne::math::Vec3f(2.0f, 2.0f, 0.0f)));
 }
 
+TEST(Ortho2DController, VisibleRegionDelegates) {
+    vne::interaction::Ortho2DController ctrl;
+    EXPECT_FALSE(ctrl.getVisibleRegion().valid);
+    auto cam = makeOrthoCamera();
+    ctrl.setCamera(cam);
+    ctrl.onResize(512.0f, 512.0f);
+
+    const vne::interaction::VisibleRegion region = ctrl.getVisibleRegion(0.1);
+    ASSERT_TRUE(region.valid);
+    EXPECT_NEAR(region.half_width * 2.0f, cam->getWidth(), 1e-5f);
+    EXPECT_FLOAT_EQ(region.world_units_per_pixel, ctrl.getWorldUnitsPerPixel());
+}
+
 TEST(Ortho2DController, SetPanDamping) {
     vne::interaction::Ortho2DController ctrl;
     auto cam = makeOrthoCamera();
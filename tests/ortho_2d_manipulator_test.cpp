@@ -19,6 +19,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+
 namespace vne_interaction_test {
 
 static std::shared_ptr<vne::scene::OrthographicCamera> makeOrthoCamera() {
@@ -101,4 +103,180 @@ TEST(Ortho2DManipulator, InPlaneRotatePreservesEyeTargetDistance) {
     EXPECT_GT((cam->getUp() - up_before).length(), 0.01f);
 }
 
+TEST(Ortho2DManipulator, VisibleRegionFollowsRotationAndPyramidLevel) {
+    auto cam = makeOrthoCamera();
+    cam->lookAt(vne::math::Vec3f(3.0f, 4.0f, 10.0f),
+                vne::math::Vec3f(3.0f, 4.0f, 0.0f),
+                vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    cam->updateMatrices();
+
+    vne::interaction::Ortho2DManipulator b;
+    EXPECT_FALSE(b.getVisibleRegion().valid);
+    b.setCamera(cam);
+    b.onResize(512.0f, 512.0f);
+
+    vne::interaction::VisibleRegion region = b.getVisibleRegion();
+    ASSERT_TRUE(region.valid);
+    EXPECT_NEAR((region.center - vne::math::Vec3f(3.0f, 4.0f, 0.0f)).length(), 0.0f, 1e-5f);
+    EXPECT_NEAR(region.half_width, 10.0f, 1e-5f);
+    EXPECT_NEAR(region.half_height, 10.0f, 1e-5f);
+    EXPECT_NEAR(region.bounds_min.x(), -7.0f, 1e-4f);
+    EXPECT_NEAR(region.bounds_max.y(), 14.0f, 1e-4f);
+    EXPECT_NEAR((region.corner(0) - vne::math::Vec3f(-7.0f, -6.0f, 0.0f)).length(), 0.0f, 1e-4f);
+    EXPECT_NEAR((region.corner(2) - vne::math::Vec3f(13.0f, 14.0f, 0.0f)).length(), 0.0f, 1e-4f);
+    EXPECT_FLOAT_EQ(region.world_units_per_pixel, b.getWorldUnitsPerPixel());
+
+    // Texels four times smaller than a pixel: level 2, unless the pyramid stops earlier
+    const float wupp = region.world_units_per_pixel;
+    EXPECT_EQ(region.pyramidLevel(wupp / 4.0f, 8), 2);
+    EXPECT_EQ(region.pyramidLevel(wupp / 4.0f, 1), 1);
+    EXPECT_EQ(region.pyramidLevel(wupp * 2.0f, 8), 0);
+    EXPECT_EQ(region.pyramidLevel(0.0f, 8), 0);
+
+    // 45 degree in-plane rotation: the axes turn, the world box grows to the rotated square's extent
+    vne::interaction::CameraCommandPayload p;
+    p.delta_x_px = 45.0f / b.getRotationSensitivityDegreesPerPixel();
+    b.onAction(vne::interaction::CameraActionType::eBeginRotate, p, 0.0);
+    b.onAction(vne::interaction::CameraActionType::eRotateDelta, p, 0.016);
+    b.onAction(vne::interaction::CameraActionType::eEndRotate, p, 0.0);
+
+    region = b.getVisibleRegion();
+    EXPECT_NEAR(std::abs(region.axis_x.x()), std::sqrt(0.5f), 1e-4f);
+    EXPECT_NEAR(std::abs(region.axis_x.y()), std::sqrt(0.5f), 1e-4f);
+    EXPECT_NEAR(region.bounds_max.x() - 3.0f, 20.0f * std::sqrt(0.5f), 1e-3f);
+    EXPECT_NEAR(region.bounds_max.y() - 4.0f, 20.0f * std::sqrt(0.5f), 1e-3f);
+    EXPECT_NEAR((region.corner(2) - region.center).length(), 10.0f * std::sqrt(2.0f), 1e-3f);
+}
+
+TEST(Ortho2DManipulator, VisibleRegionPredictsDragAndInertia) {
+    auto cam = makeOrthoCamera();
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 10.0f),
+                vne::math::Vec3f(0.0f, 0.0f, 0.0f),
+                vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    cam->updateMatrices();
+
+    vne::interaction::Ortho2DManipulator b;
+    b.setCamera(cam);
+    b.onResize(512.0f, 512.0f);
+
+    // Drag left at a steady 10 px per frame: the view moves towards +X
+    vne::interaction::CameraCommandPayload p;
+    p.delta_x_px = -10.0f;
+    b.onAction(vne::interaction::CameraActionType::eBeginPan, p, 0.0);
+    for (int i = 0; i < 30; ++i) {
+        b.onAction(vne::interaction::CameraActionType::ePanDelta, p, 0.016);
+    }
+    const float speed = 10.0f * b.getWorldUnitsPerPixel() / 0.016f;
+    const vne::math::Vec3f now = b.getVisibleRegion().center;
+    vne::interaction::VisibleRegion ahead = b.getVisibleRegion(0.25);
+    EXPECT_NEAR(ahead.center.x() - now.x(), speed * 0.25f, speed * 0.25f * 0.01f);
+    EXPECT_NEAR(ahead.bounds_min.x() - now.x(), speed * 0.25f - 10.0f, 1e-2f);
+    EXPECT_NEAR(b.getVisibleRegion(-1.0).center.x(), now.x(), 1e-6f);
+
+    // Released: the prediction matches where inertia actually carries the view
+    b.onAction(vne::interaction::CameraActionType::eEndPan, p, 0.0);
+    const vne::math::Vec3f released = cam->getTarget();
+    const float predicted = b.getVisibleRegion(0.5).center.x() - released.x();
+    EXPECT_GT(predicted, 0.0f);
+    EXPECT_LT(predicted, speed * 0.5f);
+    for (int i = 0; i < 60; ++i) {
+        b.onUpdate(0.5 / 60.0);
+    }
+    EXPECT_NEAR(cam->getTarget().x() - released.x(), predicted, predicted * 0.06f);
+
+    // Without inertia nothing coasts, so nothing is predicted after release
+    b.setPanInertiaEnabled(false);
+    b.onAction(vne::interaction::CameraActionType::eBeginPan, p, 0.0);
+    b.onAction(vne::interaction::CameraActionType::ePanDelta, p, 0.016);
+    EXPECT_GT(b.getVisibleRegion(0.25).center.x(), cam->getTarget().x());
+    b.onAction(vne::interaction::CameraActionType::eEndPan, p, 0.0);
+    EXPECT_NEAR(b.getVisibleRegion(0.25).center.x(), cam->getTarget().x(), 1e-6f);
+}
+
+TEST(Ortho2DManipulator, MotionStateReportsPanGlideAndZoom) {
+    auto cam = makeOrthoCamera();
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 10.0f),
+                vne::math::Vec3f(0.0f, 0.0f, 0.0f),
+                vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    cam->updateMatrices();
+
+    vne::interaction::Ortho2DManipulator b;
+    b.setCamera(cam);
+    b.onResize(512.0f, 512.0f);
+    EXPECT_FALSE(b.getMotionState().isMoving());
+
+    vne::interaction::CameraCommandPayload p;
+    p.delta_x_px = -10.0f;
+    b.onAction(vne::interaction::CameraActionType::eBeginPan, p, 0.0);
+    for (int i = 0; i < 30; ++i) {
+        b.onAction(vne::interaction::CameraActionType::ePanDelta, p, 0.016);
+    }
+    const float speed = 10.0f * b.getWorldUnitsPerPixel() / 0.016f;
+    vne::interaction::CameraMotionState state = b.getMotionState();
+    EXPECT_TRUE(state.dragging);
+    EXPECT_NEAR(state.linear_speed, speed, speed * 0.01f);
+
+    b.onAction(vne::interaction::CameraActionType::eEndPan, p, 0.0);
+    state = b.getMotionState();
+    EXPECT_TRUE(state.inertia);
+    ASSERT_GT(state.settle_time_s, 0.0f);
+    constexpr double kDt = 0.01;
+    double elapsed = 0.0;
+    while (b.getMotionState().isMoving() && elapsed < 10.0) {
+        b.onUpdate(kDt);
+        elapsed += kDt;
+    }
+    EXPECT_NEAR(elapsed, state.settle_time_s, 2.0 * kDt);
+
+    // Zoom out by the wheel: positive rate, back to rest once the wheel stops
+    p.x_px = 256.0f;
+    p.y_px = 256.0f;
+    p.zoom_factor = 1.1f;
+    b.onAction(vne::interaction::CameraActionType::eZoomAtCursor, p, 0.016);
+    b.onUpdate(0.016);
+    EXPECT_GT(b.getMotionState().zoom_rate, 0.0f);
+    for (int i = 0; i < 60; ++i) {
+        b.onUpdate(0.016);
+    }
+    EXPECT_FALSE(b.getMotionState().isMoving());
+}
+
+TEST(Ortho2DManipulator, PredictPoseContinuesRotationAndPan) {
+    auto cam = makeOrthoCamera();
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 10.0f),
+                vne::math::Vec3f(0.0f, 0.0f, 0.0f),
+                vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    cam->updateMatrices();
+
+    vne::interaction::Ortho2DManipulator b;
+    b.setCamera(cam);
+    b.onResize(512.0f, 512.0f);
+
+    // Steady in-plane rotation: the prediction turns the same way, by the same amount
+    vne::interaction::CameraCommandPayload p;
+    p.delta_x_px = 4.0f;
+    b.onAction(vne::interaction::CameraActionType::eBeginRotate, p, 0.0);
+    for (int i = 0; i < 20; ++i) {
+        b.onAction(vne::interaction::CameraActionType::eRotateDelta, p, 0.016);
+    }
+    const vne::interaction::CameraPoseSnapshot turned = b.predictPose(5 * 0.016);
+    for (int i = 0; i < 5; ++i) {
+        b.onAction(vne::interaction::CameraActionType::eRotateDelta, p, 0.016);
+    }
+    EXPECT_NEAR((turned.orientation.getYAxis() - cam->getUp().normalized()).length(), 0.0f, 1e-3f);
+    EXPECT_NEAR((turned.position - cam->getPosition()).length(), 0.0f, 1e-3f);
+    b.onAction(vne::interaction::CameraActionType::eEndRotate, p, 0.0);
+
+    // Pan: the pose moves with the visible region's predicted center
+    p.delta_x_px = -10.0f;
+    b.onAction(vne::interaction::CameraActionType::eBeginPan, p, 0.0);
+    for (int i = 0; i < 10; ++i) {
+        b.onAction(vne::interaction::CameraActionType::ePanDelta, p, 0.016);
+    }
+    const vne::interaction::CameraPoseSnapshot panned = b.predictPose(0.25);
+    EXPECT_NEAR((panned.target - b.getVisibleRegion(0.25).center).length(), 0.0f, 1e-4f);
+    EXPECT_NEAR((panned.position - panned.target - (cam->getPosition() - cam->getTarget())).length(), 0.0f, 1e-4f);
+    EXPECT_EQ(panned.ortho_width, cam->getWidth());
+}
+
 }  // namespace vne_interaction_test
@@ -0,0 +1,326 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * PickIndex tests: ray casts match brute force, parallel builds match serial ones, box updates refit,
+ * pivot at cursor through IDepthQuery, swept-sphere contacts on faces, edges, vertices and boxes.
+ */
+
+#include "vertexnova/interaction/pick_index.h"
+#include "vertexnova/interaction/trackball_manipulator.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace vne_interaction_test {
+
+namespace {
+
+using vne::interaction::PickHit;
+using vne::interaction::PickIndex;
+using vne::math::Vec3f;
+
+/** Deterministic pseudo-random floats in [lo, hi). */
+class Lcg {
+   public:
+    float next(float lo, float hi) noexcept {
+        state_ = state_ * 6364136223846793005ull + 1442695040888963407ull;
+        const auto u = static_cast<float>((state_ >> 40) & 0xFFFFFFu) / 16777216.0f;
+        return lo + (hi - lo) * u;
+    }
+    Vec3f point(float lo, float hi) noexcept { return Vec3f(next(lo, hi), next(lo, hi), next(lo, hi)); }
+
+   private:
+    std::uint64_t state_ = 12345u;
+};
+
+/** Small random triangles scattered through a 20-unit cube (non-indexed). */
+std::vector<Vec3f> makeTriangleSoup(std::size_t count) {
+    Lcg rng;
+    std::vector<Vec3f> v;
+    v.reserve(3 * count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const Vec3f c = rng.point(-10.0f, 10.0f);
+        v.push_back(c + rng.point(-0.5f, 0.5f));
+        v.push_back(c + rng.point(-0.5f, 0.5f));
+        v.push_back(c + rng.point(-0.5f, 0.5f));
+    }
+    return v;
+}
+
+/** Closest two-sided hit over all triangles. */
+float bruteForce(const std::vector<Vec3f>& v, const Vec3f& o, const Vec3f& d) {
+    float best = std::numeric_limits<float>::infinity();
+    for (std::size_t i = 0; i + 2 < v.size(); i += 3) {
+        const Vec3f e1 = v[i + 1] - v[i];
+        const Vec3f e2 = v[i + 2] - v[i];
+        const Vec3f p = d.cross(e2);
+        const float det = e1.dot(p);
+        if (std::abs(det) < 1e-12f) {
+            continue;
+        }
+        const Vec3f s = o - v[i];
+        const float u = s.dot(p) / det;
+        const Vec3f q = s.cross(e1);
+        const float w = d.dot(q) / det;
+        const float t = e2.dot(q) / det;
+        if (u >= 0.0f && u <= 1.0f && w >= 0.0f && u + w <= 1.0f && t >= 0.0f) {
+            best = std::min(best, t);
+        }
+    }
+    return best;
+}
+
+}  // namespace
+
+TEST(PickIndex, RaycastMatchesBruteForce) {
+    const std::vector<Vec3f> soup = makeTriangleSoup(3000);
+    PickIndex index(0);
+    index.buildFromTriangles(soup.data(), soup.size(), nullptr, soup.size() / 3);
+    EXPECT_EQ(index.size(), 3000u);
+    EXPECT_GT(index.nodeCount(), 1u);
+
+    Lcg rng;
+    int hits = 0;
+    for (int i = 0; i < 400; ++i) {
+        const Vec3f o = rng.point(-15.0f, 15.0f);
+        const Vec3f d = (rng.point(-10.0f, 10.0f) - o).normalized();
+        const float expected = bruteForce(soup, o, d);
+        PickHit hit;
+        const bool found = index.raycast(o, d * 3.0f, hit);  // direction length does not matter
+        ASSERT_EQ(found, std::isfinite(expected)) << "ray " << i;
+        if (found) {
+            ++hits;
+            EXPECT_NEAR(hit.distance, expected, 1e-3f) << "ray " << i;
+            EXPECT_LT(hit.primitive, 3000u);
+            const Vec3f p = o + d * hit.distance;
+            EXPECT_NEAR((hit.point - p).length(), 0.0f, 1e-3f);
+        }
+    }
+    EXPECT_GT(hits, 50);
+
+    PickHit hit;
+    EXPECT_FALSE(index.raycast(Vec3f(0.0f, 0.0f, 0.0f), Vec3f(0.0f, 0.0f, 0.0f), hit));
+    index.clear();
+    EXPECT_TRUE(index.empty());
+    EXPECT_FALSE(index.raycast(Vec3f(0.0f, 0.0f, 30.0f), Vec3f(0.0f, 0.0f, -1.0f), hit));
+}
+
+TEST(PickIndex, ParallelBuildMatchesSerialBuild) {
+    // 2 x 180 x 180 indexed grid triangles on a wavy height field: large enough for the parallel path
+    const int n = 180;
+    std::vector<Vec3f> vertices;
+    for (int j = 0; j <= n; ++j) {
+        for (int i = 0; i <= n; ++i) {
+            const float x = static_cast<float>(i) * 0.1f;
+            const float z = static_cast<float>(j) * 0.1f;
+            vertices.emplace_back(x, 0.3f * std::sin(x) * std::cos(z), z);
+        }
+    }
+    std::vector<std::uint32_t> indices;
+    for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+            const auto a = static_cast<std::uint32_t>(j * (n + 1) + i);
+            const auto c = a + static_cast<std::uint32_t>(n + 1);
+            indices.insert(indices.end(), {a, a + 1, c, a + 1, c + 1, c});
+        }
+    }
+    indices.insert(indices.end(), {0u, 1u, 999999u});  // out of range: skipped
+    const std::size_t tri_count = indices.size() / 3;
+
+    PickIndex serial(0);
+    PickIndex parallel(3);
+    PickIndex external(0);
+    std::size_t executor_calls = 0;
+    external.setExecutor([&executor_calls](std::size_t count, const std::function<void(std::size_t)>& task) {
+        ++executor_calls;
+        for (std::size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+    });
+    serial.buildFromTriangles(vertices.data(), vertices.size(), indices.data(), tri_count);
+    parallel.buildFromTriangles(vertices.data(), vertices.size(), indices.data(), tri_count);
+    external.buildFromTriangles(vertices.data(), vertices.size(), indices.data(), tri_count);
+    EXPECT_EQ(serial.size(), tri_count - 1);
+    EXPECT_EQ(parallel.size(), serial.size());
+    EXPECT_GT(executor_calls, 0u);
+
+    Lcg rng;
+    for (int r = 0; r < 500; ++r) {
+        const Vec3f o(rng.next(0.0f, 18.0f), 5.0f, rng.next(0.0f, 18.0f));
+        const Vec3f d = Vec3f(rng.next(-0.3f, 0.3f), -1.0f, rng.next(-0.3f, 0.3f));
+        PickHit a;
+        PickHit b;
+        PickHit c;
+        const bool ha = serial.raycast(o, d, a);
+        ASSERT_EQ(ha, parallel.raycast(o, d, b));
+        ASSERT_EQ(ha, external.raycast(o, d, c));
+        if (ha) {
+            EXPECT_EQ(a.distance, b.distance);
+            EXPECT_EQ(a.primitive, b.primitive);
+            EXPECT_EQ(a.distance, c.distance);
+            EXPECT_LT(std::abs(a.point.y()), 0.31f);
+        }
+    }
+}
+
+TEST(PickIndex, BoxUpdatesRefitTheHierarchy) {
+    std::vector<Vec3f> mins;
+    std::vector<Vec3f> maxs;
+    for (int i = 0; i < 64; ++i) {
+        const float x = static_cast<float>(i % 8) * 3.0f;
+        const float y = static_cast<float>(i / 8) * 3.0f;
+        mins.emplace_back(x, y, 0.0f);
+        maxs.emplace_back(x + 1.0f, y + 1.0f, 1.0f);
+    }
+    mins.emplace_back(0.0f, 0.0f, 0.0f);  // inverted: skipped
+    maxs.emplace_back(-1.0f, 0.0f, 0.0f);
+    PickIndex index(0);
+    index.buildFromBoxes(mins.data(), maxs.data(), mins.size());
+    EXPECT_EQ(index.size(), 64u);
+
+    PickHit hit;
+    ASSERT_TRUE(index.raycast(Vec3f(3.5f, 3.5f, 10.0f), Vec3f(0.0f, 0.0f, -1.0f), hit));
+    EXPECT_EQ(hit.primitive, 9u);
+    EXPECT_NEAR(hit.distance, 9.0f, 1e-5f);
+
+    // Move box 9 far outside the original bounds; the old spot is empty, the new one is found
+    index.updateBox(9, Vec3f(100.0f, 100.0f, 4.0f), Vec3f(101.0f, 101.0f, 5.0f));
+    EXPECT_FALSE(index.raycast(Vec3f(3.5f, 3.5f, 10.0f), Vec3f(0.0f, 0.0f, -1.0f), hit));
+    ASSERT_TRUE(index.raycast(Vec3f(100.5f, 100.5f, 10.0f), Vec3f(0.0f, 0.0f, -1.0f), hit));
+    EXPECT_EQ(hit.primitive, 9u);
+    EXPECT_NEAR(hit.distance, 5.0f, 1e-5f);
+    EXPECT_FALSE(index.raycast(Vec3f(100.5f, 100.5f, 10.0f), Vec3f(0.0f, 0.0f, -1.0f), hit, 4.0f));
+
+    // A ray starting inside a box hits it at its origin
+    ASSERT_TRUE(index.raycast(Vec3f(0.5f, 0.5f, 0.5f), Vec3f(1.0f, 0.0f, 0.0f), hit));
+    EXPECT_EQ(hit.primitive, 0u);
+    EXPECT_FLOAT_EQ(hit.distance, 0.0f);
+    index.updateTriangle(0, Vec3f(0.0f, 0.0f, 0.0f), Vec3f(1.0f, 0.0f, 0.0f), Vec3f(0.0f, 1.0f, 0.0f));  // ignored
+}
+
+TEST(PickIndex, AnswersDepthQueriesForPivotAtCursor) {
+    // Floor quad at z = -2 spanning [-50, 50]^2
+    const std::vector<Vec3f> floor = {Vec3f(-50.0f, -50.0f, -2.0f),
+                                      Vec3f(50.0f, -50.0f, -2.0f),
+                                      Vec3f(50.0f, 50.0f, -2.0f),
+                                      Vec3f(-50.0f, -50.0f, -2.0f),
+                                      Vec3f(50.0f, 50.0f, -2.0f),
+                                      Vec3f(-50.0f, 50.0f, -2.0f)};
+    auto picks = std::make_shared<PickIndex>(0);
+    picks->buildFromTriangles(floor.data(), floor.size(), nullptr, 2);
+
+    auto camera = vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(45.0f, 4.0f / 3.0f, 0.1f, 1000.0f));
+    camera->setPosition(Vec3f(0.0f, 0.0f, 10.0f));
+    camera->lookAt(Vec3f(0.0f, 0.0f, 0.0f), Vec3f(0.0f, 1.0f, 0.0f));
+    vne::interaction::TrackballManipulator manip;
+    manip.setCamera(camera);
+    manip.onResize(800.0f, 600.0f);
+    manip.setDepthQuery(picks);
+
+    vne::interaction::CameraCommandPayload p;
+    p.x_px = 400.0f;
+    p.y_px = 300.0f;
+    manip.onAction(vne::interaction::CameraActionType::eSetPivotAtCursor, p, 0.0);
+    const Vec3f coi = manip.getCenterOfInterestWorld();
+    EXPECT_NEAR(coi.x(), 0.0f, 1e-3f);
+    EXPECT_NEAR(coi.y(), 0.0f, 1e-3f);
+    EXPECT_NEAR(coi.z(), -2.0f, 1e-3f);
+
+    // Results stay available for a few later requests; misses report eMiss
+    vne::interaction::DepthRequest up;
+    up.ray_origin = Vec3f(0.0f, 0.0f, 10.0f);
+    up.ray_direction = Vec3f(0.0f, 0.0f, 1.0f);
+    const auto id = picks->requestDepth(up);
+    Vec3f point;
+    EXPECT_EQ(picks->pollDepth(id, point), vne::interaction::DepthQueryStatus::eMiss);
+    EXPECT_EQ(picks->pollDepth(vne::interaction::IDepthQuery::kNoRequest, point),
+              vne::interaction::DepthQueryStatus::eMiss);
+}
+
+TEST(PickIndex, SphereCastHitsFacesEdgesVerticesAndBoxes) {
+    // 20 x 20 wall in the z = 0 plane, two triangles
+    const std::vector<Vec3f> wall = {
+        Vec3f(-10.0f, -10.0f, 0.0f), Vec3f(10.0f, -10.0f, 0.0f), Vec3f(10.0f, 10.0f, 0.0f), Vec3f(-10.0f, 10.0f, 0.0f)};
+    const std::vector<std::uint32_t> indices = {0, 1, 2, 0, 2, 3};
+    PickIndex index(0);
+    index.buildFromTriangles(wall.data(), wall.size(), indices.data(), 2);
+    const Vec3f down(0.0f, 0.0f, -1.0f);
+    vne::interaction::SweepHit hit;
+
+    // Face, from either side
+    ASSERT_TRUE(index.sphereCast(Vec3f(0.0f, 1.0f, 5.0f), down, 0.5f, 100.0f, hit));
+    EXPECT_NEAR(hit.distance, 4.5f, 1e-4f);
+    EXPECT_NEAR(hit.normal.z(), 1.0f, 1e-5f);
+    EXPECT_NEAR((hit.point - Vec3f(0.0f, 1.0f, 0.0f)).length(), 0.0f, 1e-4f);
+    ASSERT_TRUE(index.sphereCast(Vec3f(0.0f, 1.0f, -5.0f), -down, 0.5f, 100.0f, hit));
+    EXPECT_NEAR(hit.normal.z(), -1.0f, 1e-5f);
+    EXPECT_FALSE(index.sphereCast(Vec3f(0.0f, 1.0f, 5.0f), down, 0.5f, 4.0f, hit));  // beyond max distance
+
+    // Edge x = 10 passes 1 unit beside the center: contact sqrt(3) above the plane
+    ASSERT_TRUE(index.sphereCast(Vec3f(11.0f, 0.0f, 5.0f), down, 2.0f, 100.0f, hit));
+    EXPECT_NEAR(hit.distance, 5.0f - std::sqrt(3.0f), 1e-4f);
+    EXPECT_NEAR(hit.normal.x(), 0.5f, 1e-4f);
+    EXPECT_NEAR((hit.point - Vec3f(10.0f, 0.0f, 0.0f)).length(), 0.0f, 1e-3f);
+
+    // Corner (10, 10, 0) at sqrt(2) beside the center
+    ASSERT_TRUE(index.sphereCast(Vec3f(11.0f, 11.0f, 5.0f), down, 2.0f, 100.0f, hit));
+    EXPECT_NEAR(hit.distance, 5.0f - std::sqrt(2.0f), 1e-4f);
+    EXPECT_FALSE(index.sphereCast(Vec3f(13.0f, 0.0f, 5.0f), down, 2.0f, 100.0f, hit));
+
+    // Already touching: moving deeper reports 0, moving away is free
+    ASSERT_TRUE(index.sphereCast(Vec3f(0.0f, 0.0f, 0.2f), down, 0.5f, 1.0f, hit));
+    EXPECT_EQ(hit.distance, 0.0f);
+    EXPECT_FALSE(index.sphereCast(Vec3f(0.0f, 0.0f, 0.2f), -down, 0.5f, 1.0f, hit));
+
+    // A hint never changes the answer
+    const std::vector<Vec3f> soup = makeTriangleSoup(2000);
+    PickIndex soup_index(0);
+    soup_index.buildFromTriangles(soup.data(), soup.size(), nullptr, soup.size() / 3);
+    Lcg rng;
+    int hits = 0;
+    for (int i = 0; i < 200; ++i) {
+        const Vec3f o = rng.point(-15.0f, 15.0f);
+        const Vec3f d = (rng.point(-10.0f, 10.0f) - o).normalized();
+        const auto hint = static_cast<std::uint32_t>(rng.next(0.0f, 2000.0f));
+        vne::interaction::SweepHit plain;
+        vne::interaction::SweepHit hinted;
+        const bool found = soup_index.sphereCast(o, d, 0.3f, 40.0f, plain);
+        ASSERT_EQ(soup_index.sphereCast(o, d, 0.3f, 40.0f, hinted, hint), found) << "cast " << i;
+        if (found) {
+            ++hits;
+            EXPECT_NEAR(hinted.distance, plain.distance, 1e-5f) << "cast " << i;
+            // A sphere cast never reaches further than the ray along its center
+            EXPECT_LE(plain.distance, bruteForce(soup, o, d) + 1e-4f) << "cast " << i;
+        }
+    }
+    EXPECT_GT(hits, 50);
+
+    // Boxes are inflated by the radius
+    const Vec3f mn(-1.0f, -1.0f, -1.0f);
+    const Vec3f mx(1.0f, 1.0f, 1.0f);
+    PickIndex boxes(0);
+    boxes.buildFromBoxes(&mn, &mx, 1);
+    ASSERT_TRUE(boxes.sphereCast(Vec3f(5.0f, 0.0f, 0.0f), Vec3f(-2.0f, 0.0f, 0.0f), 0.5f, 100.0f, hit));
+    EXPECT_NEAR(hit.distance, 3.5f, 1e-4f);
+    EXPECT_NEAR(hit.normal.x(), 1.0f, 1e-5f);
+    EXPECT_EQ(hit.primitive, 0u);
+}
+
+}  // namespace vne_interaction_test
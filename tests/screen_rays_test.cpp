@@ -0,0 +1,112 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * screenToWorldRays tests: agreement with the single-point helper per graphics API, parallel orthographic rays
+ * on the near plane, span and viewport edge cases.
+ */
+
+#include "vertexnova/interaction/screen_rays.h"
+#include "vertexnova/interaction/interaction_utils.h"
+#include "vertexnova/scene/camera/camera_factory.h"
+#include "vertexnova/scene/camera/camera_types.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace vne_interaction_test {
+
+namespace {
+
+using vne::math::Vec2f;
+using vne::math::Vec3f;
+
+void expectNear(const Vec3f& a, const Vec3f& b, float tol) {
+    EXPECT_NEAR(a.x(), b.x(), tol);
+    EXPECT_NEAR(a.y(), b.y(), tol);
+    EXPECT_NEAR(a.z(), b.z(), tol);
+}
+
+/** 7 x 5 grid over an 800 x 600 viewport plus two off-grid points: not a multiple of the kernel block. */
+std::vector<Vec2f> samplePoints() {
+    std::vector<Vec2f> points;
+    for (int j = 0; j < 5; ++j) {
+        for (int i = 0; i < 7; ++i) {
+            points.emplace_back(static_cast<float>(i) * 800.0f / 6.0f, static_cast<float>(j) * 150.0f);
+        }
+    }
+    points.emplace_back(400.0f, 300.0f);
+    points.emplace_back(123.5f, 456.25f);
+    return points;
+}
+
+}  // namespace
+
+TEST(ScreenRays, MatchSingleRayHelperForEachGraphicsApi) {
+    const vne::math::Viewport vp(800.0f, 600.0f);
+    const std::vector<Vec2f> points = samplePoints();
+    for (const auto api : {vne::math::GraphicsApi::eOpenGL, vne::math::GraphicsApi::eVulkan}) {
+        auto camera = vne::scene::CameraFactory::createPerspective(
+            vne::scene::PerspectiveCameraParameters(60.0f, 800.0f / 600.0f, 0.1f, 500.0f));
+        camera->setGraphicsApi(api);
+        camera->lookAt(Vec3f(1.0f, 2.0f, 10.0f), Vec3f(0.0f, 0.0f, 0.0f), Vec3f(0.0f, 1.0f, 0.0f));
+        camera->updateMatrices();
+
+        std::vector<vne::math::Ray> rays(points.size());
+        ASSERT_EQ(vne::interaction::screenToWorldRays(*camera, vp, points, rays), points.size());
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            const vne::math::Ray single =
+                vne::interaction::mouseToWorldRay(*camera, points[i].x(), points[i].y(), vp);
+            expectNear(rays[i].origin(), single.origin(), 1e-4f);
+            expectNear(rays[i].direction(), single.direction().normalized(), 1e-4f);
+            EXPECT_NEAR(rays[i].direction().length(), 1.0f, 1e-5f);
+        }
+        expectNear(rays[points.size() - 2].direction(), camera->getForwardDir(), 1e-4f);  // viewport center
+    }
+}
+
+TEST(ScreenRays, OrthographicRaysAreParallelAndStartOnTheNearPlane) {
+    auto ortho = vne::scene::CameraFactory::createOrthographic(
+        vne::scene::OrthographicCameraParameters(-4.0f, 4.0f, -3.0f, 3.0f, 0.5f, 100.0f));
+    ortho->lookAt(Vec3f(0.0f, 0.0f, 10.0f), Vec3f(0.0f, 0.0f, 0.0f), Vec3f(0.0f, 1.0f, 0.0f));
+    ortho->updateMatrices();
+
+    const std::vector<Vec2f> points = {Vec2f(0.0f, 0.0f), Vec2f(800.0f, 600.0f), Vec2f(400.0f, 300.0f)};
+    std::vector<vne::math::Ray> rays(points.size());
+    ASSERT_EQ(vne::interaction::screenToWorldRays(*ortho, vne::math::Viewport(800.0f, 600.0f), points, rays), 3u);
+    for (const vne::math::Ray& ray : rays) {
+        expectNear(ray.direction(), Vec3f(0.0f, 0.0f, -1.0f), 1e-4f);
+        EXPECT_NEAR(ray.origin().z(), 9.5f, 1e-3f);
+    }
+    expectNear(rays[0].origin(), Vec3f(-4.0f, 3.0f, 9.5f), 1e-3f);  // top-left pixel: left, top
+    expectNear(rays[1].origin(), Vec3f(4.0f, -3.0f, 9.5f), 1e-3f);
+    expectNear(rays[2].origin(), Vec3f(0.0f, 0.0f, 9.5f), 1e-3f);
+}
+
+TEST(ScreenRays, CountFollowsTheShorterSpanAndEmptyViewports) {
+    auto camera = vne::scene::CameraFactory::createPerspective(
+        vne::scene::PerspectiveCameraParameters(45.0f, 1.0f, 0.1f, 100.0f));
+    camera->updateMatrices();
+    const std::vector<Vec2f> points(40, Vec2f(10.0f, 10.0f));
+    std::vector<vne::math::Ray> rays(
+        33, vne::math::Ray(Vec3f(7.0f, 7.0f, 7.0f), Vec3f(0.0f, 1.0f, 0.0f)));
+
+    EXPECT_EQ(vne::interaction::screenToWorldRays(*camera, vne::math::Viewport(0.0f, 100.0f), points, rays), 0u);
+    expectNear(rays[0].origin(), Vec3f(7.0f, 7.0f, 7.0f), 0.0f);
+    EXPECT_EQ(vne::interaction::screenToWorldRays(*camera, vne::math::Viewport(100.0f, 100.0f), points, rays), 33u);
+    EXPECT_EQ(vne::interaction::screenToWorldRays(
+                  *camera, vne::math::Viewport(100.0f, 100.0f), std::span<const Vec2f>(points).first(5), rays),
+              5u);
+    EXPECT_EQ(vne::interaction::screenToWorldRays(*camera, vne::math::Viewport(100.0f, 100.0f), {}, rays), 0u);
+}
+
+}  // namespace vne_interaction_test
@@ -9,6 +9,8 @@
 #include "vertexnova/scene/camera/camera_types.h"
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <memory>
@@ -403,4 +405,251 @@ TEST(TrackballManipulator, OrthoDollyZoomSyncsCoiWithCameraTarget) {
     EXPECT_NEAR(coi.z(), tgt.z(), 1e-3f);
 }
 
+/** Horizontal rotate drag of @p steps samples; camera position at the last sample (before release). */
+static std::shared_ptr<vne::scene::PerspectiveCamera> rotateGesture(vne::interaction::TrackballManipulator& b,
+                                                                     int steps,
+                                                                     float step_px) {
+    auto cam = makePerspCamera();
+    cam->setPosition(vne::math::Vec3f(0.0f, 0.0f, 5.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    b.setCamera(cam);
+    b.onResize(800.0f, 600.0f);
+    b.setRotationInertiaEnabled(false);
+
+    vne::interaction::CameraCommandPayload p;
+    p.x_px = 400.0f;
+    p.y_px = 300.0f;
+    b.onAction(vne::interaction::CameraActionType::eBeginRotate, p, 0.016);
+    for (int i = 0; i < steps; ++i) {
+        p.x_px += step_px;
+        p.delta_x_px = step_px;
+        b.onAction(vne::interaction::CameraActionType::eRotateDelta, p, 0.016);
+    }
+    return cam;
+}
+
+TEST(TrackballManipulator, LatencyCompensationLeadsRotateAndSettlesOnRelease) {
+    vne::interaction::TrackballManipulator plain;
+    vne::interaction::TrackballManipulator led;
+    led.setLatencyCompensation(0.05f);
+    EXPECT_FLOAT_EQ(led.getLatencyCompensation(), 0.05f);
+
+    auto cam_plain = rotateGesture(plain, 6, 10.0f);
+    auto cam_led = rotateGesture(led, 6, 10.0f);
+    const vne::math::Vec3f start(0.0f, 0.0f, 5.0f);
+    const float plain_travel = (cam_plain->getPosition() - start).length();
+    const float led_travel = (cam_led->getPosition() - start).length();
+    EXPECT_GT(led_travel, plain_travel + 1e-4f);
+
+    // Release: no jump back; onUpdate blends the lead out onto the un-extrapolated pose.
+    const vne::math::Vec3f shown = cam_led->getPosition();
+    vne::interaction::CameraCommandPayload p;
+    plain.onAction(vne::interaction::CameraActionType::eEndRotate, p, 0.016);
+    led.onAction(vne::interaction::CameraActionType::eEndRotate, p, 0.016);
+    EXPECT_LT((cam_led->getPosition() - shown).length(), 1e-5f);
+    float gap = (cam_plain->getPosition() - cam_led->getPosition()).length();
+    EXPECT_GT(gap, 1e-4f);
+    EXPECT_TRUE(led.getMotionState().isMoving());
+    for (int i = 0; i < 30; ++i) {
+        plain.onUpdate(0.016);
+        led.onUpdate(0.016);
+        const float next = (cam_plain->getPosition() - cam_led->getPosition()).length();
+        EXPECT_LE(next, gap + 1e-6f);
+        gap = next;
+    }
+    EXPECT_LT(gap, 1e-3f);
+    EXPECT_FALSE(led.getMotionState().isMoving());
+}
+
+/** Horizontal pan drag of @p steps samples (pan inertia off); camera at the last sample (before release). */
+static std::shared_ptr<vne::scene::PerspectiveCamera> panGesture(vne::interaction::TrackballManipulator& b,
+                                                                  int steps,
+                                                                  float step_px) {
+    auto cam = makePerspCamera();
+    cam->setPosition(vne::math::Vec3f(0.0f, 0.0f, 5.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    b.setCamera(cam);
+    b.onResize(800.0f, 600.0f);
+    b.setPanInertiaEnabled(false);
+
+    vne::interaction::CameraCommandPayload p;
+    p.x_px = 400.0f;
+    p.y_px = 300.0f;
+    b.onAction(vne::interaction::CameraActionType::eBeginPan, p, 0.016);
+    for (int i = 0; i < steps; ++i) {
+        p.x_px += step_px;
+        p.delta_x_px = step_px;
+        b.onAction(vne::interaction::CameraActionType::ePanDelta, p, 0.016);
+    }
+    return cam;
+}
+
+TEST(TrackballManipulator, LatencyCompensationLeadsPanAndSettlesOnRelease) {
+    vne::interaction::TrackballManipulator plain;
+    vne::interaction::TrackballManipulator led;
+    led.setLatencyCompensation(0.05f);
+
+    auto cam_plain = panGesture(plain, 6, 10.0f);
+    auto cam_led = panGesture(led, 6, 10.0f);
+    const vne::math::Vec3f travel = cam_plain->getTarget();  // pan started with the target at the origin
+    const vne::math::Vec3f lead = cam_led->getTarget() - cam_plain->getTarget();
+    ASSERT_GT(travel.length(), 1e-3f);
+    EXPECT_GT(lead.dot(travel), 1e-6f);
+    EXPECT_LE(lead.length(), 5.0f * std::tan(vne::math::degToRad(led.getLatencyCompensationMaxAngle())) + 1e-4f);
+
+    // Release: no jump back; onUpdate blends the lead out onto where the drag ended.
+    const vne::math::Vec3f shown = cam_led->getTarget();
+    vne::interaction::CameraCommandPayload p;
+    plain.onAction(vne::interaction::CameraActionType::eEndPan, p, 0.016);
+    led.onAction(vne::interaction::CameraActionType::eEndPan, p, 0.016);
+    EXPECT_LT((cam_led->getTarget() - shown).length(), 1e-5f);
+    float gap = (cam_plain->getTarget() - cam_led->getTarget()).length();
+    for (int i = 0; i < 30; ++i) {
+        plain.onUpdate(0.016);
+        led.onUpdate(0.016);
+        const float next = (cam_plain->getTarget() - cam_led->getTarget()).length();
+        EXPECT_LE(next, gap + 1e-6f);
+        gap = next;
+    }
+    EXPECT_LT(gap, 1e-3f);
+    EXPECT_LT((cam_plain->getPosition() - cam_led->getPosition()).length(), 1e-3f);
+}
+
+TEST(TrackballManipulator, LatencyPanLeadClampedByMaxAngle) {
+    vne::interaction::TrackballManipulator plain;
+    vne::interaction::TrackballManipulator led;
+    led.setLatencyCompensation(0.1f);
+    led.setLatencyCompensationMaxAngle(0.5f);
+
+    auto cam_plain = panGesture(plain, 4, 60.0f);
+    auto cam_led = panGesture(led, 4, 60.0f);
+    const float lead = (cam_led->getTarget() - cam_plain->getTarget()).length();
+    EXPECT_GT(lead, 1e-4f);
+    EXPECT_LE(lead, 5.0f * std::tan(vne::math::degToRad(0.5f)) + 1e-4f);
+}
+
+TEST(TrackballManipulator, LatencyCompensationClampedByMaxAngle) {
+    vne::interaction::TrackballManipulator plain;
+    vne::interaction::TrackballManipulator led;
+    led.setLatencyCompensation(0.1f);
+    led.setLatencyCompensationMaxAngle(1.0f);
+
+    auto cam_plain = rotateGesture(plain, 4, 60.0f);
+    auto cam_led = rotateGesture(led, 4, 60.0f);
+    const vne::math::Vec3f a = cam_plain->getPosition().normalized();
+    const vne::math::Vec3f c = cam_led->getPosition().normalized();
+    const float lead_deg = vne::math::radToDeg(std::acos(std::min(1.0f, a.dot(c))));
+    EXPECT_LE(lead_deg, 1.0f + 1e-2f);
+
+    led.setLatencyCompensation(-1.0f);
+    EXPECT_FLOAT_EQ(led.getLatencyCompensation(), 0.0f);
+}
+
+TEST(TrackballManipulator, MotionStateReportsDragInertiaAndSettle) {
+    vne::interaction::TrackballManipulator b;
+    EXPECT_FALSE(b.getMotionState().isMoving());
+    rotateGesture(b, 6, 10.0f);
+    b.setRotationInertiaEnabled(true);
+
+    const vne::interaction::CameraMotionState drag = b.getMotionState();
+    EXPECT_TRUE(drag.dragging);
+    EXPECT_FALSE(drag.inertia);
+    EXPECT_GT(drag.angular_speed, 0.0f);
+    EXPECT_EQ(drag.linear_speed, 0.0f);
+
+    // Release: the glide is reported with the time it needs to drop below the stop threshold
+    vne::interaction::CameraCommandPayload p;
+    b.onAction(vne::interaction::CameraActionType::eEndRotate, p, 0.016);
+    const vne::interaction::CameraMotionState glide = b.getMotionState();
+    EXPECT_FALSE(glide.dragging);
+    EXPECT_TRUE(glide.inertia);
+    EXPECT_GT(glide.angular_speed, 0.0f);
+    ASSERT_GT(glide.settle_time_s, 0.0f);
+
+    constexpr double kDt = 0.01;
+    double elapsed = 0.0;
+    while (b.getMotionState().isMoving() && elapsed < 10.0) {
+        b.onUpdate(kDt);
+        elapsed += kDt;
+    }
+    EXPECT_FALSE(b.getMotionState().isMoving());
+    EXPECT_NEAR(elapsed, glide.settle_time_s, 2.0 * kDt);
+}
+
+TEST(TrackballManipulator, MotionStateReportsFitAnimationAndZoom) {
+    auto cam = makePerspCamera();
+    cam->setPosition(vne::math::Vec3f(0.0f, 0.0f, 5.0f));
+    cam->lookAt(vne::math::Vec3f(0.0f, 0.0f, 0.0f), vne::math::Vec3f(0.0f, 1.0f, 0.0f));
+    vne::interaction::TrackballManipulator b;
+    b.setCamera(cam);
+    b.onResize(1280.0f, 720.0f);
+    b.setFitAnimationDuration(0.5f);
+
+    b.fitToAABB(vne::math::Vec3f(9.0f, -1.0f, -1.0f), vne::math::Vec3f(11.0f, 1.0f, 1.0f));
+    b.onUpdate(0.2);
+    const vne::interaction::CameraMotionState anim = b.getMotionState();
+    EXPECT_TRUE(anim.animating);
+    EXPECT_NEAR(anim.settle_time_s, 0.3f, 1e-4f);
+    EXPECT_GT(anim.linear_speed, 1.0f);
+
+    for (int i = 0; i < 10; ++i) {
+        b.onUpdate(0.05);
+    }
+    EXPECT_FALSE(b.getMotionState().animating);
+
+    // Wheel zoom in: a negative log-distance rate that decays once the wheel stops
+    vne::interaction::CameraCommandPayload p;
+    p.x_px = 640.0f;
+    p.y_px = 360.0f;
+    p.zoom_factor = 0.9f;
+    b.onAction(vne::interaction::CameraActionType::eZoomAtCursor, p, 0.016);
+    b.onUpdate(0.016);
+    EXPECT_LT(b.getMotionState().zoom_rate, 0.0f);
+    for (int i = 0; i < 60; ++i) {
+        b.onUpdate(0.016);
+    }
+    EXPECT_FALSE(b.getMotionState().isMoving());
+}
+
+TEST(TrackballManipulator, PredictPoseFollowsInertiaAndAnimationWithoutMoving) {
+    vne::interaction::TrackballManipulator b;
+    auto cam = rotateGesture(b, 6, 10.0f);
+    b.setRotationInertiaEnabled(true);
+    vne::interaction::CameraCommandPayload p;
+    b.onAction(vne::interaction::CameraActionType::eEndRotate, p, 0.016);
+
+    const vne::math::Vec3f released = cam->getPosition();
+    const vne::interaction::CameraPoseSnapshot now = b.predictPose(0.0);
+    EXPECT_LT((now.position - released).length(), 1e-5f);
+    const std::array<double, 3> ahead = {0.1, 0.2, 0.3};
+    std::array<vne::interaction::CameraPoseSnapshot, 3> poses;
+    ASSERT_EQ(b.predictPoses(ahead, poses), 3u);
+    EXPECT_EQ((cam->getPosition() - released).length(), 0.0f);  // prediction moves nothing
+
+    // The glide lands where the exponential decay was integrated to
+    for (int step = 0; step < 3; ++step) {
+        for (int i = 0; i < 10; ++i) {
+            b.onUpdate(0.01);
+        }
+        const float travelled = (cam->getPosition() - released).length();
+        EXPECT_GT(travelled, 1e-3f);
+        EXPECT_NEAR((poses[step].position - cam->getPosition()).length(), 0.0f, travelled * 0.06f);
+        EXPECT_NEAR((poses[step].target - cam->getTarget()).length(), 0.0f, 1e-4f);
+    }
+
+    // A fit animation is sampled ahead exactly; the glide it holds resumes once it ends
+    b.setFitAnimationDuration(0.5f);
+    b.fitToAABB(vne::math::Vec3f(9.0f, -1.0f, -1.0f), vne::math::Vec3f(11.0f, 1.0f, 1.0f));
+    b.onUpdate(0.1);
+    const vne::interaction::CameraPoseSnapshot fit = b.predictPose(0.2);
+    const vne::interaction::CameraPoseSnapshot done = b.predictPose(1.0);
+    b.onUpdate(0.2);
+    EXPECT_NEAR((fit.position - cam->getPosition()).length(), 0.0f, 1e-3f);
+    for (int i = 0; i < 80; ++i) {
+        b.onUpdate(0.01);
+    }
+    EXPECT_NEAR((done.position - cam->getPosition()).length(), 0.0f, 2e-2f);
+    EXPECT_NEAR(done.target.x(), 10.0f, 1e-3f);
+}
+
 }  // namespace vne_interaction_test
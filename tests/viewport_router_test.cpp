@@ -0,0 +1,247 @@
+/* ---------------------------------------------------------------------
+ * Copyright (c) 2026 Ajeet Singh Yadav. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * Author:    Ajeet Singh Yadav
+ * Created:   October 2026
+ *
+ * Autodoc:   yes
+ * ----------------------------------------------------------------------
+ */
+
+/**
+ * ViewportRouter tests: local coordinates, border ownership, drag capture, keyboard focus hand-over, touch
+ * routing, grid hit tests.
+ */
+
+#include "vertexnova/interaction/viewport_router.h"
+#include "vertexnova/events/key_event.h"
+#include "vertexnova/events/mouse_event.h"
+#include "vertexnova/events/touch_event.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace vne_interaction_test {
+
+namespace {
+
+using vne::events::MouseButton;
+using vne::interaction::ViewportRect;
+using vne::interaction::ViewportRouter;
+
+/** Remembers the events it receives, with their (local) pointer positions. */
+class RecordingController : public vne::interaction::ICameraController {
+   public:
+    void setCamera(std::shared_ptr<vne::scene::ICamera>) noexcept override {}
+    void onResize(float w, float h) noexcept override {
+        width = w;
+        height = h;
+    }
+    void onUpdate(double) noexcept override { ++updates; }
+    void onEvent(const vne::events::Event& event, double) noexcept override {
+        types.push_back(event.type());
+        if (event.type() == vne::events::EventType::eMouseMoved) {
+            const auto& e = static_cast<const vne::events::MouseMovedEvent&>(event);
+            x = e.x();
+            y = e.y();
+        } else if (event.type() == vne::events::EventType::eMouseButtonPressed
+                   || event.type() == vne::events::EventType::eMouseButtonReleased) {
+            const auto& e = static_cast<const vne::events::MouseButtonEvent&>(event);
+            x = e.x();
+            y = e.y();
+        } else if (event.type() == vne::events::EventType::eTouchPress
+                   || event.type() == vne::events::EventType::eTouchMove
+                   || event.type() == vne::events::EventType::eTouchRelease) {
+            const auto& e = static_cast<const vne::events::TouchEvent&>(event);
+            x = e.x();
+            y = e.y();
+        }
+    }
+
+    std::vector<vne::events::EventType> types;
+    double x = 0.0;
+    double y = 0.0;
+    float width = 0.0f;
+    float height = 0.0f;
+    int updates = 0;
+};
+
+struct Layout {
+    ViewportRouter router;
+    std::vector<std::shared_ptr<RecordingController>> views;
+};
+
+/** Side-by-side 400 x 300 viewports: [0, 400) and [400, 800). */
+void makeSideBySide(Layout& layout) {
+    for (int k = 0; k < 2; ++k) {
+        layout.views.push_back(std::make_shared<RecordingController>());
+        const float x = 400.0f * static_cast<float>(k);
+        layout.router.addViewport(layout.views.back(), ViewportRect{x, 0.0f, 400.0f, 300.0f});
+    }
+}
+
+}  // namespace
+
+TEST(ViewportRouter, TranslatesToLocalCoordinatesAndSplitsBorders) {
+    Layout l;
+    makeSideBySide(l);
+    EXPECT_FLOAT_EQ(l.views[1]->width, 400.0f);
+    EXPECT_FLOAT_EQ(l.views[1]->height, 300.0f);
+
+    EXPECT_TRUE(l.router.onEvent(vne::events::MouseMovedEvent(450.0, 120.0)));
+    EXPECT_TRUE(l.views[0]->types.empty());
+    EXPECT_DOUBLE_EQ(l.views[1]->x, 50.0);
+    EXPECT_DOUBLE_EQ(l.views[1]->y, 120.0);
+
+    // The shared edge belongs to the right viewport only
+    EXPECT_EQ(l.router.viewportAt(400.0f, 10.0f), 1u);
+    EXPECT_EQ(l.router.viewportAt(399.5f, 10.0f), 0u);
+    EXPECT_EQ(l.router.viewportAt(800.0f, 10.0f), ViewportRouter::kNoViewport);
+    EXPECT_FALSE(l.router.onEvent(vne::events::MouseMovedEvent(900.0, 10.0)));
+
+    // Scroll goes to the viewport under the last cursor position
+    l.router.onEvent(vne::events::MouseMovedEvent(20.0, 20.0));
+    l.router.onEvent(vne::events::MouseScrolledEvent(0.0, 1.0));
+    EXPECT_EQ(l.views[0]->types.back(), vne::events::EventType::eMouseScrolled);
+
+    l.router.setViewportRect(1, ViewportRect{400.0f, 0.0f, 200.0f, 300.0f});
+    EXPECT_FLOAT_EQ(l.views[1]->width, 200.0f);
+    EXPECT_EQ(l.router.viewportAt(700.0f, 10.0f), ViewportRouter::kNoViewport);
+
+    l.router.onUpdate(0.016);
+    EXPECT_EQ(l.views[0]->updates, 1);
+    EXPECT_EQ(l.views[1]->updates, 1);
+}
+
+TEST(ViewportRouter, DragKeepsCaptureOutsideItsViewport) {
+    Layout l;
+    makeSideBySide(l);
+    l.router.onEvent(vne::events::MouseButtonPressedEvent(MouseButton::eLeft, 0, 350.0, 100.0));
+    EXPECT_EQ(l.router.capturedViewport(), 0u);
+    EXPECT_EQ(l.router.focusedViewport(), 0u);
+
+    l.router.onEvent(vne::events::MouseMovedEvent(520.0, 80.0));
+    l.router.onEvent(vne::events::MouseButtonPressedEvent(MouseButton::eRight, 0, 530.0, 80.0));
+    l.router.onEvent(vne::events::MouseButtonReleasedEvent(MouseButton::eLeft, 0, 540.0, 80.0));
+    EXPECT_EQ(l.router.capturedViewport(), 0u);  // right button still down
+    l.router.onEvent(vne::events::MouseButtonReleasedEvent(MouseButton::eRight, 0, 540.0, 80.0));
+    EXPECT_EQ(l.router.capturedViewport(), ViewportRouter::kNoViewport);
+
+    EXPECT_TRUE(l.views[1]->types.empty());
+    EXPECT_DOUBLE_EQ(l.views[0]->x, 540.0);  // beyond the 400 px width: still the owner's local frame
+    EXPECT_EQ(l.views[0]->types.back(), vne::events::EventType::eMouseButtonReleased);
+
+    // After release the hover goes back to hit testing
+    l.router.onEvent(vne::events::MouseMovedEvent(541.0, 80.0));
+    ASSERT_EQ(l.views[1]->types.size(), 1u);
+    EXPECT_DOUBLE_EQ(l.views[1]->x, 141.0);
+}
+
+TEST(ViewportRouter, HeldKeysMoveWithFocus) {
+    Layout l;
+    makeSideBySide(l);
+    EXPECT_FALSE(l.router.onEvent(vne::events::KeyPressedEvent(vne::events::KeyCode::eW)));  // nothing focused
+
+    l.router.onEvent(vne::events::MouseButtonPressedEvent(MouseButton::eLeft, 0, 10.0, 10.0));
+    l.router.onEvent(vne::events::MouseButtonReleasedEvent(MouseButton::eLeft, 0, 10.0, 10.0));
+    l.router.onEvent(vne::events::KeyPressedEvent(vne::events::KeyCode::eW));
+
+    // Clicking the other viewport moves focus with W still held: the left viewport stops moving and the
+    // right one starts, so W's later release ends the motion where it now runs
+    const std::vector<vne::events::EventType>& left = l.views[0]->types;
+    const std::vector<vne::events::EventType>& right = l.views[1]->types;
+    l.router.onEvent(vne::events::MouseButtonPressedEvent(MouseButton::eLeft, 0, 500.0, 10.0));
+    EXPECT_EQ(l.router.focusedViewport(), 1u);
+    EXPECT_EQ(left.back(), vne::events::EventType::eKeyReleased);
+    ASSERT_GE(right.size(), 2u);
+    EXPECT_EQ(right[0], vne::events::EventType::eKeyPressed);
+    EXPECT_EQ(right[1], vne::events::EventType::eMouseButtonPressed);
+
+    l.router.onEvent(vne::events::MouseButtonReleasedEvent(MouseButton::eLeft, 0, 500.0, 10.0));
+    l.router.onEvent(vne::events::KeyPressedEvent(vne::events::KeyCode::eD));
+    l.router.onEvent(vne::events::KeyReleasedEvent(vne::events::KeyCode::eW));
+    l.router.onEvent(vne::events::KeyReleasedEvent(vne::events::KeyCode::eD));
+    EXPECT_EQ(std::count(left.begin(), left.end(), vne::events::EventType::eKeyPressed), 1);
+    EXPECT_EQ(std::count(left.begin(), left.end(), vne::events::EventType::eKeyReleased), 1);
+    EXPECT_EQ(std::count(right.begin(), right.end(), vne::events::EventType::eKeyPressed), 2);
+    EXPECT_EQ(std::count(right.begin(), right.end(), vne::events::EventType::eKeyReleased), 2);
+
+    // Clearing focus releases what is still held
+    l.router.onEvent(vne::events::KeyPressedEvent(vne::events::KeyCode::eA));
+    l.router.setFocusedViewport(ViewportRouter::kNoViewport);
+    EXPECT_EQ(right.back(), vne::events::EventType::eKeyReleased);
+    EXPECT_FALSE(l.router.onEvent(vne::events::KeyReleasedEvent(vne::events::KeyCode::eA)));
+    l.router.setFocusedViewport(1);
+
+    // Removing a viewport keeps focus on the same controller
+    EXPECT_EQ(l.router.removeViewport(0).get(), l.views[0].get());
+    EXPECT_EQ(l.router.focusedViewport(), 0u);
+    EXPECT_EQ(l.router.controller(0).get(), l.views[1].get());
+    EXPECT_EQ(l.router.controller(3), nullptr);
+    EXPECT_EQ(l.router.addViewport(nullptr, ViewportRect{}), ViewportRouter::kNoViewport);
+}
+
+TEST(ViewportRouter, TouchIsHitTestedAndCaptured) {
+    Layout l;
+    makeSideBySide(l);
+    EXPECT_FALSE(l.router.onEvent(vne::events::TouchPressEvent(900.0, 10.0)));
+
+    EXPECT_TRUE(l.router.onEvent(vne::events::TouchPressEvent(450.0, 40.0)));
+    EXPECT_EQ(l.router.focusedViewport(), 1u);
+    EXPECT_DOUBLE_EQ(l.views[1]->x, 50.0);
+    EXPECT_DOUBLE_EQ(l.views[1]->y, 40.0);
+
+    // The finger drifts into the left viewport: the gesture stays with the one it started in
+    EXPECT_TRUE(l.router.onEvent(vne::events::TouchMoveEvent(380.0, 45.0)));
+    EXPECT_TRUE(l.router.onEvent(vne::events::TouchReleaseEvent(370.0, 45.0)));
+    EXPECT_TRUE(l.views[0]->types.empty());
+    EXPECT_EQ(l.views[1]->types.back(), vne::events::EventType::eTouchRelease);
+    EXPECT_DOUBLE_EQ(l.views[1]->x, -30.0);
+
+    // After release the next touch is hit tested again
+    l.router.onEvent(vne::events::TouchPressEvent(370.0, 45.0));
+    ASSERT_EQ(l.views[0]->types.size(), 1u);
+    EXPECT_DOUBLE_EQ(l.views[0]->x, 370.0);
+}
+
+TEST(ViewportRouter, GridHitTestMatchesLinearScan) {
+    ViewportRouter router;
+    std::vector<ViewportRect> rects;
+    // 9 x 7 video-wall tiles of 100 x 80 px with 4 px gutters, plus an overlay spanning four tiles
+    for (int row = 0; row < 7; ++row) {
+        for (int col = 0; col < 9; ++col) {
+            const float x = 104.0f * static_cast<float>(col);
+            const float y = 84.0f * static_cast<float>(row);
+            rects.push_back(ViewportRect{x, y, 100.0f, 80.0f});
+        }
+    }
+    rects.push_back(ViewportRect{150.0f, 120.0f, 160.0f, 100.0f});
+    for (const ViewportRect& r : rects) {
+        router.addViewport(std::make_shared<RecordingController>(), r);
+    }
+    ASSERT_GE(router.size(), ViewportRouter::kGridThreshold);
+
+    for (float y = -10.0f; y < 600.0f; y += 3.5f) {
+        for (float x = -10.0f; x < 950.0f; x += 3.5f) {
+            std::size_t expected = ViewportRouter::kNoViewport;
+            for (std::size_t i = rects.size(); i-- > 0;) {
+                if (rects[i].contains(x, y)) {
+                    expected = i;
+                    break;
+                }
+            }
+            ASSERT_EQ(router.viewportAt(x, y), expected) << "at " << x << ", " << y;
+        }
+    }
+    EXPECT_EQ(router.viewportAt(200.0f, 150.0f), rects.size() - 1);  // overlay is on top
+
+    router.setViewportRect(0, ViewportRect{2000.0f, 2000.0f, 50.0f, 50.0f});
+    EXPECT_EQ(router.viewportAt(10.0f, 10.0f), ViewportRouter::kNoViewport);
+    EXPECT_EQ(router.viewportAt(2010.0f, 2010.0f), 0u);
+}
+
+}  // namespace vne_interaction_test